@@ -0,0 +1,83 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include <benchmark/benchmark.h>
+#include <vertexnova/math/geometry/aabb.h>
+#include <vertexnova/math/geometry/obb.h>
+
+#include <random>
+#include <vector>
+
+using namespace vne::math;
+
+namespace {
+
+constexpr std::uint32_t kSeed = 0x5EED0062u;
+
+struct RefitData {
+    std::vector<Aabb> local;
+    std::vector<Mat4f> world;
+};
+
+RefitData makeRefitData(std::size_t count) {
+    std::mt19937 rng(kSeed);
+    std::uniform_real_distribution<float> pos(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> scl(0.1f, 4.0f);
+
+    RefitData data;
+    data.local.reserve(count);
+    data.world.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const Vec3f e(scl(rng), scl(rng), scl(rng));
+        data.local.emplace_back(-e, e);
+        const Vec3f axis = Vec3f(unit(rng), unit(rng), unit(rng)).normalized();
+        data.world.push_back(Mat4f::translate(pos(rng), pos(rng), pos(rng)) * Mat4f::rotate(unit(rng) * 3.0f, axis)
+                             * Mat4f::scale(scl(rng), scl(rng), scl(rng)));
+    }
+    return data;
+}
+
+template<typename Fn>
+void runRefit(benchmark::State& state, Fn&& fn) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const RefitData data = makeRefitData(count);
+    std::vector<Aabb> out(count);
+    for (auto _ : state) {
+        fn(data, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_AabbTransformViaObb(benchmark::State& state) {
+    runRefit(state, [](const RefitData& data, std::vector<Aabb>& out) {
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            Obb obb = Obb::fromAabb(data.local[i]);
+            obb.transform(data.world[i]);
+            out[i] = obb.getAabb();
+        }
+    });
+}
+
+void BM_AabbTransformed(benchmark::State& state) {
+    runRefit(state, [](const RefitData& data, std::vector<Aabb>& out) {
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            out[i] = data.local[i].transformed(data.world[i]);
+        }
+    });
+}
+
+void BM_AabbTransformBatch(benchmark::State& state) {
+    runRefit(state, [](const RefitData& data, std::vector<Aabb>& out) { transformAabbs(data.local, data.world, out); });
+}
+
+}  // namespace
+
+BENCHMARK(BM_AabbTransformViaObb)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_AabbTransformed)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_AabbTransformBatch)->RangeMultiplier(8)->Range(64, 262144);
@@ -0,0 +1,101 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Shared benchmark helpers: working-set sizes from L1-resident to
+ * DRAM-resident and fixed-seed input generators.
+ * ----------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <vertexnova/math/core/core.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace vne::math::bench {
+
+/// Bytes touched per run: L1, L2, last-level cache and well past any L3 into DRAM
+inline constexpr std::size_t kWorkingSetBytes[] = {16u << 10, 256u << 10, 4u << 20, 64u << 20};
+
+/**
+ * @brief Registers one run per working set.
+ *
+ * range(0) is the element count that makes the inputs and outputs of one
+ * element, kElementBytes together, fill the working set.
+ *
+ * @code
+ * BENCHMARK_REGISTER_F(VecFixture, Dot)->Apply(workingSets<sizeof(Vec3f) * 2 + sizeof(float)>);
+ * @endcode
+ */
+template<std::size_t kElementBytes>
+void workingSets(benchmark::internal::Benchmark* b) {
+    for (const std::size_t bytes : kWorkingSetBytes) {
+        b->Arg(static_cast<int64_t>(bytes / kElementBytes));
+    }
+    b->ArgName("n");
+}
+
+/// Items and bytes per second for a loop over range(0) elements of kElementBytes each
+template<std::size_t kElementBytes>
+void setThroughput(benchmark::State& state) {
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0)
+                            * static_cast<int64_t>(kElementBytes));
+}
+
+/// Uniform floats in [lo, hi)
+[[nodiscard]] inline std::vector<float> randomFloats(std::size_t count, std::uint32_t seed, float lo, float hi) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(lo, hi);
+    std::vector<float> values(count);
+    for (float& v : values) {
+        v = dist(rng);
+    }
+    return values;
+}
+
+/// Vectors with components uniform in [lo, hi)
+template<typename VecT>
+[[nodiscard]] std::vector<VecT> randomVecs(std::size_t count, std::uint32_t seed, float lo = -1.0f, float hi = 1.0f) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(lo, hi);
+    std::vector<VecT> values(count);
+    for (VecT& v : values) {
+        for (std::size_t i = 0; i < VecT::dimensions; ++i) {
+            v[i] = dist(rng);
+        }
+    }
+    return values;
+}
+
+/// Uniformly distributed unit quaternions
+[[nodiscard]] inline std::vector<Quatf> randomRotations(std::size_t count, std::uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> gauss(0.0f, 1.0f);
+    std::vector<Quatf> values(count);
+    for (Quatf& q : values) {
+        q = Quatf(gauss(rng), gauss(rng), gauss(rng), gauss(rng)).normalized();
+    }
+    return values;
+}
+
+/// Well-conditioned affine transforms: rotation, non-uniform scale and translation
+[[nodiscard]] inline std::vector<Mat4f> randomTransforms(std::size_t count, std::uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> pos(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+    const std::vector<Quatf> rotations = randomRotations(count, seed ^ 0x9E3779B9u);
+    std::vector<Mat4f> values(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        values[i] = Mat4f::translate(pos(rng), pos(rng), pos(rng)) * rotations[i].toMatrix4()
+                    * Mat4f::scale(scale(rng), scale(rng), scale(rng));
+    }
+    return values;
+}
+
+}  // namespace vne::math::bench
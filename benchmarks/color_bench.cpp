@@ -0,0 +1,113 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include "bench_common.h"
+
+#include <vertexnova/math/color.h>
+
+#include <vector>
+
+using namespace vne::math;
+using namespace vne::math::bench;
+
+namespace {
+
+constexpr std::uint32_t kSeed = 0x5EED0571u;
+
+/// Random opaque colors and their HSV/HSL encodings
+class ColorFixture : public benchmark::Fixture {
+   public:
+    void SetUp(const benchmark::State& state) override {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const std::vector<Vec3f> rgb = randomVecs<Vec3f>(count, kSeed, 0.0f, 1.0f);
+        colors.clear();
+        hsv.clear();
+        for (const Vec3f& c : rgb) {
+            colors.emplace_back(c.x(), c.y(), c.z(), 1.0f);
+            hsv.push_back(colors.back().toHSV());
+        }
+        out.assign(count, Color());
+        out_hsv.assign(count, Vec3f::zero());
+    }
+
+    void TearDown(const benchmark::State&) override {
+        colors = {};
+        hsv = {};
+        out = {};
+        out_hsv = {};
+    }
+
+    std::vector<Color> colors;
+    std::vector<Vec3f> hsv;
+    std::vector<Color> out;
+    std::vector<Vec3f> out_hsv;
+};
+
+constexpr std::size_t kToHsvBytes = sizeof(Color) + sizeof(Vec3f);
+constexpr std::size_t kColorBytes = 2 * sizeof(Color);
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(ColorFixture, ToHsv)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < colors.size(); ++i) {
+            out_hsv[i] = colors[i].toHSV();
+        }
+        benchmark::DoNotOptimize(out_hsv.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kToHsvBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(ColorFixture, FromHsv)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < hsv.size(); ++i) {
+            out[i] = Color::fromHSV(hsv[i].x(), hsv[i].y(), hsv[i].z());
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kToHsvBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(ColorFixture, ToHsl)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < colors.size(); ++i) {
+            out_hsv[i] = colors[i].toHSL();
+        }
+        benchmark::DoNotOptimize(out_hsv.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kToHsvBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(ColorFixture, ToLinear)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < colors.size(); ++i) {
+            out[i] = colors[i].toLinear();
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kColorBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(ColorFixture, ToSrgb)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < colors.size(); ++i) {
+            out[i] = colors[i].toSRGB();
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kColorBytes>(state);
+}
+
+BENCHMARK_REGISTER_F(ColorFixture, ToHsv)->Apply(workingSets<kToHsvBytes>);
+BENCHMARK_REGISTER_F(ColorFixture, FromHsv)->Apply(workingSets<kToHsvBytes>);
+BENCHMARK_REGISTER_F(ColorFixture, ToHsl)->Apply(workingSets<kToHsvBytes>);
+BENCHMARK_REGISTER_F(ColorFixture, ToLinear)->Apply(workingSets<kColorBytes>);
+BENCHMARK_REGISTER_F(ColorFixture, ToSrgb)->Apply(workingSets<kColorBytes>);
@@ -0,0 +1,95 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include <benchmark/benchmark.h>
+#include <vertexnova/math/geometry/contact.h>
+
+#include <random>
+#include <vector>
+
+using namespace vne::math;
+
+namespace {
+
+constexpr std::uint32_t kSeed = 0x5EED0064u;
+
+struct Scene {
+    std::vector<Obb> boxes;
+    std::vector<Sphere> spheres;
+    std::vector<Capsule> capsules;
+    std::vector<ContactPair> pairs;
+};
+
+/// Bodies paired with a neighbour placed close enough that most pairs touch, like a broadphase output
+Scene makeScene(std::size_t count) {
+    std::mt19937 rng(kSeed);
+    std::uniform_real_distribution<float> pos(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> offset(-1.2f, 1.2f);
+    std::uniform_real_distribution<float> ext(0.3f, 1.0f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    Scene scene;
+    for (std::size_t i = 0; i < count; ++i) {
+        const Vec3f center(pos(rng), pos(rng), pos(rng));
+        const Vec3f near = center + Vec3f(offset(rng), offset(rng), offset(rng));
+        const Quatf qa = Quatf(unit(rng), unit(rng), unit(rng), unit(rng)).normalized();
+        const Quatf qb = Quatf(unit(rng), unit(rng), unit(rng), unit(rng)).normalized();
+        scene.boxes.emplace_back(center, Vec3f(ext(rng), ext(rng), ext(rng)), qa);
+        scene.boxes.emplace_back(near, Vec3f(ext(rng), ext(rng), ext(rng)), qb);
+        scene.spheres.emplace_back(near, ext(rng));
+        scene.spheres.emplace_back(center, ext(rng));
+        scene.capsules.emplace_back(near, near + Vec3f(unit(rng), unit(rng), unit(rng)), ext(rng) * 0.5f);
+        scene.capsules.emplace_back(center, center + Vec3f(unit(rng), unit(rng), unit(rng)), ext(rng) * 0.5f);
+        scene.pairs.push_back(ContactPair{static_cast<uint32_t>(2 * i + 1), static_cast<uint32_t>(2 * i)});
+    }
+    return scene;
+}
+
+template <typename ShapeA>
+void runPairs(benchmark::State& state, const std::vector<ShapeA>& shapes_a, const Scene& scene) {
+    std::vector<ContactManifold> manifolds(scene.pairs.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            generateContacts(std::span<const ShapeA>(shapes_a), std::span<const Obb>(scene.boxes), scene.pairs, manifolds));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_ContactsObbObb(benchmark::State& state) {
+    const Scene scene = makeScene(static_cast<std::size_t>(state.range(0)));
+    runPairs(state, scene.boxes, scene);
+}
+
+void BM_ContactsSphereObb(benchmark::State& state) {
+    const Scene scene = makeScene(static_cast<std::size_t>(state.range(0)));
+    runPairs(state, scene.spheres, scene);
+}
+
+void BM_ContactsCapsuleObb(benchmark::State& state) {
+    const Scene scene = makeScene(static_cast<std::size_t>(state.range(0)));
+    runPairs(state, scene.capsules, scene);
+}
+
+void BM_ContactsCapsuleCapsule(benchmark::State& state) {
+    const Scene scene = makeScene(static_cast<std::size_t>(state.range(0)));
+    std::vector<ContactManifold> manifolds(scene.pairs.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(generateContacts(std::span<const Capsule>(scene.capsules),
+                                                  std::span<const Capsule>(scene.capsules),
+                                                  scene.pairs,
+                                                  manifolds));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_ContactsObbObb)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_ContactsSphereObb)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_ContactsCapsuleObb)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_ContactsCapsuleCapsule)->RangeMultiplier(8)->Range(64, 262144);
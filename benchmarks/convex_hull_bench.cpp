@@ -0,0 +1,107 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include <benchmark/benchmark.h>
+#include <vertexnova/math/geometry/convex_hull.h>
+
+#include <random>
+#include <vector>
+
+using namespace vne::math;
+
+namespace {
+
+constexpr std::uint32_t kSeed = 0x5EED0070u;
+
+/// Uniform in a box: the hull keeps only a few hundred points
+std::vector<Vec3f> makeBox(std::size_t count) {
+    std::mt19937 rng(kSeed);
+    std::uniform_real_distribution<float> coord(-1.0f, 1.0f);
+    std::vector<Vec3f> points;
+    for (std::size_t i = 0; i < count; ++i) {
+        points.emplace_back(coord(rng) * 4.0f, coord(rng), coord(rng) * 0.5f);
+    }
+    return points;
+}
+
+/// Uniform in a ball: the hull grows with n^(1/3)
+std::vector<Vec3f> makeBall(std::size_t count) {
+    std::mt19937 rng(kSeed);
+    std::uniform_real_distribution<float> coord(-1.0f, 1.0f);
+    std::vector<Vec3f> points;
+    while (points.size() < count) {
+        const Vec3f p(coord(rng), coord(rng), coord(rng));
+        if (p.lengthSquared() <= 1.0f) {
+            points.push_back(p);
+        }
+    }
+    return points;
+}
+
+/// On a sphere: every point is a hull vertex, the worst case
+std::vector<Vec3f> makeSphere(std::size_t count) {
+    std::mt19937 rng(kSeed);
+    std::normal_distribution<float> gauss(0.0f, 1.0f);
+    std::vector<Vec3f> points;
+    for (std::size_t i = 0; i < count; ++i) {
+        points.push_back(Vec3f(gauss(rng), gauss(rng), gauss(rng)).normalized());
+    }
+    return points;
+}
+
+void runHull3d(benchmark::State& state, const std::vector<Vec3f>& points) {
+    HullScratch scratch;
+    ConvexHull hull;
+    for (auto _ : state) {
+        convexHull(points, hull, scratch);
+        benchmark::DoNotOptimize(hull.triangles.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["faces"] = static_cast<double>(hull.faceCount());
+}
+
+void BM_ConvexHull3dBox(benchmark::State& state) {
+    runHull3d(state, makeBox(static_cast<std::size_t>(state.range(0))));
+}
+
+void BM_ConvexHull3dBall(benchmark::State& state) {
+    runHull3d(state, makeBall(static_cast<std::size_t>(state.range(0))));
+}
+
+void BM_ConvexHull3dSphere(benchmark::State& state) {
+    runHull3d(state, makeSphere(static_cast<std::size_t>(state.range(0))));
+}
+
+/// Fresh scratch and output every build, to show what reuse saves
+void BM_ConvexHull3dBallNoReuse(benchmark::State& state) {
+    const std::vector<Vec3f> points = makeBall(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(convexHull(points));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ConvexHull2dDisc(benchmark::State& state) {
+    std::vector<Vec2f> points;
+    for (const Vec3f& p : makeBall(static_cast<std::size_t>(state.range(0)))) {
+        points.emplace_back(p.x(), p.y());
+    }
+    HullScratch scratch;
+    std::vector<uint32_t> hull;
+    for (auto _ : state) {
+        convexHull(points, hull, scratch);
+        benchmark::DoNotOptimize(hull.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_ConvexHull3dBox)->RangeMultiplier(8)->Range(1024, 1 << 20);
+BENCHMARK(BM_ConvexHull3dBall)->RangeMultiplier(8)->Range(1024, 1 << 20);
+BENCHMARK(BM_ConvexHull3dSphere)->RangeMultiplier(8)->Range(1024, 1 << 20);
+BENCHMARK(BM_ConvexHull3dBallNoReuse)->RangeMultiplier(8)->Range(1024, 1 << 20);
+BENCHMARK(BM_ConvexHull2dDisc)->RangeMultiplier(8)->Range(1024, 1 << 20);
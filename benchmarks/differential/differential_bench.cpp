@@ -0,0 +1,1195 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Differential benchmark: runs each core Vec/Mat/Quat operation through
+ * the library, a plain scalar implementation, the Float4 SIMD layer where
+ * it applies and glm called directly, and reports time per operation, ULP
+ * error against a double-precision reference and code size per kernel.
+ * ----------------------------------------------------------------------
+ */
+
+#include "../bench_common.h"
+
+#include <vertexnova/math/simd/float4.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace vne::math;
+using namespace vne::math::bench;
+
+// Every kernel processes a whole batch and is kept out of line under a fixed
+// unmangled name, so its timing has no call overhead per element and its size
+// can be read back from the symbol table.
+#if defined(_MSC_VER)
+#define VNE_DIFF_KERNEL extern "C" __declspec(noinline)
+#else
+#define VNE_DIFF_KERNEL extern "C" __attribute__((noinline))
+#endif
+
+namespace {
+
+constexpr std::uint32_t kSeed = 0x5EED0073u;
+
+/// Interpolation factor of the slerp kernels
+constexpr float kSlerpFactor = 0.3f;
+
+// ============================================================================
+// Element Access
+// ============================================================================
+
+Vec3f loadVec3(const float* p) noexcept {
+    return Vec3f(p[0], p[1], p[2]);
+}
+
+void storeVec3(float* p, const Vec3f& v) noexcept {
+    p[0] = v.x();
+    p[1] = v.y();
+    p[2] = v.z();
+}
+
+Mat4f loadMat4(const float* p) noexcept {
+    Mat4f m;
+    for (std::size_t c = 0; c < 4; ++c) {
+        for (std::size_t r = 0; r < 4; ++r) {
+            m.columns[c][r] = p[c * 4 + r];
+        }
+    }
+    return m;
+}
+
+void storeMat4(float* p, const Mat4f& m) noexcept {
+    for (std::size_t c = 0; c < 4; ++c) {
+        for (std::size_t r = 0; r < 4; ++r) {
+            p[c * 4 + r] = m.columns[c][r];
+        }
+    }
+}
+
+/// Quaternions are stored x, y, z, w
+Quatf loadQuat(const float* p) noexcept {
+    return Quatf(p[0], p[1], p[2], p[3]);
+}
+
+void storeQuat(float* p, const Quatf& q) noexcept {
+    p[0] = q.x;
+    p[1] = q.y;
+    p[2] = q.z;
+    p[3] = q.w;
+}
+
+template<typename T>
+glm::qua<T> loadGlmQuat(const float* p) noexcept {
+    return glm::qua<T>(T(p[3]), T(p[0]), T(p[1]), T(p[2]));
+}
+
+template<typename T, typename U>
+void storeGlmVec3(T* p, const glm::vec<3, U>& v) noexcept {
+    p[0] = static_cast<T>(v.x);
+    p[1] = static_cast<T>(v.y);
+    p[2] = static_cast<T>(v.z);
+}
+
+template<typename T, typename U>
+void storeGlmMat4(T* p, const glm::mat<4, 4, U>& m) noexcept {
+    for (int c = 0; c < 4; ++c) {
+        for (int r = 0; r < 4; ++r) {
+            p[c * 4 + r] = static_cast<T>(m[c][r]);
+        }
+    }
+}
+
+template<typename T, typename U>
+void storeGlmQuat(T* p, const glm::qua<U>& q) noexcept {
+    p[0] = static_cast<T>(q.x);
+    p[1] = static_cast<T>(q.y);
+    p[2] = static_cast<T>(q.z);
+    p[3] = static_cast<T>(q.w);
+}
+
+/// Four x, y, z, w quaternions (16 floats) as one register per component
+void loadQuat4(const float* p, simd::Float4& x, simd::Float4& y, simd::Float4& z, simd::Float4& w) noexcept {
+    x = simd::load(p);
+    y = simd::load(p + 4);
+    z = simd::load(p + 8);
+    w = simd::load(p + 12);
+    simd::transpose(x, y, z, w);
+}
+
+}  // namespace
+
+// ============================================================================
+// Vec3 Kernels
+// ============================================================================
+
+VNE_DIFF_KERNEL void vne_diff_vec3_length_current(const float* a, const float*, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = loadVec3(a + i * 3).length();
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_vec3_length_scalar(const float* a, const float*, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const float* v = a + i * 3;
+        out[i] = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_vec3_length_simd(const float* a, const float* b, float* out, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + simd::kLanes <= n; i += simd::kLanes) {
+        simd::Float4 x, y, z;
+        simd::loadXyz(a + i * 3, x, y, z);
+        simd::store(out + i, simd::sqrt(simd::madd(x, x, simd::madd(y, y, z * z))));
+    }
+    vne_diff_vec3_length_scalar(a + i * 3, b, out + i, n - i);
+}
+
+VNE_DIFF_KERNEL void vne_diff_vec3_length_glm(const float* a, const float*, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = glm::length(glm::make_vec3(a + i * 3));
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_vec3_normalize_current(const float* a, const float*, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        storeVec3(out + i * 3, loadVec3(a + i * 3).normalized());
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_vec3_normalize_scalar(const float* a, const float*, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const float* v = a + i * 3;
+        const float length = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+        const float inv = length > kEpsilon<float> ? 1.0f / length : 0.0f;
+        out[i * 3 + 0] = v[0] * inv;
+        out[i * 3 + 1] = v[1] * inv;
+        out[i * 3 + 2] = v[2] * inv;
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_vec3_normalize_simd(const float* a, const float* b, float* out, std::size_t n) {
+    const simd::Float4 epsilon = simd::broadcast(kEpsilon<float>);
+    std::size_t i = 0;
+    for (; i + simd::kLanes <= n; i += simd::kLanes) {
+        simd::Float4 x, y, z;
+        simd::loadXyz(a + i * 3, x, y, z);
+        const simd::Float4 length = simd::sqrt(simd::madd(x, x, simd::madd(y, y, z * z)));
+        const simd::Float4 valid = simd::cmpGt(length, epsilon);
+        simd::storeXyz(out + i * 3, (x / length) & valid, (y / length) & valid, (z / length) & valid);
+    }
+    vne_diff_vec3_normalize_scalar(a + i * 3, b, out + i * 3, n - i);
+}
+
+VNE_DIFF_KERNEL void vne_diff_vec3_normalize_glm(const float* a, const float*, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        storeGlmVec3(out + i * 3, glm::normalize(glm::make_vec3(a + i * 3)));
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_vec3_cross_current(const float* a, const float* b, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        storeVec3(out + i * 3, loadVec3(a + i * 3).cross(loadVec3(b + i * 3)));
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_vec3_cross_scalar(const float* a, const float* b, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const float* u = a + i * 3;
+        const float* v = b + i * 3;
+        out[i * 3 + 0] = u[1] * v[2] - u[2] * v[1];
+        out[i * 3 + 1] = u[2] * v[0] - u[0] * v[2];
+        out[i * 3 + 2] = u[0] * v[1] - u[1] * v[0];
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_vec3_cross_simd(const float* a, const float* b, float* out, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + simd::kLanes <= n; i += simd::kLanes) {
+        simd::Float4 ux, uy, uz, vx, vy, vz;
+        simd::loadXyz(a + i * 3, ux, uy, uz);
+        simd::loadXyz(b + i * 3, vx, vy, vz);
+        simd::storeXyz(out + i * 3, uy * vz - uz * vy, uz * vx - ux * vz, ux * vy - uy * vx);
+    }
+    vne_diff_vec3_cross_scalar(a + i * 3, b + i * 3, out + i * 3, n - i);
+}
+
+VNE_DIFF_KERNEL void vne_diff_vec3_cross_glm(const float* a, const float* b, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        storeGlmVec3(out + i * 3, glm::cross(glm::make_vec3(a + i * 3), glm::make_vec3(b + i * 3)));
+    }
+}
+
+// ============================================================================
+// Mat4 Kernels
+// ============================================================================
+
+VNE_DIFF_KERNEL void vne_diff_mat4_multiply_current(const float* a, const float* b, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        storeMat4(out + i * 16, loadMat4(a + i * 16) * loadMat4(b + i * 16));
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_mat4_multiply_scalar(const float* a, const float* b, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const float* l = a + i * 16;
+        const float* r = b + i * 16;
+        for (std::size_t c = 0; c < 4; ++c) {
+            for (std::size_t row = 0; row < 4; ++row) {
+                out[i * 16 + c * 4 + row] = l[row] * r[c * 4] + l[4 + row] * r[c * 4 + 1] + l[8 + row] * r[c * 4 + 2]
+                                            + l[12 + row] * r[c * 4 + 3];
+            }
+        }
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_mat4_multiply_simd(const float* a, const float* b, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const float* l = a + i * 16;
+        const float* r = b + i * 16;
+        const simd::Float4 c0 = simd::load(l);
+        const simd::Float4 c1 = simd::load(l + 4);
+        const simd::Float4 c2 = simd::load(l + 8);
+        const simd::Float4 c3 = simd::load(l + 12);
+        for (std::size_t c = 0; c < 4; ++c) {
+            const float* column = r + c * 4;
+            simd::Float4 sum = c0 * simd::broadcast(column[0]);
+            sum = simd::madd(c1, simd::broadcast(column[1]), sum);
+            sum = simd::madd(c2, simd::broadcast(column[2]), sum);
+            sum = simd::madd(c3, simd::broadcast(column[3]), sum);
+            simd::store(out + i * 16 + c * 4, sum);
+        }
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_mat4_multiply_glm(const float* a, const float* b, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        storeGlmMat4(out + i * 16, glm::make_mat4(a + i * 16) * glm::make_mat4(b + i * 16));
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_mat4_transform_point_current(const float* a, const float* b, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        storeVec3(out + i * 3, loadMat4(a + i * 16).transformPoint(loadVec3(b + i * 3)));
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_mat4_transform_point_scalar(const float* a, const float* b, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const float* m = a + i * 16;
+        const float* p = b + i * 3;
+        for (std::size_t row = 0; row < 3; ++row) {
+            out[i * 3 + row] = m[row] * p[0] + m[4 + row] * p[1] + m[8 + row] * p[2] + m[12 + row];
+        }
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_mat4_transform_point_simd(const float* a, const float* b, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const float* m = a + i * 16;
+        const float* p = b + i * 3;
+        simd::Float4 sum = simd::madd(simd::load(m), simd::broadcast(p[0]), simd::load(m + 12));
+        sum = simd::madd(simd::load(m + 4), simd::broadcast(p[1]), sum);
+        sum = simd::madd(simd::load(m + 8), simd::broadcast(p[2]), sum);
+        // A four-float store would run past the last point
+        float result[4];
+        simd::store(result, sum);
+        std::memcpy(out + i * 3, result, sizeof(float) * 3);
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_mat4_transform_point_glm(const float* a, const float* b, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const glm::vec4 p = glm::make_mat4(a + i * 16) * glm::vec4(glm::make_vec3(b + i * 3), 1.0f);
+        storeGlmVec3(out + i * 3, glm::vec3(p));
+    }
+}
+
+namespace {
+
+/**
+ * @brief 2x2 sub-determinants shared by the scalar inverse and determinant.
+ *
+ * Laplace expansion along the first two rows (s) and the last two (c). The
+ * input is read row-major; the column-major storage is the transpose, which
+ * has the same determinant and whose inverse is the transposed inverse.
+ */
+struct Minors {
+    float s[6];
+    float c[6];
+    float det;
+
+    explicit Minors(const float* m) noexcept {
+        s[0] = m[0] * m[5] - m[4] * m[1];
+        s[1] = m[0] * m[6] - m[4] * m[2];
+        s[2] = m[0] * m[7] - m[4] * m[3];
+        s[3] = m[1] * m[6] - m[5] * m[2];
+        s[4] = m[1] * m[7] - m[5] * m[3];
+        s[5] = m[2] * m[7] - m[6] * m[3];
+        c[5] = m[10] * m[15] - m[14] * m[11];
+        c[4] = m[9] * m[15] - m[13] * m[11];
+        c[3] = m[9] * m[14] - m[13] * m[10];
+        c[2] = m[8] * m[15] - m[12] * m[11];
+        c[1] = m[8] * m[14] - m[12] * m[10];
+        c[0] = m[8] * m[13] - m[12] * m[9];
+        det = s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0];
+    }
+};
+
+}  // namespace
+
+VNE_DIFF_KERNEL void vne_diff_mat4_inverse_current(const float* a, const float*, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        storeMat4(out + i * 16, loadMat4(a + i * 16).inverse());
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_mat4_inverse_scalar(const float* a, const float*, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const float* m = a + i * 16;
+        const Minors k(m);
+        const float inv = 1.0f / k.det;
+        float* o = out + i * 16;
+        o[0] = (m[5] * k.c[5] - m[6] * k.c[4] + m[7] * k.c[3]) * inv;
+        o[1] = (-m[1] * k.c[5] + m[2] * k.c[4] - m[3] * k.c[3]) * inv;
+        o[2] = (m[13] * k.s[5] - m[14] * k.s[4] + m[15] * k.s[3]) * inv;
+        o[3] = (-m[9] * k.s[5] + m[10] * k.s[4] - m[11] * k.s[3]) * inv;
+        o[4] = (-m[4] * k.c[5] + m[6] * k.c[2] - m[7] * k.c[1]) * inv;
+        o[5] = (m[0] * k.c[5] - m[2] * k.c[2] + m[3] * k.c[1]) * inv;
+        o[6] = (-m[12] * k.s[5] + m[14] * k.s[2] - m[15] * k.s[1]) * inv;
+        o[7] = (m[8] * k.s[5] - m[10] * k.s[2] + m[11] * k.s[1]) * inv;
+        o[8] = (m[4] * k.c[4] - m[5] * k.c[2] + m[7] * k.c[0]) * inv;
+        o[9] = (-m[0] * k.c[4] + m[1] * k.c[2] - m[3] * k.c[0]) * inv;
+        o[10] = (m[12] * k.s[4] - m[13] * k.s[2] + m[15] * k.s[0]) * inv;
+        o[11] = (-m[8] * k.s[4] + m[9] * k.s[2] - m[11] * k.s[0]) * inv;
+        o[12] = (-m[4] * k.c[3] + m[5] * k.c[1] - m[6] * k.c[0]) * inv;
+        o[13] = (m[0] * k.c[3] - m[1] * k.c[1] + m[2] * k.c[0]) * inv;
+        o[14] = (-m[12] * k.s[3] + m[13] * k.s[1] - m[14] * k.s[0]) * inv;
+        o[15] = (m[8] * k.s[3] - m[9] * k.s[1] + m[10] * k.s[0]) * inv;
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_mat4_inverse_glm(const float* a, const float*, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        storeGlmMat4(out + i * 16, glm::inverse(glm::make_mat4(a + i * 16)));
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_mat4_determinant_current(const float* a, const float*, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = loadMat4(a + i * 16).determinant();
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_mat4_determinant_scalar(const float* a, const float*, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = Minors(a + i * 16).det;
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_mat4_determinant_glm(const float* a, const float*, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = glm::determinant(glm::make_mat4(a + i * 16));
+    }
+}
+
+// ============================================================================
+// Quat Kernels
+// ============================================================================
+
+VNE_DIFF_KERNEL void vne_diff_quat_to_matrix_current(const float* a, const float*, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        storeMat4(out + i * 16, loadQuat(a + i * 4).toMatrix4());
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_quat_to_matrix_scalar(const float* a, const float*, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const float x = a[i * 4], y = a[i * 4 + 1], z = a[i * 4 + 2], w = a[i * 4 + 3];
+        float* o = out + i * 16;
+        o[0] = 1.0f - 2.0f * (y * y + z * z);
+        o[1] = 2.0f * (x * y + w * z);
+        o[2] = 2.0f * (x * z - w * y);
+        o[3] = 0.0f;
+        o[4] = 2.0f * (x * y - w * z);
+        o[5] = 1.0f - 2.0f * (x * x + z * z);
+        o[6] = 2.0f * (y * z + w * x);
+        o[7] = 0.0f;
+        o[8] = 2.0f * (x * z + w * y);
+        o[9] = 2.0f * (y * z - w * x);
+        o[10] = 1.0f - 2.0f * (x * x + y * y);
+        o[11] = 0.0f;
+        o[12] = 0.0f;
+        o[13] = 0.0f;
+        o[14] = 0.0f;
+        o[15] = 1.0f;
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_quat_to_matrix_glm(const float* a, const float*, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        storeGlmMat4(out + i * 16, glm::mat4_cast(loadGlmQuat<float>(a + i * 4)));
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_quat_to_euler_current(const float* a, const float*, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        storeVec3(out + i * 3, loadQuat(a + i * 4).toEuler());
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_quat_to_euler_scalar(const float* a, const float*, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const float x = a[i * 4], y = a[i * 4 + 1], z = a[i * 4 + 2], w = a[i * 4 + 3];
+        // Same (pitch, yaw, roll) convention as Quatf::toEuler
+        out[i * 3 + 0] = std::atan2(2.0f * (y * z + w * x), w * w - x * x - y * y + z * z);
+        out[i * 3 + 1] = std::asin(std::clamp(-2.0f * (x * z - w * y), -1.0f, 1.0f));
+        out[i * 3 + 2] = std::atan2(2.0f * (x * y + w * z), w * w + x * x - y * y - z * z);
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_quat_to_euler_glm(const float* a, const float*, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        storeGlmVec3(out + i * 3, glm::eulerAngles(loadGlmQuat<float>(a + i * 4)));
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_quat_rotate_current(const float* a, const float* b, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        storeVec3(out + i * 3, loadQuat(a + i * 4).rotate(loadVec3(b + i * 3)));
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_quat_rotate_scalar(const float* a, const float* b, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const float x = a[i * 4], y = a[i * 4 + 1], z = a[i * 4 + 2], w = a[i * 4 + 3];
+        const float* v = b + i * 3;
+        // v + 2w (q x v) + 2 q x (q x v)
+        const float tx = 2.0f * (y * v[2] - z * v[1]);
+        const float ty = 2.0f * (z * v[0] - x * v[2]);
+        const float tz = 2.0f * (x * v[1] - y * v[0]);
+        out[i * 3 + 0] = v[0] + w * tx + (y * tz - z * ty);
+        out[i * 3 + 1] = v[1] + w * ty + (z * tx - x * tz);
+        out[i * 3 + 2] = v[2] + w * tz + (x * ty - y * tx);
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_quat_rotate_simd(const float* a, const float* b, float* out, std::size_t n) {
+    const simd::Float4 two = simd::broadcast(2.0f);
+    std::size_t i = 0;
+    for (; i + simd::kLanes <= n; i += simd::kLanes) {
+        simd::Float4 x, y, z, w, vx, vy, vz;
+        loadQuat4(a + i * 4, x, y, z, w);
+        simd::loadXyz(b + i * 3, vx, vy, vz);
+        const simd::Float4 tx = two * (y * vz - z * vy);
+        const simd::Float4 ty = two * (z * vx - x * vz);
+        const simd::Float4 tz = two * (x * vy - y * vx);
+        simd::storeXyz(out + i * 3,
+                       simd::madd(w, tx, vx) + (y * tz - z * ty),
+                       simd::madd(w, ty, vy) + (z * tx - x * tz),
+                       simd::madd(w, tz, vz) + (x * ty - y * tx));
+    }
+    vne_diff_quat_rotate_scalar(a + i * 4, b + i * 3, out + i * 3, n - i);
+}
+
+VNE_DIFF_KERNEL void vne_diff_quat_rotate_glm(const float* a, const float* b, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        storeGlmVec3(out + i * 3, loadGlmQuat<float>(a + i * 4) * glm::make_vec3(b + i * 3));
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_quat_multiply_current(const float* a, const float* b, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        storeQuat(out + i * 4, loadQuat(a + i * 4) * loadQuat(b + i * 4));
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_quat_multiply_scalar(const float* a, const float* b, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const float* p = a + i * 4;
+        const float* q = b + i * 4;
+        out[i * 4 + 0] = p[3] * q[0] + p[0] * q[3] + p[1] * q[2] - p[2] * q[1];
+        out[i * 4 + 1] = p[3] * q[1] - p[0] * q[2] + p[1] * q[3] + p[2] * q[0];
+        out[i * 4 + 2] = p[3] * q[2] + p[0] * q[1] - p[1] * q[0] + p[2] * q[3];
+        out[i * 4 + 3] = p[3] * q[3] - p[0] * q[0] - p[1] * q[1] - p[2] * q[2];
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_quat_multiply_glm(const float* a, const float* b, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        storeGlmQuat(out + i * 4, loadGlmQuat<float>(a + i * 4) * loadGlmQuat<float>(b + i * 4));
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_quat_slerp_current(const float* a, const float* b, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        storeQuat(out + i * 4, Quatf::slerp(loadQuat(a + i * 4), loadQuat(b + i * 4), kSlerpFactor));
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_quat_slerp_scalar(const float* a, const float* b, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const float* p = a + i * 4;
+        const float* q = b + i * 4;
+        float cos_theta = p[0] * q[0] + p[1] * q[1] + p[2] * q[2] + p[3] * q[3];
+        // Shortest arc, then lerp where the sine of the angle would lose all precision
+        const float sign = cos_theta < 0.0f ? -1.0f : 1.0f;
+        cos_theta *= sign;
+        float wp = 1.0f - kSlerpFactor;
+        float wq = kSlerpFactor;
+        if (cos_theta <= 1.0f - std::numeric_limits<float>::epsilon()) {
+            const float angle = std::acos(cos_theta);
+            const float inv_sin = 1.0f / std::sin(angle);
+            wp = std::sin(wp * angle) * inv_sin;
+            wq = std::sin(wq * angle) * inv_sin;
+        }
+        wq *= sign;
+        for (std::size_t k = 0; k < 4; ++k) {
+            out[i * 4 + k] = wp * p[k] + wq * q[k];
+        }
+    }
+}
+
+VNE_DIFF_KERNEL void vne_diff_quat_slerp_glm(const float* a, const float* b, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const glm::quat from = loadGlmQuat<float>(a + i * 4);
+        const glm::quat to = loadGlmQuat<float>(b + i * 4);
+        storeGlmQuat(out + i * 4, glm::slerp(from, to, kSlerpFactor));
+    }
+}
+
+namespace {
+
+// ============================================================================
+// Operations
+// ============================================================================
+
+using Kernel = void (*)(const float* a, const float* b, float* out, std::size_t n);
+
+/// Double-precision result for one element
+using Reference = void (*)(const float* a, const float* b, double* out);
+
+/// Kind of an operand; determines its generator and its floats per element
+enum class Input : uint8_t {
+    eNone,       ///< Unused operand
+    eVector,     ///< Vec3 with components in [-10, 10)
+    eRotation,   ///< Unit quaternion, x y z w
+    eTransform,  ///< Affine Mat4, column-major
+};
+
+struct Variant {
+    const char* name;    ///< current, scalar, simd or glm
+    Kernel kernel;       ///< Batch kernel
+    const char* symbol;  ///< Unmangled kernel name, for the size lookup
+};
+
+#define VNE_DIFF_VARIANT(op, variant) Variant{#variant, &vne_diff_##op##_##variant, "vne_diff_" #op "_" #variant}
+
+struct Operation {
+    const char* name;
+    Input a;
+    Input b;
+    std::size_t out_floats;  ///< Floats per result
+    std::size_t group;       ///< Result floats sharing one ULP scale: a vector or a matrix column
+    bool angular;            ///< Results are angles; errors wrap at 2 pi
+    Reference reference;
+    std::vector<Variant> variants;
+};
+
+std::size_t floatsOf(Input input) noexcept {
+    switch (input) {
+        case Input::eVector:
+            return 3;
+        case Input::eRotation:
+            return 4;
+        case Input::eTransform:
+            return 16;
+        default:
+            return 0;
+    }
+}
+
+std::vector<float> makeInput(Input input, std::size_t count, std::uint32_t seed) {
+    std::vector<float> values;
+    values.reserve(count * floatsOf(input));
+    switch (input) {
+        case Input::eVector:
+            for (const Vec3f& v : randomVecs<Vec3f>(count, seed, -10.0f, 10.0f)) {
+                values.insert(values.end(), {v.x(), v.y(), v.z()});
+            }
+            break;
+        case Input::eRotation:
+            for (const Quatf& q : randomRotations(count, seed)) {
+                values.insert(values.end(), {q.x, q.y, q.z, q.w});
+            }
+            break;
+        case Input::eTransform:
+            for (const Mat4f& m : randomTransforms(count, seed)) {
+                values.resize(values.size() + 16);
+                storeMat4(values.data() + values.size() - 16, m);
+            }
+            break;
+        default:
+            break;
+    }
+    return values;
+}
+
+std::vector<Operation> makeOperations() {
+    using glm::dmat4;
+    using glm::dvec3;
+    using glm::dvec4;
+
+    std::vector<Operation> ops;
+    ops.push_back({"vec3.length",
+                   Input::eVector,
+                   Input::eNone,
+                   1,
+                   1,
+                   false,
+                   [](const float* a, const float*, double* out) { out[0] = glm::length(dvec3(glm::make_vec3(a))); },
+                   {VNE_DIFF_VARIANT(vec3_length, current),
+                    VNE_DIFF_VARIANT(vec3_length, scalar),
+                    VNE_DIFF_VARIANT(vec3_length, simd),
+                    VNE_DIFF_VARIANT(vec3_length, glm)}});
+    ops.push_back({"vec3.normalize",
+                   Input::eVector,
+                   Input::eNone,
+                   3,
+                   3,
+                   false,
+                   [](const float* a, const float*, double* out) {
+                       storeGlmVec3(out, glm::normalize(dvec3(glm::make_vec3(a))));
+                   },
+                   {VNE_DIFF_VARIANT(vec3_normalize, current),
+                    VNE_DIFF_VARIANT(vec3_normalize, scalar),
+                    VNE_DIFF_VARIANT(vec3_normalize, simd),
+                    VNE_DIFF_VARIANT(vec3_normalize, glm)}});
+    ops.push_back({"vec3.cross",
+                   Input::eVector,
+                   Input::eVector,
+                   3,
+                   3,
+                   false,
+                   [](const float* a, const float* b, double* out) {
+                       storeGlmVec3(out, glm::cross(dvec3(glm::make_vec3(a)), dvec3(glm::make_vec3(b))));
+                   },
+                   {VNE_DIFF_VARIANT(vec3_cross, current),
+                    VNE_DIFF_VARIANT(vec3_cross, scalar),
+                    VNE_DIFF_VARIANT(vec3_cross, simd),
+                    VNE_DIFF_VARIANT(vec3_cross, glm)}});
+    ops.push_back({"mat4.multiply",
+                   Input::eTransform,
+                   Input::eTransform,
+                   16,
+                   4,
+                   false,
+                   [](const float* a, const float* b, double* out) {
+                       storeGlmMat4(out, dmat4(glm::make_mat4(a)) * dmat4(glm::make_mat4(b)));
+                   },
+                   {VNE_DIFF_VARIANT(mat4_multiply, current),
+                    VNE_DIFF_VARIANT(mat4_multiply, scalar),
+                    VNE_DIFF_VARIANT(mat4_multiply, simd),
+                    VNE_DIFF_VARIANT(mat4_multiply, glm)}});
+    ops.push_back({"mat4.transformPoint",
+                   Input::eTransform,
+                   Input::eVector,
+                   3,
+                   3,
+                   false,
+                   [](const float* a, const float* b, double* out) {
+                       const dvec4 p = dmat4(glm::make_mat4(a)) * dvec4(dvec3(glm::make_vec3(b)), 1.0);
+                       storeGlmVec3(out, dvec3(p));
+                   },
+                   {VNE_DIFF_VARIANT(mat4_transform_point, current),
+                    VNE_DIFF_VARIANT(mat4_transform_point, scalar),
+                    VNE_DIFF_VARIANT(mat4_transform_point, simd),
+                    VNE_DIFF_VARIANT(mat4_transform_point, glm)}});
+    ops.push_back({"mat4.inverse",
+                   Input::eTransform,
+                   Input::eNone,
+                   16,
+                   4,
+                   false,
+                   [](const float* a, const float*, double* out) {
+                       storeGlmMat4(out, glm::inverse(dmat4(glm::make_mat4(a))));
+                   },
+                   {VNE_DIFF_VARIANT(mat4_inverse, current),
+                    VNE_DIFF_VARIANT(mat4_inverse, scalar),
+                    VNE_DIFF_VARIANT(mat4_inverse, glm)}});
+    ops.push_back({"mat4.determinant",
+                   Input::eTransform,
+                   Input::eNone,
+                   1,
+                   1,
+                   false,
+                   [](const float* a, const float*, double* out) {
+                       out[0] = glm::determinant(dmat4(glm::make_mat4(a)));
+                   },
+                   {VNE_DIFF_VARIANT(mat4_determinant, current),
+                    VNE_DIFF_VARIANT(mat4_determinant, scalar),
+                    VNE_DIFF_VARIANT(mat4_determinant, glm)}});
+    ops.push_back({"quat.toMatrix4",
+                   Input::eRotation,
+                   Input::eNone,
+                   16,
+                   4,
+                   false,
+                   [](const float* a, const float*, double* out) {
+                       storeGlmMat4(out, glm::mat4_cast(loadGlmQuat<double>(a)));
+                   },
+                   {VNE_DIFF_VARIANT(quat_to_matrix, current),
+                    VNE_DIFF_VARIANT(quat_to_matrix, scalar),
+                    VNE_DIFF_VARIANT(quat_to_matrix, glm)}});
+    ops.push_back({"quat.toEuler",
+                   Input::eRotation,
+                   Input::eNone,
+                   3,
+                   3,
+                   true,
+                   [](const float* a, const float*, double* out) {
+                       storeGlmVec3(out, glm::eulerAngles(loadGlmQuat<double>(a)));
+                   },
+                   {VNE_DIFF_VARIANT(quat_to_euler, current),
+                    VNE_DIFF_VARIANT(quat_to_euler, scalar),
+                    VNE_DIFF_VARIANT(quat_to_euler, glm)}});
+    ops.push_back({"quat.rotate",
+                   Input::eRotation,
+                   Input::eVector,
+                   3,
+                   3,
+                   false,
+                   [](const float* a, const float* b, double* out) {
+                       storeGlmVec3(out, loadGlmQuat<double>(a) * dvec3(glm::make_vec3(b)));
+                   },
+                   {VNE_DIFF_VARIANT(quat_rotate, current),
+                    VNE_DIFF_VARIANT(quat_rotate, scalar),
+                    VNE_DIFF_VARIANT(quat_rotate, simd),
+                    VNE_DIFF_VARIANT(quat_rotate, glm)}});
+    ops.push_back({"quat.multiply",
+                   Input::eRotation,
+                   Input::eRotation,
+                   4,
+                   4,
+                   false,
+                   [](const float* a, const float* b, double* out) {
+                       storeGlmQuat(out, loadGlmQuat<double>(a) * loadGlmQuat<double>(b));
+                   },
+                   {VNE_DIFF_VARIANT(quat_multiply, current),
+                    VNE_DIFF_VARIANT(quat_multiply, scalar),
+                    VNE_DIFF_VARIANT(quat_multiply, glm)}});
+    ops.push_back({"quat.slerp",
+                   Input::eRotation,
+                   Input::eRotation,
+                   4,
+                   4,
+                   false,
+                   [](const float* a, const float* b, double* out) {
+                       storeGlmQuat(out,
+                                    glm::slerp(loadGlmQuat<double>(a),
+                                               loadGlmQuat<double>(b),
+                                               static_cast<double>(kSlerpFactor)));
+                   },
+                   {VNE_DIFF_VARIANT(quat_slerp, current),
+                    VNE_DIFF_VARIANT(quat_slerp, scalar),
+                    VNE_DIFF_VARIANT(quat_slerp, glm)}});
+    return ops;
+}
+
+#undef VNE_DIFF_VARIANT
+
+// ============================================================================
+// Measurement
+// ============================================================================
+
+struct Options {
+    std::size_t elements = 4096;
+    std::size_t samples = 11;
+    double min_time_ms = 5.0;
+    std::string filter;
+    std::string json;
+    std::string nm = "nm";
+};
+
+struct Timing {
+    double median_ns = 0.0;  ///< Median over samples, per element
+    double min_ns = 0.0;     ///< Fastest sample, per element
+};
+
+/// Repeats the kernel until one sample takes min_time_ms, then takes the samples
+Timing timeKernel(Kernel kernel, const float* a, const float* b, float* out, const Options& options) {
+    using Clock = std::chrono::steady_clock;
+    const auto runFor = [&](std::size_t repeats) {
+        const auto start = Clock::now();
+        for (std::size_t r = 0; r < repeats; ++r) {
+            kernel(a, b, out, options.elements);
+            benchmark::ClobberMemory();
+        }
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    };
+
+    std::size_t repeats = 1;
+    while (runFor(repeats) < options.min_time_ms * 1e6 && repeats < (std::size_t{1} << 24)) {
+        repeats *= 2;
+    }
+    std::vector<double> samples;
+    for (std::size_t s = 0; s < options.samples; ++s) {
+        samples.push_back(runFor(repeats) / static_cast<double>(repeats * options.elements));
+    }
+    std::sort(samples.begin(), samples.end());
+    return {samples[samples.size() / 2], samples.front()};
+}
+
+/// Upper bounds of the ULP histogram buckets; the last one catches the rest
+constexpr double kUlpBuckets[] = {0.5, 1.0, 2.0, 4.0, 16.0, 256.0, std::numeric_limits<double>::infinity()};
+constexpr std::size_t kUlpBucketCount = std::size(kUlpBuckets);
+
+struct UlpStats {
+    double mean = 0.0;
+    double p50 = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+    double max = 0.0;
+    std::size_t histogram[kUlpBucketCount] = {};
+};
+
+/// Spacing of floats at the given magnitude
+double ulpAt(double magnitude) noexcept {
+    const float f = static_cast<float>(std::abs(magnitude));
+    return static_cast<double>(std::nextafter(f, std::numeric_limits<float>::infinity())) - static_cast<double>(f);
+}
+
+/**
+ * @brief Worst error of each result in ULPs, summarised over all elements.
+ *
+ * A component's error is counted in ULPs of the largest reference component
+ * in its group (the vector, or the matrix column), so entries that cancel
+ * to nearly zero do not report unbounded counts.
+ */
+UlpStats measureUlps(const Operation& op, const std::vector<float>& out, const std::vector<double>& reference) {
+    const std::size_t count = out.size() / op.out_floats;
+    std::vector<double> errors(count, 0.0);
+    for (std::size_t i = 0; i < count; ++i) {
+        double worst = 0.0;
+        for (std::size_t g = 0; g < op.out_floats; g += op.group) {
+            const std::size_t base = i * op.out_floats + g;
+            double scale = 0.0;
+            for (std::size_t k = 0; k < op.group; ++k) {
+                scale = std::max(scale, std::abs(reference[base + k]));
+            }
+            const double ulp = ulpAt(scale);
+            for (std::size_t k = 0; k < op.group; ++k) {
+                double diff = static_cast<double>(out[base + k]) - reference[base + k];
+                if (op.angular) {
+                    diff = std::remainder(diff, 2.0 * kPiT<double>);
+                }
+                const double error = std::abs(diff) / ulp;
+                worst = std::isnan(error) ? std::numeric_limits<double>::infinity() : std::max(worst, error);
+            }
+        }
+        errors[i] = worst;
+    }
+
+    UlpStats stats;
+    if (errors.empty()) {
+        return stats;
+    }
+    std::sort(errors.begin(), errors.end());
+    const auto at = [&](double q) { return errors[static_cast<std::size_t>(q * static_cast<double>(count - 1))]; };
+    double sum = 0.0;
+    for (const double e : errors) {
+        sum += e;
+        std::size_t bucket = 0;
+        while (e > kUlpBuckets[bucket]) {
+            ++bucket;
+        }
+        ++stats.histogram[bucket];
+    }
+    stats.mean = sum / static_cast<double>(count);
+    stats.p50 = at(0.5);
+    stats.p90 = at(0.9);
+    stats.p99 = at(0.99);
+    stats.max = errors.back();
+    return stats;
+}
+
+// ============================================================================
+// Code Size
+// ============================================================================
+
+std::string executablePath(const char* argv0) {
+    std::error_code error;
+    const std::filesystem::path self = std::filesystem::read_symlink("/proc/self/exe", error);
+    return error ? std::string(argv0) : self.string();
+}
+
+/**
+ * @brief Symbol sizes of the vne_diff_ kernels, from nm -S.
+ *
+ * Compiler-split parts (vne_diff_x.cold and the like) count towards their
+ * kernel; functions the kernel calls out of line do not. Empty when nm is
+ * missing or cannot report sizes (e.g. Apple nm).
+ */
+std::map<std::string, std::size_t> kernelSizes(const std::string& nm, const std::string& executable) {
+    std::map<std::string, std::size_t> sizes;
+#if defined(_WIN32)
+    const std::string command = "\"" + nm + "\" -S --defined-only \"" + executable + "\" 2>NUL";
+    FILE* pipe = _popen(command.c_str(), "r");
+#else
+    const std::string command = "'" + nm + "' -S --defined-only '" + executable + "' 2>/dev/null";
+    FILE* pipe = popen(command.c_str(), "r");
+#endif
+    if (pipe == nullptr) {
+        return sizes;
+    }
+    char line[1024];
+    while (std::fgets(line, sizeof(line), pipe) != nullptr) {
+        char address[64], size[64], type[8], name[512];
+        if (std::sscanf(line, "%63s %63s %7s %511s", address, size, type, name) != 4) {
+            continue;
+        }
+        std::string symbol = name;
+        if (symbol.rfind("_vne_diff_", 0) == 0) {
+            symbol.erase(0, 1);  // Leading underscore of Mach-O and 32-bit Windows names
+        }
+        if (symbol.rfind("vne_diff_", 0) != 0) {
+            continue;
+        }
+        symbol = symbol.substr(0, symbol.find('.'));
+        sizes[symbol] += std::strtoull(size, nullptr, 16);
+    }
+#if defined(_WIN32)
+    _pclose(pipe);
+#else
+    pclose(pipe);
+#endif
+    return sizes;
+}
+
+// ============================================================================
+// Report
+// ============================================================================
+
+struct Result {
+    const Operation* op;
+    const Variant* variant;
+    Timing timing;
+    UlpStats ulps;
+    std::size_t bytes;  ///< 0 when unknown
+};
+
+const char* simdBackend() noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    return "sse2";
+#elif defined(VNE_MATH_SIMD_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+/// JSON has no infinity; unbounded errors are written as null
+void writeNumber(FILE* file, double value) {
+    if (std::isfinite(value)) {
+        std::fprintf(file, "%.6g", value);
+    } else {
+        std::fprintf(file, "null");
+    }
+}
+
+bool writeJson(const std::string& path, const std::vector<Result>& results, const Options& options) {
+    FILE* file = std::fopen(path.c_str(), "w");
+    if (file == nullptr) {
+        return false;
+    }
+    std::fprintf(file,
+                 "{\n  \"context\": {\"elements\": %zu, \"samples\": %zu, \"simd\": \"%s\"},\n",
+                 options.elements,
+                 options.samples,
+                 simdBackend());
+    std::fprintf(file, "  \"ulp_buckets\": [");
+    for (std::size_t b = 0; b + 1 < kUlpBucketCount; ++b) {
+        std::fprintf(file, "%s%g", b == 0 ? "" : ", ", kUlpBuckets[b]);
+    }
+    std::fprintf(file, ", null],\n  \"results\": [\n");
+    for (std::size_t r = 0; r < results.size(); ++r) {
+        const Result& result = results[r];
+        std::fprintf(file,
+                     "    {\"operation\": \"%s\", \"variant\": \"%s\", \"symbol\": \"%s\", \"ns_per_op\": ",
+                     result.op->name,
+                     result.variant->name,
+                     result.variant->symbol);
+        writeNumber(file, result.timing.median_ns);
+        std::fprintf(file, ", \"ns_per_op_min\": ");
+        writeNumber(file, result.timing.min_ns);
+        std::fprintf(file, ", \"code_bytes\": ");
+        if (result.bytes > 0) {
+            std::fprintf(file, "%zu", result.bytes);
+        } else {
+            std::fprintf(file, "null");
+        }
+        std::fprintf(file, ",\n     \"ulp\": {\"mean\": ");
+        writeNumber(file, result.ulps.mean);
+        std::fprintf(file, ", \"p50\": ");
+        writeNumber(file, result.ulps.p50);
+        std::fprintf(file, ", \"p90\": ");
+        writeNumber(file, result.ulps.p90);
+        std::fprintf(file, ", \"p99\": ");
+        writeNumber(file, result.ulps.p99);
+        std::fprintf(file, ", \"max\": ");
+        writeNumber(file, result.ulps.max);
+        std::fprintf(file, ", \"histogram\": [");
+        for (std::size_t b = 0; b < kUlpBucketCount; ++b) {
+            std::fprintf(file, "%s%zu", b == 0 ? "" : ", ", result.ulps.histogram[b]);
+        }
+        std::fprintf(file, "]}}%s\n", r + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(file, "  ]\n}\n");
+    return std::fclose(file) == 0;
+}
+
+void printUsage(const char* program) {
+    std::printf(
+        "Usage: %s [options]\n"
+        "  --elements N      Elements per batch (default 4096)\n"
+        "  --samples N       Timed samples per kernel, the median is reported (default 11)\n"
+        "  --min-time-ms T   Minimum duration of one sample (default 5)\n"
+        "  --filter TEXT     Only operations whose name contains TEXT\n"
+        "  --json PATH       Also write the results as JSON\n"
+        "  --nm PATH         nm used for the code sizes (default nm)\n",
+        program);
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            return false;
+        }
+        if (i + 1 >= argc) {
+            std::fprintf(stderr, "error: %s needs a value\n", arg.c_str());
+            return false;
+        }
+        const char* value = argv[++i];
+        if (arg == "--elements") {
+            options.elements = std::strtoull(value, nullptr, 10);
+        } else if (arg == "--samples") {
+            options.samples = std::strtoull(value, nullptr, 10);
+        } else if (arg == "--min-time-ms") {
+            options.min_time_ms = std::strtod(value, nullptr);
+        } else if (arg == "--filter") {
+            options.filter = value;
+        } else if (arg == "--json") {
+            options.json = value;
+        } else if (arg == "--nm") {
+            options.nm = value;
+        } else {
+            std::fprintf(stderr, "error: unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    if (options.elements == 0 || options.samples == 0) {
+        std::fprintf(stderr, "error: --elements and --samples must be positive\n");
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    const std::map<std::string, std::size_t> sizes = kernelSizes(options.nm, executablePath(argv[0]));
+    const std::vector<Operation> ops = makeOperations();
+
+    std::printf("vnemath differential benchmark: %zu elements per batch, median of %zu samples, SIMD backend %s\n",
+                options.elements,
+                options.samples,
+                simdBackend());
+    std::printf("ULP error: worst component of each result against a double-precision reference\n\n");
+    std::printf("%-20s %-8s %9s %9s %9s %9s %11s %7s\n",
+                "Operation",
+                "Variant",
+                "ns/op",
+                "ULP mean",
+                "ULP p50",
+                "ULP p99",
+                "ULP max",
+                "Bytes");
+
+    std::vector<Result> results;
+    std::uint32_t seed = kSeed;
+    for (const Operation& op : ops) {
+        if (!options.filter.empty() && std::string(op.name).find(options.filter) == std::string::npos) {
+            continue;
+        }
+        const std::vector<float> a = makeInput(op.a, options.elements, seed++);
+        const std::vector<float> b = makeInput(op.b, options.elements, seed++);
+        const std::size_t a_floats = floatsOf(op.a);
+        const std::size_t b_floats = floatsOf(op.b);
+
+        std::vector<double> reference(options.elements * op.out_floats);
+        for (std::size_t i = 0; i < options.elements; ++i) {
+            op.reference(a.data() + i * a_floats, b.data() + i * b_floats, reference.data() + i * op.out_floats);
+        }
+
+        std::vector<float> out(options.elements * op.out_floats);
+        for (const Variant& variant : op.variants) {
+            std::fill(out.begin(), out.end(), 0.0f);
+            variant.kernel(a.data(), b.data(), out.data(), options.elements);
+            const UlpStats ulps = measureUlps(op, out, reference);
+            const Timing timing = timeKernel(variant.kernel, a.data(), b.data(), out.data(), options);
+            const auto size = sizes.find(variant.symbol);
+            const std::size_t bytes = size == sizes.end() ? 0 : size->second;
+            results.push_back({&op, &variant, timing, ulps, bytes});
+
+            std::printf("%-20s %-8s %9.2f %9.3f %9.2f %9.2f %11.4g ",
+                        op.name,
+                        variant.name,
+                        timing.median_ns,
+                        ulps.mean,
+                        ulps.p50,
+                        ulps.p99,
+                        ulps.max);
+            if (bytes > 0) {
+                std::printf("%7zu\n", bytes);
+            } else {
+                std::printf("%7s\n", "-");
+            }
+            std::fflush(stdout);
+        }
+    }
+    if (sizes.empty()) {
+        std::printf("\nCode sizes unavailable: '%s -S' did not list the kernels (pass --nm)\n", options.nm.c_str());
+    }
+
+    if (!options.json.empty()) {
+        if (!writeJson(options.json, results, options)) {
+            std::fprintf(stderr, "error: cannot write %s\n", options.json.c_str());
+            return 2;
+        }
+        std::printf("\nResults written to %s\n", options.json.c_str());
+    }
+    return 0;
+}
@@ -0,0 +1,111 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include <benchmark/benchmark.h>
+#include <vertexnova/math/geometry/fitting.h>
+
+#include <random>
+#include <vector>
+
+using namespace vne::math;
+
+namespace {
+
+constexpr std::uint32_t kSeed = 0x5EED0069u;
+
+std::vector<Vec3f> makeCloud(std::size_t count, std::uint32_t seed = kSeed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> coord(-1.0f, 1.0f);
+    const Quatf tilt = Quatf::fromAxisAngle(Vec3f(1, 2, 3).normalized(), 0.6f);
+    std::vector<Vec3f> points;
+    for (std::size_t i = 0; i < count; ++i) {
+        points.push_back(tilt.rotate(Vec3f(coord(rng) * 4.0f, coord(rng), coord(rng) * 0.5f)));
+    }
+    return points;
+}
+
+void BM_FitSphereRitter(benchmark::State& state) {
+    const std::vector<Vec3f> points = makeCloud(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fitSphereRitter(points));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_FitSphereWelzl(benchmark::State& state) {
+    const std::vector<Vec3f> points = makeCloud(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fitSphereWelzl(points));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_FitObbPca(benchmark::State& state) {
+    const std::vector<Vec3f> points = makeCloud(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fitObbPca(points));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_FitObbDito(benchmark::State& state) {
+    const std::vector<Vec3f> points = makeCloud(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fitObbDito(points));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_FitKdop26(benchmark::State& state) {
+    const std::vector<Vec3f> points = makeCloud(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fitKdop(points, DopType::eDop26));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_FitKdop26ScalarLoop(benchmark::State& state) {
+    const std::vector<Vec3f> points = makeCloud(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        Kdop dop(DopType::eDop26);
+        for (const Vec3f& p : points) {
+            dop.expand(p);
+        }
+        benchmark::DoNotOptimize(dop);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// 64 meshes of the given vertex count, fitted with the thread count in range(1)
+void BM_FitBoundsMeshes(benchmark::State& state) {
+    constexpr std::uint32_t kMeshes = 64;
+    std::vector<std::vector<Vec3f>> clouds;
+    std::vector<std::span<const Vec3f>> meshes;
+    for (std::uint32_t i = 0; i < kMeshes; ++i) {
+        clouds.push_back(makeCloud(static_cast<std::size_t>(state.range(0)), kSeed + i));
+    }
+    for (const auto& cloud : clouds) {
+        meshes.push_back(cloud);
+    }
+    FitOptions options;
+    options.thread_count = static_cast<std::uint32_t>(state.range(1));
+    std::vector<MeshBounds> out(kMeshes);
+    for (auto _ : state) {
+        fitBounds(meshes, out, options);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * kMeshes);
+}
+
+}  // namespace
+
+BENCHMARK(BM_FitSphereRitter)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_FitSphereWelzl)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_FitObbPca)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_FitObbDito)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_FitKdop26)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_FitKdop26ScalarLoop)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_FitBoundsMeshes)->ArgsProduct({{4096, 32768}, {1, 4}})->UseRealTime();
@@ -0,0 +1,110 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include "bench_common.h"
+
+#include <vertexnova/math/geometry/aabb.h>
+#include <vertexnova/math/geometry/frustum.h>
+#include <vertexnova/math/geometry/sphere.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace vne::math;
+using namespace vne::math::bench;
+
+namespace {
+
+constexpr std::uint32_t kSeed = 0x5EED0371u;
+
+/// A camera frustum and a scene of boxes, spheres and points around it; about half are visible
+class FrustumFixture : public benchmark::Fixture {
+   public:
+    void SetUp(const benchmark::State& state) override {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const Mat4f view = Mat4f::lookAt(Vec3f(0.0f, 5.0f, 60.0f), Vec3f(0.0f), Vec3f(0.0f, 1.0f, 0.0f));
+        const Mat4f projection = Mat4f::perspective(degToRad(60.0f), 16.0f / 9.0f, 0.1f, 200.0f);
+        frustum.extractFromMatrix(projection * view);
+
+        centers = randomVecs<Vec3f>(count, kSeed, -80.0f, 80.0f);
+        const std::vector<float> sizes = randomFloats(count, kSeed + 1, 0.5f, 4.0f);
+        boxes.clear();
+        spheres.clear();
+        for (std::size_t i = 0; i < count; ++i) {
+            boxes.emplace_back(centers[i] - Vec3f(sizes[i]), centers[i] + Vec3f(sizes[i]));
+            spheres.emplace_back(centers[i], sizes[i]);
+        }
+        visible.assign(count, 0);
+    }
+
+    void TearDown(const benchmark::State&) override {
+        centers = {};
+        boxes = {};
+        spheres = {};
+        visible = {};
+    }
+
+    Frustum frustum;
+    std::vector<Vec3f> centers;
+    std::vector<Aabb> boxes;
+    std::vector<Sphere> spheres;
+    std::vector<std::uint8_t> visible;
+};
+
+constexpr std::size_t kAabbBytes = sizeof(Aabb) + 1;
+constexpr std::size_t kSphereBytes = sizeof(Sphere) + 1;
+constexpr std::size_t kPointBytes = sizeof(Vec3f) + 1;
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(FrustumFixture, IntersectsAabb)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            visible[i] = frustum.intersects(boxes[i]);
+        }
+        benchmark::DoNotOptimize(visible.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kAabbBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(FrustumFixture, IntersectsSphere)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < spheres.size(); ++i) {
+            visible[i] = frustum.intersects(spheres[i]);
+        }
+        benchmark::DoNotOptimize(visible.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kSphereBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(FrustumFixture, ContainsFullyAabb)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            visible[i] = frustum.containsFully(boxes[i]);
+        }
+        benchmark::DoNotOptimize(visible.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kAabbBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(FrustumFixture, ContainsPoint)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < centers.size(); ++i) {
+            visible[i] = frustum.contains(centers[i]);
+        }
+        benchmark::DoNotOptimize(visible.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kPointBytes>(state);
+}
+
+BENCHMARK_REGISTER_F(FrustumFixture, IntersectsAabb)->Apply(workingSets<kAabbBytes>);
+BENCHMARK_REGISTER_F(FrustumFixture, IntersectsSphere)->Apply(workingSets<kSphereBytes>);
+BENCHMARK_REGISTER_F(FrustumFixture, ContainsFullyAabb)->Apply(workingSets<kAabbBytes>);
+BENCHMARK_REGISTER_F(FrustumFixture, ContainsPoint)->Apply(workingSets<kPointBytes>);
@@ -0,0 +1,133 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include <benchmark/benchmark.h>
+#include <vertexnova/math/geometry/gjk.h>
+
+#include <random>
+#include <vector>
+
+using namespace vne::math;
+
+namespace {
+
+constexpr std::uint32_t kSeed = 0x5EED0063u;
+
+struct Pairs {
+    std::vector<Obb> boxes_a;
+    std::vector<Obb> boxes_b;
+    std::vector<Sphere> spheres;
+    std::vector<Capsule> capsules;
+};
+
+/// Shape pairs placed so that roughly half of them overlap
+Pairs makePairs(std::size_t count) {
+    std::mt19937 rng(kSeed);
+    std::uniform_real_distribution<float> pos(-2.5f, 2.5f);
+    std::uniform_real_distribution<float> ext(0.3f, 1.5f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    Pairs pairs;
+    for (std::size_t i = 0; i < count; ++i) {
+        const Quatf qa = Quatf(unit(rng), unit(rng), unit(rng), unit(rng)).normalized();
+        const Quatf qb = Quatf(unit(rng), unit(rng), unit(rng), unit(rng)).normalized();
+        pairs.boxes_a.emplace_back(Vec3f::zero(), Vec3f(ext(rng), ext(rng), ext(rng)), qa);
+        pairs.boxes_b.emplace_back(Vec3f(pos(rng), pos(rng), pos(rng)), Vec3f(ext(rng), ext(rng), ext(rng)), qb);
+        pairs.spheres.emplace_back(Vec3f(pos(rng), pos(rng), pos(rng)), ext(rng));
+        const Vec3f start(pos(rng), pos(rng), pos(rng));
+        pairs.capsules.emplace_back(start, start + Vec3f(unit(rng), unit(rng), unit(rng)) * 2.0f, ext(rng) * 0.5f);
+    }
+    return pairs;
+}
+
+void BM_GjkDistanceSphereObb(benchmark::State& state) {
+    const Pairs pairs = makePairs(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        float total = 0.0f;
+        for (std::size_t i = 0; i < pairs.spheres.size(); ++i) {
+            total += gjkDistance(pairs.spheres[i], pairs.boxes_a[i]).distance;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_GjkDistanceCapsuleObb(benchmark::State& state) {
+    const Pairs pairs = makePairs(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        float total = 0.0f;
+        for (std::size_t i = 0; i < pairs.capsules.size(); ++i) {
+            total += gjkDistance(pairs.capsules[i], pairs.boxes_a[i]).distance;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_GjkIntersectsObbObb(benchmark::State& state) {
+    const Pairs pairs = makePairs(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::size_t hits = 0;
+        for (std::size_t i = 0; i < pairs.boxes_a.size(); ++i) {
+            hits += gjkIntersects(pairs.boxes_a[i], pairs.boxes_b[i]) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+/// Same pairs as above, each re-queried with the simplex cached by the previous run
+void BM_GjkIntersectsObbObbWarm(benchmark::State& state) {
+    const Pairs pairs = makePairs(static_cast<std::size_t>(state.range(0)));
+    std::vector<GjkCache> caches(pairs.boxes_a.size());
+    for (std::size_t i = 0; i < pairs.boxes_a.size(); ++i) {
+        benchmark::DoNotOptimize(gjkIntersects(pairs.boxes_a[i], pairs.boxes_b[i], &caches[i]));
+    }
+    for (auto _ : state) {
+        std::size_t hits = 0;
+        for (std::size_t i = 0; i < pairs.boxes_a.size(); ++i) {
+            hits += gjkIntersects(pairs.boxes_a[i], pairs.boxes_b[i], &caches[i]) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_PenetrationObbObb(benchmark::State& state) {
+    const Pairs pairs = makePairs(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        float total = 0.0f;
+        for (std::size_t i = 0; i < pairs.boxes_a.size(); ++i) {
+            total += penetration(pairs.boxes_a[i], pairs.boxes_b[i]).depth;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_GjkDistancePointSet(benchmark::State& state) {
+    std::mt19937 rng(kSeed);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::vector<Vec3f> hull_a(static_cast<std::size_t>(state.range(0)));
+    std::vector<Vec3f> hull_b(hull_a.size());
+    for (std::size_t i = 0; i < hull_a.size(); ++i) {
+        hull_a[i] = Vec3f(unit(rng), unit(rng), unit(rng));
+        hull_b[i] = Vec3f(unit(rng), unit(rng), unit(rng)) + Vec3f(3.0f, 0.5f, -0.25f);
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(gjkDistance(ConvexPointSet{hull_a}, ConvexPointSet{hull_b}).distance);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_GjkDistanceSphereObb)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_GjkDistanceCapsuleObb)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_GjkIntersectsObbObb)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_GjkIntersectsObbObbWarm)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_PenetrationObbObb)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_GjkDistancePointSet)->RangeMultiplier(8)->Range(64, 262144);
@@ -0,0 +1,96 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include <benchmark/benchmark.h>
+#include <vertexnova/math/gpu_instance.h>
+
+#include <random>
+#include <vector>
+
+using namespace vne::math;
+
+namespace {
+
+constexpr std::uint32_t kSeed = 0x5EED0060u;
+
+struct InstanceData {
+    std::vector<TransformComponents> components;
+    std::vector<Mat4f> matrices;
+};
+
+InstanceData makeInstanceData(std::size_t count) {
+    std::mt19937 rng(kSeed);
+    std::uniform_real_distribution<float> pos(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> scl(0.1f, 4.0f);
+
+    InstanceData data;
+    data.components.resize(count);
+    data.matrices.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        TransformComponents& c = data.components[i];
+        c.translation = Vec3f(pos(rng), pos(rng), pos(rng));
+        c.rotation = Quatf(unit(rng), unit(rng), unit(rng), unit(rng)).normalized();
+        c.scale = Vec3f(scl(rng), scl(rng), scl(rng));
+        data.matrices[i] = compose(c);
+    }
+    return data;
+}
+
+template<typename Out, typename Fn>
+void runPack(benchmark::State& state, Fn&& fn) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const InstanceData data = makeInstanceData(count);
+    std::vector<Out> out(count);
+    for (auto _ : state) {
+        fn(data, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0)
+                            * static_cast<int64_t>(sizeof(Out)));
+}
+
+void BM_InstanceMat4PerObject(benchmark::State& state) {
+    runPack<GpuMat4f>(state, [](const InstanceData& data, std::vector<GpuMat4f>& out) {
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            out[i] = GpuMat4f(data.matrices[i]);
+        }
+    });
+}
+
+void BM_InstanceAffineFromMat4(benchmark::State& state) {
+    runPack<GpuAffine3f>(state, [](const InstanceData& data, std::vector<GpuAffine3f>& out) {
+        packInstances(data.matrices, out);
+    });
+}
+
+void BM_InstanceAffineFromTrs(benchmark::State& state) {
+    runPack<GpuAffine3f>(state, [](const InstanceData& data, std::vector<GpuAffine3f>& out) {
+        packInstances(data.components, out);
+    });
+}
+
+void BM_InstanceQuantizedFromTrs(benchmark::State& state) {
+    runPack<GpuInstanceTrs>(state, [](const InstanceData& data, std::vector<GpuInstanceTrs>& out) {
+        packInstances(data.components, out);
+    });
+}
+
+void BM_InstanceQuantizedFromMat4(benchmark::State& state) {
+    runPack<GpuInstanceTrs>(state, [](const InstanceData& data, std::vector<GpuInstanceTrs>& out) {
+        packInstances(data.matrices, out);
+    });
+}
+
+}  // namespace
+
+BENCHMARK(BM_InstanceMat4PerObject)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_InstanceAffineFromMat4)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_InstanceAffineFromTrs)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_InstanceQuantizedFromTrs)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_InstanceQuantizedFromMat4)->RangeMultiplier(8)->Range(64, 262144);
@@ -0,0 +1,94 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include <benchmark/benchmark.h>
+#include <vertexnova/math/gpu_types.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace vne::math;
+
+namespace {
+
+constexpr std::uint32_t kSeed = 0x5EED0058u;
+
+struct DrawData {
+    Mat4f model;
+    Mat4f model_view_projection;
+    Vec3f tint;
+    float alpha;
+};
+
+using DrawBlock = GpuBlock<GpuBufferLayout::eStd140,
+                           &DrawData::model,
+                           &DrawData::model_view_projection,
+                           &DrawData::tint,
+                           &DrawData::alpha>;
+
+/// The hand-written equivalent of DrawBlock
+struct alignas(16) DrawUniforms {
+    GpuMat4f model;
+    GpuMat4f model_view_projection;
+    Vec3f tint;
+    float alpha;
+};
+static_assert(sizeof(DrawUniforms) == DrawBlock::kSize);
+
+std::vector<DrawData> makeDraws(std::size_t count) {
+    std::mt19937 rng(kSeed);
+    std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+
+    std::vector<DrawData> draws(count);
+    for (DrawData& draw : draws) {
+        for (int c = 0; c < 4; ++c) {
+            for (int r = 0; r < 4; ++r) {
+                draw.model[c][r] = dist(rng);
+                draw.model_view_projection[c][r] = dist(rng);
+            }
+        }
+        draw.tint = Vec3f(dist(rng), dist(rng), dist(rng));
+        draw.alpha = dist(rng);
+    }
+    return draws;
+}
+
+void BM_PackUniformsPerObject(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<DrawData> draws = makeDraws(count);
+    std::vector<std::byte> mapped(count * DrawBlock::kUniformStride);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < count; ++i) {
+            DrawUniforms uniforms;
+            uniforms.model = GpuMat4f(draws[i].model);
+            uniforms.model_view_projection = GpuMat4f(draws[i].model_view_projection);
+            uniforms.tint = draws[i].tint;
+            uniforms.alpha = draws[i].alpha;
+            std::memcpy(mapped.data() + i * DrawBlock::kUniformStride, &uniforms, sizeof(uniforms));
+        }
+        benchmark::DoNotOptimize(mapped.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_PackUniformsBulk(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<DrawData> draws = makeDraws(count);
+    std::vector<std::byte> mapped(count * DrawBlock::kUniformStride);
+    for (auto _ : state) {
+        DrawBlock::pack(std::span<const DrawData>(draws), mapped);
+        benchmark::DoNotOptimize(mapped.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_PackUniformsPerObject)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_PackUniformsBulk)->RangeMultiplier(8)->Range(64, 262144);
@@ -0,0 +1,201 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include <benchmark/benchmark.h>
+#include <vertexnova/math/geometry/intersection.h>
+
+#include <random>
+#include <vector>
+
+using namespace vne::math;
+
+namespace {
+
+constexpr std::uint32_t kSeed = 0x5EED0066u;
+
+std::vector<Aabb> makeBoxes(std::size_t count) {
+    std::mt19937 rng(kSeed);
+    std::uniform_real_distribution<float> pos(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> size(0.5f, 5.0f);
+
+    std::vector<Aabb> boxes;
+    for (std::size_t i = 0; i < count; ++i) {
+        const Vec3f min(pos(rng), pos(rng), pos(rng));
+        boxes.emplace_back(min, min + Vec3f(size(rng), size(rng), size(rng)));
+    }
+    return boxes;
+}
+
+const Ray kRay(Vec3f(-60.0f, -10.0f, 5.0f), Vec3f(1.0f, 0.2f, -0.1f));
+
+void BM_RayAabbScalar(benchmark::State& state) {
+    const std::vector<Aabb> boxes = makeBoxes(static_cast<std::size_t>(state.range(0)));
+    std::vector<float> distances(boxes.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            distances[i] = intersect(kRay, boxes[i]).distance;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_RayAabbPrecomputed(benchmark::State& state) {
+    const std::vector<Aabb> boxes = makeBoxes(static_cast<std::size_t>(state.range(0)));
+    std::vector<uint8_t> hits(boxes.size());
+    const PrecomputedRay ray(kRay);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            hits[i] = intersects(ray, boxes[i]) ? 1 : 0;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_RayAabbBatch(benchmark::State& state) {
+    const std::vector<Aabb> boxes = makeBoxes(static_cast<std::size_t>(state.range(0)));
+    std::vector<float> distances(boxes.size());
+    const PrecomputedRay ray(kRay);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(intersect(ray, boxes, distances));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+/// Spheres and planes through the same volume as the boxes
+std::vector<Sphere> makeSpheres(std::size_t count) {
+    std::mt19937 rng(kSeed + 2);
+    std::uniform_real_distribution<float> pos(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> radius(0.5f, 5.0f);
+
+    std::vector<Sphere> spheres;
+    for (std::size_t i = 0; i < count; ++i) {
+        spheres.emplace_back(Vec3f(pos(rng), pos(rng), pos(rng)), radius(rng));
+    }
+    return spheres;
+}
+
+std::vector<Plane> makePlanes(std::size_t count) {
+    std::mt19937 rng(kSeed + 3);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> offset(-50.0f, 50.0f);
+
+    std::vector<Plane> planes;
+    for (std::size_t i = 0; i < count; ++i) {
+        planes.emplace_back(Vec3f(unit(rng), unit(rng), unit(rng)).normalized(), offset(rng));
+    }
+    return planes;
+}
+
+void BM_RaySphere(benchmark::State& state) {
+    const std::vector<Sphere> spheres = makeSpheres(static_cast<std::size_t>(state.range(0)));
+    std::vector<float> distances(spheres.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < spheres.size(); ++i) {
+            distances[i] = intersect(kRay, spheres[i]).distance;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_RaySphereBoolean(benchmark::State& state) {
+    const std::vector<Sphere> spheres = makeSpheres(static_cast<std::size_t>(state.range(0)));
+    std::vector<uint8_t> hits(spheres.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < spheres.size(); ++i) {
+            hits[i] = intersects(kRay, spheres[i]) ? 1 : 0;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_RayPlane(benchmark::State& state) {
+    const std::vector<Plane> planes = makePlanes(static_cast<std::size_t>(state.range(0)));
+    std::vector<float> distances(planes.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < planes.size(); ++i) {
+            distances[i] = intersect(kRay, planes[i]).distance;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+/// Small triangles scattered through the same volume as the boxes
+std::vector<Triangle> makeTriangles(std::size_t count) {
+    std::mt19937 rng(kSeed + 1);
+    std::uniform_real_distribution<float> pos(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> offset(-3.0f, 3.0f);
+
+    std::vector<Triangle> triangles;
+    for (std::size_t i = 0; i < count; ++i) {
+        const Vec3f v0(pos(rng), pos(rng), pos(rng));
+        triangles.emplace_back(v0,
+                               v0 + Vec3f(offset(rng), offset(rng), offset(rng)),
+                               v0 + Vec3f(offset(rng), offset(rng), offset(rng)));
+    }
+    return triangles;
+}
+
+void BM_RayTriangleMollerTrumbore(benchmark::State& state) {
+    const std::vector<Triangle> triangles = makeTriangles(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        RayHit closest = RayHit::none();
+        for (const Triangle& triangle : triangles) {
+            const RayHit hit = intersect(kRay, triangle);
+            if (hit && (!closest || hit.distance < closest.distance)) {
+                closest = hit;
+            }
+        }
+        benchmark::DoNotOptimize(closest);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_RayTriangleWatertight(benchmark::State& state) {
+    const std::vector<Triangle> triangles = makeTriangles(static_cast<std::size_t>(state.range(0)));
+    const PrecomputedRay ray(kRay);
+    for (auto _ : state) {
+        RayHit closest = RayHit::none();
+        for (const Triangle& triangle : triangles) {
+            const RayHit hit = intersect(ray, triangle);
+            if (hit && (!closest || hit.distance < closest.distance)) {
+                closest = hit;
+            }
+        }
+        benchmark::DoNotOptimize(closest);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_RayTrianglePackets(benchmark::State& state) {
+    const std::vector<Triangle> triangles = makeTriangles(static_cast<std::size_t>(state.range(0)));
+    std::vector<TrianglePacket> packets((triangles.size() + 3) / 4);
+    packTriangles(triangles, packets);
+    const PrecomputedRay ray(kRay);
+    for (auto _ : state) {
+        uint32_t index = 0;
+        benchmark::DoNotOptimize(intersect(ray, packets, index));
+        benchmark::DoNotOptimize(index);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_RayAabbScalar)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_RayAabbPrecomputed)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_RayAabbBatch)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_RaySphere)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_RaySphereBoolean)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_RayPlane)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_RayTriangleMollerTrumbore)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_RayTriangleWatertight)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_RayTrianglePackets)->RangeMultiplier(8)->Range(64, 262144);
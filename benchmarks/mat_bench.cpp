@@ -0,0 +1,114 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include "bench_common.h"
+
+#include <vector>
+
+using namespace vne::math;
+using namespace vne::math::bench;
+
+namespace {
+
+constexpr std::uint32_t kSeed = 0x5EED0171u;
+
+/// Affine transforms, a second operand and points to transform
+class MatFixture : public benchmark::Fixture {
+   public:
+    void SetUp(const benchmark::State& state) override {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        a = randomTransforms(count, kSeed);
+        b = randomTransforms(count, kSeed + 1);
+        points = randomVecs<Vec3f>(count, kSeed + 2, -10.0f, 10.0f);
+        out.assign(count, Mat4f::identity());
+        out_points.assign(count, Vec3f::zero());
+        scalars.assign(count, 0.0f);
+    }
+
+    void TearDown(const benchmark::State&) override {
+        a = {};
+        b = {};
+        points = {};
+        out = {};
+        out_points = {};
+        scalars = {};
+    }
+
+    std::vector<Mat4f> a;
+    std::vector<Mat4f> b;
+    std::vector<Vec3f> points;
+    std::vector<Mat4f> out;
+    std::vector<Vec3f> out_points;
+    std::vector<float> scalars;
+};
+
+constexpr std::size_t kBinaryBytes = 3 * sizeof(Mat4f);
+constexpr std::size_t kUnaryBytes = 2 * sizeof(Mat4f);
+constexpr std::size_t kReduceBytes = sizeof(Mat4f) + sizeof(float);
+constexpr std::size_t kPointBytes = sizeof(Mat4f) + 2 * sizeof(Vec3f);
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(MatFixture, Multiply)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            out[i] = a[i] * b[i];
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kBinaryBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(MatFixture, Inverse)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            out[i] = a[i].inverse();
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kUnaryBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(MatFixture, Transpose)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            out[i] = a[i].transpose();
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kUnaryBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(MatFixture, Determinant)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            scalars[i] = a[i].determinant();
+        }
+        benchmark::DoNotOptimize(scalars.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kReduceBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(MatFixture, TransformPoint)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            out_points[i] = a[i].transformPoint(points[i]);
+        }
+        benchmark::DoNotOptimize(out_points.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kPointBytes>(state);
+}
+
+BENCHMARK_REGISTER_F(MatFixture, Multiply)->Apply(workingSets<kBinaryBytes>);
+BENCHMARK_REGISTER_F(MatFixture, Inverse)->Apply(workingSets<kUnaryBytes>);
+BENCHMARK_REGISTER_F(MatFixture, Transpose)->Apply(workingSets<kUnaryBytes>);
+BENCHMARK_REGISTER_F(MatFixture, Determinant)->Apply(workingSets<kReduceBytes>);
+BENCHMARK_REGISTER_F(MatFixture, TransformPoint)->Apply(workingSets<kPointBytes>);
@@ -0,0 +1,117 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include "bench_common.h"
+
+#include <vertexnova/math/noise.h>
+
+#include <vector>
+
+using namespace vne::math;
+using namespace vne::math::bench;
+
+namespace {
+
+constexpr std::uint32_t kSeed = 0x5EED0471u;
+
+/// Sample positions spread over many lattice cells
+class NoiseFixture : public benchmark::Fixture {
+   public:
+    void SetUp(const benchmark::State& state) override {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        points2 = randomVecs<Vec2f>(count, kSeed, -64.0f, 64.0f);
+        points3 = randomVecs<Vec3f>(count, kSeed + 1, -64.0f, 64.0f);
+        out.assign(count, 0.0f);
+    }
+
+    void TearDown(const benchmark::State&) override {
+        points2 = {};
+        points3 = {};
+        out = {};
+    }
+
+    std::vector<Vec2f> points2;
+    std::vector<Vec3f> points3;
+    std::vector<float> out;
+};
+
+constexpr std::size_t k2dBytes = sizeof(Vec2f) + sizeof(float);
+constexpr std::size_t k3dBytes = sizeof(Vec3f) + sizeof(float);
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(NoiseFixture, Perlin2d)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < points2.size(); ++i) {
+            out[i] = perlin(points2[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<k2dBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(NoiseFixture, Perlin3d)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < points3.size(); ++i) {
+            out[i] = perlin(points3[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<k3dBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(NoiseFixture, Simplex2d)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < points2.size(); ++i) {
+            out[i] = simplex(points2[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<k2dBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(NoiseFixture, Simplex3d)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < points3.size(); ++i) {
+            out[i] = simplex(points3[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<k3dBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(NoiseFixture, Fbm3d)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < points3.size(); ++i) {
+            out[i] = fbm(points3[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<k3dBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(NoiseFixture, Value2d)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < points2.size(); ++i) {
+            out[i] = valueNoise(points2[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<k2dBytes>(state);
+}
+
+BENCHMARK_REGISTER_F(NoiseFixture, Perlin2d)->Apply(workingSets<k2dBytes>);
+BENCHMARK_REGISTER_F(NoiseFixture, Perlin3d)->Apply(workingSets<k3dBytes>);
+BENCHMARK_REGISTER_F(NoiseFixture, Simplex2d)->Apply(workingSets<k2dBytes>);
+BENCHMARK_REGISTER_F(NoiseFixture, Simplex3d)->Apply(workingSets<k3dBytes>);
+BENCHMARK_REGISTER_F(NoiseFixture, Fbm3d)->Apply(workingSets<k3dBytes>);
+BENCHMARK_REGISTER_F(NoiseFixture, Value2d)->Apply(workingSets<k2dBytes>);
@@ -0,0 +1,83 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include <benchmark/benchmark.h>
+#include <vertexnova/math/geometry/aabb.h>
+#include <vertexnova/math/geometry/obb.h>
+
+#include <random>
+#include <vector>
+
+using namespace vne::math;
+
+namespace {
+
+constexpr std::uint32_t kSeed = 0x5EED0061u;
+
+/// Boxes scattered so that roughly a third of them overlap the query
+std::vector<Obb> makeCandidates(std::size_t count) {
+    std::mt19937 rng(kSeed);
+    std::uniform_real_distribution<float> pos(-6.0f, 6.0f);
+    std::uniform_real_distribution<float> ext(0.2f, 1.5f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    std::vector<Obb> boxes;
+    boxes.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const Quatf q = Quatf(unit(rng), unit(rng), unit(rng), unit(rng)).normalized();
+        boxes.emplace_back(Vec3f(pos(rng), pos(rng), pos(rng)), Vec3f(ext(rng), ext(rng), ext(rng)), q);
+    }
+    return boxes;
+}
+
+const Obb kQuery(Vec3f(0.5f, 0.0f, -0.5f),
+                 Vec3f(3.0f, 1.5f, 2.0f),
+                 Quatf::fromAxisAngle(Vec3f(1.0f, 2.0f, 3.0f).normalized(), 0.6f));
+
+void BM_ObbIntersectsObb(benchmark::State& state) {
+    const std::vector<Obb> candidates = makeCandidates(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::size_t hits = 0;
+        for (const Obb& candidate : candidates) {
+            hits += kQuery.intersects(candidate) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_ObbIntersectsAabb(benchmark::State& state) {
+    const std::vector<Obb> candidates = makeCandidates(static_cast<std::size_t>(state.range(0)));
+    std::vector<Aabb> boxes;
+    boxes.reserve(candidates.size());
+    for (const Obb& candidate : candidates) {
+        boxes.push_back(candidate.getAabb());
+    }
+    for (auto _ : state) {
+        std::size_t hits = 0;
+        for (const Aabb& box : boxes) {
+            hits += kQuery.intersects(box) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_ObbIntersectsBatch(benchmark::State& state) {
+    const std::vector<Obb> candidates = makeCandidates(static_cast<std::size_t>(state.range(0)));
+    std::vector<uint8_t> hits(candidates.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(intersects(kQuery, candidates, hits));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_ObbIntersectsObb)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_ObbIntersectsAabb)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_ObbIntersectsBatch)->RangeMultiplier(8)->Range(64, 262144);
@@ -0,0 +1,86 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include <benchmark/benchmark.h>
+#include <vertexnova/math/projection_utils.h>
+
+#include <random>
+#include <vector>
+
+using namespace vne::math;
+
+namespace {
+
+constexpr std::uint32_t kSeed = 0x5EED0054u;
+
+std::vector<Vec3f> makePoints(std::size_t count) {
+    std::mt19937 rng(kSeed);
+    std::uniform_real_distribution<float> pos(-50.0f, 50.0f);
+    std::vector<Vec3f> points;
+    points.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        points.emplace_back(pos(rng), pos(rng), pos(rng));
+    }
+    return points;
+}
+
+Mat4f makeViewProjection() {
+    const Mat4f view = Mat4f::lookAt(Vec3f(0.0f, 10.0f, 80.0f), Vec3f::zero(), Vec3f::yAxis(), GraphicsApi::eVulkan);
+    const Mat4f proj = Mat4f::perspective(degToRad(60.0f), 16.0f / 9.0f, 0.1f, 500.0f, GraphicsApi::eVulkan);
+    return proj * view;
+}
+
+const Viewport kViewport(0.0f, 0.0f, 1920.0f, 1080.0f);
+
+void BM_ProjectScalar(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<Vec3f> points = makePoints(count);
+    std::vector<Vec3f> screen(count);
+    const Mat4f vp = makeViewProjection();
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < count; ++i) {
+            screen[i] = project(points[i], vp, kViewport, GraphicsApi::eVulkan);
+        }
+        benchmark::DoNotOptimize(screen.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_ProjectBatch(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<Vec3f> points = makePoints(count);
+    std::vector<Vec3f> screen(count);
+    std::vector<uint8_t> visible(count);
+    const Mat4f vp = makeViewProjection();
+    for (auto _ : state) {
+        projectPoints<GraphicsApi::eVulkan>(points, vp, kViewport, screen, visible);
+        benchmark::DoNotOptimize(screen.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_UnprojectBatch(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::vector<Vec3f> screen(count);
+    std::vector<Vec3f> world(count);
+    const Mat4f vp = makeViewProjection();
+    projectPoints(makePoints(count), vp, kViewport, screen, GraphicsApi::eVulkan);
+    const Mat4f inv_vp = vp.inverse();
+    for (auto _ : state) {
+        unprojectPoints<GraphicsApi::eVulkan>(screen, inv_vp, kViewport, world);
+        benchmark::DoNotOptimize(world.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_ProjectScalar)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_ProjectBatch)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_UnprojectBatch)->RangeMultiplier(8)->Range(64, 262144);
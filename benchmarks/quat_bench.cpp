@@ -0,0 +1,129 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include "bench_common.h"
+
+#include <vector>
+
+using namespace vne::math;
+using namespace vne::math::bench;
+
+namespace {
+
+constexpr std::uint32_t kSeed = 0x5EED0271u;
+
+/// Unit quaternions, a second operand, vectors and Euler angles
+class QuatFixture : public benchmark::Fixture {
+   public:
+    void SetUp(const benchmark::State& state) override {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        a = randomRotations(count, kSeed);
+        b = randomRotations(count, kSeed + 1);
+        vectors = randomVecs<Vec3f>(count, kSeed + 2);
+        angles = randomVecs<Vec3f>(count, kSeed + 3, -1.5f, 1.5f);
+        out.assign(count, Quatf::identity());
+        out_vectors.assign(count, Vec3f::zero());
+        out_matrices.assign(count, Mat4f::identity());
+    }
+
+    void TearDown(const benchmark::State&) override {
+        a = {};
+        b = {};
+        vectors = {};
+        angles = {};
+        out = {};
+        out_vectors = {};
+        out_matrices = {};
+    }
+
+    std::vector<Quatf> a;
+    std::vector<Quatf> b;
+    std::vector<Vec3f> vectors;
+    std::vector<Vec3f> angles;
+    std::vector<Quatf> out;
+    std::vector<Vec3f> out_vectors;
+    std::vector<Mat4f> out_matrices;
+};
+
+constexpr std::size_t kBinaryBytes = 3 * sizeof(Quatf);
+constexpr std::size_t kRotateBytes = sizeof(Quatf) + 2 * sizeof(Vec3f);
+constexpr std::size_t kMatrixBytes = sizeof(Quatf) + sizeof(Mat4f);
+constexpr std::size_t kEulerBytes = sizeof(Quatf) + sizeof(Vec3f);
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(QuatFixture, Multiply)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            out[i] = a[i] * b[i];
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kBinaryBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(QuatFixture, Rotate)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            out_vectors[i] = a[i].rotate(vectors[i]);
+        }
+        benchmark::DoNotOptimize(out_vectors.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kRotateBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(QuatFixture, Slerp)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            out[i] = Quatf::slerp(a[i], b[i], 0.3f);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kBinaryBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(QuatFixture, ToMatrix4)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            out_matrices[i] = a[i].toMatrix4();
+        }
+        benchmark::DoNotOptimize(out_matrices.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kMatrixBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(QuatFixture, FromEuler)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            out[i] = Quatf::fromEuler(angles[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kEulerBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(QuatFixture, ToEuler)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            out_vectors[i] = a[i].toEuler();
+        }
+        benchmark::DoNotOptimize(out_vectors.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kEulerBytes>(state);
+}
+
+BENCHMARK_REGISTER_F(QuatFixture, Multiply)->Apply(workingSets<kBinaryBytes>);
+BENCHMARK_REGISTER_F(QuatFixture, Rotate)->Apply(workingSets<kRotateBytes>);
+BENCHMARK_REGISTER_F(QuatFixture, Slerp)->Apply(workingSets<kBinaryBytes>);
+BENCHMARK_REGISTER_F(QuatFixture, ToMatrix4)->Apply(workingSets<kMatrixBytes>);
+BENCHMARK_REGISTER_F(QuatFixture, FromEuler)->Apply(workingSets<kEulerBytes>);
+BENCHMARK_REGISTER_F(QuatFixture, ToEuler)->Apply(workingSets<kEulerBytes>);
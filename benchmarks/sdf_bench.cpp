@@ -0,0 +1,119 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include <benchmark/benchmark.h>
+#include <vertexnova/math/geometry/sdf.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace vne::math;
+
+namespace {
+
+constexpr std::uint32_t kSeed = 0x5EED0068u;
+
+std::vector<Vec3f> makePoints(std::size_t count) {
+    std::mt19937 rng(kSeed);
+    std::uniform_real_distribution<float> coord(-3.0f, 3.0f);
+    std::vector<Vec3f> points;
+    for (std::size_t i = 0; i < count; ++i) {
+        points.push_back(Vec3f(coord(rng), coord(rng), coord(rng)));
+    }
+    return points;
+}
+
+std::vector<SdfPrimitive> makeScene() {
+    const Quatf tilt = Quatf::fromAxisAngle(Vec3f(1, 1, 0).normalized(), 0.4f);
+    return {SdfPrimitive::sphere(Vec3f(-1, 0, 0), 1.0f),
+            SdfPrimitive::roundedBox(Vec3f(1, 0, 0), Vec3f(0.7f, 0.7f, 0.7f), 0.1f, tilt),
+            SdfPrimitive::torus(Vec3f(0, 1, 0), 1.0f, 0.2f, tilt),
+            SdfPrimitive::cylinder(Vec3f(0, -1, 0), 0.5f, 0.4f),
+            SdfPrimitive::cone(Vec3f(0, 0, 1), 0.8f, 0.6f, 0.1f, tilt)};
+}
+
+void BM_SdfSceneBatch(benchmark::State& state) {
+    const std::vector<Vec3f> points = makePoints(static_cast<std::size_t>(state.range(0)));
+    const std::vector<SdfPrimitive> scene = makeScene();
+    std::vector<float> out(points.size());
+    for (auto _ : state) {
+        evaluate(scene, points, out, 0.2f);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SdfSceneScalarLoop(benchmark::State& state) {
+    const std::vector<Vec3f> points = makePoints(static_cast<std::size_t>(state.range(0)));
+    const std::vector<SdfPrimitive> scene = makeScene();
+    std::vector<float> out(points.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            float d = std::numeric_limits<float>::infinity();
+            for (const SdfPrimitive& primitive : scene) {
+                d = sdfSmoothUnion(d, primitive.distance(points[i]), 0.2f);
+            }
+            out[i] = d;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Latitude-longitude sphere of radius 1 with about count triangles
+void makeSphereMesh(std::size_t count, std::vector<Vec3f>& vertices, std::vector<uint32_t>& indices) {
+    const auto rings = static_cast<uint32_t>(std::sqrt(static_cast<float>(count) / 4.0f)) + 2;
+    const uint32_t segments = 2 * rings;
+    for (uint32_t r = 0; r <= rings; ++r) {
+        const float theta = kPi * static_cast<float>(r) / static_cast<float>(rings);
+        for (uint32_t s = 0; s <= segments; ++s) {
+            const float phi = kTwoPi * static_cast<float>(s) / static_cast<float>(segments);
+            vertices.push_back(
+                Vec3f(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi)));
+        }
+    }
+    for (uint32_t r = 0; r < rings; ++r) {
+        for (uint32_t s = 0; s < segments; ++s) {
+            const uint32_t i = r * (segments + 1) + s;
+            indices.insert(indices.end(), {i, i + 1, i + segments + 1, i + 1, i + segments + 2, i + segments + 1});
+        }
+    }
+}
+
+void BM_SdfBakeSphereMesh(benchmark::State& state) {
+    std::vector<Vec3f> vertices;
+    std::vector<uint32_t> indices;
+    makeSphereMesh(static_cast<std::size_t>(state.range(0)), vertices, indices);
+    SdfBakeSettings settings;
+    settings.voxel_size = 0.05f;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(SdfVolume::bake(vertices, indices, settings));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(indices.size() / 3));
+}
+
+void BM_SdfVolumeSample(benchmark::State& state) {
+    std::vector<Vec3f> vertices;
+    std::vector<uint32_t> indices;
+    makeSphereMesh(4096, vertices, indices);
+    const SdfVolume volume = SdfVolume::bake(vertices, indices);
+    const std::vector<Vec3f> points = makePoints(static_cast<std::size_t>(state.range(0)));
+    std::vector<float> out(points.size());
+    for (auto _ : state) {
+        volume.sample(points, out);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_SdfSceneBatch)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_SdfSceneScalarLoop)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_SdfBakeSphereMesh)->RangeMultiplier(8)->Range(64, 4096)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SdfVolumeSample)->RangeMultiplier(8)->Range(64, 262144);
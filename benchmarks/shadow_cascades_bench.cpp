@@ -0,0 +1,66 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include <benchmark/benchmark.h>
+#include <vertexnova/math/shadow_cascades.h>
+
+#include <vector>
+
+using namespace vne::math;
+
+namespace {
+
+CascadeCamera makeCamera() {
+    CascadeCamera camera;
+    camera.view = Mat4f::lookAt(Vec3f(12.0f, 4.0f, 30.0f), Vec3f(0.0f, 0.0f, -40.0f), Vec3f::yAxis());
+    camera.fov_y = degToRad(60.0f);
+    camera.aspect = 16.0f / 9.0f;
+    camera.z_near = 0.1f;
+    camera.z_far = 300.0f;
+    return camera;
+}
+
+void BM_CascadeSplits(benchmark::State& state) {
+    std::vector<float> splits(static_cast<std::size_t>(state.range(0)) + 1);
+    for (auto _ : state) {
+        computeCascadeSplits(0.1f, 300.0f, splits);
+        benchmark::DoNotOptimize(splits.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void runCascadeFit(benchmark::State& state, CascadeFitMode fit) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const CascadeCamera camera = makeCamera();
+    std::vector<float> splits(count + 1);
+    computeCascadeSplits(camera.z_near, camera.z_far, splits);
+    std::vector<ShadowCascade> cascades(count);
+
+    ShadowCascadeSettings settings;
+    settings.light_direction = Vec3f(0.3f, -1.0f, 0.4f).normalized();
+    settings.fit = fit;
+    for (auto _ : state) {
+        computeShadowCascades(camera, splits, settings, cascades);
+        benchmark::DoNotOptimize(cascades.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_ShadowCascadesTight(benchmark::State& state) {
+    runCascadeFit(state, CascadeFitMode::eTight);
+}
+
+void BM_ShadowCascadesStable(benchmark::State& state) {
+    runCascadeFit(state, CascadeFitMode::eStable);
+}
+
+}  // namespace
+
+BENCHMARK(BM_CascadeSplits)->Arg(4)->Arg(8);
+BENCHMARK(BM_ShadowCascadesTight)->Arg(2)->Arg(4)->Arg(8);
+BENCHMARK(BM_ShadowCascadesStable)->Arg(2)->Arg(4)->Arg(8);
@@ -0,0 +1,152 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include <benchmark/benchmark.h>
+#include <vertexnova/math/geometry/sweep.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace vne::math;
+
+namespace {
+
+constexpr std::uint32_t kSeed = 0x5EED0065u;
+
+/// Moving bodies per iteration; the static world size is the benchmark range
+constexpr std::size_t kMovers = 64;
+
+struct Movers {
+    std::vector<Aabb> boxes;
+    std::vector<Sphere> spheres;
+    std::vector<Capsule> capsules;
+    std::vector<Vec3f> motions;
+};
+
+Movers makeMovers() {
+    std::mt19937 rng(kSeed);
+    std::uniform_real_distribution<float> pos(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> step(-20.0f, 20.0f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    Movers movers;
+    for (std::size_t i = 0; i < kMovers; ++i) {
+        const Vec3f center(pos(rng), pos(rng), pos(rng));
+        movers.boxes.emplace_back(center - Vec3f(0.5f, 0.5f, 0.5f), center + Vec3f(0.5f, 0.5f, 0.5f));
+        movers.spheres.emplace_back(center, 0.5f);
+        movers.capsules.emplace_back(center, center + Vec3f(unit(rng), unit(rng), unit(rng)), 0.3f);
+        movers.motions.push_back(Vec3f(step(rng), step(rng), step(rng)));
+    }
+    return movers;
+}
+
+std::vector<Aabb> makeAabbWorld(std::size_t count) {
+    std::mt19937 rng(kSeed + 1);
+    std::uniform_real_distribution<float> pos(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> size(0.2f, 2.0f);
+
+    std::vector<Aabb> world;
+    for (std::size_t i = 0; i < count; ++i) {
+        const Vec3f min(pos(rng), pos(rng), pos(rng));
+        world.emplace_back(min, min + Vec3f(size(rng), size(rng), size(rng)));
+    }
+    return world;
+}
+
+void BM_SweepAabbBatch(benchmark::State& state) {
+    const Movers movers = makeMovers();
+    const std::vector<Aabb> world = makeAabbWorld(static_cast<std::size_t>(state.range(0)));
+    std::vector<SweepHit> hits(kMovers);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            sweep(std::span<const Aabb>(movers.boxes), movers.motions, std::span<const Aabb>(world), hits));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kMovers) * state.range(0));
+}
+
+void BM_SweepAabbScalarLoop(benchmark::State& state) {
+    const Movers movers = makeMovers();
+    const std::vector<Aabb> world = makeAabbWorld(static_cast<std::size_t>(state.range(0)));
+    std::vector<SweepHit> hits(kMovers);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < kMovers; ++i) {
+            SweepHit best = SweepHit::none();
+            for (const Aabb& obstacle : world) {
+                const SweepHit hit = sweep(movers.boxes[i], movers.motions[i], obstacle);
+                if (hit && (!best || hit.time < best.time)) {
+                    best = hit;
+                }
+            }
+            hits[i] = best;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kMovers) * state.range(0));
+}
+
+/// Height-field style grid mesh with about count triangles spanning the movers' region
+void BM_SweepSphereMesh(benchmark::State& state) {
+    const Movers movers = makeMovers();
+    const auto side = static_cast<uint32_t>(std::sqrt(static_cast<float>(state.range(0)) / 2.0f)) + 1;
+    std::mt19937 rng(kSeed + 2);
+    std::uniform_real_distribution<float> height(-2.0f, 2.0f);
+
+    std::vector<Vec3f> vertices;
+    for (uint32_t z = 0; z <= side; ++z) {
+        for (uint32_t x = 0; x <= side; ++x) {
+            const float u = static_cast<float>(x) / static_cast<float>(side);
+            const float v = static_cast<float>(z) / static_cast<float>(side);
+            vertices.push_back(Vec3f(u * 100.0f - 50.0f, height(rng), v * 100.0f - 50.0f));
+        }
+    }
+    std::vector<uint32_t> indices;
+    for (uint32_t z = 0; z < side; ++z) {
+        for (uint32_t x = 0; x < side; ++x) {
+            const uint32_t i = z * (side + 1) + x;
+            indices.insert(indices.end(), {i, i + side + 1, i + 1, i + 1, i + side + 1, i + side + 2});
+        }
+    }
+
+    std::vector<SweepHit> hits(kMovers);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            sweep(std::span<const Sphere>(movers.spheres), movers.motions, vertices, indices, hits));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kMovers) * state.range(0));
+}
+
+void BM_SweepCapsuleObb(benchmark::State& state) {
+    const Movers movers = makeMovers();
+    std::mt19937 rng(kSeed + 3);
+    std::uniform_real_distribution<float> pos(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> ext(0.3f, 2.0f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    std::vector<Obb> world;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        world.emplace_back(Vec3f(pos(rng), pos(rng), pos(rng)),
+                           Vec3f(ext(rng), ext(rng), ext(rng)),
+                           Quatf(unit(rng), unit(rng), unit(rng), unit(rng)).normalized());
+    }
+
+    std::vector<SweepHit> hits(kMovers);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            sweep(std::span<const Capsule>(movers.capsules), movers.motions, std::span<const Obb>(world), hits));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kMovers) * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_SweepAabbBatch)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_SweepAabbScalarLoop)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_SweepSphereMesh)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_SweepCapsuleObb)->RangeMultiplier(8)->Range(64, 262144);
@@ -0,0 +1,120 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include <benchmark/benchmark.h>
+#include <vertexnova/math/transform_utils.h>
+
+#include <random>
+#include <vector>
+
+using namespace vne::math;
+
+namespace {
+
+constexpr std::uint32_t kSeed = 0x5EED0051u;
+
+struct TrsData {
+    std::vector<Vec3f> translations;
+    std::vector<Quatf> rotations;
+    std::vector<Vec3f> scales;
+    std::vector<Mat4f> matrices;
+};
+
+TrsData makeTrsData(std::size_t count) {
+    std::mt19937 rng(kSeed);
+    std::uniform_real_distribution<float> pos(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> scl(0.1f, 4.0f);
+
+    TrsData data;
+    data.translations.reserve(count);
+    data.rotations.reserve(count);
+    data.scales.reserve(count);
+    data.matrices.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        data.translations.emplace_back(pos(rng), pos(rng), pos(rng));
+        data.rotations.push_back(Quatf(unit(rng), unit(rng), unit(rng), unit(rng)).normalized());
+        data.scales.emplace_back(scl(rng), scl(rng), scl(rng));
+        data.matrices[i] = compose(data.translations[i], data.rotations[i], data.scales[i]);
+    }
+    return data;
+}
+
+void BM_ComposeScalar(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    TrsData data = makeTrsData(count);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < count; ++i) {
+            data.matrices[i] = compose(data.translations[i], data.rotations[i], data.scales[i]);
+        }
+        benchmark::DoNotOptimize(data.matrices.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_ComposeBatch(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    TrsData data = makeTrsData(count);
+    for (auto _ : state) {
+        compose(data.translations, data.rotations, data.scales, data.matrices);
+        benchmark::DoNotOptimize(data.matrices.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_DecomposeScalar(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    TrsData data = makeTrsData(count);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < count; ++i) {
+            const TransformComponents tc = decompose(data.matrices[i]);
+            data.translations[i] = tc.translation;
+            data.rotations[i] = tc.rotation;
+            data.scales[i] = tc.scale;
+        }
+        benchmark::DoNotOptimize(data.rotations.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_DecomposeBatch(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    TrsData data = makeTrsData(count);
+    for (auto _ : state) {
+        decompose(data.matrices, data.translations, data.rotations, data.scales);
+        benchmark::DoNotOptimize(data.rotations.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_DecomposeAffineBatch(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    TrsData data = makeTrsData(count);
+    // Add shear so the polar iteration does real work
+    for (std::size_t i = 0; i < count; ++i) {
+        data.matrices[i][1][0] += 0.3f;
+        data.matrices[i][2][1] -= 0.2f;
+    }
+    std::vector<AffineComponents> out(count);
+    for (auto _ : state) {
+        decomposeAffine(data.matrices, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_ComposeScalar)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_ComposeBatch)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_DecomposeScalar)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_DecomposeBatch)->RangeMultiplier(8)->Range(64, 262144);
+BENCHMARK(BM_DecomposeAffineBatch)->RangeMultiplier(8)->Range(64, 262144);
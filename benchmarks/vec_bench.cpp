@@ -0,0 +1,139 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include "bench_common.h"
+
+#include <vector>
+
+using namespace vne::math;
+using namespace vne::math::bench;
+
+namespace {
+
+constexpr std::uint32_t kSeed = 0x5EED0071u;
+
+/// Two input arrays and one output array of Vec3f, plus scalar and Vec4f lanes
+class VecFixture : public benchmark::Fixture {
+   public:
+    void SetUp(const benchmark::State& state) override {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        a = randomVecs<Vec3f>(count, kSeed);
+        b = randomVecs<Vec3f>(count, kSeed + 1);
+        a4 = randomVecs<Vec4f>(count, kSeed + 2);
+        out.assign(count, Vec3f::zero());
+        out4.assign(count, Vec4f::zero());
+        scalars.assign(count, 0.0f);
+    }
+
+    void TearDown(const benchmark::State&) override {
+        a = {};
+        b = {};
+        a4 = {};
+        out = {};
+        out4 = {};
+        scalars = {};
+    }
+
+    std::vector<Vec3f> a;
+    std::vector<Vec3f> b;
+    std::vector<Vec4f> a4;
+    std::vector<Vec3f> out;
+    std::vector<Vec4f> out4;
+    std::vector<float> scalars;
+};
+
+constexpr std::size_t kBinaryBytes = 3 * sizeof(Vec3f);
+constexpr std::size_t kReduceBytes = 2 * sizeof(Vec3f) + sizeof(float);
+constexpr std::size_t kUnaryBytes = 2 * sizeof(Vec3f);
+constexpr std::size_t kLengthBytes = sizeof(Vec3f) + sizeof(float);
+constexpr std::size_t kUnary4Bytes = 2 * sizeof(Vec4f);
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(VecFixture, Add)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            out[i] = a[i] + b[i];
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kBinaryBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(VecFixture, Dot)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            scalars[i] = a[i].dot(b[i]);
+        }
+        benchmark::DoNotOptimize(scalars.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kReduceBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(VecFixture, Cross)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            out[i] = a[i].cross(b[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kBinaryBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(VecFixture, Length)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            scalars[i] = a[i].length();
+        }
+        benchmark::DoNotOptimize(scalars.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kLengthBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(VecFixture, Normalize)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            out[i] = a[i].normalized();
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kUnaryBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(VecFixture, Lerp)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            out[i] = Vec3f::lerp(a[i], b[i], 0.25f);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kBinaryBytes>(state);
+}
+
+BENCHMARK_DEFINE_F(VecFixture, Normalize4)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a4.size(); ++i) {
+            out4[i] = a4[i].normalized();
+        }
+        benchmark::DoNotOptimize(out4.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<kUnary4Bytes>(state);
+}
+
+BENCHMARK_REGISTER_F(VecFixture, Add)->Apply(workingSets<kBinaryBytes>);
+BENCHMARK_REGISTER_F(VecFixture, Dot)->Apply(workingSets<kReduceBytes>);
+BENCHMARK_REGISTER_F(VecFixture, Cross)->Apply(workingSets<kBinaryBytes>);
+BENCHMARK_REGISTER_F(VecFixture, Length)->Apply(workingSets<kLengthBytes>);
+BENCHMARK_REGISTER_F(VecFixture, Normalize)->Apply(workingSets<kUnaryBytes>);
+BENCHMARK_REGISTER_F(VecFixture, Lerp)->Apply(workingSets<kBinaryBytes>);
+BENCHMARK_REGISTER_F(VecFixture, Normalize4)->Apply(workingSets<kUnary4Bytes>);
@@ -0,0 +1,413 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file affine.h
+ * @brief Templated compact 3x4 affine transform.
+ *
+ * This file provides an Affine3<T> class that stores only the top three rows
+ * of an affine 4x4 matrix. The implicit bottom row is always [0 0 0 1], so
+ * storage is 12 scalars (48 bytes for float) and concatenation needs 36
+ * multiplies instead of 64.
+ */
+
+#include "mat.h"
+#include "quat.h"
+#include "vec.h"
+
+#include <array>
+#include <cmath>
+#include <ostream>
+
+namespace vne::math {
+
+/**
+ * @class Affine3
+ * @brief A 3x4 affine transform (row-major storage, implicit [0 0 0 1] bottom row).
+ *
+ * @tparam T The scalar type (must satisfy FloatingPoint concept)
+ *
+ * Each row holds (linear row, translation component), so transforming a point
+ * is three 4-wide dot products against (p, 1). The memory layout matches the
+ * row-major float3x4 / VkTransformMatrixKHR convention used for GPU instance data.
+ *
+ * Semantics are identical to the equivalent Mat4: transforms compose
+ * right-to-left, i.e. (a * b).transformPoint(p) == a.transformPoint(b.transformPoint(p)).
+ *
+ * @example
+ * ```cpp
+ * Affine3f world = Affine3f::fromTrs(position, rotation, scale);
+ * Affine3f child_world = world * child_local;
+ * Vec3f p = child_world.transformPoint(Vec3f(0, 1, 0));
+ * Mat4f m = child_world.toMat4();
+ * ```
+ */
+template<typename T>
+    requires FloatingPoint<T>
+class Affine3 {
+   public:
+    using value_type = T;
+    using size_type = size_t;
+    using row_type = Vec<T, 4>;
+
+    /// @brief Row-major storage: rows[r] = (m_r0, m_r1, m_r2, t_r)
+    std::array<row_type, 3> rows{row_type(T(1), T(0), T(0), T(0)),
+                                 row_type(T(0), T(1), T(0), T(0)),
+                                 row_type(T(0), T(0), T(1), T(0))};
+
+   public:
+    // ========================================================================
+    // Constructors
+    // ========================================================================
+
+    /**
+     * @brief Default constructor, initializes to identity.
+     */
+    constexpr Affine3() noexcept = default;
+
+    /**
+     * @brief Constructs from three rows.
+     */
+    constexpr Affine3(const row_type& row0, const row_type& row1, const row_type& row2) noexcept
+        : rows{row0, row1, row2} {}
+
+    /**
+     * @brief Constructs from a linear part and a translation.
+     * @param linear The upper-left 3x3 (rotation/scale/shear)
+     * @param translation The translation
+     */
+    constexpr Affine3(const Mat<T, 3, 3>& linear, const Vec<T, 3>& translation) noexcept
+        : rows{row_type(linear[0][0], linear[1][0], linear[2][0], translation.x()),
+               row_type(linear[0][1], linear[1][1], linear[2][1], translation.y()),
+               row_type(linear[0][2], linear[1][2], linear[2][2], translation.z())} {}
+
+    /**
+     * @brief Constructs from a 4x4 matrix, dropping the bottom row.
+     *
+     * Lossless for affine matrices (bottom row [0 0 0 1]). Projective terms are discarded.
+     */
+    constexpr explicit Affine3(const Mat<T, 4, 4>& m) noexcept
+        : rows{row_type(m[0][0], m[1][0], m[2][0], m[3][0]),
+               row_type(m[0][1], m[1][1], m[2][1], m[3][1]),
+               row_type(m[0][2], m[1][2], m[2][2], m[3][2])} {}
+
+    // ========================================================================
+    // Static Factory Methods
+    // ========================================================================
+
+    /**
+     * @brief Returns the identity transform.
+     */
+    [[nodiscard]] static constexpr Affine3 identity() noexcept { return Affine3(); }
+
+    /**
+     * @brief Creates a pure translation.
+     */
+    [[nodiscard]] static constexpr Affine3 fromTranslation(const Vec<T, 3>& t) noexcept {
+        return Affine3(row_type(T(1), T(0), T(0), t.x()),
+                       row_type(T(0), T(1), T(0), t.y()),
+                       row_type(T(0), T(0), T(1), t.z()));
+    }
+
+    /**
+     * @brief Creates a non-uniform scale.
+     */
+    [[nodiscard]] static constexpr Affine3 fromScale(const Vec<T, 3>& s) noexcept {
+        return Affine3(row_type(s.x(), T(0), T(0), T(0)),
+                       row_type(T(0), s.y(), T(0), T(0)),
+                       row_type(T(0), T(0), s.z(), T(0)));
+    }
+
+    /**
+     * @brief Creates a rotation from a (normalized) quaternion.
+     */
+    [[nodiscard]] static constexpr Affine3 fromRotation(const Quat<T>& q) noexcept {
+        return fromTrs(Vec<T, 3>::zero(), q, Vec<T, 3>(T(1)));
+    }
+
+    /**
+     * @brief Creates T * R * S directly from components.
+     *
+     * Builds the rotation basis from the quaternion without an intermediate matrix.
+     *
+     * @param t Translation
+     * @param q Rotation (should be normalized)
+     * @param s Scale
+     */
+    [[nodiscard]] static constexpr Affine3 fromTrs(const Vec<T, 3>& t, const Quat<T>& q, const Vec<T, 3>& s) noexcept {
+        const T xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+        const T xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+        const T wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+        return Affine3(row_type((T(1) - T(2) * (yy + zz)) * s.x(),
+                                T(2) * (xy - wz) * s.y(),
+                                T(2) * (xz + wy) * s.z(),
+                                t.x()),
+                       row_type(T(2) * (xy + wz) * s.x(),
+                                (T(1) - T(2) * (xx + zz)) * s.y(),
+                                T(2) * (yz - wx) * s.z(),
+                                t.y()),
+                       row_type(T(2) * (xz - wy) * s.x(),
+                                T(2) * (yz + wx) * s.y(),
+                                (T(1) - T(2) * (xx + yy)) * s.z(),
+                                t.z()));
+    }
+
+    /**
+     * @brief Creates an affine transform from a 4x4 matrix (bottom row ignored).
+     */
+    [[nodiscard]] static constexpr Affine3 fromMat4(const Mat<T, 4, 4>& m) noexcept { return Affine3(m); }
+
+    // ========================================================================
+    // Element Access
+    // ========================================================================
+
+    /**
+     * @brief Accesses a row by index.
+     */
+    [[nodiscard]] constexpr row_type& operator[](size_type r) noexcept { return rows[r]; }
+
+    /**
+     * @brief Accesses a row by index (const).
+     */
+    [[nodiscard]] constexpr const row_type& operator[](size_type r) const noexcept { return rows[r]; }
+
+    /**
+     * @brief Returns the element at (row, col), col 3 being the translation.
+     */
+    [[nodiscard]] constexpr T at(size_type row, size_type col) const noexcept { return rows[row][col]; }
+
+    /**
+     * @brief Returns a pointer to the 12 contiguous scalars (row-major).
+     */
+    [[nodiscard]] constexpr T* ptr() noexcept { return rows[0].ptr(); }
+
+    /**
+     * @brief Returns a const pointer to the 12 contiguous scalars (row-major).
+     */
+    [[nodiscard]] constexpr const T* ptr() const noexcept { return rows[0].ptr(); }
+
+    /**
+     * @brief Gets the translation component.
+     */
+    [[nodiscard]] constexpr Vec<T, 3> translation() const noexcept {
+        return Vec<T, 3>(rows[0].w(), rows[1].w(), rows[2].w());
+    }
+
+    /**
+     * @brief Sets the translation component.
+     */
+    constexpr void setTranslation(const Vec<T, 3>& t) noexcept {
+        rows[0].w() = t.x();
+        rows[1].w() = t.y();
+        rows[2].w() = t.z();
+    }
+
+    /**
+     * @brief Gets basis column @p c (0 = X axis, 1 = Y axis, 2 = Z axis).
+     */
+    [[nodiscard]] constexpr Vec<T, 3> axis(size_type c) const noexcept {
+        return Vec<T, 3>(rows[0][c], rows[1][c], rows[2][c]);
+    }
+
+    /**
+     * @brief Returns the upper-left 3x3 (linear) part.
+     */
+    [[nodiscard]] constexpr Mat<T, 3, 3> linear() const noexcept { return Mat<T, 3, 3>(axis(0), axis(1), axis(2)); }
+
+    // ========================================================================
+    // Conversion
+    // ========================================================================
+
+    /**
+     * @brief Expands to a 4x4 matrix with bottom row [0 0 0 1]. Lossless.
+     */
+    [[nodiscard]] constexpr Mat<T, 4, 4> toMat4() const noexcept {
+        return Mat<T, 4, 4>(Vec<T, 4>(rows[0].x(), rows[1].x(), rows[2].x(), T(0)),
+                            Vec<T, 4>(rows[0].y(), rows[1].y(), rows[2].y(), T(0)),
+                            Vec<T, 4>(rows[0].z(), rows[1].z(), rows[2].z(), T(0)),
+                            Vec<T, 4>(rows[0].w(), rows[1].w(), rows[2].w(), T(1)));
+    }
+
+    // ========================================================================
+    // Properties
+    // ========================================================================
+
+    /**
+     * @brief Determinant of the linear part (equal to the 4x4 determinant).
+     */
+    [[nodiscard]] constexpr T determinant() const noexcept {
+        const row_type& a = rows[0];
+        const row_type& b = rows[1];
+        const row_type& c = rows[2];
+        return a.x() * (b.y() * c.z() - b.z() * c.y()) - a.y() * (b.x() * c.z() - b.z() * c.x())
+               + a.z() * (b.x() * c.y() - b.y() * c.x());
+    }
+
+    /**
+     * @brief Returns the general affine inverse.
+     *
+     * Inverts the 3x3 linear part by cofactors and maps the translation
+     * through it. Results are undefined for singular transforms.
+     */
+    [[nodiscard]] constexpr Affine3 inverse() const noexcept {
+        const row_type& a = rows[0];
+        const row_type& b = rows[1];
+        const row_type& c = rows[2];
+
+        // Cofactors of the linear part (transposed = adjugate)
+        const T c00 = b.y() * c.z() - b.z() * c.y();
+        const T c01 = b.z() * c.x() - b.x() * c.z();
+        const T c02 = b.x() * c.y() - b.y() * c.x();
+        const T c10 = a.z() * c.y() - a.y() * c.z();
+        const T c11 = a.x() * c.z() - a.z() * c.x();
+        const T c12 = a.y() * c.x() - a.x() * c.y();
+        const T c20 = a.y() * b.z() - a.z() * b.y();
+        const T c21 = a.z() * b.x() - a.x() * b.z();
+        const T c22 = a.x() * b.y() - a.y() * b.x();
+
+        const T inv_det = T(1) / (a.x() * c00 + a.y() * c01 + a.z() * c02);
+
+        const row_type r0(c00 * inv_det, c10 * inv_det, c20 * inv_det, T(0));
+        const row_type r1(c01 * inv_det, c11 * inv_det, c21 * inv_det, T(0));
+        const row_type r2(c02 * inv_det, c12 * inv_det, c22 * inv_det, T(0));
+        return withInverseTranslation(r0, r1, r2);
+    }
+
+    /**
+     * @brief Returns the inverse of a rigid transform (rotation + translation only).
+     *
+     * Transposes the rotation instead of inverting it. Only valid when the
+     * linear part is orthonormal; use inverse() for scaled or sheared transforms.
+     */
+    [[nodiscard]] constexpr Affine3 inverseRigid() const noexcept {
+        const row_type r0(rows[0].x(), rows[1].x(), rows[2].x(), T(0));
+        const row_type r1(rows[0].y(), rows[1].y(), rows[2].y(), T(0));
+        const row_type r2(rows[0].z(), rows[1].z(), rows[2].z(), T(0));
+        return withInverseTranslation(r0, r1, r2);
+    }
+
+    // ========================================================================
+    // Vector Transformation
+    // ========================================================================
+
+    /**
+     * @brief Transforms a point (applies translation).
+     */
+    [[nodiscard]] constexpr Vec<T, 3> transformPoint(const Vec<T, 3>& p) const noexcept {
+        return Vec<T, 3>(rows[0].x() * p.x() + rows[0].y() * p.y() + rows[0].z() * p.z() + rows[0].w(),
+                         rows[1].x() * p.x() + rows[1].y() * p.y() + rows[1].z() * p.z() + rows[1].w(),
+                         rows[2].x() * p.x() + rows[2].y() * p.y() + rows[2].z() * p.z() + rows[2].w());
+    }
+
+    /**
+     * @brief Transforms a direction vector (ignores translation).
+     */
+    [[nodiscard]] constexpr Vec<T, 3> transformVector(const Vec<T, 3>& v) const noexcept {
+        return Vec<T, 3>(rows[0].x() * v.x() + rows[0].y() * v.y() + rows[0].z() * v.z(),
+                         rows[1].x() * v.x() + rows[1].y() * v.y() + rows[1].z() * v.z(),
+                         rows[2].x() * v.x() + rows[2].y() * v.y() + rows[2].z() * v.z());
+    }
+
+    /**
+     * @brief Transforms a surface normal by the inverse transpose of the linear part.
+     *
+     * Correct under non-uniform scale and shear. The result is not normalized.
+     */
+    [[nodiscard]] constexpr Vec<T, 3> transformNormal(const Vec<T, 3>& n) const noexcept {
+        // inverse-transpose * n == (inverse rows as columns) * n
+        const Affine3 inv = inverse();
+        return Vec<T, 3>(inv.rows[0].x() * n.x() + inv.rows[1].x() * n.y() + inv.rows[2].x() * n.z(),
+                         inv.rows[0].y() * n.x() + inv.rows[1].y() * n.y() + inv.rows[2].y() * n.z(),
+                         inv.rows[0].z() * n.x() + inv.rows[1].z() * n.y() + inv.rows[2].z() * n.z());
+    }
+
+    // ========================================================================
+    // Comparison
+    // ========================================================================
+
+    /**
+     * @brief Checks if two transforms are approximately equal.
+     */
+    [[nodiscard]] constexpr bool approxEquals(const Affine3& other, T epsilon = defaultEpsilon<T>()) const noexcept {
+        return rows[0].approxEquals(other.rows[0], epsilon) && rows[1].approxEquals(other.rows[1], epsilon)
+               && rows[2].approxEquals(other.rows[2], epsilon);
+    }
+
+    [[nodiscard]] constexpr bool operator==(const Affine3& other) const noexcept = default;
+
+    // ========================================================================
+    // Composition
+    // ========================================================================
+
+    /**
+     * @brief Concatenates two affine transforms (this applied after @p o).
+     *
+     * 36 multiplies: 27 for the linear part and 9 for the translation.
+     */
+    [[nodiscard]] constexpr Affine3 operator*(const Affine3& o) const noexcept {
+        Affine3 result;
+        for (size_type r = 0; r < 3; ++r) {
+            const row_type& a = rows[r];
+            result.rows[r] = row_type(a.x() * o.rows[0].x() + a.y() * o.rows[1].x() + a.z() * o.rows[2].x(),
+                                      a.x() * o.rows[0].y() + a.y() * o.rows[1].y() + a.z() * o.rows[2].y(),
+                                      a.x() * o.rows[0].z() + a.y() * o.rows[1].z() + a.z() * o.rows[2].z(),
+                                      a.x() * o.rows[0].w() + a.y() * o.rows[1].w() + a.z() * o.rows[2].w() + a.w());
+        }
+        return result;
+    }
+
+    constexpr Affine3& operator*=(const Affine3& o) noexcept { return *this = *this * o; }
+
+    // ========================================================================
+    // Stream Output
+    // ========================================================================
+
+    friend std::ostream& operator<<(std::ostream& os, const Affine3& a) {
+        return os << "[" << a.rows[0] << ", " << a.rows[1] << ", " << a.rows[2] << "]";
+    }
+
+   private:
+    /// Fills in translation -L^-1 * t given the rows of L^-1.
+    [[nodiscard]] constexpr Affine3 withInverseTranslation(row_type r0, row_type r1, row_type r2) const noexcept {
+        const T tx = rows[0].w();
+        const T ty = rows[1].w();
+        const T tz = rows[2].w();
+        r0.w() = -(r0.x() * tx + r0.y() * ty + r0.z() * tz);
+        r1.w() = -(r1.x() * tx + r1.y() * ty + r1.z() * tz);
+        r2.w() = -(r2.x() * tx + r2.y() * ty + r2.z() * tz);
+        return Affine3(r0, r1, r2);
+    }
+};
+
+// ============================================================================
+// Free Function Operators
+// ============================================================================
+
+/**
+ * @brief Mat4 * Affine3 (widens the affine transform).
+ */
+template<typename T>
+    requires FloatingPoint<T>
+[[nodiscard]] constexpr Mat<T, 4, 4> operator*(const Mat<T, 4, 4>& m, const Affine3<T>& a) noexcept {
+    return m * a.toMat4();
+}
+
+/**
+ * @brief Affine3 * Mat4 (widens the affine transform).
+ */
+template<typename T>
+    requires FloatingPoint<T>
+[[nodiscard]] constexpr Mat<T, 4, 4> operator*(const Affine3<T>& a, const Mat<T, 4, 4>& m) noexcept {
+    return a.toMat4() * m;
+}
+
+}  // namespace vne::math
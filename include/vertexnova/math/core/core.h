@@ -18,11 +18,13 @@
  * - Vec<T, N>: N-dimensional vectors
  * - Mat<T, R, C>: R x C matrices
  * - Quat<T>: Quaternions for rotations
+ * - Affine3<T>: Compact 3x4 affine transforms
  *
  * Type aliases are provided for common use cases:
  * - Vec2f, Vec3f, Vec4f, Vec2d, Vec3d, Vec4d, Vec2i, Vec3i, Vec4i
  * - Mat2f, Mat3f, Mat4f, Mat2d, Mat3d, Mat4d
  * - Quatf, Quatd
+ * - Affine3f, Affine3d
  *
  * Graphics API support is built-in for:
  * - OpenGL (depth [-1,1], right-handed, Y-up)
@@ -58,6 +60,7 @@
 #include "vec.h"
 #include "mat.h"
 #include "quat.h"
+#include "affine.h"
 
 namespace vne::math {
 
@@ -568,6 +568,20 @@ class Mat {
         return lookAtRH(eye, center, up);
     }
 
+    /**
+     * @brief Creates a view matrix using the handedness of an API fixed at compile time.
+     */
+    template<GraphicsApi Api>
+    [[nodiscard]] static Mat lookAt(const Vec<T, 3>& eye, const Vec<T, 3>& center, const Vec<T, 3>& up) noexcept
+        requires(R == 4 && C == 4)
+    {
+        if constexpr (GraphicsApiTraits<Api>::kHandedness == Handedness::eLeft) {
+            return lookAtLH(eye, center, up);
+        } else {
+            return lookAtRH(eye, center, up);
+        }
+    }
+
     // ========================================================================
     // Projection Matrix Factories (4x4 Only)
     // ========================================================================
@@ -608,40 +622,190 @@ class Mat {
         return glm::perspectiveLH_NO(fovy, aspect, z_near, z_far);
     }
 
+    /**
+     * @brief Shared part of the infinite perspective builders.
+     * @param z_sign -1 for right-handed (view looks down -Z), +1 for left-handed
+     */
+    [[nodiscard]] static Mat perspectiveInfiniteBase(T fovy, T aspect, T z_sign) noexcept
+        requires(R == 4 && C == 4)
+    {
+        const T focal = T(1) / std::tan(fovy / T(2));
+        Mat result = zero();
+        result[0][0] = focal / aspect;
+        result[1][1] = focal;
+        result[2][2] = z_sign;
+        result[2][3] = z_sign;
+        return result;
+    }
+
+    /**
+     * @brief Creates a right-handed perspective matrix with [0,1] depth range and no far plane.
+     */
+    [[nodiscard]] static Mat perspectiveInfiniteRH_ZO(T fovy, T aspect, T z_near) noexcept
+        requires(R == 4 && C == 4)
+    {
+        Mat result = perspectiveInfiniteBase(fovy, aspect, T(-1));
+        result[3][2] = -z_near;
+        return result;
+    }
+
+    /**
+     * @brief Creates a right-handed perspective matrix with [-1,1] depth range and no far plane.
+     */
+    [[nodiscard]] static Mat perspectiveInfiniteRH_NO(T fovy, T aspect, T z_near) noexcept
+        requires(R == 4 && C == 4)
+    {
+        Mat result = perspectiveInfiniteBase(fovy, aspect, T(-1));
+        result[3][2] = T(-2) * z_near;
+        return result;
+    }
+
+    /**
+     * @brief Creates a left-handed perspective matrix with [0,1] depth range and no far plane.
+     */
+    [[nodiscard]] static Mat perspectiveInfiniteLH_ZO(T fovy, T aspect, T z_near) noexcept
+        requires(R == 4 && C == 4)
+    {
+        Mat result = perspectiveInfiniteBase(fovy, aspect, T(1));
+        result[3][2] = -z_near;
+        return result;
+    }
+
+    /**
+     * @brief Creates a left-handed perspective matrix with [-1,1] depth range and no far plane.
+     */
+    [[nodiscard]] static Mat perspectiveInfiniteLH_NO(T fovy, T aspect, T z_near) noexcept
+        requires(R == 4 && C == 4)
+    {
+        Mat result = perspectiveInfiniteBase(fovy, aspect, T(1));
+        result[3][2] = T(-2) * z_near;
+        return result;
+    }
+
     /**
      * @brief Creates a perspective matrix for the specified graphics API.
      * @param fovy Field of view in radians
      * @param aspect Aspect ratio (width / height)
      * @param z_near Near clipping plane
-     * @param z_far Far clipping plane
+     * @param z_far Far clipping plane (ignored for infinite depth modes)
      * @param api Target graphics API
+     * @param mode Depth orientation and far-plane placement
      * @return The projection matrix
      */
-    [[nodiscard]] static Mat perspective(
-        T fovy, T aspect, T z_near, T z_far, GraphicsApi api = GraphicsApi::eVulkan) noexcept
+    [[nodiscard]] static Mat perspective(T fovy,
+                                         T aspect,
+                                         T z_near,
+                                         T z_far,
+                                         GraphicsApi api = GraphicsApi::eVulkan,
+                                         DepthMode mode = DepthMode::eStandard) noexcept
         requires(R == 4 && C == 4)
     {
-        bool left_handed = getHandedness(api) == Handedness::eLeft;
-        bool zero_to_one = getClipSpaceDepth(api) == ClipSpaceDepth::eZeroToOne;
+        return dispatchGraphicsApi(api, [&](auto tag) {
+            constexpr GraphicsApi kApi = decltype(tag)::value;
+            switch (mode) {
+                case DepthMode::eReversed:
+                    return perspective<kApi, DepthMode::eReversed>(fovy, aspect, z_near, z_far);
+                case DepthMode::eInfinite:
+                    return perspective<kApi, DepthMode::eInfinite>(fovy, aspect, z_near, z_far);
+                case DepthMode::eInfiniteReversed:
+                    return perspective<kApi, DepthMode::eInfiniteReversed>(fovy, aspect, z_near, z_far);
+                default:
+                    return perspective<kApi, DepthMode::eStandard>(fovy, aspect, z_near, z_far);
+            }
+        });
+    }
+
+    /**
+     * @brief Creates a perspective matrix for a graphics API fixed at compile time.
+     *
+     * Handedness, depth range and Y-flip come from GraphicsApiTraits, so the
+     * result is a single branch-free factory call.
+     *
+     * Reverse-Z modes remap clip z to w - z for [0,1] depth and to -z for
+     * [-1,1] depth, so near lands on the high end of the range. OpenGL only
+     * gains the precision benefit when the context uses glClipControl with
+     * GL_ZERO_TO_ONE and the matrix is built for a [0,1] API.
+     *
+     * @code
+     * Mat4f proj = Mat4f::perspective<GraphicsApi::eVulkan>(fovy, aspect, 0.1f, 100.0f);
+     * Mat4f rz = Mat4f::perspective<GraphicsApi::eVulkan, DepthMode::eInfiniteReversed>(fovy, aspect, 0.1f, 0.0f);
+     * @endcode
+     */
+    template<GraphicsApi Api, DepthMode Mode = DepthMode::eStandard>
+    [[nodiscard]] static Mat perspective(T fovy, T aspect, T z_near, T z_far) noexcept
+        requires(R == 4 && C == 4)
+    {
+        using Traits = GraphicsApiTraits<Api>;
+        constexpr bool kZeroToOne = Traits::kDepth == ClipSpaceDepth::eZeroToOne;
 
         Mat result;
-        if (left_handed) {
-            result = zero_to_one ? perspectiveLH_ZO(fovy, aspect, z_near, z_far)
-                                 : perspectiveLH_NO(fovy, aspect, z_near, z_far);
+        if constexpr (hasInfiniteFar(Mode)) {
+            if constexpr (Traits::kHandedness == Handedness::eLeft) {
+                result = kZeroToOne ? perspectiveInfiniteLH_ZO(fovy, aspect, z_near)
+                                    : perspectiveInfiniteLH_NO(fovy, aspect, z_near);
+            } else {
+                result = kZeroToOne ? perspectiveInfiniteRH_ZO(fovy, aspect, z_near)
+                                    : perspectiveInfiniteRH_NO(fovy, aspect, z_near);
+            }
+        } else if constexpr (Traits::kHandedness == Handedness::eLeft) {
+            result = kZeroToOne ? perspectiveLH_ZO(fovy, aspect, z_near, z_far)
+                                : perspectiveLH_NO(fovy, aspect, z_near, z_far);
         } else {
-            result = zero_to_one ? perspectiveRH_ZO(fovy, aspect, z_near, z_far)
-                                 : perspectiveRH_NO(fovy, aspect, z_near, z_far);
+            result = kZeroToOne ? perspectiveRH_ZO(fovy, aspect, z_near, z_far)
+                                : perspectiveRH_NO(fovy, aspect, z_near, z_far);
+        }
+
+        if constexpr (isReversedDepth(Mode)) {
+            for (size_type c = 0; c < 4; ++c) {
+                result[c][2] = kZeroToOne ? result[c][3] - result[c][2] : -result[c][2];
+            }
         }
 
         // Apply projection Y-flip only for Vulkan (NDC Y-down).
         // Metal/DirectX/WebGPU have NDC Y-up, so no flip needed.
-        if (needsProjectionYFlip(api)) {
+        if constexpr (Traits::kProjectionYFlip) {
             result[1][1] *= T(-1);
         }
 
         return result;
     }
 
+    /**
+     * @brief Creates a reverse-Z perspective matrix (near -> 1, far -> 0 for [0,1] depth).
+     */
+    [[nodiscard]] static Mat perspectiveReverseZ(
+        T fovy, T aspect, T z_near, T z_far, GraphicsApi api = GraphicsApi::eVulkan) noexcept
+        requires(R == 4 && C == 4)
+    {
+        return perspective(fovy, aspect, z_near, z_far, api, DepthMode::eReversed);
+    }
+
+    /**
+     * @brief Creates a perspective matrix with the far plane at infinity.
+     */
+    [[nodiscard]] static Mat perspectiveInfinite(T fovy,
+                                                 T aspect,
+                                                 T z_near,
+                                                 GraphicsApi api = GraphicsApi::eVulkan) noexcept
+        requires(R == 4 && C == 4)
+    {
+        return perspective(fovy, aspect, z_near, T(0), api, DepthMode::eInfinite);
+    }
+
+    /**
+     * @brief Creates a reverse-Z perspective matrix with the far plane at infinity.
+     *
+     * For [0,1] depth this maps view distance d to depth z_near / d.
+     */
+    [[nodiscard]] static Mat perspectiveInfiniteReverseZ(T fovy,
+                                                         T aspect,
+                                                         T z_near,
+                                                         GraphicsApi api = GraphicsApi::eVulkan) noexcept
+        requires(R == 4 && C == 4)
+    {
+        return perspective(fovy, aspect, z_near, T(0), api, DepthMode::eInfiniteReversed);
+    }
+
     /**
      * @brief Creates a right-handed orthographic matrix with [0,1] depth range.
      */
@@ -685,22 +849,37 @@ class Mat {
         T left, T right, T bottom, T top, T z_near, T z_far, GraphicsApi api = GraphicsApi::eVulkan) noexcept
         requires(R == 4 && C == 4)
     {
-        bool left_handed = getHandedness(api) == Handedness::eLeft;
-        bool zero_to_one = getClipSpaceDepth(api) == ClipSpaceDepth::eZeroToOne;
+        return dispatchGraphicsApi(api, [&](auto tag) {
+            return ortho<decltype(tag)::value>(left, right, bottom, top, z_near, z_far);
+        });
+    }
+
+    /**
+     * @brief Creates an orthographic matrix for a graphics API fixed at compile time.
+     */
+    template<GraphicsApi Api>
+    [[nodiscard]] static Mat ortho(T left, T right, T bottom, T top, T z_near, T z_far) noexcept
+        requires(R == 4 && C == 4)
+    {
+        using Traits = GraphicsApiTraits<Api>;
+        constexpr bool kZeroToOne = Traits::kDepth == ClipSpaceDepth::eZeroToOne;
 
         Mat result;
-        if (left_handed) {
-            result = zero_to_one ? orthoLH_ZO(left, right, bottom, top, z_near, z_far)
-                                 : orthoLH_NO(left, right, bottom, top, z_near, z_far);
+        if constexpr (Traits::kHandedness == Handedness::eLeft) {
+            result = kZeroToOne ? orthoLH_ZO(left, right, bottom, top, z_near, z_far)
+                                : orthoLH_NO(left, right, bottom, top, z_near, z_far);
         } else {
-            result = zero_to_one ? orthoRH_ZO(left, right, bottom, top, z_near, z_far)
-                                 : orthoRH_NO(left, right, bottom, top, z_near, z_far);
+            result = kZeroToOne ? orthoRH_ZO(left, right, bottom, top, z_near, z_far)
+                                : orthoRH_NO(left, right, bottom, top, z_near, z_far);
         }
 
         // Apply projection Y-flip only for Vulkan (NDC Y-down).
         // Metal/DirectX/WebGPU have NDC Y-up, so no flip needed.
-        if (needsProjectionYFlip(api)) {
-            result[1][1] *= T(-1);
+        // Negate the whole Y row: off-center windows carry a Y translation.
+        if constexpr (Traits::kProjectionYFlip) {
+            for (size_type c = 0; c < 4; ++c) {
+                result[c][1] *= T(-1);
+            }
         }
 
         return result;
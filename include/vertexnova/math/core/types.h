@@ -69,6 +69,36 @@ enum class ClipSpaceDepth : uint8_t {
     eZeroToOne          ///< [0, 1] - Vulkan/Metal/DirectX/WebGPU convention
 };
 
+/**
+ * @enum DepthMode
+ * @brief Specifies how a perspective projection distributes depth.
+ *
+ * Reverse-Z maps the near plane to the high end of the depth range and the
+ * far plane to the low end, which pairs floating-point precision with the
+ * perspective divide. With an infinite far plane, depth approaches the far
+ * end asymptotically and no far clipping plane exists.
+ */
+enum class DepthMode : uint8_t {
+    eStandard,         ///< Near at the low end of the depth range, finite far plane
+    eReversed,         ///< Near at the high end (reverse-Z), finite far plane
+    eInfinite,         ///< Near at the low end, far plane at infinity
+    eInfiniteReversed  ///< Reverse-Z with the far plane at infinity
+};
+
+/**
+ * @brief Returns true if the depth mode maps near to the high end of the depth range.
+ */
+[[nodiscard]] constexpr bool isReversedDepth(DepthMode mode) noexcept {
+    return mode == DepthMode::eReversed || mode == DepthMode::eInfiniteReversed;
+}
+
+/**
+ * @brief Returns true if the depth mode places the far plane at infinity.
+ */
+[[nodiscard]] constexpr bool hasInfiniteFar(DepthMode mode) noexcept {
+    return mode == DepthMode::eInfinite || mode == DepthMode::eInfiniteReversed;
+}
+
 /**
  * @enum Handedness
  * @brief Specifies the coordinate system handedness.
@@ -255,6 +285,53 @@ struct GraphicsApiTraits<GraphicsApi::eWebGPU> {
     }
 }
 
+// ============================================================================
+// Compile-time API Dispatch
+// ============================================================================
+
+/**
+ * @brief Tag type carrying a GraphicsApi as a compile-time constant.
+ */
+template<GraphicsApi Api>
+using GraphicsApiTag = std::integral_constant<GraphicsApi, Api>;
+
+/**
+ * @brief Calls @p fn with the GraphicsApiTag matching a runtime API value.
+ *
+ * Bridges code that only knows the API at runtime to the compile-time
+ * overloads: the switch happens once here instead of inside every routine.
+ *
+ * @code
+ * Mat4f proj = dispatchGraphicsApi(api, [&](auto tag) {
+ *     return Mat4f::perspective<decltype(tag)::value>(fovy, aspect, z_near, z_far);
+ * });
+ * @endcode
+ *
+ * Every instantiation of @p fn must return the same type. Values outside
+ * the enumeration dispatch as OpenGL. The runtime trait queries have no
+ * single fallback API for such values (getClipSpaceDepth() reports [0,1]
+ * depth, screenOriginIsTopLeft() a bottom-left origin), so results for them
+ * differ from those queries; pass only enumerated values.
+ */
+template<typename Fn>
+constexpr decltype(auto) dispatchGraphicsApi(GraphicsApi api, Fn&& fn) noexcept(
+    noexcept(fn(GraphicsApiTag<GraphicsApi::eOpenGL>{})) && noexcept(fn(GraphicsApiTag<GraphicsApi::eVulkan>{}))
+    && noexcept(fn(GraphicsApiTag<GraphicsApi::eMetal>{})) && noexcept(fn(GraphicsApiTag<GraphicsApi::eDirectX>{}))
+    && noexcept(fn(GraphicsApiTag<GraphicsApi::eWebGPU>{}))) {
+    switch (api) {
+        case GraphicsApi::eVulkan:
+            return fn(GraphicsApiTag<GraphicsApi::eVulkan>{});
+        case GraphicsApi::eMetal:
+            return fn(GraphicsApiTag<GraphicsApi::eMetal>{});
+        case GraphicsApi::eDirectX:
+            return fn(GraphicsApiTag<GraphicsApi::eDirectX>{});
+        case GraphicsApi::eWebGPU:
+            return fn(GraphicsApiTag<GraphicsApi::eWebGPU>{});
+        default:
+            return fn(GraphicsApiTag<GraphicsApi::eOpenGL>{});
+    }
+}
+
 // ============================================================================
 // C++20 Concepts
 // ============================================================================
@@ -303,6 +380,10 @@ template<typename T>
     requires FloatingPoint<T>
 class Quat;
 
+template<typename T>
+    requires FloatingPoint<T>
+class Affine3;
+
 // ============================================================================
 // Vector Type Aliases
 // ============================================================================
@@ -382,6 +463,13 @@ using Mat4x4f = Mat4f;
 using Quatf = Quat<float>;
 using Quatd = Quat<double>;
 
+// ============================================================================
+// Affine Transform Type Aliases
+// ============================================================================
+
+using Affine3f = Affine3<float>;
+using Affine3d = Affine3<double>;
+
 // ============================================================================
 // Core Math Constants (Required by vec.h, mat.h, quat.h)
 // ============================================================================
@@ -0,0 +1,115 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Runtime CPU feature detection and SIMD level selection for the batch APIs.
+ * ----------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace vne::math {
+
+/**
+ * @enum SimdLevel
+ * @brief Instruction set used by the batch kernels, lowest first within each architecture.
+ *
+ * The batch APIs (transformAabbs(), compose(), decompose(), decomposeAffine()
+ * and the batch Frustum intersects()) are built once per level and routed at
+ * run time, so one binary uses the best kernels the CPU offers.
+ */
+enum class SimdLevel : uint8_t {
+    eScalar,  ///< Portable C++; always available
+    eSse2,    ///< x86-64 baseline
+    eSse42,   ///< SSE4.2: blend instructions for lane selects
+    eAvx2,    ///< AVX2 and FMA: VEX encoding, fused multiply-add
+    eAvx512,  ///< AVX-512F and VL: EVEX encoding, 32 vector registers
+    eNeon     ///< AArch64 Advanced SIMD
+};
+
+/**
+ * @struct CpuFeatures
+ * @brief Instruction set extensions reported by the CPU and enabled by the OS.
+ */
+struct CpuFeatures {
+    bool sse2{false};      ///< SSE2
+    bool sse41{false};     ///< SSE4.1
+    bool sse42{false};     ///< SSE4.2
+    bool avx{false};       ///< AVX, with OS support for the YMM state
+    bool avx2{false};      ///< AVX2, with OS support for the YMM state
+    bool fma{false};       ///< FMA3, with OS support for the YMM state
+    bool avx512f{false};   ///< AVX-512 Foundation, with OS support for the ZMM state
+    bool avx512vl{false};  ///< AVX-512 Vector Length extensions
+    bool neon{false};      ///< AArch64 Advanced SIMD
+};
+
+/**
+ * @brief Features of the running CPU, detected once on first call.
+ */
+[[nodiscard]] const CpuFeatures& cpuFeatures() noexcept;
+
+/**
+ * @brief True if the CPU supports @p level and this build contains kernels for it.
+ */
+[[nodiscard]] bool isSimdLevelSupported(SimdLevel level) noexcept;
+
+/**
+ * @brief Highest level supported by both the CPU and this build.
+ */
+[[nodiscard]] SimdLevel bestSimdLevel() noexcept;
+
+/**
+ * @brief Level the batch APIs currently use.
+ *
+ * Chosen on first use: bestSimdLevel(), lowered to the VNE_MATH_SIMD
+ * environment variable when that names a level (scalar, sse2, sse4.2, avx2,
+ * avx512, neon). A request above what the machine supports falls back to the
+ * best supported level below it; unknown values are ignored.
+ */
+[[nodiscard]] SimdLevel activeSimdLevel() noexcept;
+
+/**
+ * @brief Routes the batch APIs to @p level.
+ *
+ * Intended for tests and benchmarks that compare the paths; switching while
+ * another thread runs a batch API is safe, the call in flight finishes on the
+ * kernels it started with.
+ *
+ * @return false, leaving the level unchanged, if @p level is not supported
+ */
+bool setSimdLevel(SimdLevel level) noexcept;
+
+/**
+ * @brief Parses a level name as accepted by VNE_MATH_SIMD (case-insensitive).
+ *
+ * "sse42" is accepted as an alias of "sse4.2" and "avx512f" of "avx512".
+ */
+[[nodiscard]] std::optional<SimdLevel> parseSimdLevel(std::string_view name) noexcept;
+
+/**
+ * @brief Returns the VNE_MATH_SIMD spelling of a level.
+ */
+[[nodiscard]] constexpr const char* simdLevelName(SimdLevel level) noexcept {
+    switch (level) {
+        case SimdLevel::eScalar:
+            return "scalar";
+        case SimdLevel::eSse2:
+            return "sse2";
+        case SimdLevel::eSse42:
+            return "sse4.2";
+        case SimdLevel::eAvx2:
+            return "avx2";
+        case SimdLevel::eAvx512:
+            return "avx512";
+        case SimdLevel::eNeon:
+            return "neon";
+        default:
+            return "unknown";
+    }
+}
+
+}  // namespace vne::math
@@ -17,10 +17,12 @@
 
 // Project includes
 #include "vertexnova/math/core/constants.h"
+#include "vertexnova/math/core/mat.h"
 #include "vertexnova/math/core/vec.h"
 
 // Standard library includes
 #include <ostream>
+#include <span>
 
 namespace vne::math {
 
@@ -184,6 +186,19 @@ class Aabb {
      */
     void translate(const Vec3f& offset) noexcept;
 
+    /**
+     * @brief Computes the AABB bounding this box after an affine transform
+     *
+     * Uses Arvo's method: the center is transformed as a point and the
+     * half-extents by the absolute value of the upper 3x3, which gives the
+     * same box as transforming all eight corners. An invalid AABB is
+     * returned unchanged.
+     *
+     * @param matrix Affine transform (the bottom row is ignored)
+     * @return The transformed bounds
+     */
+    [[nodiscard]] Aabb transformed(const Mat4f& matrix) const noexcept;
+
     /**
      * @brief Resets the AABB to invalid state
      */
@@ -251,4 +266,17 @@ class Aabb {
     Vec3f max_;  ///< Maximum corner of the AABB
 };
 
+/**
+ * @brief Transforms many AABBs, each by its own matrix
+ *
+ * Equivalent to out[i] = boxes[i].transformed(matrices[i]), processing four
+ * boxes per iteration with the SIMD level picked at run time (see
+ * activeSimdLevel()). @p out may alias @p boxes.
+ *
+ * @param boxes Local-space bounds
+ * @param matrices One affine transform per box
+ * @param out Receives the transformed bounds
+ */
+void transformAabbs(std::span<const Aabb> boxes, std::span<const Mat4f> matrices, std::span<Aabb> out) noexcept;
+
 }  // namespace vne::math
@@ -0,0 +1,157 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Contact manifolds (points, normal and depths) for box, capsule and
+ * sphere pairs, for narrowphase collision response.
+ * ----------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include "../core/vec.h"
+#include "capsule.h"
+#include "obb.h"
+#include "sphere.h"
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace vne::math {
+
+// ============================================================================
+// Manifold
+// ============================================================================
+
+/**
+ * @struct ContactPoint
+ * @brief One point of a contact manifold.
+ */
+struct ContactPoint {
+    Vec3f position{Vec3f::zero()};  ///< Point on the surface of B
+    float depth{0.0f};              ///< Penetration along the manifold normal (>= 0)
+};
+
+/**
+ * @struct ContactManifold
+ * @brief Contact points of one overlapping pair, sharing a single normal.
+ *
+ * The capacity is fixed, so manifolds can be stored in plain arrays and
+ * filled without allocating. The normal points from A to B: moving B by
+ * normal * depth resolves a point, and the matching point on A is
+ * position + normal * depth.
+ */
+struct ContactManifold {
+    static constexpr uint32_t kMaxPoints = 4;  ///< Enough for a box face resting on another
+
+    std::array<ContactPoint, kMaxPoints> points{};  ///< Contact points, the first count are valid
+    Vec3f normal{Vec3f::zero()};                    ///< Unit direction from A to B
+    uint32_t count{0};                              ///< Number of valid points
+
+    /// Removes all points
+    void clear() noexcept { count = 0; }
+
+    /// True if the pair is not touching
+    [[nodiscard]] bool empty() const noexcept { return count == 0; }
+
+    /// Appends a point; ignored once the manifold is full
+    void addPoint(const Vec3f& position, float depth) noexcept {
+        if (count < kMaxPoints) {
+            points[count++] = ContactPoint{position, depth};
+        }
+    }
+
+    /// The valid points
+    [[nodiscard]] std::span<const ContactPoint> contacts() const noexcept { return {points.data(), count}; }
+};
+
+// ============================================================================
+// Pair Queries
+// ============================================================================
+
+/**
+ * @brief Box-box contacts.
+ *
+ * Separating Axis Theorem over the 15 axes, keeping the axis of least
+ * penetration (face axes are preferred unless an edge axis is clearly
+ * better). For a face axis the most anti-parallel face of the other box is
+ * clipped against the side planes of the reference face and reduced to at
+ * most four points; for an edge axis the closest points of the two edges give
+ * a single contact.
+ *
+ * @param a First box
+ * @param b Second box
+ * @param out Receives the manifold (cleared first)
+ * @return True if the boxes touch
+ */
+bool generateContacts(const Obb& a, const Obb& b, ContactManifold& out) noexcept;
+
+/**
+ * @brief Capsule-capsule contacts from the closest points of the two segments.
+ *
+ * Parallel, overlapping capsules get two points at the ends of the overlap so
+ * that they can rest on each other without rolling.
+ */
+bool generateContacts(const Capsule& a, const Capsule& b, ContactManifold& out) noexcept;
+
+/**
+ * @brief Sphere-box contact: one point, from the closest point on the box or,
+ * with the center inside the box, from the nearest face.
+ */
+bool generateContacts(const Sphere& a, const Obb& b, ContactManifold& out) noexcept;
+
+/**
+ * @brief Capsule-box contacts.
+ *
+ * The segment-box distance (or, with the segment inside the box, the
+ * penetration depth) comes from GJK / EPA. When the normal is a box face
+ * normal the segment is clipped to that face, which gives two points for a
+ * capsule lying on the face.
+ */
+bool generateContacts(const Capsule& a, const Obb& b, ContactManifold& out) noexcept;
+
+// ============================================================================
+// Batch Queries
+// ============================================================================
+
+/**
+ * @struct ContactPair
+ * @brief Indices of a candidate pair, as produced by a broadphase.
+ */
+struct ContactPair {
+    uint32_t a{0};  ///< Index into the A shapes
+    uint32_t b{0};  ///< Index into the B shapes
+};
+
+/**
+ * @brief Generates a manifold for every candidate pair.
+ *
+ * out[i] receives the manifold of pairs[i]; pairs that do not touch get an
+ * empty manifold. For pairs within one set pass the same span as A and B.
+ *
+ * @param shapes_a Shapes indexed by ContactPair::a
+ * @param shapes_b Shapes indexed by ContactPair::b
+ * @param pairs Candidate pairs
+ * @param out Receives one manifold per pair
+ * @return Number of touching pairs
+ */
+size_t generateContacts(std::span<const Obb> shapes_a,
+                        std::span<const Obb> shapes_b,
+                        std::span<const ContactPair> pairs,
+                        std::span<ContactManifold> out) noexcept;
+size_t generateContacts(std::span<const Capsule> shapes_a,
+                        std::span<const Capsule> shapes_b,
+                        std::span<const ContactPair> pairs,
+                        std::span<ContactManifold> out) noexcept;
+size_t generateContacts(std::span<const Sphere> shapes_a,
+                        std::span<const Obb> shapes_b,
+                        std::span<const ContactPair> pairs,
+                        std::span<ContactManifold> out) noexcept;
+size_t generateContacts(std::span<const Capsule> shapes_a,
+                        std::span<const Obb> shapes_b,
+                        std::span<const ContactPair> pairs,
+                        std::span<ContactManifold> out) noexcept;
+
+}  // namespace vne::math
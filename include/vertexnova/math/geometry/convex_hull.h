@@ -0,0 +1,175 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Convex hulls of point sets: Andrew's monotone chain in 2D and quickhull
+ * in 3D, with reusable working memory so repeated builds do not allocate.
+ * ----------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "../core/vec.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace vne::math {
+
+// ============================================================================
+// Working Memory
+// ============================================================================
+
+/**
+ * @class HullScratch
+ * @brief Working memory reused across convex hull builds.
+ *
+ * Buffers are cleared, never freed, between builds: once a scratch has seen
+ * an input of a given size and shape, later builds of that size or smaller
+ * do not touch the heap. Not thread-safe; keep one per thread.
+ *
+ * @code
+ * HullScratch scratch;
+ * ConvexHull hull;
+ * for (const auto& mesh : meshes) {
+ *     convexHull(mesh.positions, hull, scratch);  // Allocates only while the buffers grow
+ *     proxies.push_back(makeProxy(mesh.positions, hull));
+ * }
+ * @endcode
+ */
+class HullScratch {
+   public:
+    HullScratch() = default;
+
+    /**
+     * @brief Pre-sizes the per-point buffers for inputs of up to @p point_count points.
+     *
+     * Face buffers depend on the hull size and still grow on first use.
+     */
+    void reserve(size_t point_count);
+
+    /// Bytes currently held by the buffers
+    [[nodiscard]] size_t capacity() const noexcept;
+
+   private:
+    /// Triangle of the 3D hull under construction
+    struct Face {
+        uint32_t vertex[3];       ///< Counter-clockwise seen from outside
+        uint32_t neighbor[3];     ///< Face across the edge vertex[i] -> vertex[(i + 1) % 3]
+        Vec3f normal;             ///< Outward unit normal
+        float offset;             ///< Plane offset: dot(normal, point) on the face
+        uint32_t outside;         ///< First point of the outside set
+        uint32_t furthest;        ///< Outside point farthest above the plane
+        float furthest_distance;  ///< Its height above the plane
+        uint32_t visit;           ///< Step that last marked the face visible
+        bool alive;               ///< False once the face is replaced
+    };
+
+    /// Edge between the visible region and a face that stays
+    struct HorizonEdge {
+        uint32_t a;     ///< Start vertex, in the winding of the visible face
+        uint32_t b;     ///< End vertex
+        uint32_t face;  ///< Visible face on the inner side, then the kept face on the outer side
+        uint32_t edge;  ///< Edge slot in face
+    };
+
+    /// Frame of the iterative depth-first search over visible faces
+    struct VisitFrame {
+        uint32_t face;   ///< Visible face being expanded
+        uint32_t start;  ///< Edge slot the search entered through
+        uint32_t step;   ///< Edges of the face examined so far
+    };
+
+    std::vector<uint32_t> order_;       ///< 2D: points sorted by x then y
+    std::vector<Vec2f> projected_;      ///< Flat 3D input projected onto its plane
+    std::vector<Face> faces_;           ///< Live and recycled faces
+    std::vector<uint32_t> free_faces_;  ///< Slots of replaced faces
+    std::vector<uint32_t> pending_;     ///< Faces that may still have outside points
+    std::vector<uint32_t> next_point_;  ///< Per point: next point in the same outside set
+    std::vector<uint32_t> visible_;     ///< Faces seen from the current eye point
+    std::vector<VisitFrame> stack_;     ///< Search stack
+    std::vector<HorizonEdge> horizon_;  ///< Horizon of the current eye point, in order
+    std::vector<uint32_t> new_faces_;   ///< Faces added for the current eye point
+
+    friend struct HullBuilder;
+};
+
+// ============================================================================
+// 2D Hull
+// ============================================================================
+
+/**
+ * @brief Convex hull of 2D points (Andrew's monotone chain).
+ *
+ * O(n log n): one sort followed by two linear passes. Points on a hull edge
+ * are dropped; of several equal points only the lowest index is reported.
+ *
+ * @param points Input points
+ * @param hull Receives the hull vertex indices in counter-clockwise order,
+ *             starting from the lowest-x point; edges join consecutive entries
+ *             and the last back to the first. Collinear input gives the two
+ *             end points, identical points a single index.
+ * @param scratch Reusable working memory
+ */
+void convexHull(std::span<const Vec2f> points, std::vector<uint32_t>& hull, HullScratch& scratch);
+
+/**
+ * @brief Convex hull of 2D points with temporary working memory.
+ */
+[[nodiscard]] std::vector<uint32_t> convexHull(std::span<const Vec2f> points);
+
+// ============================================================================
+// 3D Hull
+// ============================================================================
+
+/**
+ * @struct ConvexHull
+ * @brief Triangulated 3D convex hull as indices into the input points.
+ */
+struct ConvexHull {
+    std::vector<uint32_t> triangles;  ///< Three indices per face, counter-clockwise seen from outside
+    std::vector<uint32_t> edges;      ///< Two indices per edge, each edge listed once, smaller index first
+    std::vector<uint32_t> vertices;   ///< Indices of the hull vertices, ascending
+
+    /// Number of triangles
+    [[nodiscard]] size_t faceCount() const noexcept { return triangles.size() / 3; }
+
+    /// Number of edges
+    [[nodiscard]] size_t edgeCount() const noexcept { return edges.size() / 2; }
+
+    /// True if the points did not span at least a plane
+    [[nodiscard]] bool empty() const noexcept { return triangles.empty(); }
+
+    /// Empties the hull, keeping the capacity for the next build
+    void clear() noexcept {
+        triangles.clear();
+        edges.clear();
+        vertices.clear();
+    }
+};
+
+/**
+ * @brief Convex hull of 3D points (quickhull, Barber et al. 1996).
+ *
+ * Starts from a tetrahedron of extreme points and repeatedly adds the point
+ * farthest above a face, replacing every face that point sees. Points within
+ * a tolerance scaled to the input extent count as on the hull and are
+ * dropped, so nearly coplanar faces stay triangulated rather than merged.
+ * Expected O(n log n).
+ *
+ * Coplanar input gives a flat, two-sided hull (the 2D hull triangulated on
+ * both faces); fewer than three non-collinear points give an empty hull.
+ *
+ * @param points Input points
+ * @param hull Receives the hull; its previous contents are discarded
+ * @param scratch Reusable working memory
+ */
+void convexHull(std::span<const Vec3f> points, ConvexHull& hull, HullScratch& scratch);
+
+/**
+ * @brief Convex hull of 3D points with temporary working memory.
+ */
+[[nodiscard]] ConvexHull convexHull(std::span<const Vec3f> points);
+
+}  // namespace vne::math
@@ -0,0 +1,153 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Bounding volume fitting: enclosing spheres, oriented boxes and k-DOPs
+ * computed from point clouds, singly or for many meshes in parallel.
+ * ----------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "../core/vec.h"
+#include "aabb.h"
+#include "kdop.h"
+#include "obb.h"
+#include "sphere.h"
+
+#include <cstdint>
+#include <span>
+
+namespace vne::math {
+
+// ============================================================================
+// Spheres
+// ============================================================================
+
+/**
+ * @brief Ritter's approximate bounding sphere.
+ *
+ * Starts from the most distant pair of extreme points along the seven 14-DOP
+ * axes and grows the sphere over one more pass. Two linear passes; usually
+ * within 5-20% of the minimal radius.
+ *
+ * @param points Point cloud
+ * @return Enclosing sphere, or an invalid Sphere() for an empty span
+ */
+[[nodiscard]] Sphere fitSphereRitter(std::span<const Vec3f> points) noexcept;
+
+/**
+ * @brief Minimal enclosing sphere (Welzl's algorithm with move-to-front).
+ *
+ * Expected linear time on a shuffled copy of the points; the shuffle uses a
+ * fixed seed, so results are reproducible. A final pass grows the radius to
+ * cover any point lost to rounding.
+ *
+ * @param points Point cloud
+ * @return Smallest enclosing sphere, or an invalid Sphere() for an empty span
+ */
+[[nodiscard]] Sphere fitSphereWelzl(std::span<const Vec3f> points);
+
+// ============================================================================
+// Oriented Boxes
+// ============================================================================
+
+/**
+ * @brief Oriented box aligned with the principal axes of the points.
+ *
+ * The axes are the eigenvectors of the point covariance. Fast and stable, but
+ * sensitive to uneven point density (a finely tessellated side pulls the axes
+ * towards it).
+ *
+ * @param points Point cloud
+ * @return Enclosing box; flat point sets give a zero half-extent; Obb() for an empty span
+ */
+[[nodiscard]] Obb fitObbPca(std::span<const Vec3f> points) noexcept;
+
+/**
+ * @brief Oriented box from the ditetrahedron heuristic (DiTO-14, Larsson and Kallberg 2011).
+ *
+ * Candidate orientations come from the edges of a large triangle and two
+ * tetrahedra spanned by the 14 extreme points along the 14-DOP axes; each is
+ * scored by surface area over those 14 points and the best is fitted to the
+ * whole cloud. Falls back to the AABB when that is smaller. Typically tighter
+ * than PCA and insensitive to point density.
+ *
+ * @param points Point cloud
+ * @return Enclosing box; flat point sets give a zero half-extent; Obb() for an empty span
+ */
+[[nodiscard]] Obb fitObbDito(std::span<const Vec3f> points) noexcept;
+
+// ============================================================================
+// k-DOPs
+// ============================================================================
+
+/**
+ * @brief Tight k-DOP of a point cloud.
+ *
+ * Projects four points per SIMD iteration onto every axis and keeps running
+ * min/max registers, reduced once at the end.
+ *
+ * @param points Point cloud
+ * @param type Axis set
+ * @return Enclosing k-DOP, empty (invalid) for an empty span
+ */
+[[nodiscard]] Kdop fitKdop(std::span<const Vec3f> points, DopType type = DopType::eDop26) noexcept;
+
+// ============================================================================
+// Many Meshes
+// ============================================================================
+
+/// Bounding sphere algorithm for fitBounds()
+enum class SphereFit : uint8_t {
+    eRitter,  ///< fitSphereRitter()
+    eWelzl,   ///< fitSphereWelzl()
+};
+
+/// Oriented box algorithm for fitBounds()
+enum class ObbFit : uint8_t {
+    ePca,   ///< fitObbPca()
+    eDito,  ///< fitObbDito()
+};
+
+/**
+ * @struct FitOptions
+ * @brief Algorithms and parallelism for fitBounds().
+ */
+struct FitOptions {
+    SphereFit sphere{SphereFit::eWelzl};  ///< Sphere algorithm
+    ObbFit obb{ObbFit::eDito};            ///< Oriented box algorithm
+    DopType dop{DopType::eDop26};         ///< k-DOP axis set
+    uint32_t thread_count{1};             ///< Worker threads; 0 uses std::thread::hardware_concurrency()
+};
+
+/**
+ * @struct MeshBounds
+ * @brief Every bounding volume of one mesh.
+ */
+struct MeshBounds {
+    Aabb aabb;                  ///< Axis-aligned box (the coordinate slabs of dop)
+    Sphere sphere;              ///< Enclosing sphere
+    Obb obb;                    ///< Oriented box
+    Kdop dop{DopType::eDop26};  ///< Discrete oriented polytope
+};
+
+/**
+ * @brief Fits all bounding volumes of many meshes, e.g. at asset import.
+ *
+ * Meshes are independent, so with thread_count > 1 they are handed out to
+ * worker threads one at a time; each mesh is still fitted by a single thread.
+ * If a worker cannot be started, the remaining threads share its meshes.
+ *
+ * @param meshes Vertex positions of each mesh
+ * @param out Receives the bounds of each mesh
+ * @param options Algorithms and thread count
+ * @throws std::bad_alloc if fitting a mesh runs out of memory. A worker's exception
+ *         is rethrown on the calling thread after all workers have joined; the
+ *         contents of @p out are then unspecified.
+ */
+void fitBounds(std::span<const std::span<const Vec3f>> meshes,
+               std::span<MeshBounds> out,
+               const FitOptions& options = FitOptions{});
+
+}  // namespace vne::math
@@ -19,7 +19,10 @@
 #include "vertexnova/math/geometry/plane.h"
 
 // Standard library includes
+#include <cstddef>
+#include <cstdint>
 #include <ostream>
+#include <span>
 
 // Forward declarations
 namespace vne::math {
@@ -66,6 +69,24 @@ class Frustum {
      */
     void extractFromMatrix(const Mat4x4f& mat) noexcept;
 
+    /**
+     * @brief Extracts frustum planes from a matrix with an explicit depth convention
+     * @param mat The matrix to extract planes from
+     * @param depth Clip-space depth range the projection targets
+     * @param mode Depth orientation and far-plane placement of the projection
+     * @param with_far_plane Whether to keep a far plane for finite projections
+     *
+     * The near and far planes follow the clip-space bounds of @p depth and
+     * @p mode: [0,1] depth clips at z >= 0, reverse-Z swaps which bound is
+     * near. Infinite modes, or @p with_far_plane set to false, produce a
+     * 5-plane frustum: the far plane always passes and is skipped by the
+     * culling tests.
+     */
+    void extractFromMatrix(const Mat4x4f& mat,
+                           ClipSpaceDepth depth,
+                           DepthMode mode = DepthMode::eStandard,
+                           bool with_far_plane = true) noexcept;
+
    public:
     /// @name Containment Tests
     /// @{
@@ -116,6 +137,12 @@ class Frustum {
     [[nodiscard]] const Plane& rightPlane() const noexcept { return right_; }
     [[nodiscard]] const Plane& topPlane() const noexcept { return top_; }
     [[nodiscard]] const Plane& bottomPlane() const noexcept { return bottom_; }
+
+    /** @brief Returns false for a 5-plane frustum with no far plane */
+    [[nodiscard]] bool hasFarPlane() const noexcept { return has_far_; }
+
+    /** @brief Returns the number of planes the culling tests use (5 or 6) */
+    [[nodiscard]] uint32_t planeCount() const noexcept { return has_far_ ? 6u : 5u; }
     /// @}
 
    public:
@@ -135,6 +162,20 @@ class Frustum {
     Plane right_{Vec3f::left(), 1.0f};    ///< Right clipping plane
     Plane bottom_{Vec3f::up(), 1.0f};     ///< Bottom clipping plane
     Plane top_{Vec3f::down(), 1.0f};      ///< Top clipping plane
+    bool has_far_{true};                  ///< Whether the far plane takes part in culling
 };
 
+/**
+ * @brief Culls many AABBs against one frustum.
+ *
+ * Runs the p-vertex test of Frustum::intersects(const Aabb&) on four boxes per
+ * iteration with the SIMD level picked at run time (see activeSimdLevel()).
+ *
+ * @param frustum The view frustum
+ * @param boxes Bounds to test
+ * @param out_visible Receives 1 for each box that may be visible and 0 for each culled box
+ * @return Number of boxes that may be visible
+ */
+size_t intersects(const Frustum& frustum, std::span<const Aabb> boxes, std::span<uint8_t> out_visible) noexcept;
+
 }  // namespace vne::math
@@ -19,13 +19,20 @@
 
 #include "aabb.h"
 #include "capsule.h"
+#include "contact.h"
+#include "convex_hull.h"
+#include "fitting.h"
 #include "frustum.h"
+#include "gjk.h"
 #include "intersection.h"
+#include "kdop.h"
 #include "line.h"
 #include "line_segment.h"
 #include "obb.h"
 #include "plane.h"
 #include "ray.h"
 #include "rect.h"
+#include "sdf.h"
 #include "sphere.h"
+#include "sweep.h"
 #include "triangle.h"
@@ -0,0 +1,215 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * GJK distance / overlap and EPA penetration queries between convex shapes.
+ * ----------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include "../core/vec.h"
+#include "aabb.h"
+#include "capsule.h"
+#include "line_segment.h"
+#include "obb.h"
+#include "sphere.h"
+#include "triangle.h"
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace vne::math {
+
+// ============================================================================
+// Support Functions
+// ============================================================================
+
+/**
+ * @struct ConvexPointSet
+ * @brief The convex hull of a point cloud, described by the points alone.
+ *
+ * The points are not copied and need not be hull vertices; interior points
+ * only cost time in support(). Must not be empty.
+ */
+struct ConvexPointSet {
+    std::span<const Vec3f> points;  ///< Points whose convex hull is the shape
+};
+
+/**
+ * @brief Support functions: the point of the shape furthest along @p direction.
+ *
+ * @p direction need not be normalized. Ties resolve to any maximizing point.
+ */
+[[nodiscard]] Vec3f support(const LineSegment& segment, const Vec3f& direction) noexcept;
+[[nodiscard]] Vec3f support(const Triangle& triangle, const Vec3f& direction) noexcept;
+[[nodiscard]] Vec3f support(const Aabb& aabb, const Vec3f& direction) noexcept;
+[[nodiscard]] Vec3f support(const Obb& obb, const Vec3f& direction) noexcept;
+[[nodiscard]] Vec3f support(const Sphere& sphere, const Vec3f& direction) noexcept;
+[[nodiscard]] Vec3f support(const Capsule& capsule, const Vec3f& direction) noexcept;
+
+/**
+ * @brief Support function of a point set, scanning four points per SIMD iteration.
+ */
+[[nodiscard]] Vec3f support(const ConvexPointSet& set, const Vec3f& direction) noexcept;
+
+/**
+ * @class ConvexShape
+ * @brief Non-owning view of any convex primitive, for the GJK / EPA queries.
+ *
+ * Every geometry class converts implicitly, so the queries accept them
+ * directly. Spheres and capsules are split into a core (a point or segment)
+ * and a margin (the radius): GJK runs on the cores, which converges in a
+ * couple of iterations and keeps curved surfaces exact. The referenced shape
+ * must outlive the view.
+ */
+class ConvexShape {
+   public:
+    /// Kind of primitive being referenced
+    enum class Type : uint8_t {
+        ePoint,
+        eSegment,
+        eTriangle,
+        eAabb,
+        eObb,
+        eSphere,
+        eCapsule,
+        ePointSet,
+    };
+
+    // Implicit on purpose: the queries take any primitive.
+    ConvexShape(const Vec3f& point) noexcept;          // NOLINT(google-explicit-constructor)
+    ConvexShape(const LineSegment& segment) noexcept;  // NOLINT(google-explicit-constructor)
+    ConvexShape(const Triangle& triangle) noexcept;    // NOLINT(google-explicit-constructor)
+    ConvexShape(const Aabb& aabb) noexcept;            // NOLINT(google-explicit-constructor)
+    ConvexShape(const Obb& obb) noexcept;              // NOLINT(google-explicit-constructor)
+    ConvexShape(const Sphere& sphere) noexcept;        // NOLINT(google-explicit-constructor)
+    ConvexShape(const Capsule& capsule) noexcept;      // NOLINT(google-explicit-constructor)
+    ConvexShape(const ConvexPointSet& set) noexcept;   // NOLINT(google-explicit-constructor)
+
+   public:
+    /// Support point of the whole shape, margin included
+    [[nodiscard]] Vec3f support(const Vec3f& direction) const noexcept;
+
+    /// Support point of the core (the shape shrunk by margin())
+    [[nodiscard]] Vec3f coreSupport(const Vec3f& direction) const noexcept;
+
+    /// Radius swept around the core (0 for polytopes)
+    [[nodiscard]] float margin() const noexcept { return margin_; }
+
+    /// A point inside the core, used to seed the search direction
+    [[nodiscard]] Vec3f interiorPoint() const noexcept;
+
+    [[nodiscard]] Type type() const noexcept { return type_; }
+
+    /// View of the same shape moved by @p offset (offsets accumulate); the shape itself is untouched
+    [[nodiscard]] ConvexShape translated(const Vec3f& offset) const noexcept {
+        ConvexShape moved = *this;
+        moved.offset_ += offset;
+        return moved;
+    }
+
+   private:
+    [[nodiscard]] Vec3f untranslatedCoreSupport(const Vec3f& direction) const noexcept;
+    [[nodiscard]] Vec3f untranslatedInteriorPoint() const noexcept;
+
+   private:
+    const void* shape_;
+    Vec3f offset_{Vec3f::zero()};
+    float margin_{0.0f};
+    Type type_;
+};
+
+// ============================================================================
+// GJK
+// ============================================================================
+
+/**
+ * @struct GjkCache
+ * @brief Simplex carried from one query to the next for the same shape pair.
+ *
+ * Stores the support directions of the final simplex. The next query
+ * re-evaluates the supports along them, which gives a valid simplex of the
+ * moved shapes; with small motion it already encloses the origin or lies
+ * next to the closest feature, so the query finishes in one or two
+ * iterations. Keep one cache per pair; a default cache means a cold start.
+ */
+struct GjkCache {
+    std::array<Vec3f, 4> directions{};  ///< Support directions (for shape A) of the simplex vertices
+    uint32_t count{0};                  ///< Number of valid directions
+
+    /// Forgets the simplex (e.g. when the pair stops being a broadphase candidate)
+    void reset() noexcept { count = 0; }
+};
+
+/**
+ * @struct GjkResult
+ * @brief Outcome of a GJK distance query.
+ */
+struct GjkResult {
+    float distance{0.0f};          ///< Gap between the shapes, 0 if they touch or overlap
+    Vec3f point_a{Vec3f::zero()};  ///< Closest point on A (meaningless when intersecting)
+    Vec3f point_b{Vec3f::zero()};  ///< Closest point on B (meaningless when intersecting)
+    Vec3f normal{Vec3f::zero()};   ///< Unit direction from A to B when separated
+    uint32_t iterations{0};        ///< Support evaluations performed
+    bool intersecting{false};      ///< True if the shapes overlap or touch
+};
+
+/**
+ * @brief Computes the distance and closest points between two convex shapes.
+ *
+ * Van den Bergen's GJK with Johnson's sub-simplex solve on the shape cores;
+ * margins are then subtracted from the core distance.
+ *
+ * @param a First shape
+ * @param b Second shape
+ * @param cache Optional warm-start simplex, read and updated
+ */
+[[nodiscard]] GjkResult gjkDistance(const ConvexShape& a, const ConvexShape& b, GjkCache* cache = nullptr) noexcept;
+
+/**
+ * @brief Boolean overlap test.
+ *
+ * Stops at the first separating axis, so disjoint pairs are cheaper than a
+ * full gjkDistance(). Touching shapes intersect.
+ */
+[[nodiscard]] bool gjkIntersects(const ConvexShape& a, const ConvexShape& b, GjkCache* cache = nullptr) noexcept;
+
+// ============================================================================
+// EPA
+// ============================================================================
+
+/**
+ * @struct PenetrationResult
+ * @brief Minimum translation separating two overlapping shapes.
+ *
+ * Translating B by normal * depth (or A by the opposite) brings the shapes
+ * into touching contact.
+ */
+struct PenetrationResult {
+    float depth{0.0f};             ///< Penetration depth (>= 0)
+    Vec3f normal{Vec3f::zero()};   ///< Unit direction from A to B
+    Vec3f point_a{Vec3f::zero()};  ///< Deepest point of A inside B
+    Vec3f point_b{Vec3f::zero()};  ///< Deepest point of B inside A
+    bool intersecting{false};      ///< False if the shapes are disjoint (other fields unset)
+};
+
+/**
+ * @brief Computes the penetration depth and contact points of two convex shapes.
+ *
+ * When only the margins overlap the answer comes straight from the GJK core
+ * distance. Otherwise the Expanding Polytope Algorithm grows the final GJK
+ * simplex over the Minkowski difference; the polytope lives in fixed-size
+ * arrays, so the query never allocates.
+ *
+ * @param a First shape
+ * @param b Second shape
+ * @param cache Optional warm-start simplex, read and updated
+ */
+[[nodiscard]] PenetrationResult penetration(const ConvexShape& a,
+                                            const ConvexShape& b,
+                                            GjkCache* cache = nullptr) noexcept;
+
+}  // namespace vne::math
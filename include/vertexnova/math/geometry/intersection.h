@@ -10,13 +10,19 @@
 
 #include "../core/types.h"
 #include "../core/vec.h"
+#include "../instrumentation.h"
 #include "aabb.h"
 #include "plane.h"
 #include "ray.h"
 #include "sphere.h"
 #include "triangle.h"
 
+#include <cmath>
+#include <cstdint>
+#include <limits>
 #include <optional>
+#include <span>
+#include <utility>
 
 namespace vne::math {
 
@@ -50,6 +56,109 @@ struct RayHit {
     [[nodiscard]] constexpr explicit operator bool() const noexcept { return valid(); }
 };
 
+// ============================================================================
+// Precomputed Ray
+// ============================================================================
+
+/**
+ * @struct PrecomputedRay
+ * @brief A ray with its reciprocal direction and direction signs cached.
+ *
+ * Build one per ray before testing it against many boxes (BVH traversal,
+ * broadphase queries) so the slab tests need no divisions. Zero direction
+ * components give infinite reciprocals, which the slab tests handle.
+ */
+struct PrecomputedRay {
+    Vec3f origin;                  ///< Ray origin
+    Vec3f direction;               ///< Normalized ray direction
+    Vec3f inv_direction;           ///< 1 / direction; +-infinity for zero components
+    uint32_t sign[3] = {0, 0, 0};  ///< 1 where direction is negative, i.e. the slab is entered through max
+    uint32_t axes[3] = {0, 1, 2};  ///< Watertight triangle test axes (kx, ky, kz); kz is the dominant direction axis
+    Vec3f shear;                   ///< Watertight triangle test shear (Sx, Sy, Sz) mapping the ray onto +kz
+
+    PrecomputedRay() noexcept = default;
+
+    /**
+     * @brief Precomputes the reciprocal direction, signs and triangle shear of a ray.
+     */
+    explicit PrecomputedRay(const Ray& ray) noexcept
+        : origin(ray.origin())
+        , direction(ray.direction())
+        , inv_direction(1.0f / direction.x(), 1.0f / direction.y(), 1.0f / direction.z()) {
+        for (int k = 0; k < 3; ++k) {
+            sign[k] = std::signbit(inv_direction[k]) ? 1u : 0u;
+        }
+
+        const Vec3f abs_direction = direction.abs();
+        uint32_t kz = 0;
+        if (abs_direction.y() > abs_direction[kz]) {
+            kz = 1;
+        }
+        if (abs_direction.z() > abs_direction[kz]) {
+            kz = 2;
+        }
+        uint32_t kx = (kz + 1) % 3;
+        uint32_t ky = (kx + 1) % 3;
+        if (direction[kz] < 0.0f) {
+            std::swap(kx, ky);  // Keep the winding, so the determinant sign still means front facing
+        }
+        axes[0] = kx;
+        axes[1] = ky;
+        axes[2] = kz;
+        shear = Vec3f(direction[kx] / direction[kz], direction[ky] / direction[kz], 1.0f / direction[kz]);
+    }
+
+    /**
+     * @brief Gets a point along the ray at the given distance.
+     */
+    [[nodiscard]] Vec3f getPoint(float distance) const noexcept { return origin + direction * distance; }
+};
+
+namespace detail {
+
+/// Scale applied to slab exit distances so rounding can never turn a grazing hit into a miss
+/// (1 + 2 * gamma(3), Ize 2013).
+inline constexpr float kSlabExitScale = 1.0000004f;
+
+/**
+ * Unclipped slab interval of a ray against a box.
+ *
+ * The near plane of each slab is picked by the direction sign, so no min/max
+ * of the two plane distances is needed. A slab distance is NaN only when a
+ * zero direction component meets an origin lying exactly on that slab's
+ * plane (0 * inf); the comparisons are written so a NaN leaves the interval
+ * unchanged, which counts the ray as inside that slab.
+ *
+ * @return false if the slabs do not overlap
+ */
+[[nodiscard]] inline bool slabInterval(const PrecomputedRay& ray,
+                                       const Aabb& aabb,
+                                       float& t_enter,
+                                       float& t_exit,
+                                       int& enter_axis,
+                                       int& exit_axis) noexcept {
+    const Vec3f* bounds[2] = {&aabb.min(), &aabb.max()};
+    t_enter = -std::numeric_limits<float>::infinity();
+    t_exit = std::numeric_limits<float>::infinity();
+    enter_axis = 0;
+    exit_axis = 0;
+    for (int k = 0; k < 3; ++k) {
+        const float near = ((*bounds[ray.sign[k]])[k] - ray.origin[k]) * ray.inv_direction[k];
+        const float far = ((*bounds[1 - ray.sign[k]])[k] - ray.origin[k]) * ray.inv_direction[k] * kSlabExitScale;
+        if (near > t_enter) {
+            t_enter = near;
+            enter_axis = k;
+        }
+        if (far < t_exit) {
+            t_exit = far;
+            exit_axis = k;
+        }
+    }
+    return t_enter <= t_exit;
+}
+
+}  // namespace detail
+
 // ============================================================================
 // Ray-Plane Intersection
 // ============================================================================
@@ -65,6 +174,7 @@ struct RayHit {
 [[nodiscard]] inline RayHit intersect(const Ray& ray,
                                       const Plane& plane,
                                       float max_distance = std::numeric_limits<float>::max()) noexcept {
+    VNE_MATH_PROBE_COUNT(Probe::eRayTest);
     float denom = plane.normal.dot(ray.direction());
 
     // Check if ray is parallel to plane
@@ -103,6 +213,7 @@ struct RayHit {
 [[nodiscard]] inline RayHit intersect(const Ray& ray,
                                       const Sphere& sphere,
                                       float max_distance = std::numeric_limits<float>::max()) noexcept {
+    VNE_MATH_PROBE_COUNT(Probe::eRayTest);
     Vec3f oc = ray.origin() - sphere.center();
     float b = oc.dot(ray.direction());
     float c = oc.dot(oc) - sphere.radius() * sphere.radius();
@@ -141,100 +252,122 @@ struct RayHit {
 // ============================================================================
 
 /**
- * @brief Intersects a ray with an axis-aligned bounding box.
+ * @brief Intersects a precomputed ray with an axis-aligned bounding box.
  *
- * Uses the optimized slab method with IEEE floating-point handling.
+ * Slab method without divisions. A ray starting inside the box reports the
+ * exit point. The normal is the face of the slab that decided the hit, so it
+ * is exact even on edges and corners.
  *
- * @param ray The ray
+ * @param ray The precomputed ray
  * @param aabb The AABB
  * @param max_distance Maximum distance to check
  * @return Hit result if intersection found
  */
-[[nodiscard]] inline RayHit intersect(const Ray& ray,
+[[nodiscard]] inline RayHit intersect(const PrecomputedRay& ray,
                                       const Aabb& aabb,
                                       float max_distance = std::numeric_limits<float>::max()) noexcept {
-    Vec3f inv_dir(1.0f / ray.direction().x(), 1.0f / ray.direction().y(), 1.0f / ray.direction().z());
-
-    Vec3f t0 = (aabb.min() - ray.origin()) * inv_dir.x();
-    Vec3f t1 = (aabb.max() - ray.origin()) * inv_dir.x();
-
-    // Handle negative direction components
-    float tx_min = min(t0.x(), t1.x());
-    float tx_max = max(t0.x(), t1.x());
-
-    Vec3f t0y = (aabb.min() - ray.origin()) * inv_dir.y();
-    Vec3f t1y = (aabb.max() - ray.origin()) * inv_dir.y();
-    float ty_min = min(t0y.y(), t1y.y());
-    float ty_max = max(t0y.y(), t1y.y());
-
-    if (tx_min > ty_max || ty_min > tx_max) {
+    VNE_MATH_PROBE_COUNT(Probe::eRayTest);
+    float t_enter;
+    float t_exit;
+    int enter_axis;
+    int exit_axis;
+    if (!detail::slabInterval(ray, aabb, t_enter, t_exit, enter_axis, exit_axis) || t_exit < 0.0f) {
         return RayHit::none();
     }
 
-    float t_min = max(tx_min, ty_min);
-    float t_max = min(tx_max, ty_max);
-
-    Vec3f t0z = (aabb.min() - ray.origin()) * inv_dir.z();
-    Vec3f t1z = (aabb.max() - ray.origin()) * inv_dir.z();
-    float tz_min = min(t0z.z(), t1z.z());
-    float tz_max = max(t0z.z(), t1z.z());
-
-    if (t_min > tz_max || tz_min > t_max) {
-        return RayHit::none();
-    }
-
-    t_min = max(t_min, tz_min);
-    t_max = min(t_max, tz_max);
-
-    // Check if intersection is in valid range
-    float t = t_min >= 0.0f ? t_min : t_max;
-    if (t < 0.0f || t > max_distance) {
+    // Entering faces oppose the direction; from inside the box the exit face points along it
+    const bool inside = t_enter < 0.0f;
+    const float t = inside ? t_exit : t_enter;
+    if (t > max_distance) {
         return RayHit::none();
     }
 
     RayHit hit;
     hit.distance = t;
     hit.point = ray.getPoint(t);
-
-    // Compute normal (face that was hit)
-    Vec3f center = aabb.center();
-    Vec3f local = hit.point - center;
-    Vec3f half = aabb.halfExtents();
-
-    // Find which face was hit by checking which component is closest to edge
-    Vec3f abs_local(std::abs(local.x()) / half.x(), std::abs(local.y()) / half.y(), std::abs(local.z()) / half.z());
-
-    if (abs_local.x() > abs_local.y() && abs_local.x() > abs_local.z()) {
-        hit.normal = Vec3f(local.x() > 0 ? 1.0f : -1.0f, 0.0f, 0.0f);
-    } else if (abs_local.y() > abs_local.z()) {
-        hit.normal = Vec3f(0.0f, local.y() > 0 ? 1.0f : -1.0f, 0.0f);
+    hit.normal = Vec3f::zero();
+    if (inside) {
+        hit.normal[exit_axis] = ray.sign[exit_axis] ? -1.0f : 1.0f;
     } else {
-        hit.normal = Vec3f(0.0f, 0.0f, local.z() > 0 ? 1.0f : -1.0f);
+        hit.normal[enter_axis] = ray.sign[enter_axis] ? 1.0f : -1.0f;
     }
-
     return hit;
 }
 
+/**
+ * @brief Intersects a ray with an axis-aligned bounding box.
+ *
+ * Precomputes the ray and uses the slab method above; build a PrecomputedRay
+ * once when testing the same ray against many boxes.
+ *
+ * @param ray The ray
+ * @param aabb The AABB
+ * @param max_distance Maximum distance to check
+ * @return Hit result if intersection found
+ */
+[[nodiscard]] inline RayHit intersect(const Ray& ray,
+                                      const Aabb& aabb,
+                                      float max_distance = std::numeric_limits<float>::max()) noexcept {
+    return intersect(PrecomputedRay(ray), aabb, max_distance);
+}
+
 // ============================================================================
-// Ray-Triangle Intersection (Möller–Trumbore Algorithm)
+// Ray-Triangle Intersection
 // ============================================================================
 
+/**
+ * @enum TriangleIntersectMode
+ * @brief Algorithm used by the ray-triangle tests.
+ */
+enum class TriangleIntersectMode : uint8_t {
+    eMollerTrumbore,  ///< Fastest; a determinant epsilon can let rays slip through edges shared by two triangles
+    eWatertight       ///< Woop/Benthin/Wald; a ray through a shared edge or vertex always hits one of the triangles
+};
+
+/**
+ * @brief Intersects a precomputed ray with a triangle (watertight).
+ *
+ * Woop/Benthin/Wald: the triangle is translated to the ray origin and
+ * sheared so the ray runs along +kz, then the 2D edge functions decide the
+ * hit. Edge functions that round to exactly zero are recomputed in double
+ * precision, so neighbouring triangles agree on every shared edge.
+ * Returns barycentric coordinates (weights of v1 and v2) in the uv field.
+ *
+ * @param ray The precomputed ray
+ * @param triangle The triangle
+ * @param max_distance Maximum distance to check
+ * @param cull_backface If true, only front-facing triangles are hit
+ * @return Hit result if intersection found
+ */
+[[nodiscard]] RayHit intersect(const PrecomputedRay& ray,
+                               const Triangle& triangle,
+                               float max_distance = std::numeric_limits<float>::max(),
+                               bool cull_backface = false) noexcept;
+
 /**
  * @brief Intersects a ray with a triangle.
  *
- * Uses the Möller–Trumbore algorithm for fast ray-triangle intersection.
+ * Uses the Möller–Trumbore algorithm for fast ray-triangle intersection, or
+ * the watertight test above when @p mode asks for it.
  * Returns barycentric coordinates in uv field.
  *
  * @param ray The ray
  * @param triangle The triangle
  * @param max_distance Maximum distance to check
  * @param cull_backface If true, only front-facing triangles are hit
+ * @param mode Intersection algorithm
  * @return Hit result if intersection found
  */
 [[nodiscard]] inline RayHit intersect(const Ray& ray,
                                       const Triangle& triangle,
                                       float max_distance = std::numeric_limits<float>::max(),
-                                      bool cull_backface = false) noexcept {
+                                      bool cull_backface = false,
+                                      TriangleIntersectMode mode = TriangleIntersectMode::eMollerTrumbore) noexcept {
+    if (mode == TriangleIntersectMode::eWatertight) {
+        return intersect(PrecomputedRay(ray), triangle, max_distance, cull_backface);
+    }
+    VNE_MATH_PROBE_COUNT(Probe::eRayTest);
+
     constexpr float epsilon = 1e-8f;
 
     Vec3f edge1 = triangle.edge01();
@@ -293,6 +426,7 @@ struct RayHit {
 [[nodiscard]] inline bool intersects(const Ray& ray,
                                      const Sphere& sphere,
                                      float max_distance = std::numeric_limits<float>::max()) noexcept {
+    VNE_MATH_PROBE_COUNT(Probe::eRayTest);
     Vec3f oc = ray.origin() - sphere.center();
     float b = oc.dot(ray.direction());
     float c = oc.dot(oc) - sphere.radius() * sphere.radius();
@@ -314,6 +448,23 @@ struct RayHit {
     return t >= 0.0f && t <= max_distance;
 }
 
+/**
+ * @brief Fast precomputed ray-AABB intersection test (no hit info).
+ *
+ * Division-free slab test; the inner loop of BVH traversal.
+ */
+[[nodiscard]] inline bool intersects(const PrecomputedRay& ray,
+                                     const Aabb& aabb,
+                                     float max_distance = std::numeric_limits<float>::max()) noexcept {
+    VNE_MATH_PROBE_COUNT(Probe::eRayTest);
+    float t_enter;
+    float t_exit;
+    int enter_axis;
+    int exit_axis;
+    return detail::slabInterval(ray, aabb, t_enter, t_exit, enter_axis, exit_axis) && t_exit >= 0.0f
+           && t_enter <= max_distance;
+}
+
 /**
  * @brief Fast ray-AABB intersection test (no hit info).
  *
@@ -322,24 +473,7 @@ struct RayHit {
 [[nodiscard]] inline bool intersects(const Ray& ray,
                                      const Aabb& aabb,
                                      float max_distance = std::numeric_limits<float>::max()) noexcept {
-    Vec3f inv_dir(1.0f / ray.direction().x(), 1.0f / ray.direction().y(), 1.0f / ray.direction().z());
-
-    float tx1 = (aabb.min().x() - ray.origin().x()) * inv_dir.x();
-    float tx2 = (aabb.max().x() - ray.origin().x()) * inv_dir.x();
-    float t_min = min(tx1, tx2);
-    float t_max = max(tx1, tx2);
-
-    float ty1 = (aabb.min().y() - ray.origin().y()) * inv_dir.y();
-    float ty2 = (aabb.max().y() - ray.origin().y()) * inv_dir.y();
-    t_min = max(t_min, min(ty1, ty2));
-    t_max = min(t_max, max(ty1, ty2));
-
-    float tz1 = (aabb.min().z() - ray.origin().z()) * inv_dir.z();
-    float tz2 = (aabb.max().z() - ray.origin().z()) * inv_dir.z();
-    t_min = max(t_min, min(tz1, tz2));
-    t_max = min(t_max, max(tz1, tz2));
-
-    return t_max >= max(0.0f, t_min) && t_min <= max_distance;
+    return intersects(PrecomputedRay(ray), aabb, max_distance);
 }
 
 /**
@@ -348,6 +482,7 @@ struct RayHit {
 [[nodiscard]] inline bool intersects(const Ray& ray,
                                      const Plane& plane,
                                      float max_distance = std::numeric_limits<float>::max()) noexcept {
+    VNE_MATH_PROBE_COUNT(Probe::eRayTest);
     float denom = plane.normal.dot(ray.direction());
     if (isZero(denom)) {
         return false;
@@ -363,10 +498,95 @@ struct RayHit {
 [[nodiscard]] inline bool intersects(const Ray& ray,
                                      const Triangle& triangle,
                                      float max_distance = std::numeric_limits<float>::max(),
-                                     bool cull_backface = false) noexcept {
-    return intersect(ray, triangle, max_distance, cull_backface).valid();
+                                     bool cull_backface = false,
+                                     TriangleIntersectMode mode = TriangleIntersectMode::eMollerTrumbore) noexcept {
+    return intersect(ray, triangle, max_distance, cull_backface, mode).valid();
 }
 
+// ============================================================================
+// Batch Ray Casting
+// ============================================================================
+
+/**
+ * @brief Casts one ray against many boxes.
+ *
+ * Four boxes are slab-tested per SIMD iteration with the same NaN handling as
+ * intersects(const PrecomputedRay&, const Aabb&, float).
+ *
+ * @param ray The precomputed ray
+ * @param boxes Boxes to test, e.g. the children of a BVH node
+ * @param out_distances Receives the entry distance of each hit box (0 if the
+ *        ray starts inside it) or -1 for a miss
+ * @param max_distance Maximum distance to check
+ * @return Number of boxes hit
+ */
+size_t intersect(const PrecomputedRay& ray,
+                 std::span<const Aabb> boxes,
+                 std::span<float> out_distances,
+                 float max_distance = std::numeric_limits<float>::max()) noexcept;
+
+/**
+ * @struct TrianglePacket
+ * @brief Four triangles in structure-of-arrays layout, e.g. one BVH leaf.
+ *
+ * Lanes past the end of a packed range hold NaN vertices, which never hit.
+ */
+struct alignas(16) TrianglePacket {
+    static constexpr size_t kWidth = 4;  ///< Triangles per packet
+
+    float v[3][3][kWidth];  ///< v[vertex][axis][lane]
+
+    /**
+     * @brief Gets one triangle back out of the packet.
+     */
+    [[nodiscard]] Triangle triangle(size_t lane) const noexcept {
+        return Triangle(Vec3f(v[0][0][lane], v[0][1][lane], v[0][2][lane]),
+                        Vec3f(v[1][0][lane], v[1][1][lane], v[1][2][lane]),
+                        Vec3f(v[2][0][lane], v[2][1][lane], v[2][2][lane]));
+    }
+};
+
+/**
+ * @brief Packs triangles into SoA packets.
+ *
+ * @param triangles Triangles in order; triangle i lands in packet i / 4, lane i % 4
+ * @param out Receives (triangles.size() + 3) / 4 packets
+ * @return Number of packets written
+ */
+size_t packTriangles(std::span<const Triangle> triangles, std::span<TrianglePacket> out) noexcept;
+
+/**
+ * @brief Packs an indexed triangle mesh into SoA packets.
+ *
+ * @param vertices Mesh positions
+ * @param indices Three indices per triangle
+ * @param out Receives (indices.size() / 3 + 3) / 4 packets
+ * @return Number of packets written
+ */
+size_t packTriangles(std::span<const Vec3f> vertices,
+                     std::span<const uint32_t> indices,
+                     std::span<TrianglePacket> out) noexcept;
+
+/**
+ * @brief Finds the closest triangle hit by one ray among many packets.
+ *
+ * Runs the watertight test on a whole packet per SIMD iteration. Lanes whose
+ * edge functions round to exactly zero fall back to the scalar test, so the
+ * result matches intersect(const PrecomputedRay&, const Triangle&, float, bool).
+ *
+ * @param ray The precomputed ray
+ * @param packets Packed triangles
+ * @param out_index Receives the index of the hit triangle (packet * 4 + lane)
+ * @param max_distance Maximum distance to check
+ * @param cull_backface If true, only front-facing triangles are hit
+ * @return The closest hit, with barycentric coordinates in uv
+ */
+[[nodiscard]] RayHit intersect(const PrecomputedRay& ray,
+                               std::span<const TrianglePacket> packets,
+                               uint32_t& out_index,
+                               float max_distance = std::numeric_limits<float>::max(),
+                               bool cull_backface = false) noexcept;
+
 // ============================================================================
 // Distance Functions
 // ============================================================================
@@ -0,0 +1,168 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file kdop.h
+ * @brief Defines the Kdop class for discrete oriented polytope bounding volumes.
+ */
+
+// Project includes
+#include "vertexnova/math/core/vec.h"
+#include "vertexnova/math/geometry/aabb.h"
+
+// Standard library includes
+#include <cstdint>
+#include <ostream>
+
+namespace vne::math {
+
+/**
+ * @brief The fixed axis sets a Kdop can use.
+ *
+ * Slots 0-2 are always the coordinate axes, so every k-DOP contains its AABB.
+ */
+enum class DopType : uint8_t {
+    eDop14,  ///< Coordinate axes and the 4 cube diagonals (1, +-1, +-1)
+    eDop18,  ///< Coordinate axes and the 6 edge diagonals (1, +-1, 0) and permutations
+    eDop26,  ///< Coordinate axes, cube diagonals and edge diagonals
+};
+
+/**
+ * @class Kdop
+ * @brief Discrete oriented polytope: the intersection of k/2 slabs along fixed axes.
+ *
+ * A k-DOP hugs a shape more tightly than an AABB while keeping overlap tests
+ * to a few comparisons per axis. The axes are not normalized, so the stored
+ * extents are projections onto the raw axis vectors; only k-DOPs of the same
+ * type can be compared.
+ */
+class Kdop {
+   public:
+    /// Largest number of slabs (26-DOP)
+    static constexpr uint32_t kMaxAxes = 13;
+
+    /**
+     * @brief Creates an empty (invalid) k-DOP; expanding it by any point makes it valid.
+     */
+    explicit Kdop(DopType type = DopType::eDop26) noexcept;
+
+    /** @brief Default destructor */
+    ~Kdop() noexcept = default;
+
+    /** @brief Copy constructor */
+    Kdop(const Kdop& other) noexcept = default;
+
+    /** @brief Copy assignment operator */
+    Kdop& operator=(const Kdop& other) noexcept = default;
+
+   public:
+    /// @name Axes
+    /// @{
+
+    /**
+     * @brief Number of slabs of a k-DOP type (k / 2).
+     */
+    [[nodiscard]] static uint32_t axisCount(DopType type) noexcept;
+
+    /**
+     * @brief Unnormalized direction of a slab.
+     *
+     * @param type The k-DOP type
+     * @param slot Slab index in [0, axisCount(type))
+     */
+    [[nodiscard]] static Vec3f axis(DopType type, uint32_t slot) noexcept;
+
+    /// @}
+
+   public:
+    /// @name Accessors
+    /// @{
+
+    /// The axis set
+    [[nodiscard]] DopType type() const noexcept { return type_; }
+
+    /// Number of slabs
+    [[nodiscard]] uint32_t axisCount() const noexcept { return axisCount(type_); }
+
+    /// Smallest projection onto the axis of @p slot
+    [[nodiscard]] float min(uint32_t slot) const noexcept;
+
+    /// Largest projection onto the axis of @p slot
+    [[nodiscard]] float max(uint32_t slot) const noexcept;
+
+    /**
+     * @brief Sets one slab.
+     */
+    void setSlab(uint32_t slot, float min, float max) noexcept;
+
+    /// @}
+
+   public:
+    /// @name Modification Methods
+    /// @{
+
+    /**
+     * @brief Expands the k-DOP to include a point.
+     */
+    void expand(const Vec3f& point) noexcept;
+
+    /**
+     * @brief Expands the k-DOP to include another of the same type.
+     */
+    void expand(const Kdop& other) noexcept;
+
+    /**
+     * @brief Makes the k-DOP empty again.
+     */
+    void reset() noexcept;
+
+    /// @}
+
+   public:
+    /// @name Query Methods
+    /// @{
+
+    /**
+     * @brief True if every slab has min <= max.
+     */
+    [[nodiscard]] bool isValid() const noexcept;
+
+    /**
+     * @brief Checks whether a point lies inside every slab.
+     */
+    [[nodiscard]] bool contains(const Vec3f& point) const noexcept;
+
+    /**
+     * @brief Checks whether two k-DOPs of the same type overlap.
+     *
+     * Overlap of every slab is necessary but, as for any k-DOP, only an
+     * approximation of the true polytope overlap.
+     */
+    [[nodiscard]] bool intersects(const Kdop& other) const noexcept;
+
+    /**
+     * @brief The AABB given by the coordinate slabs.
+     */
+    [[nodiscard]] Aabb getAabb() const noexcept;
+
+    /// @}
+
+   public:
+    friend std::ostream& operator<<(std::ostream& os, const Kdop& dop);
+
+   private:
+    DopType type_;
+    float min_[kMaxAxes];  ///< Smallest projection per slab
+    float max_[kMaxAxes];  ///< Largest projection per slab
+};
+
+}  // namespace vne::math
@@ -120,6 +120,28 @@ class LineSegment {
      */
     [[nodiscard]] float squaredDistanceToPoint(const Vec3f& point) const noexcept;
 
+    // ========================================================================
+    // Segment Queries
+    // ========================================================================
+
+    /**
+     * @brief Finds the closest pair of points between this segment and another.
+     *
+     * Solves for both parameters together and clamps them in turn, so the
+     * result is exact for crossing, parallel and degenerate segments alike.
+     *
+     * @param other The other segment
+     * @param out_point Closest point on this segment
+     * @param out_other_point Closest point on @p other
+     * @return Squared distance between the two points
+     */
+    float closestPoints(const LineSegment& other, Vec3f& out_point, Vec3f& out_other_point) const noexcept;
+
+    /**
+     * @brief Computes the squared distance between this segment and another.
+     */
+    [[nodiscard]] float squaredDistanceToSegment(const LineSegment& other) const noexcept;
+
     // ========================================================================
     // Validation
     // ========================================================================
@@ -21,7 +21,9 @@
 #include "vertexnova/math/core/quat.h"
 #include "vertexnova/math/core/vec.h"
 
+#include <cstdint>
 #include <ostream>
+#include <span>
 
 namespace vne::math {
 
@@ -41,6 +43,10 @@ class Aabb;
  * - A center point
  * - Three orthonormal axes (stored as a rotation matrix or quaternion)
  * - Half-extents along each local axis
+ *
+ * The rotation basis is cached next to the quaternion and refreshed whenever
+ * the orientation changes, so axis queries, containment and the SAT overlap
+ * tests read the axes directly instead of rotating by the quaternion.
  */
 class Obb {
    public:
@@ -130,8 +136,10 @@ class Obb {
 
     /**
      * @brief Gets the orientation as a 3x3 rotation matrix.
+     *
+     * Column i is the local axis i in world space.
      */
-    [[nodiscard]] Mat3f rotationMatrix() const noexcept;
+    [[nodiscard]] const Mat3f& rotationMatrix() const noexcept;
     /// @}
 
    public:
@@ -191,6 +199,8 @@ class Obb {
 
     /**
      * @brief Computes the AABB that bounds this OBB.
+     *
+     * The world extent along each axis is |R| * half_extents, so no corners are built.
      */
     [[nodiscard]] Aabb getAabb() const noexcept;
     /// @}
@@ -256,12 +266,19 @@ class Obb {
 
     /**
      * @brief Checks if this OBB intersects another OBB.
-     * Uses the Separating Axis Theorem (SAT).
+     *
+     * Separating Axis Theorem in Gottschalk's form: the other box is expressed
+     * in this box's frame, the absolute rotation terms are computed once and
+     * shared by all 15 axes, and the test exits at the first separating axis.
+     * Touching boxes intersect.
      */
     [[nodiscard]] bool intersects(const Obb& other) const noexcept;
 
     /**
      * @brief Checks if this OBB intersects an AABB.
+     *
+     * Same SAT as the OBB-OBB test with the AABB's identity basis folded in,
+     * so the relative rotation is this box's basis itself.
      */
     [[nodiscard]] bool intersects(const Aabb& aabb) const noexcept;
     /// @}
@@ -278,10 +295,29 @@ class Obb {
    public:
     friend std::ostream& operator<<(std::ostream& os, const Obb& obb);
 
+   private:
+    /// Recomputes basis_ from orientation_
+    void updateBasis() noexcept;
+
    private:
     Vec3f center_{Vec3f::zero()};           ///< Center point
     Vec3f half_extents_{0.5f, 0.5f, 0.5f};  ///< Half-extents along local axes
     Quatf orientation_{Quatf::identity()};  ///< Orientation quaternion
+    Mat3f basis_{Mat3f::identity()};        ///< Cached rotation; column i is local axis i
 };
 
+/**
+ * @brief Tests one OBB against many candidates.
+ *
+ * Runs the same separating-axis test as Obb::intersects(const Obb&) on four
+ * candidates per iteration with SIMD; a block stops as soon as every lane has
+ * found a separating axis.
+ *
+ * @param query The box tested against every candidate
+ * @param candidates Boxes to test
+ * @param out_hits Receives 1 for each intersecting candidate and 0 otherwise
+ * @return Number of intersecting candidates
+ */
+size_t intersects(const Obb& query, std::span<const Obb> candidates, std::span<uint8_t> out_hits) noexcept;
+
 }  // namespace vne::math
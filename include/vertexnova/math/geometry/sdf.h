@@ -0,0 +1,262 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Signed distance fields: analytic primitives, smooth CSG operators, batch
+ * evaluation and sparse-brick volumes baked from triangle meshes.
+ * ----------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "../core/quat.h"
+#include "../core/types.h"
+#include "../core/vec.h"
+#include "aabb.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace vne::math {
+
+// ============================================================================
+// Primitives
+// ============================================================================
+
+/**
+ * @brief Signed distance functions of primitives in their local frame.
+ *
+ * Every primitive is centered on the origin; round shapes are symmetric
+ * about the Y axis. Distances are exact (negative inside) except where
+ * noted. Transform the query point into the local frame first, or use
+ * SdfPrimitive, which does it.
+ */
+[[nodiscard]] float sdfSphere(const Vec3f& p, float radius) noexcept;
+
+/// Box with the given half-extents
+[[nodiscard]] float sdfBox(const Vec3f& p, const Vec3f& half_extents) noexcept;
+
+/// Box with the given outer half-extents whose edges are rounded by @p radius
+[[nodiscard]] float sdfRoundedBox(const Vec3f& p, const Vec3f& half_extents, float radius) noexcept;
+
+/// Torus lying in the XZ plane: a ring of @p major_radius swept by a circle of @p minor_radius
+[[nodiscard]] float sdfTorus(const Vec3f& p, float major_radius, float minor_radius) noexcept;
+
+/// Capped cylinder along Y spanning [-half_height, half_height]
+[[nodiscard]] float sdfCylinder(const Vec3f& p, float half_height, float radius) noexcept;
+
+/**
+ * @brief Capped cone along Y spanning [-half_height, half_height].
+ *
+ * @param bottom_radius Radius at y = -half_height
+ * @param top_radius Radius at y = +half_height (0 for a pointed cone)
+ */
+[[nodiscard]] float sdfCone(const Vec3f& p, float half_height, float bottom_radius, float top_radius) noexcept;
+
+// ============================================================================
+// Operators
+// ============================================================================
+
+/**
+ * @brief Smooth union (polynomial smooth minimum).
+ *
+ * Blends the two surfaces over a region of width @p k; k <= 0 gives the
+ * hard union min(a, b). The result is a bound rather than an exact distance
+ * inside the blend region.
+ */
+[[nodiscard]] inline float sdfSmoothUnion(float a, float b, float k) noexcept {
+    if (k <= 0.0f) {
+        return std::min(a, b);
+    }
+    const float h = std::max(k - std::abs(a - b), 0.0f) / k;
+    return std::min(a, b) - h * h * k * 0.25f;
+}
+
+/**
+ * @brief Smooth intersection (smooth maximum); k <= 0 gives max(a, b).
+ */
+[[nodiscard]] inline float sdfSmoothIntersection(float a, float b, float k) noexcept {
+    return -sdfSmoothUnion(-a, -b, k);
+}
+
+/**
+ * @brief Smoothly carves @p b out of @p a; k <= 0 gives max(a, -b).
+ */
+[[nodiscard]] inline float sdfSmoothSubtraction(float a, float b, float k) noexcept {
+    return sdfSmoothIntersection(a, -b, k);
+}
+
+// ============================================================================
+// Placed Primitives and Batch Evaluation
+// ============================================================================
+
+/**
+ * @struct SdfPrimitive
+ * @brief A primitive with a position and orientation, for batch evaluation.
+ *
+ * Build one with the factories; params holds the shape dimensions in the
+ * order of the matching sdf*() function.
+ */
+struct SdfPrimitive {
+    /// Kind of primitive
+    enum class Type : uint8_t {
+        eSphere,      ///< params.x = radius
+        eBox,         ///< params.xyz = half-extents
+        eRoundedBox,  ///< params.xyz = half-extents, params.w = edge radius
+        eTorus,       ///< params.x = major radius, params.y = minor radius
+        eCylinder,    ///< params.x = half height, params.y = radius
+        eCone,        ///< params.x = half height, params.y = bottom radius, params.z = top radius
+    };
+
+    Type type{Type::eSphere};              ///< Kind of primitive
+    Vec3f center{Vec3f::zero()};           ///< World position of the local origin
+    Quatf orientation{Quatf::identity()};  ///< World rotation of the local frame (unit length)
+    Vec4f params{1.0f, 0.0f, 0.0f, 0.0f};  ///< Dimensions, see Type
+
+    [[nodiscard]] static SdfPrimitive sphere(const Vec3f& center, float radius) noexcept;
+    [[nodiscard]] static SdfPrimitive box(const Vec3f& center,
+                                          const Vec3f& half_extents,
+                                          const Quatf& orientation = Quatf::identity()) noexcept;
+    [[nodiscard]] static SdfPrimitive roundedBox(const Vec3f& center,
+                                                 const Vec3f& half_extents,
+                                                 float radius,
+                                                 const Quatf& orientation = Quatf::identity()) noexcept;
+    [[nodiscard]] static SdfPrimitive torus(const Vec3f& center,
+                                            float major_radius,
+                                            float minor_radius,
+                                            const Quatf& orientation = Quatf::identity()) noexcept;
+    [[nodiscard]] static SdfPrimitive cylinder(const Vec3f& center,
+                                               float half_height,
+                                               float radius,
+                                               const Quatf& orientation = Quatf::identity()) noexcept;
+    [[nodiscard]] static SdfPrimitive cone(const Vec3f& center,
+                                           float half_height,
+                                           float bottom_radius,
+                                           float top_radius,
+                                           const Quatf& orientation = Quatf::identity()) noexcept;
+
+    /**
+     * @brief Signed distance from a world-space point.
+     */
+    [[nodiscard]] float distance(const Vec3f& point) const noexcept;
+};
+
+/**
+ * @brief Evaluates one primitive at many points, four points per SIMD iteration.
+ *
+ * @param primitive The primitive
+ * @param points World-space query points
+ * @param out Receives the signed distance of each point
+ */
+void evaluate(const SdfPrimitive& primitive, std::span<const Vec3f> points, std::span<float> out) noexcept;
+
+/**
+ * @brief Evaluates the smooth union of several primitives at many points.
+ *
+ * Each block of four points is carried through every primitive while it is
+ * in registers, so the points are read once.
+ *
+ * @param primitives Primitives combined with sdfSmoothUnion(); empty gives +infinity
+ * @param points World-space query points
+ * @param out Receives the signed distance of each point
+ * @param smoothness Blend width passed to sdfSmoothUnion() (0 for a hard union)
+ */
+void evaluate(std::span<const SdfPrimitive> primitives,
+              std::span<const Vec3f> points,
+              std::span<float> out,
+              float smoothness = 0.0f) noexcept;
+
+// ============================================================================
+// Sparse Brick Volumes
+// ============================================================================
+
+/**
+ * @struct SdfBakeSettings
+ * @brief Resolution and narrow band of a baked SdfVolume.
+ */
+struct SdfBakeSettings {
+    float voxel_size{0.05f};  ///< Spacing of the distance samples
+    float padding{0.1f};      ///< Margin added around the mesh bounds
+    float narrow_band{0.1f};  ///< Bricks farther than this from the surface keep only their corner values
+    uint32_t brick_size{8};   ///< Cells along each brick side; a brick stores (brick_size + 1)^3 samples
+};
+
+/**
+ * @class SdfVolume
+ * @brief Signed distance field of a triangle mesh, sampled on a sparse brick grid.
+ *
+ * The volume is split into bricks of brick_size^3 cells. Only bricks within
+ * the narrow band of the surface store their samples; the others are
+ * represented by the distances at the brick-grid corners, so far-field
+ * queries still get a continuous (coarser) answer. Each brick duplicates its
+ * boundary samples, which keeps every trilinear lookup inside one brick.
+ *
+ * Unsigned distances come from a BVH closest-point search; the sign comes
+ * from the generalized winding number, so meshes with small holes or
+ * self-intersections still get a sensible inside.
+ */
+class SdfVolume {
+   public:
+    SdfVolume() noexcept = default;
+
+    /**
+     * @brief Bakes the signed distance field of an indexed triangle mesh.
+     *
+     * Triangles should wind counter-clockwise seen from outside.
+     *
+     * @param vertices Mesh positions
+     * @param indices Three indices per triangle
+     * @param settings Resolution and narrow band
+     * @return The baked volume, empty() if the mesh or settings are invalid
+     */
+    [[nodiscard]] static SdfVolume bake(std::span<const Vec3f> vertices,
+                                        std::span<const uint32_t> indices,
+                                        const SdfBakeSettings& settings = SdfBakeSettings{});
+
+   public:
+    /**
+     * @brief Trilinearly interpolated signed distance at a point.
+     *
+     * Points outside the volume get the value at the nearest point of the
+     * volume plus the distance to it.
+     */
+    [[nodiscard]] float sample(const Vec3f& point) const noexcept;
+
+    /**
+     * @brief Samples many points.
+     */
+    void sample(std::span<const Vec3f> points, std::span<float> out) const noexcept;
+
+   public:
+    /// True if nothing was baked
+    [[nodiscard]] bool empty() const noexcept { return brick_index_.empty(); }
+
+    /// Region covered by the samples
+    [[nodiscard]] const Aabb& bounds() const noexcept { return bounds_; }
+
+    /// Distance between neighbouring samples
+    [[nodiscard]] float voxelSize() const noexcept { return voxel_size_; }
+
+    /// Number of bricks in the grid
+    [[nodiscard]] size_t brickCount() const noexcept { return brick_index_.size(); }
+
+    /// Number of bricks that store samples (the rest are outside the narrow band)
+    [[nodiscard]] size_t allocatedBrickCount() const noexcept;
+
+    /// Bytes used by samples and brick tables
+    [[nodiscard]] size_t memoryUsage() const noexcept;
+
+   private:
+    Aabb bounds_;
+    float voxel_size_{0.0f};
+    uint32_t brick_size_{0};
+    uint32_t bricks_[3]{0, 0, 0};       ///< Brick grid dimensions
+    std::vector<int32_t> brick_index_;  ///< Per brick: index of its sample block, or -1 outside the band
+    std::vector<float> samples_;        ///< (brick_size + 1)^3 samples per allocated brick
+    std::vector<float> corners_;        ///< Signed distance at every brick-grid corner
+};
+
+}  // namespace vne::math
@@ -0,0 +1,190 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Continuous collision detection: time of impact of moving shapes, so
+ * fast bodies cannot tunnel through thin geometry between steps.
+ * ----------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include "../core/vec.h"
+#include "aabb.h"
+#include "capsule.h"
+#include "gjk.h"
+#include "obb.h"
+#include "sphere.h"
+#include "triangle.h"
+
+#include <cstdint>
+#include <span>
+
+namespace vne::math {
+
+// ============================================================================
+// Sweep Result
+// ============================================================================
+
+/**
+ * @struct SweepHit
+ * @brief First contact of a shape moving along a straight path.
+ *
+ * A shape sweeps from its current position to position + motion; time is the
+ * fraction of that motion travelled at first contact. Shapes that already
+ * overlap report time 0.
+ */
+struct SweepHit {
+    float time = -1.0f;  ///< Fraction of the motion in [0, 1] at first contact
+    Vec3f point;         ///< Contact point at the time of impact
+    Vec3f normal;        ///< Unit normal of the struck surface, pointing back at the moving shape
+    uint32_t index = 0;  ///< Struck triangle or obstacle in mesh and batch queries
+
+    /**
+     * @brief Creates an empty/invalid hit.
+     */
+    static constexpr SweepHit none() noexcept { return SweepHit{-1.0f, Vec3f::zero(), Vec3f::zero(), 0}; }
+
+    /**
+     * @brief Checks if this represents a valid hit.
+     */
+    [[nodiscard]] constexpr bool valid() const noexcept { return time >= 0.0f; }
+
+    /**
+     * @brief Implicit conversion to bool.
+     */
+    [[nodiscard]] constexpr explicit operator bool() const noexcept { return valid(); }
+};
+
+// ============================================================================
+// Swept Sphere
+// ============================================================================
+
+/**
+ * @brief Sweeps a sphere against a triangle.
+ *
+ * Tests the face first (the sphere touching the plane inside the triangle);
+ * otherwise the earliest hit among the three edges (ray against cylinder) and
+ * vertices (ray against sphere).
+ *
+ * @param sphere The moving sphere at its start position
+ * @param motion Displacement over the step
+ * @param triangle The static triangle (either side can be hit)
+ */
+[[nodiscard]] SweepHit sweep(const Sphere& sphere, const Vec3f& motion, const Triangle& triangle) noexcept;
+
+/**
+ * @brief Sweeps a sphere against an indexed triangle mesh.
+ *
+ * Triangles whose bounds miss the swept bounds of the sphere are skipped; the
+ * scan is linear, so large worlds should be narrowed by a broadphase first.
+ *
+ * @param vertices Mesh positions
+ * @param indices Three indices per triangle
+ * @return The earliest hit; index is the triangle number (first index / 3)
+ */
+[[nodiscard]] SweepHit sweep(const Sphere& sphere,
+                             const Vec3f& motion,
+                             std::span<const Vec3f> vertices,
+                             std::span<const uint32_t> indices) noexcept;
+
+// ============================================================================
+// Swept AABB
+// ============================================================================
+
+/**
+ * @brief Sweeps a box against a static box (slab method).
+ *
+ * The obstacle is grown by the moving box's half-extents, which turns the
+ * query into a ray cast of the box center over [0, 1]. Zero motion components
+ * are handled without dividing, so the test is NaN-free.
+ */
+[[nodiscard]] SweepHit sweep(const Aabb& box, const Vec3f& motion, const Aabb& obstacle) noexcept;
+
+// ============================================================================
+// Swept Capsule
+// ============================================================================
+
+/**
+ * @brief Sweeps a capsule against a static oriented box.
+ *
+ * Conservative advancement on the capsule core, see timeOfImpact().
+ */
+[[nodiscard]] SweepHit sweep(const Capsule& capsule,
+                             const Vec3f& motion,
+                             const Obb& obstacle,
+                             float tolerance = 1e-3f) noexcept;
+
+// ============================================================================
+// Conservative Advancement
+// ============================================================================
+
+/**
+ * @brief Time of impact of two translating convex shapes.
+ *
+ * Conservative advancement: GJK gives the distance d and normal n at the
+ * current time, and the shapes are advanced by d / (relative motion . n).
+ * Because the distance is convex along a linear path this never steps past
+ * the contact, and the simplex is warm-started between steps.
+ *
+ * @param a First shape at its start position
+ * @param motion_a Displacement of @p a over the step
+ * @param b Second shape at its start position
+ * @param motion_b Displacement of @p b over the step
+ * @param tolerance Gap (in world units) that counts as contact
+ * @return First contact; point is on @p b and normal points from @p b to @p a
+ */
+[[nodiscard]] SweepHit timeOfImpact(const ConvexShape& a,
+                                    const Vec3f& motion_a,
+                                    const ConvexShape& b,
+                                    const Vec3f& motion_b,
+                                    float tolerance = 1e-3f) noexcept;
+
+// ============================================================================
+// Batch Sweeps Against a Static World
+// ============================================================================
+
+/**
+ * @brief Sweeps many spheres against one static triangle mesh.
+ *
+ * @param spheres Moving spheres
+ * @param motions Displacement of each sphere
+ * @param out Receives the earliest hit of each sphere (none() if it moves freely)
+ * @return Number of spheres that hit the mesh
+ */
+size_t sweep(std::span<const Sphere> spheres,
+             std::span<const Vec3f> motions,
+             std::span<const Vec3f> vertices,
+             std::span<const uint32_t> indices,
+             std::span<SweepHit> out) noexcept;
+
+/**
+ * @brief Sweeps many boxes against static boxes.
+ *
+ * Each moving box is slab-tested against four obstacles per SIMD iteration;
+ * only the earliest obstacle is then re-run in scalar code for the contact
+ * point and normal.
+ *
+ * @return Number of boxes that hit an obstacle
+ */
+size_t sweep(std::span<const Aabb> boxes,
+             std::span<const Vec3f> motions,
+             std::span<const Aabb> world,
+             std::span<SweepHit> out) noexcept;
+
+/**
+ * @brief Sweeps many capsules against static oriented boxes.
+ *
+ * Obstacles whose bounds miss the capsule's swept bounds are skipped before
+ * conservative advancement runs.
+ *
+ * @return Number of capsules that hit an obstacle
+ */
+size_t sweep(std::span<const Capsule> capsules,
+             std::span<const Vec3f> motions,
+             std::span<const Obb> world,
+             std::span<SweepHit> out,
+             float tolerance = 1e-3f) noexcept;
+
+}  // namespace vne::math
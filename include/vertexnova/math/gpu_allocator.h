@@ -0,0 +1,225 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file gpu_allocator.h
+ * @brief Lock-free linear and ring sub-allocators over mapped GPU memory.
+ */
+
+// Project includes
+#include "vertexnova/math/gpu_types.h"
+
+// Standard library includes
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace vne::math {
+
+/**
+ * @struct GpuAllocation
+ * @brief A sub-range of a mapped GPU buffer.
+ *
+ * An empty allocation (data() == nullptr) means the allocator was exhausted.
+ */
+struct GpuAllocation {
+    std::span<std::byte> data;  ///< CPU-visible bytes to write
+    size_t offset{0};           ///< Byte offset inside the GPU buffer, for binding / dynamic offsets
+    size_t stride{0};           ///< Bytes between blocks for allocateBlocks(); the size otherwise
+
+    [[nodiscard]] bool valid() const noexcept { return data.data() != nullptr; }
+    [[nodiscard]] explicit operator bool() const noexcept { return valid(); }
+};
+
+/**
+ * @brief Stride of consecutive blocks of a GpuStructLayout inside one allocation.
+ *
+ * std140 blocks are bound one at a time through dynamic uniform offsets, so
+ * each one starts on gpu::kUniformBufferAlign. std430 and Metal blocks are read
+ * as a storage buffer array and are tightly packed at their size.
+ */
+template<typename Block>
+[[nodiscard]] constexpr size_t gpuBlockStride() noexcept {
+    return Block::kLayout == GpuBufferLayout::eStd140 ? Block::kUniformStride : Block::kSize;
+}
+
+/**
+ * @class GpuLinearAllocator
+ * @brief Bump allocator over a caller-provided mapped memory region.
+ *
+ * allocate() is lock-free and may be called from any number of threads at
+ * once (one compare-and-swap per allocation). reset() recycles the whole
+ * region and must not race with allocate(). Offsets are aligned relative to
+ * the start of the GPU buffer, so the region may itself sit at a non-zero
+ * offset inside a larger buffer.
+ *
+ * @code
+ * GpuLinearAllocator frame_uniforms(mapped, 0);
+ * // Any recording thread:
+ * GpuAllocation a = frame_uniforms.allocateBlocks<DrawBlock>(draws.size());
+ * DrawBlock::pack(draws, a.data, a.stride);
+ * @endcode
+ */
+class GpuLinearAllocator {
+   public:
+    GpuLinearAllocator() noexcept = default;
+
+    /**
+     * @brief Creates an allocator over @p memory.
+     *
+     * @param memory Mapped bytes the allocator hands out
+     * @param buffer_offset Offset of memory.data() inside the GPU buffer
+     * @param min_alignment Smallest offset alignment handed out (the device's
+     *        minUniformBufferOffsetAlignment; a power of two)
+     */
+    explicit GpuLinearAllocator(std::span<std::byte> memory,
+                                size_t buffer_offset = 0,
+                                size_t min_alignment = gpu::kUniformBufferAlign) noexcept;
+
+    GpuLinearAllocator(const GpuLinearAllocator&) = delete;
+    GpuLinearAllocator& operator=(const GpuLinearAllocator&) = delete;
+
+   public:
+    /**
+     * @brief Allocates @p size bytes aligned to max(alignment, min_alignment).
+     * @return The allocation, or an empty one if the region is exhausted
+     */
+    [[nodiscard]] GpuAllocation allocate(size_t size, size_t alignment = gpu::kScalarAlign) noexcept;
+
+    /**
+     * @brief Allocates @p count consecutive blocks of a GpuStructLayout.
+     *
+     * The returned stride is gpuBlockStride<Block>().
+     */
+    template<typename Block>
+    [[nodiscard]] GpuAllocation allocateBlocks(size_t count = 1) noexcept {
+        if (count == 0) {
+            return {};
+        }
+        constexpr size_t kStride = gpuBlockStride<Block>();
+        GpuAllocation allocation = allocate((count - 1) * kStride + Block::kSize, Block::kAlignment);
+        allocation.stride = allocation.valid() ? kStride : 0;
+        return allocation;
+    }
+
+    /// Makes the whole region available again. Not thread-safe against allocate().
+    void reset() noexcept;
+
+    /// Bytes handed out so far, including alignment padding
+    [[nodiscard]] size_t used() const noexcept;
+
+    /// Size of the managed region
+    [[nodiscard]] size_t capacity() const noexcept { return memory_.size(); }
+
+   private:
+    std::span<std::byte> memory_;
+    size_t buffer_offset_{0};
+    size_t min_alignment_{gpu::kUniformBufferAlign};
+    std::atomic<size_t> head_{0};
+};
+
+/**
+ * @class GpuRingAllocator
+ * @brief Per-frame ring allocator for data the GPU reads while later frames record.
+ *
+ * Allocations advance a head through the region and wrap back to the start;
+ * an allocation never straddles the end. Memory written during a frame stays
+ * untouched until that frame's slot comes round again, so with N frames in
+ * flight the caller only has to wait on the fence of frame (current - N)
+ * before beginFrame() - the usual swapchain pacing.
+ *
+ * allocate() is lock-free and may be called from any number of threads.
+ * beginFrame() and reset() must be called from one thread while no
+ * allocation is in progress.
+ */
+class GpuRingAllocator {
+   public:
+    /// Upper bound on frames in flight
+    static constexpr uint32_t kMaxFramesInFlight = 8;
+
+    GpuRingAllocator() noexcept = default;
+
+    /**
+     * @brief Creates a ring over @p memory.
+     *
+     * @param memory Mapped bytes the allocator hands out
+     * @param frames_in_flight Frames the GPU may still be reading (1..kMaxFramesInFlight)
+     * @param buffer_offset Offset of memory.data() inside the GPU buffer
+     * @param min_alignment Smallest offset alignment handed out (a power of two)
+     */
+    GpuRingAllocator(std::span<std::byte> memory,
+                     uint32_t frames_in_flight,
+                     size_t buffer_offset = 0,
+                     size_t min_alignment = gpu::kUniformBufferAlign) noexcept;
+
+    GpuRingAllocator(const GpuRingAllocator&) = delete;
+    GpuRingAllocator& operator=(const GpuRingAllocator&) = delete;
+
+   public:
+    /**
+     * @brief Starts recording a new frame.
+     *
+     * Retires the memory of the frame that last used the incoming slot, i.e.
+     * frames_in_flight frames ago. The caller must have waited for the GPU to
+     * finish that frame.
+     */
+    void beginFrame() noexcept;
+
+    /**
+     * @brief Allocates @p size bytes aligned to max(alignment, min_alignment).
+     * @return The allocation, or an empty one if the ring is full
+     */
+    [[nodiscard]] GpuAllocation allocate(size_t size, size_t alignment = gpu::kScalarAlign) noexcept;
+
+    /**
+     * @brief Allocates @p count consecutive blocks of a GpuStructLayout.
+     *
+     * The returned stride is gpuBlockStride<Block>().
+     */
+    template<typename Block>
+    [[nodiscard]] GpuAllocation allocateBlocks(size_t count = 1) noexcept {
+        if (count == 0) {
+            return {};
+        }
+        constexpr size_t kStride = gpuBlockStride<Block>();
+        GpuAllocation allocation = allocate((count - 1) * kStride + Block::kSize, Block::kAlignment);
+        allocation.stride = allocation.valid() ? kStride : 0;
+        return allocation;
+    }
+
+    /// Forgets every frame. The GPU must be idle.
+    void reset() noexcept;
+
+    /// Bytes still reserved by the current and in-flight frames
+    [[nodiscard]] size_t used() const noexcept;
+
+    /// Size of the managed region
+    [[nodiscard]] size_t capacity() const noexcept { return memory_.size(); }
+
+    /// Slot of the frame being recorded, in [0, frames_in_flight)
+    [[nodiscard]] uint32_t frameIndex() const noexcept { return frame_; }
+
+   private:
+    std::span<std::byte> memory_;
+    size_t buffer_offset_{0};
+    size_t min_alignment_{gpu::kUniformBufferAlign};
+    uint32_t frames_in_flight_{1};
+    uint32_t frame_{0};
+    /// Head and tail are monotonic byte positions; position % capacity is the offset.
+    std::atomic<uint64_t> head_{0};
+    std::atomic<uint64_t> tail_{0};
+    std::array<uint64_t, kMaxFramesInFlight> frame_ends_{};
+};
+
+}  // namespace vne::math
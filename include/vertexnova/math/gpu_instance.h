@@ -0,0 +1,197 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Compact per-instance transform formats for GPU instance buffers.
+ * ----------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "core/mat.h"
+#include "core/quat.h"
+#include "core/vec.h"
+#include "gpu_types.h"
+#include "transform_utils.h"
+
+#include <bit>
+#include <cstdint>
+#include <span>
+
+namespace vne::math {
+
+// ============================================================================
+// Half-Precision Floats
+// ============================================================================
+
+/**
+ * @brief Converts a float to IEEE 754 binary16 bits (round to nearest even).
+ *
+ * Overflow becomes infinity, tiny values become subnormals or zero, and NaN
+ * stays NaN. Matches GLSL packHalf2x16 / HLSL f32tof16.
+ */
+[[nodiscard]] constexpr uint16_t packHalf(float value) noexcept {
+    const uint32_t bits = std::bit_cast<uint32_t>(value);
+    const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+    const uint32_t abs = bits & 0x7FFFFFFFu;
+
+    if (abs - 0x38800000u < 0x477FF000u - 0x38800000u) {
+        // Normal half range [2^-14, 65520): rebias the exponent from 127 to 15 and
+        // round off 13 mantissa bits to nearest even
+        const uint32_t rounded = abs + 0x0FFFu + ((abs >> 13) & 1u);
+        return static_cast<uint16_t>(sign | ((rounded - 0x38000000u) >> 13));
+    }
+    if (abs >= 0x7F800000u) {
+        // Infinity, or NaN with a quiet bit so it cannot collapse to infinity
+        return static_cast<uint16_t>(sign | 0x7C00u | (abs > 0x7F800000u ? 0x0200u : 0u));
+    }
+    if (abs >= 0x477FF000u) {
+        // 65520 and above round past the largest half (65504)
+        return static_cast<uint16_t>(sign | 0x7C00u);
+    }
+    if (abs < 0x33000000u) {
+        // Below 2^-25: rounds to zero
+        return sign;
+    }
+
+    // Subnormal in units of 2^-24
+    const uint32_t mantissa = (abs & 0x007FFFFFu) | 0x00800000u;
+    const uint32_t shift = 126u - (abs >> 23);
+    const uint32_t halfway = 1u << (shift - 1);
+    const uint32_t remainder = mantissa & ((1u << shift) - 1);
+    uint32_t half = mantissa >> shift;
+    if (remainder > halfway || (remainder == halfway && (half & 1u))) {
+        ++half;
+    }
+    return static_cast<uint16_t>(sign | half);
+}
+
+/**
+ * @brief Converts IEEE 754 binary16 bits to a float (exact).
+ */
+[[nodiscard]] constexpr float unpackHalf(uint16_t half) noexcept {
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+    const uint32_t exponent = (half >> 10) & 0x1Fu;
+    const uint32_t mantissa = half & 0x03FFu;
+
+    if (exponent == 0) {
+        const float magnitude = static_cast<float>(mantissa) * (1.0f / 16777216.0f);  // 2^-24
+        return sign ? -magnitude : magnitude;
+    }
+    if (exponent == 31) {
+        return std::bit_cast<float>(sign | 0x7F800000u | (mantissa << 13));
+    }
+    return std::bit_cast<float>(sign | ((exponent + 112u) << 23) | (mantissa << 13));
+}
+
+// ============================================================================
+// Quaternion Compression
+// ============================================================================
+
+/**
+ * @brief Packs a unit quaternion into 32 bits ("smallest three").
+ *
+ * The largest-magnitude component is dropped (made positive, since q and -q
+ * are the same rotation) and its index stored in bits 30-31; the other three
+ * lie in [-1/sqrt(2), 1/sqrt(2)] and are stored with 10 bits each in bits
+ * 20-29, 10-19 and 0-9, in x, y, z, w order. Worst-case angular error is
+ * about 0.1 degrees.
+ *
+ * @param q Rotation (expected to be normalized)
+ */
+[[nodiscard]] uint32_t packQuaternion(const Quatf& q) noexcept;
+
+/**
+ * @brief Unpacks a quaternion written by packQuaternion().
+ *
+ * GLSL equivalent:
+ * @code
+ * vec4 unpackQuaternion(uint bits) {
+ *     vec3 abc = (vec3((uvec3(bits) >> uvec3(20, 10, 0)) & 1023u) / 1023.0 * 2.0 - 1.0) * 0.70710678;
+ *     float largest = sqrt(max(0.0, 1.0 - dot(abc, abc)));
+ *     uint index = bits >> 30;
+ *     return index == 0u ? vec4(largest, abc) : index == 1u ? vec4(abc.x, largest, abc.yz)
+ *          : index == 2u ? vec4(abc.xy, largest, abc.z) : vec4(abc, largest);
+ * }
+ * @endcode
+ */
+[[nodiscard]] Quatf unpackQuaternion(uint32_t bits) noexcept;
+
+// ============================================================================
+// Instance Formats
+// ============================================================================
+
+/**
+ * @struct GpuInstanceTrs
+ * @brief Quantized translation / rotation / scale for one instance (24 bytes).
+ *
+ * Scalar-only members keep the struct at 4-byte alignment, so an std430 or
+ * Metal storage buffer array of it has a 24-byte stride. Declare it in the
+ * shader as
+ * @code
+ * struct InstanceTrs { float px, py, pz; uint rotation; uint scale_xy; uint scale_z; };
+ * @endcode
+ * and decode scale with unpackHalf2x16(scale_xy) and unpackHalf2x16(scale_z).x.
+ */
+struct GpuInstanceTrs {
+    Vec3f position;        ///< Full-precision translation
+    uint32_t rotation{0};  ///< packQuaternion() bits
+    uint32_t scale_xy{0};  ///< Half-precision scale.x (low 16 bits) and scale.y (high 16 bits)
+    uint32_t scale_z{0};   ///< Half-precision scale.z in the low 16 bits
+};
+
+static_assert(sizeof(GpuInstanceTrs) == 24, "GpuInstanceTrs must be 24 bytes");
+static_assert(sizeof(GpuInstanceTrs)
+                  == GpuStructLayout<GpuBufferLayout::eStd430, float, float, float, uint32_t, uint32_t, uint32_t>::kSize,
+              "GpuInstanceTrs must match its std430 declaration");
+static_assert(isStd140Compatible<GpuAffine3f>(), "GpuAffine3f must be std140 compatible");
+
+/**
+ * @brief Quantizes one instance transform.
+ */
+[[nodiscard]] GpuInstanceTrs packInstanceTrs(const TransformComponents& components) noexcept;
+
+/**
+ * @brief Expands a quantized instance transform.
+ */
+[[nodiscard]] TransformComponents unpackInstanceTrs(const GpuInstanceTrs& instance) noexcept;
+
+// ============================================================================
+// Batch Instance Packing
+// ============================================================================
+
+/**
+ * @brief Converts world matrices to 3x4 affine instances (48 instead of 64 bytes).
+ *
+ * Each matrix is loaded as four SIMD columns and transposed; the bottom row is
+ * dropped, so matrices are expected to be affine.
+ *
+ * @param matrices World matrices
+ * @param out Receives one GpuAffine3f per matrix (e.g. a mapped instance buffer)
+ */
+void packInstances(std::span<const Mat4f> matrices, std::span<GpuAffine3f> out) noexcept;
+
+/**
+ * @brief Composes TRS components straight into 3x4 affine instances.
+ *
+ * Equivalent to GpuAffine3f(composeAffine(components[i])) for every element,
+ * processing four instances per iteration.
+ */
+void packInstances(std::span<const TransformComponents> components, std::span<GpuAffine3f> out) noexcept;
+
+/**
+ * @brief Quantizes TRS components into 24-byte instances.
+ *
+ * Equivalent to packInstanceTrs(components[i]) for every element; rotation
+ * selection and quantization run four instances at a time.
+ */
+void packInstances(std::span<const TransformComponents> components, std::span<GpuInstanceTrs> out) noexcept;
+
+/**
+ * @brief Decomposes world matrices and quantizes them into 24-byte instances.
+ *
+ * Matrices must be free of shear (see decompose()).
+ */
+void packInstances(std::span<const Mat4f> matrices, std::span<GpuInstanceTrs> out) noexcept;
+
+}  // namespace vne::math
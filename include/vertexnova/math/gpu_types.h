@@ -12,14 +12,21 @@
  * - Aligned vector/matrix types for GPU buffers (std140/std430)
  * - Compile-time alignment validation macros
  * - Padding helpers
+ * - Compile-time std140/std430/Metal block layouts and a bulk block packer
  * ----------------------------------------------------------------------
  */
 
 #include "core/types.h"
 #include "core/vec.h"
 #include "core/mat.h"
+#include "core/affine.h"
 
+#include "vertexnova/common/macros.h"
+
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <span>
 #include <type_traits>
 
 namespace vne::math {
@@ -151,6 +158,26 @@ struct alignas(16) GpuMat4f {
     }
 };
 
+/**
+ * @brief 16-byte aligned 3x4 affine transform for GPU buffers.
+ *
+ * Stored as 3 row vectors (48 bytes), matching Affine3f. In shaders read it as
+ * `vec4 rows[3]` (or a row-major float3x4) and transform a point with
+ * `vec3(dot(rows[0], p), dot(rows[1], p), dot(rows[2], p))` where p = vec4(pos, 1).
+ */
+struct alignas(16) GpuAffine3f {
+    GpuVec4f rows[3];
+
+    GpuAffine3f() = default;
+
+    constexpr GpuAffine3f(const Affine3f& a)  // NOLINT
+        : rows{GpuVec4f(a[0]), GpuVec4f(a[1]), GpuVec4f(a[2])} {}
+
+    [[nodiscard]] Affine3f toAffine3f() const {
+        return Affine3f(rows[0].toVec4f(), rows[1].toVec4f(), rows[2].toVec4f());
+    }
+};
+
 // ============================================================================
 // Padding Helpers
 // ============================================================================
@@ -328,6 +355,343 @@ constexpr size_t std140PaddedSize() {
     return Vec4f(v.x(), v.y(), v.z(), 0.0f);
 }
 
+// ============================================================================
+// Layout Descriptors
+// ============================================================================
+
+namespace gpu {
+
+/// Rounds @p value up to a multiple of @p alignment (a power of two).
+[[nodiscard]] constexpr size_t alignUp(size_t value, size_t alignment) noexcept {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+}  // namespace gpu
+
+/**
+ * @enum GpuFieldType
+ * @brief Shader-side type of one member of a GPU block.
+ */
+enum class GpuFieldType : uint8_t {
+    eFloat,  ///< float
+    eInt,    ///< int
+    eUint,   ///< uint
+    eVec2,   ///< vec2 / float2
+    eVec3,   ///< vec3 / float3
+    eVec4,   ///< vec4 / float4
+    eMat3,   ///< mat3 / float3x3 (three column vectors)
+    eMat4    ///< mat4 / float4x4
+};
+
+/**
+ * @brief Base alignment of a member under a layout standard.
+ *
+ * All three standards agree on single members: scalars 4, vec2 8 and
+ * everything vec3-sized or larger 16.
+ */
+[[nodiscard]] constexpr size_t gpuFieldAlignment(GpuFieldType type, GpuBufferLayout /*layout*/) noexcept {
+    switch (type) {
+        case GpuFieldType::eFloat:
+        case GpuFieldType::eInt:
+        case GpuFieldType::eUint:
+            return gpu::kScalarAlign;
+        case GpuFieldType::eVec2:
+            return gpu::kVec2Align;
+        default:
+            return gpu::kVec4Align;
+    }
+}
+
+/**
+ * @brief Bytes a member occupies under a layout standard.
+ *
+ * A vec3 occupies 12 bytes in std140/std430 (a following scalar may use the
+ * last 4 bytes of its slot) but a full 16 in Metal, where float3 is padded.
+ */
+[[nodiscard]] constexpr size_t gpuFieldSize(GpuFieldType type, GpuBufferLayout layout) noexcept {
+    switch (type) {
+        case GpuFieldType::eFloat:
+        case GpuFieldType::eInt:
+        case GpuFieldType::eUint:
+            return 4;
+        case GpuFieldType::eVec2:
+            return 8;
+        case GpuFieldType::eVec3:
+            return layout == GpuBufferLayout::eMetal ? 16 : 12;
+        case GpuFieldType::eVec4:
+            return 16;
+        case GpuFieldType::eMat3:
+            return 48;
+        default:
+            return 64;
+    }
+}
+
+/**
+ * @brief Alignment of an array member. std140 rounds array alignment up to a vec4.
+ */
+[[nodiscard]] constexpr size_t gpuArrayAlignment(GpuFieldType type, GpuBufferLayout layout) noexcept {
+    const size_t align = gpuFieldAlignment(type, layout);
+    return layout == GpuBufferLayout::eStd140 && align < gpu::kStructAlign ? gpu::kStructAlign : align;
+}
+
+/**
+ * @brief Bytes between consecutive array elements.
+ */
+[[nodiscard]] constexpr size_t gpuArrayStride(GpuFieldType type, GpuBufferLayout layout) noexcept {
+    return gpu::alignUp(gpuFieldSize(type, layout), gpuArrayAlignment(type, layout));
+}
+
+/**
+ * @brief Maps a CPU member type to its GpuFieldType.
+ *
+ * Specialized for float, int32_t, uint32_t, Vec2f, Vec3f, Vec4f, Mat3f, Mat4f
+ * and std::array of those (a fixed-size shader array).
+ */
+template<typename T>
+struct GpuFieldTraits;
+
+namespace detail {
+
+template<GpuFieldType Type>
+struct GpuSingleField {
+    static constexpr GpuFieldType kType = Type;
+    static constexpr bool kIsArray = false;
+    static constexpr uint32_t kCount = 1;
+};
+
+}  // namespace detail
+
+template<>
+struct GpuFieldTraits<float> : detail::GpuSingleField<GpuFieldType::eFloat> {};
+template<>
+struct GpuFieldTraits<int32_t> : detail::GpuSingleField<GpuFieldType::eInt> {};
+template<>
+struct GpuFieldTraits<uint32_t> : detail::GpuSingleField<GpuFieldType::eUint> {};
+template<>
+struct GpuFieldTraits<Vec2f> : detail::GpuSingleField<GpuFieldType::eVec2> {};
+template<>
+struct GpuFieldTraits<Vec3f> : detail::GpuSingleField<GpuFieldType::eVec3> {};
+template<>
+struct GpuFieldTraits<Vec4f> : detail::GpuSingleField<GpuFieldType::eVec4> {};
+template<>
+struct GpuFieldTraits<Mat3f> : detail::GpuSingleField<GpuFieldType::eMat3> {};
+template<>
+struct GpuFieldTraits<Mat4f> : detail::GpuSingleField<GpuFieldType::eMat4> {};
+
+template<typename T, size_t N>
+struct GpuFieldTraits<std::array<T, N>> : GpuFieldTraits<T> {
+    static_assert(!GpuFieldTraits<T>::kIsArray, "GpuFieldTraits: arrays of arrays are not supported");
+    static_assert(N > 0, "GpuFieldTraits: empty arrays are not supported");
+    static constexpr bool kIsArray = true;
+    static constexpr uint32_t kCount = static_cast<uint32_t>(N);
+};
+
+/**
+ * @struct GpuFieldLayout
+ * @brief Where one member lives inside a GPU block.
+ */
+struct GpuFieldLayout {
+    GpuFieldType type{GpuFieldType::eFloat};  ///< Element type
+    uint32_t offset{0};                       ///< Byte offset from the start of the block
+    uint32_t count{1};                        ///< Array length; 1 for plain members
+    uint32_t array_stride{0};                 ///< Bytes between array elements; 0 for plain members
+
+    [[nodiscard]] constexpr bool operator==(const GpuFieldLayout&) const noexcept = default;
+};
+
+namespace detail {
+
+template<size_t N>
+struct GpuBlockInfo {
+    std::array<GpuFieldLayout, N> fields{};
+    size_t alignment{0};
+    size_t size{0};
+};
+
+template<GpuBufferLayout Layout, typename Member>
+constexpr void placeGpuField(GpuFieldLayout& field, size_t& offset, size_t& block_align) noexcept {
+    using Traits = GpuFieldTraits<Member>;
+    size_t align = gpuFieldAlignment(Traits::kType, Layout);
+    size_t size = gpuFieldSize(Traits::kType, Layout);
+    size_t stride = 0;
+    if constexpr (Traits::kIsArray) {
+        align = gpuArrayAlignment(Traits::kType, Layout);
+        stride = gpuArrayStride(Traits::kType, Layout);
+        size = stride * Traits::kCount;
+    }
+
+    offset = gpu::alignUp(offset, align);
+    field = {Traits::kType, static_cast<uint32_t>(offset), Traits::kCount, static_cast<uint32_t>(stride)};
+    offset += size;
+    block_align = align > block_align ? align : block_align;
+}
+
+template<GpuBufferLayout Layout, typename... Members>
+[[nodiscard]] constexpr GpuBlockInfo<sizeof...(Members)> computeGpuBlock() noexcept {
+    GpuBlockInfo<sizeof...(Members)> info;
+    // std140 rounds every struct up to a vec4; std430 and Metal use the largest member
+    info.alignment = Layout == GpuBufferLayout::eStd140 ? gpu::kStructAlign : gpu::kScalarAlign;
+    size_t offset = 0;
+    size_t index = 0;
+    (placeGpuField<Layout, Members>(info.fields[index++], offset, info.alignment), ...);
+    info.size = gpu::alignUp(offset, info.alignment);
+    return info;
+}
+
+template<auto First, auto... Rest>
+inline constexpr auto kFirstGpuMember = First;
+
+template<auto Member>
+struct GpuMemberPointer;
+
+template<typename Class, typename T, T Class::*Member>
+struct GpuMemberPointer<Member> {
+    using Object = Class;
+    using Type = T;
+};
+
+}  // namespace detail
+
+/**
+ * @struct GpuFieldSource
+ * @brief Strided CPU source of one member across a run of objects.
+ *
+ * Object i's value is read from `data + i * stride` bytes, so the same source
+ * describes an array of values (stride = sizeof(value)) or one member of an
+ * array of structs (stride = sizeof(struct)).
+ */
+struct GpuFieldSource {
+    const void* data{nullptr};  ///< First object's value
+    size_t stride{0};           ///< Bytes between consecutive objects' values
+};
+
+/**
+ * @brief Writes @p count GPU blocks into a mapped buffer.
+ *
+ * Block i starts at `dst.data() + i * dst_stride`; member f of it is read from
+ * @p sources[f] and written at fields[f].offset. Vector and matrix members go
+ * through 16-byte SIMD stores straight from the source values (vec3 and mat3
+ * columns are widened with w = 0), so the routine is suited to write-combined
+ * upload memory. Padding bytes between members are left untouched.
+ *
+ * @param fields Member layout, e.g. GpuStructLayout::kFields (offsets ascending)
+ * @param sources One source per field
+ * @param count Number of blocks to write
+ * @param dst Mapped destination; must hold (count - 1) * dst_stride bytes plus one block
+ * @param dst_stride Bytes between blocks, e.g. GpuStructLayout::kUniformStride
+ */
+void packGpuBlocks(std::span<const GpuFieldLayout> fields,
+                   std::span<const GpuFieldSource> sources,
+                   size_t count,
+                   std::span<std::byte> dst,
+                   size_t dst_stride) noexcept;
+
+/**
+ * @brief Compile-time layout of a GPU block from its ordered member types.
+ *
+ * Computes member offsets, block alignment and size for std140, std430 or
+ * Metal, so the CPU side never hand-places padding:
+ * @code
+ * // layout(std140) uniform Object { mat4 model; vec3 tint; float alpha; vec4 params[2]; };
+ * using ObjectBlock = GpuStructLayout<GpuBufferLayout::eStd140, Mat4f, Vec3f, float, std::array<Vec4f, 2>>;
+ * static_assert(ObjectBlock::offsetOf<2>() == 76);
+ * static_assert(ObjectBlock::kSize == 112);
+ *
+ * ObjectBlock::pack(mapped, ObjectBlock::kUniformStride, models, tints, alphas, params);
+ * @endcode
+ *
+ * @tparam Layout Buffer layout standard
+ * @tparam Members Member types in declaration order (see GpuFieldTraits)
+ */
+template<GpuBufferLayout Layout, typename... Members>
+struct GpuStructLayout {
+    static_assert(sizeof...(Members) > 0, "GpuStructLayout: a block needs at least one member");
+
+    static constexpr GpuBufferLayout kLayout = Layout;
+    static constexpr size_t kMemberCount = sizeof...(Members);
+
+   private:
+    static constexpr detail::GpuBlockInfo<kMemberCount> kInfo = detail::computeGpuBlock<Layout, Members...>();
+
+   public:
+    /// Per-member placement in declaration order
+    static constexpr std::array<GpuFieldLayout, kMemberCount> kFields = kInfo.fields;
+
+    /// Base alignment of the block
+    static constexpr size_t kAlignment = kInfo.alignment;
+
+    /// Block size including trailing padding
+    static constexpr size_t kSize = kInfo.size;
+
+    /// Stride for one block per dynamic uniform buffer offset
+    static constexpr size_t kUniformStride = gpu::alignUp(kSize, gpu::kUniformBufferAlign);
+
+    /// Byte offset of member I
+    template<size_t I>
+    [[nodiscard]] static constexpr size_t offsetOf() noexcept {
+        static_assert(I < kMemberCount, "GpuStructLayout::offsetOf: member index out of range");
+        return kFields[I].offset;
+    }
+
+    /**
+     * @brief Packs one block per object from parallel per-member arrays.
+     *
+     * Writes min(sources.size()...) blocks; all spans are expected to match.
+     */
+    static void pack(std::span<std::byte> dst, size_t dst_stride, std::span<const Members>... sources) noexcept {
+        const size_t sizes[] = {sources.size()...};
+        size_t count = sizes[0];
+        for (size_t size : sizes) {
+            VNE_ASSERT_MSG(size == sizes[0], "GpuStructLayout::pack: source spans must match");
+            count = size < count ? size : count;
+        }
+        const GpuFieldSource field_sources[] = {{sources.data(), sizeof(Members)}...};
+        packGpuBlocks(kFields, field_sources, count, dst, dst_stride);
+    }
+};
+
+/**
+ * @brief GpuStructLayout described by pointers to members of a CPU struct.
+ *
+ * The member list doubles as the shader block declaration and the packing
+ * recipe, so an array of CPU objects can be streamed into a mapped buffer
+ * without an intermediate GPU-side struct:
+ * @code
+ * struct DrawData { Mat4f model; Vec3f tint; float alpha; uint32_t id; };
+ * using DrawBlock = GpuBlock<GpuBufferLayout::eStd140, &DrawData::model, &DrawData::tint, &DrawData::alpha>;
+ * DrawBlock::pack(draws, mapped);  // one block per draw at kUniformStride
+ * @endcode
+ *
+ * @tparam Layout Buffer layout standard
+ * @tparam Members Pointers to data members of one struct, in shader declaration order
+ */
+template<GpuBufferLayout Layout, auto... Members>
+struct GpuBlock : GpuStructLayout<Layout, typename detail::GpuMemberPointer<Members>::Type...> {
+    using Base = GpuStructLayout<Layout, typename detail::GpuMemberPointer<Members>::Type...>;
+    using Object = typename detail::GpuMemberPointer<detail::kFirstGpuMember<Members...>>::Object;
+
+    static_assert((std::is_same_v<typename detail::GpuMemberPointer<Members>::Object, Object> && ...),
+                  "GpuBlock: all members must belong to the same struct");
+
+    /**
+     * @brief Packs one block per object.
+     *
+     * @param objects Source objects
+     * @param dst Mapped destination buffer
+     * @param dst_stride Bytes between blocks (defaults to one dynamic uniform offset step)
+     */
+    static void pack(std::span<const Object> objects,
+                     std::span<std::byte> dst,
+                     size_t dst_stride = Base::kUniformStride) noexcept {
+        if (objects.empty()) {
+            return;
+        }
+        const GpuFieldSource sources[] = {{&(objects.data()->*Members), sizeof(Object)}...};
+        packGpuBlocks(Base::kFields, sources, objects.size(), dst, dst_stride);
+    }
+};
+
 // ============================================================================
 // Example Usage Documentation
 // ============================================================================
@@ -0,0 +1,242 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Hot-path instrumentation: per-thread call counters, batch timing scopes and trace export.
+ * ----------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+/**
+ * Set to 1 (CMake option VNE_MATH_INSTRUMENTATION) to compile the probes into
+ * the library's hot paths. At 0 the probe macros expand to nothing, so the
+ * library carries no counters, clock reads or branches.
+ */
+#ifndef VNE_MATH_INSTRUMENTATION
+#define VNE_MATH_INSTRUMENTATION 0
+#endif
+
+namespace vne::math {
+
+/// True when the library was built with its probes compiled in.
+inline constexpr bool kInstrumentationEnabled = VNE_MATH_INSTRUMENTATION != 0;
+
+/**
+ * @enum Probe
+ * @brief Instrumented site in the library.
+ *
+ * Per-query probes only count calls; batch probes also record the element
+ * count and the time spent.
+ */
+enum class Probe : uint8_t {
+    // Per-query counters
+    eFrustumTest,          ///< Frustum contains(), intersects() and containsFully()
+    eRayTest,              ///< Ray intersect() and intersects() against a single primitive
+    eTransformNodeUpdate,  ///< TransformNode setLocalTransform(), composeTransform() or updateRootTransform()
+
+    // Timed batches
+    eTransformAabbs,    ///< transformAabbs()
+    eFrustumCull,       ///< Batch Frustum intersects()
+    eRayBatch,          ///< Ray against an Aabb span, or a TrianglePacket span (items are packets)
+    eObbBatch,          ///< Batch Obb intersects()
+    eCompose,           ///< Batch compose()
+    eDecompose,         ///< Batch decompose()
+    eDecomposeAffine,   ///< Batch decomposeAffine()
+    eProjectPoints,     ///< projectPoints()
+    eUnprojectPoints,   ///< unprojectPoints()
+    eSdfEvaluate,       ///< Batch SDF evaluate()
+    eSweep,             ///< Batch sweep() against a static world
+    eContacts,          ///< Batch generateContacts()
+    eInstancePacking,   ///< packInstances()
+
+    eCount
+};
+
+/// Number of probes.
+inline constexpr std::size_t kProbeCount = static_cast<std::size_t>(Probe::eCount);
+
+/**
+ * @brief Returns the name a probe is reported under, prefixed by its subsystem.
+ */
+[[nodiscard]] constexpr const char* probeName(Probe probe) noexcept {
+    switch (probe) {
+        case Probe::eFrustumTest:
+            return "frustum.test";
+        case Probe::eRayTest:
+            return "ray.test";
+        case Probe::eTransformNodeUpdate:
+            return "transform_node.update";
+        case Probe::eTransformAabbs:
+            return "aabb.transform_batch";
+        case Probe::eFrustumCull:
+            return "frustum.cull_batch";
+        case Probe::eRayBatch:
+            return "ray.batch";
+        case Probe::eObbBatch:
+            return "obb.intersect_batch";
+        case Probe::eCompose:
+            return "transform.compose_batch";
+        case Probe::eDecompose:
+            return "transform.decompose_batch";
+        case Probe::eDecomposeAffine:
+            return "transform.decompose_affine_batch";
+        case Probe::eProjectPoints:
+            return "projection.project_batch";
+        case Probe::eUnprojectPoints:
+            return "projection.unproject_batch";
+        case Probe::eSdfEvaluate:
+            return "sdf.evaluate_batch";
+        case Probe::eSweep:
+            return "sweep.batch";
+        case Probe::eContacts:
+            return "contact.generate_batch";
+        case Probe::eInstancePacking:
+            return "gpu_instance.pack_batch";
+        default:
+            return "unknown";
+    }
+}
+
+/**
+ * @struct ProbeStats
+ * @brief Totals for one probe.
+ */
+struct ProbeStats {
+    uint64_t calls{0};        ///< Times the site ran
+    uint64_t items{0};        ///< Elements processed by timed batches
+    uint64_t nanoseconds{0};  ///< Wall time inside timed batches
+};
+
+/**
+ * @struct InstrumentationSnapshot
+ * @brief Totals for every probe, summed over all threads since the last reset.
+ *
+ * Subtract two snapshots for per-frame figures without resetting:
+ * @code
+ * const InstrumentationSnapshot now = instrumentationSnapshot();
+ * const InstrumentationSnapshot frame = now - previous;
+ * previous = now;
+ * @endcode
+ */
+struct InstrumentationSnapshot {
+    std::array<ProbeStats, kProbeCount> probes{};
+    uint32_t threads{0};         ///< Threads that have hit a probe
+    uint64_t dropped_events{0};  ///< Trace events discarded because a thread's buffer was full
+
+    [[nodiscard]] const ProbeStats& operator[](Probe probe) const noexcept {
+        return probes[static_cast<std::size_t>(probe)];
+    }
+};
+
+/// Per-probe difference; @p threads is taken from @p a.
+[[nodiscard]] InstrumentationSnapshot operator-(const InstrumentationSnapshot& a,
+                                                const InstrumentationSnapshot& b) noexcept;
+
+/**
+ * @brief Aggregates the per-thread counters.
+ *
+ * Safe to call while other threads are running probes; their in-flight
+ * increments land in the next snapshot.
+ */
+[[nodiscard]] InstrumentationSnapshot instrumentationSnapshot();
+
+/**
+ * @brief Zeroes every counter and discards recorded trace events.
+ */
+void resetInstrumentation();
+
+/**
+ * @brief Starts or stops recording one trace event per timed batch.
+ *
+ * Off by default. Each thread buffers a bounded number of events; the rest are
+ * counted in InstrumentationSnapshot::dropped_events.
+ */
+void setTraceRecording(bool enabled) noexcept;
+
+/**
+ * @brief True while timed batches are being recorded.
+ */
+[[nodiscard]] bool isTraceRecording() noexcept;
+
+/**
+ * @brief Writes the recorded events as Chrome trace JSON.
+ *
+ * The output loads in chrome://tracing and Perfetto: one complete ("X") event
+ * per batch, timestamps in microseconds, the element count in args.items.
+ */
+void writeChromeTrace(std::ostream& os);
+
+/**
+ * @struct InstrumentationHooks
+ * @brief Callbacks around every timed batch, for forwarding to an external profiler.
+ *
+ * zone_begin runs when a batch starts and its return value is handed back to
+ * zone_end, so a Tracy-style profiler can map it onto its own zone contexts.
+ * Either callback may be null.
+ */
+struct InstrumentationHooks {
+    uint64_t (*zone_begin)(Probe probe, void* user_data){nullptr};
+    void (*zone_end)(Probe probe, uint64_t token, uint64_t items, void* user_data){nullptr};
+    void* user_data{nullptr};
+};
+
+/**
+ * @brief Installs @p hooks for every thread; pass a default-constructed value to remove them.
+ *
+ * A batch already in flight finishes with the hooks it started with.
+ */
+void setInstrumentationHooks(const InstrumentationHooks& hooks);
+
+/**
+ * @class ProbeScope
+ * @brief Counts one call of a timed batch and records its duration when destroyed.
+ *
+ * The library places these through VNE_MATH_PROBE_SCOPE(), which compiles
+ * away when instrumentation is off. The class itself is always available, so
+ * applications can time their own batches under a library probe.
+ */
+class ProbeScope {
+   public:
+    ProbeScope(Probe probe, uint64_t items) noexcept;
+    ~ProbeScope();
+
+    ProbeScope(const ProbeScope&) = delete;
+    ProbeScope& operator=(const ProbeScope&) = delete;
+
+   private:
+    const InstrumentationHooks* hooks_;
+    uint64_t items_;
+    uint64_t start_;
+    uint64_t token_{0};
+    Probe probe_;
+};
+
+namespace detail {
+
+/// Adds one call to @p probe on the calling thread. Out of line so the
+/// thread-local counters have a single definition inside the library.
+void countProbe(Probe probe) noexcept;
+
+}  // namespace detail
+
+}  // namespace vne::math
+
+#define VNE_MATH_PROBE_CONCAT_INNER(a, b) a##b
+#define VNE_MATH_PROBE_CONCAT(a, b) VNE_MATH_PROBE_CONCAT_INNER(a, b)
+
+#if VNE_MATH_INSTRUMENTATION
+/// Counts one call of a per-query probe.
+#define VNE_MATH_PROBE_COUNT(probe) ::vne::math::detail::countProbe(probe)
+/// Times the rest of the enclosing scope as one batch of @p items elements.
+#define VNE_MATH_PROBE_SCOPE(probe, items) \
+    const ::vne::math::ProbeScope VNE_MATH_PROBE_CONCAT(vne_probe_scope_, __LINE__)(probe, items)
+#else
+#define VNE_MATH_PROBE_COUNT(probe) static_cast<void>(0)
+#define VNE_MATH_PROBE_SCOPE(probe, items) static_cast<void>(0)
+#endif
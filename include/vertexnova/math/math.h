@@ -26,6 +26,8 @@
 #include "color.h"
 #include "transform_node.h"
 #include "random.h"
+#include "cpu_features.h"
+#include "instrumentation.h"
 
 // Interpolation and animation
 #include "easing.h"
@@ -39,6 +41,12 @@
 #include "transform_utils.h"
 #include "viewport.h"
 
+// Rendering utilities
+#include "gpu_allocator.h"
+#include "gpu_instance.h"
+#include "gpu_types.h"
+#include "shadow_cascades.h"
+
 // Geometry module includes
 #include "geometry/geometry.h"
 
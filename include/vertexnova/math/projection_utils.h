@@ -15,6 +15,9 @@
 #include "geometry/ray.h"
 #include "viewport.h"
 
+#include <cstdint>
+#include <span>
+
 namespace vne::math {
 
 // ============================================================================
@@ -22,21 +25,19 @@ namespace vne::math {
 // ============================================================================
 
 /**
- * @brief Projects a 3D world point to 2D screen coordinates.
+ * @brief Projects a 3D world point to 2D screen coordinates for an API fixed at compile time.
  *
- * This is the standard gluProject operation.
+ * Screen origin and depth range come from GraphicsApiTraits, so no per-call
+ * branching on the API remains.
  *
+ * @tparam Api Target graphics API
  * @param world_pos The 3D world position
  * @param mvp The combined Model-View-Projection matrix
  * @param viewport The viewport parameters
- * @param api Graphics API (for Y-flip handling)
- * @return Screen coordinates (x, y) and normalized depth (z)
- *         z is in [0,1] for most APIs, [-1,1] for OpenGL
+ * @return Screen coordinates (x, y) and depth mapped to the viewport range (z)
  */
-[[nodiscard]] inline Vec3f project(const Vec3f& world_pos,
-                                   const Mat4f& mvp,
-                                   const Viewport& viewport,
-                                   GraphicsApi api = GraphicsApi::eOpenGL) noexcept {
+template<GraphicsApi Api>
+[[nodiscard]] inline Vec3f project(const Vec3f& world_pos, const Mat4f& mvp, const Viewport& viewport) noexcept {
     // Transform to clip space
     Vec4f clip = mvp * Vec4f(world_pos, 1.0f);
 
@@ -53,7 +54,7 @@ namespace vne::math {
 
     // Handle screen-space origin convention.
     // Most APIs (Vulkan/Metal/DirectX/WebGPU) use top-left origin for framebuffers.
-    if (screenOriginIsTopLeft(api)) {
+    if constexpr (GraphicsApiTraits<Api>::kScreenOriginTopLeft) {
         sy = 1.0f - sy;
     }
 
@@ -62,16 +63,36 @@ namespace vne::math {
     float screen_y = viewport.y + sy * viewport.height;
 
     // Map depth to viewport range
-    float screen_z = viewport.z_near + (ndc.z() + 1.0f) * 0.5f * (viewport.z_far - viewport.z_near);
-
-    // For APIs with [0,1] depth, adjust
-    if (getClipSpaceDepth(api) == ClipSpaceDepth::eZeroToOne) {
+    float screen_z;
+    if constexpr (GraphicsApiTraits<Api>::kDepth == ClipSpaceDepth::eZeroToOne) {
         screen_z = viewport.z_near + ndc.z() * (viewport.z_far - viewport.z_near);
+    } else {
+        screen_z = viewport.z_near + (ndc.z() + 1.0f) * 0.5f * (viewport.z_far - viewport.z_near);
     }
 
     return Vec3f(screen_x, screen_y, screen_z);
 }
 
+/**
+ * @brief Projects a 3D world point to 2D screen coordinates.
+ *
+ * This is the standard gluProject operation.
+ *
+ * @param world_pos The 3D world position
+ * @param mvp The combined Model-View-Projection matrix
+ * @param viewport The viewport parameters
+ * @param api Graphics API (for Y-flip handling)
+ * @return Screen coordinates (x, y) and normalized depth (z)
+ *         z is in [0,1] for most APIs, [-1,1] for OpenGL
+ */
+[[nodiscard]] inline Vec3f project(const Vec3f& world_pos,
+                                   const Mat4f& mvp,
+                                   const Viewport& viewport,
+                                   GraphicsApi api = GraphicsApi::eOpenGL) noexcept {
+    return dispatchGraphicsApi(
+        api, [&](auto tag) { return project<decltype(tag)::value>(world_pos, mvp, viewport); });
+}
+
 /**
  * @brief Simplified project for common use case.
  */
@@ -89,26 +110,22 @@ namespace vne::math {
 // ============================================================================
 
 /**
- * @brief Unprojects a 2D screen point to a 3D world position.
+ * @brief Unprojects a 2D screen point to a 3D world position for an API fixed at compile time.
  *
- * This is the standard gluUnProject operation.
- *
- * @param screen_pos Screen coordinates (x, y) and depth (z in [0,1])
+ * @tparam Api Target graphics API
+ * @param screen_pos Screen coordinates (x, y) and depth (z in the viewport range)
  * @param inv_mvp The inverse of the Model-View-Projection matrix
  * @param viewport The viewport parameters
- * @param api Graphics API (for Y-flip handling)
  * @return World-space position
  */
-[[nodiscard]] inline Vec3f unproject(const Vec3f& screen_pos,
-                                     const Mat4f& inv_mvp,
-                                     const Viewport& viewport,
-                                     GraphicsApi api = GraphicsApi::eOpenGL) noexcept {
+template<GraphicsApi Api>
+[[nodiscard]] inline Vec3f unproject(const Vec3f& screen_pos, const Mat4f& inv_mvp, const Viewport& viewport) noexcept {
     // Screen (pixel) to normalized viewport coordinates [0, 1]
     float sx = (screen_pos.x() - viewport.x) / viewport.width;
     float sy = (screen_pos.y() - viewport.y) / viewport.height;
 
     // If screen-space uses top-left origin, invert Y to match NDC (+Y up) math
-    if (screenOriginIsTopLeft(api)) {
+    if constexpr (GraphicsApiTraits<Api>::kScreenOriginTopLeft) {
         sy = 1.0f - sy;
     }
 
@@ -118,7 +135,7 @@ namespace vne::math {
 
     // Unmap depth from viewport range to NDC
     float ndc_z;
-    if (getClipSpaceDepth(api) == ClipSpaceDepth::eZeroToOne) {
+    if constexpr (GraphicsApiTraits<Api>::kDepth == ClipSpaceDepth::eZeroToOne) {
         ndc_z = (screen_pos.z() - viewport.z_near) / (viewport.z_far - viewport.z_near);
     } else {
         ndc_z = (screen_pos.z() - viewport.z_near) / (viewport.z_far - viewport.z_near) * 2.0f - 1.0f;
@@ -138,6 +155,25 @@ namespace vne::math {
     return world.xyz() / world.w();
 }
 
+/**
+ * @brief Unprojects a 2D screen point to a 3D world position.
+ *
+ * This is the standard gluUnProject operation.
+ *
+ * @param screen_pos Screen coordinates (x, y) and depth (z in [0,1])
+ * @param inv_mvp The inverse of the Model-View-Projection matrix
+ * @param viewport The viewport parameters
+ * @param api Graphics API (for Y-flip handling)
+ * @return World-space position
+ */
+[[nodiscard]] inline Vec3f unproject(const Vec3f& screen_pos,
+                                     const Mat4f& inv_mvp,
+                                     const Viewport& viewport,
+                                     GraphicsApi api = GraphicsApi::eOpenGL) noexcept {
+    return dispatchGraphicsApi(
+        api, [&](auto tag) { return unproject<decltype(tag)::value>(screen_pos, inv_mvp, viewport); });
+}
+
 /**
  * @brief Simplified unproject for common use case.
  */
@@ -150,6 +186,156 @@ namespace vne::math {
     return unproject(Vec3f(screen_pos.x(), screen_pos.y(), depth), inv_mvp, Viewport(screen_width, screen_height), api);
 }
 
+// ============================================================================
+// Batch Projection
+// ============================================================================
+
+/**
+ * @struct ScreenMapping
+ * @brief NDC-to-screen affine map with the graphics API convention already resolved.
+ *
+ * screen = ndc * scale + offset, per component. Folds the viewport rectangle,
+ * depth range, screen-origin flip, and clip-space depth convention into six
+ * floats so batch kernels never branch on the API.
+ */
+struct ScreenMapping {
+    Vec3f scale{1.0f, 1.0f, 1.0f};   ///< Per-component NDC scale
+    Vec3f offset{0.0f, 0.0f, 0.0f};  ///< Per-component NDC offset
+
+    /**
+     * @brief Builds the mapping for a viewport and API known at runtime.
+     */
+    [[nodiscard]] static constexpr ScreenMapping create(const Viewport& viewport, GraphicsApi api) noexcept {
+        return create(viewport, screenOriginIsTopLeft(api), getClipSpaceDepth(api));
+    }
+
+    /**
+     * @brief Builds the mapping for an API known at compile time.
+     */
+    template<GraphicsApi Api>
+    [[nodiscard]] static constexpr ScreenMapping create(const Viewport& viewport) noexcept {
+        return create(viewport, GraphicsApiTraits<Api>::kScreenOriginTopLeft, GraphicsApiTraits<Api>::kDepth);
+    }
+
+    /**
+     * @brief Builds the mapping from explicit conventions.
+     *
+     * @param viewport The viewport parameters
+     * @param top_left_origin Whether screen Y grows downward
+     * @param depth Clip-space depth convention of the projection
+     */
+    [[nodiscard]] static constexpr ScreenMapping create(const Viewport& viewport,
+                                                        bool top_left_origin,
+                                                        ClipSpaceDepth depth) noexcept {
+        const float half_w = viewport.width * 0.5f;
+        const float half_h = viewport.height * 0.5f;
+        const float depth_range = viewport.z_far - viewport.z_near;
+
+        ScreenMapping mapping;
+        mapping.scale = Vec3f(half_w, top_left_origin ? -half_h : half_h, depth_range);
+        mapping.offset = Vec3f(viewport.x + half_w, viewport.y + half_h, viewport.z_near);
+        if (depth == ClipSpaceDepth::eNegativeOneToOne) {
+            mapping.scale.z() = depth_range * 0.5f;
+            mapping.offset.z() = viewport.z_near + depth_range * 0.5f;
+        }
+        return mapping;
+    }
+
+    /**
+     * @brief Maps an NDC position to screen coordinates.
+     */
+    [[nodiscard]] constexpr Vec3f toScreen(const Vec3f& ndc) const noexcept { return ndc * scale + offset; }
+
+    /**
+     * @brief Maps screen coordinates back to NDC.
+     */
+    [[nodiscard]] constexpr Vec3f toNdc(const Vec3f& screen) const noexcept { return (screen - offset) / scale; }
+};
+
+/**
+ * @brief Projects many world points to screen coordinates.
+ *
+ * Per-point results match project(). The clip transform and perspective divide
+ * run four points at a time with SIMD; the API convention is taken from
+ * @p mapping, so nothing is branched per point.
+ *
+ * @param world_points Input world positions
+ * @param mvp The combined Model-View-Projection matrix
+ * @param mapping NDC-to-screen mapping (see ScreenMapping::create)
+ * @param out_screen Receives screen x, y and depth per point
+ * @param out_visible Optional; receives 1 when the point is in front of the
+ *        camera (clip w > 0) and 0 otherwise. Pass an empty span to skip.
+ *
+ * Output spans must match the input size; in release builds only the smallest
+ * common size is processed.
+ */
+void projectPoints(std::span<const Vec3f> world_points,
+                   const Mat4f& mvp,
+                   const ScreenMapping& mapping,
+                   std::span<Vec3f> out_screen,
+                   std::span<uint8_t> out_visible = {}) noexcept;
+
+/**
+ * @brief Projects many world points, resolving the API convention once per call.
+ */
+inline void projectPoints(std::span<const Vec3f> world_points,
+                          const Mat4f& mvp,
+                          const Viewport& viewport,
+                          std::span<Vec3f> out_screen,
+                          GraphicsApi api = GraphicsApi::eOpenGL,
+                          std::span<uint8_t> out_visible = {}) noexcept {
+    projectPoints(world_points, mvp, ScreenMapping::create(viewport, api), out_screen, out_visible);
+}
+
+/**
+ * @brief Projects many world points for an API fixed at compile time.
+ */
+template<GraphicsApi Api>
+inline void projectPoints(std::span<const Vec3f> world_points,
+                          const Mat4f& mvp,
+                          const Viewport& viewport,
+                          std::span<Vec3f> out_screen,
+                          std::span<uint8_t> out_visible = {}) noexcept {
+    projectPoints(world_points, mvp, ScreenMapping::create<Api>(viewport), out_screen, out_visible);
+}
+
+/**
+ * @brief Unprojects many screen points (x, y, depth) to world positions.
+ *
+ * Per-point results match unproject().
+ *
+ * @param screen_points Screen coordinates and depth per point
+ * @param inv_mvp The inverse of the Model-View-Projection matrix
+ * @param mapping NDC-to-screen mapping (see ScreenMapping::create)
+ * @param out_world Receives world positions
+ */
+void unprojectPoints(std::span<const Vec3f> screen_points,
+                     const Mat4f& inv_mvp,
+                     const ScreenMapping& mapping,
+                     std::span<Vec3f> out_world) noexcept;
+
+/**
+ * @brief Unprojects many screen points, resolving the API convention once per call.
+ */
+inline void unprojectPoints(std::span<const Vec3f> screen_points,
+                            const Mat4f& inv_mvp,
+                            const Viewport& viewport,
+                            std::span<Vec3f> out_world,
+                            GraphicsApi api = GraphicsApi::eOpenGL) noexcept {
+    unprojectPoints(screen_points, inv_mvp, ScreenMapping::create(viewport, api), out_world);
+}
+
+/**
+ * @brief Unprojects many screen points for an API fixed at compile time.
+ */
+template<GraphicsApi Api>
+inline void unprojectPoints(std::span<const Vec3f> screen_points,
+                            const Mat4f& inv_mvp,
+                            const Viewport& viewport,
+                            std::span<Vec3f> out_world) noexcept {
+    unprojectPoints(screen_points, inv_mvp, ScreenMapping::create<Api>(viewport), out_world);
+}
+
 // ============================================================================
 // Screen-to-World Ray
 // ============================================================================
@@ -252,6 +438,41 @@ namespace vne::math {
 // Depth Utilities
 // ============================================================================
 
+/**
+ * @brief Linearizes a depth buffer value for an API fixed at compile time.
+ *
+ * @tparam Api Target graphics API (selects the depth range)
+ * @tparam Mode Depth orientation and far-plane placement of the projection
+ * @param depth Non-linear depth value (from depth buffer)
+ * @param z_near Near plane distance
+ * @param z_far Far plane distance (ignored for infinite depth modes)
+ * @return Linear depth value
+ */
+template<GraphicsApi Api, DepthMode Mode = DepthMode::eStandard>
+[[nodiscard]] constexpr float linearizeDepth(float depth, float z_near, float z_far) noexcept {
+    constexpr bool kZeroToOne = GraphicsApiTraits<Api>::kDepth == ClipSpaceDepth::eZeroToOne;
+
+    // With an infinite far plane both depth ranges store 1 - near/d (or near/d
+    // reversed) in the depth buffer.
+    if constexpr (Mode == DepthMode::eInfinite) {
+        return z_near / (1.0f - depth);
+    } else if constexpr (Mode == DepthMode::eInfiniteReversed) {
+        return z_near / depth;
+    } else if constexpr (kZeroToOne && Mode == DepthMode::eReversed) {
+        return z_near * z_far / (z_near + depth * (z_far - z_near));
+    } else if constexpr (kZeroToOne) {
+        // Vulkan/Metal/DirectX: depth in [0, 1]
+        return z_near * z_far / (z_far - depth * (z_far - z_near));
+    } else {
+        // OpenGL: depth in [-1, 1], negated by reverse-Z
+        float ndc_z = depth * 2.0f - 1.0f;
+        if constexpr (Mode == DepthMode::eReversed) {
+            ndc_z = -ndc_z;
+        }
+        return 2.0f * z_near * z_far / (z_far + z_near - ndc_z * (z_far - z_near));
+    }
+}
+
 /**
  * @brief Linearizes a depth buffer value.
  *
@@ -259,35 +480,76 @@ namespace vne::math {
  *
  * @param depth Non-linear depth value (from depth buffer)
  * @param z_near Near plane distance
- * @param z_far Far plane distance
+ * @param z_far Far plane distance (ignored for infinite depth modes)
  * @param api Graphics API (for depth range)
+ * @param mode Depth orientation and far-plane placement of the projection
  * @return Linear depth value
  */
-[[nodiscard]] inline float linearizeDepth(float depth,
-                                          float z_near,
-                                          float z_far,
-                                          GraphicsApi api = GraphicsApi::eOpenGL) noexcept {
-    if (getClipSpaceDepth(api) == ClipSpaceDepth::eZeroToOne) {
-        // Vulkan/Metal/DirectX: depth in [0, 1]
-        return z_near * z_far / (z_far - depth * (z_far - z_near));
-    }
-    // OpenGL: depth in [-1, 1]
-    float ndc_z = depth * 2.0f - 1.0f;
-    return 2.0f * z_near * z_far / (z_far + z_near - ndc_z * (z_far - z_near));
+[[nodiscard]] constexpr float linearizeDepth(float depth,
+                                             float z_near,
+                                             float z_far,
+                                             GraphicsApi api = GraphicsApi::eOpenGL,
+                                             DepthMode mode = DepthMode::eStandard) noexcept {
+    return dispatchGraphicsApi(api, [&](auto tag) {
+        constexpr GraphicsApi kApi = decltype(tag)::value;
+        switch (mode) {
+            case DepthMode::eReversed:
+                return linearizeDepth<kApi, DepthMode::eReversed>(depth, z_near, z_far);
+            case DepthMode::eInfinite:
+                return linearizeDepth<kApi, DepthMode::eInfinite>(depth, z_near, z_far);
+            case DepthMode::eInfiniteReversed:
+                return linearizeDepth<kApi, DepthMode::eInfiniteReversed>(depth, z_near, z_far);
+            default:
+                return linearizeDepth<kApi, DepthMode::eStandard>(depth, z_near, z_far);
+        }
+    });
 }
 
 /**
- * @brief Converts linear depth to non-linear depth buffer value.
+ * @brief Converts linear depth to non-linear depth buffer value for an API fixed at compile time.
  */
-[[nodiscard]] inline float encodeDepth(float linear_depth,
-                                       float z_near,
-                                       float z_far,
-                                       GraphicsApi api = GraphicsApi::eOpenGL) noexcept {
-    if (getClipSpaceDepth(api) == ClipSpaceDepth::eZeroToOne) {
+template<GraphicsApi Api, DepthMode Mode = DepthMode::eStandard>
+[[nodiscard]] constexpr float encodeDepth(float linear_depth, float z_near, float z_far) noexcept {
+    constexpr bool kZeroToOne = GraphicsApiTraits<Api>::kDepth == ClipSpaceDepth::eZeroToOne;
+
+    if constexpr (Mode == DepthMode::eInfinite) {
+        return 1.0f - z_near / linear_depth;
+    } else if constexpr (Mode == DepthMode::eInfiniteReversed) {
+        return z_near / linear_depth;
+    } else if constexpr (kZeroToOne && Mode == DepthMode::eReversed) {
+        return (z_near * z_far / linear_depth - z_near) / (z_far - z_near);
+    } else if constexpr (kZeroToOne) {
         return (z_far - z_near * z_far / linear_depth) / (z_far - z_near);
+    } else {
+        float ndc_z = (z_far + z_near - 2.0f * z_near * z_far / linear_depth) / (z_far - z_near);
+        if constexpr (Mode == DepthMode::eReversed) {
+            ndc_z = -ndc_z;
+        }
+        return (ndc_z + 1.0f) * 0.5f;
     }
-    float ndc_z = (z_far + z_near - 2.0f * z_near * z_far / linear_depth) / (z_far - z_near);
-    return (ndc_z + 1.0f) * 0.5f;
+}
+
+/**
+ * @brief Converts linear depth to non-linear depth buffer value.
+ */
+[[nodiscard]] constexpr float encodeDepth(float linear_depth,
+                                          float z_near,
+                                          float z_far,
+                                          GraphicsApi api = GraphicsApi::eOpenGL,
+                                          DepthMode mode = DepthMode::eStandard) noexcept {
+    return dispatchGraphicsApi(api, [&](auto tag) {
+        constexpr GraphicsApi kApi = decltype(tag)::value;
+        switch (mode) {
+            case DepthMode::eReversed:
+                return encodeDepth<kApi, DepthMode::eReversed>(linear_depth, z_near, z_far);
+            case DepthMode::eInfinite:
+                return encodeDepth<kApi, DepthMode::eInfinite>(linear_depth, z_near, z_far);
+            case DepthMode::eInfiniteReversed:
+                return encodeDepth<kApi, DepthMode::eInfiniteReversed>(linear_depth, z_near, z_far);
+            default:
+                return encodeDepth<kApi, DepthMode::eStandard>(linear_depth, z_near, z_far);
+        }
+    });
 }
 
 // ============================================================================
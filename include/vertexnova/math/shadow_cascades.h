@@ -0,0 +1,120 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Cascaded shadow map split and fitting utilities.
+ * ----------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "core/mat.h"
+#include "core/types.h"
+#include "core/vec.h"
+#include "geometry/frustum.h"
+
+#include <cstdint>
+#include <span>
+
+namespace vne::math {
+
+/**
+ * @enum CascadeSplitScheme
+ * @brief How the camera depth range is divided between cascades.
+ */
+enum class CascadeSplitScheme : uint8_t {
+    eLinear,       ///< Uniform slices; wastes resolution near the camera
+    eLogarithmic,  ///< Constant perspective aliasing; very thin first cascades
+    ePractical     ///< Parallel-split (PSSM) blend of logarithmic and linear by lambda
+};
+
+/**
+ * @enum CascadeFitMode
+ * @brief How each cascade's orthographic projection is fitted to its camera slice.
+ */
+enum class CascadeFitMode : uint8_t {
+    eTight,  ///< Light-space bounds of the slice corners; best resolution, shimmers when the camera turns
+    eStable  ///< Bounding sphere of the slice; constant size, texel-stable under camera rotation
+};
+
+/**
+ * @struct CascadeCamera
+ * @brief The viewing camera whose depth range the cascades cover.
+ */
+struct CascadeCamera {
+    Mat4f view{Mat4f::identity()};  ///< World-to-view matrix
+    float fov_y{1.0f};              ///< Vertical field of view in radians
+    float aspect{1.0f};             ///< Width / height
+    float z_near{0.1f};             ///< Start of the first cascade
+    float z_far{100.0f};            ///< Shadow distance: end of the last cascade
+    /// View-space convention: right-handed cameras look down -Z, left-handed down +Z
+    Handedness handedness{Handedness::eRight};
+};
+
+/**
+ * @struct ShadowCascadeSettings
+ * @brief Light and shadow map parameters shared by all cascades.
+ */
+struct ShadowCascadeSettings {
+    Vec3f light_direction{0.0f, -1.0f, 0.0f};    ///< Direction the light travels, world space
+    uint32_t resolution{2048};                   ///< Shadow map width and height in texels
+    CascadeFitMode fit{CascadeFitMode::eStable};  ///< Projection fitting strategy
+    bool snap_to_texels{true};                   ///< Snap the ortho window to whole texels
+    /// Extra depth toward the light so casters outside the camera slice still render
+    float caster_extension{0.0f};
+    GraphicsApi api{GraphicsApi::eVulkan};  ///< Conventions for the view and ortho matrices
+};
+
+/**
+ * @struct ShadowCascade
+ * @brief Matrices and culling volume for one cascade.
+ */
+struct ShadowCascade {
+    Mat4f view{Mat4f::identity()};             ///< Light view matrix
+    Mat4f projection{Mat4f::identity()};       ///< Light orthographic projection
+    Mat4f view_projection{Mat4f::identity()};  ///< projection * view
+    Frustum frustum;                           ///< World-space culling volume of the cascade
+    float split_near{0.0f};                    ///< Camera distance where the cascade starts
+    float split_far{0.0f};                     ///< Camera distance where the cascade ends
+    float texel_size{0.0f};                    ///< World units covered by one shadow map texel
+};
+
+/**
+ * @brief Computes cascade split distances.
+ *
+ * Writes out_splits.size() boundaries from @p z_near to @p z_far inclusive,
+ * so N cascades need N + 1 entries: cascade i covers
+ * [out_splits[i], out_splits[i + 1]].
+ *
+ * @param z_near Start of the first cascade (must be > 0 for logarithmic splits)
+ * @param z_far End of the last cascade
+ * @param out_splits Receives the boundaries; needs at least two entries
+ * @param scheme Split distribution
+ * @param lambda Practical-scheme blend: 0 is linear, 1 is logarithmic
+ */
+void computeCascadeSplits(float z_near,
+                          float z_far,
+                          std::span<float> out_splits,
+                          CascadeSplitScheme scheme = CascadeSplitScheme::ePractical,
+                          float lambda = 0.75f) noexcept;
+
+/**
+ * @brief Fits one shadow cascade per camera slice.
+ *
+ * For every slice [splits[i], splits[i + 1]] this builds a light view looking
+ * along the light direction, fits an orthographic window (tight corners or a
+ * rotation-invariant bounding sphere), optionally snaps it to whole texels so
+ * the shadow does not shimmer as the camera moves, and extracts a world-space
+ * Frustum for culling casters.
+ *
+ * @param camera The viewing camera
+ * @param splits Cascade boundaries, e.g. from computeCascadeSplits()
+ * @param settings Light and shadow map parameters
+ * @param out_cascades Receives splits.size() - 1 cascades
+ */
+void computeShadowCascades(const CascadeCamera& camera,
+                           std::span<const float> splits,
+                           const ShadowCascadeSettings& settings,
+                           std::span<ShadowCascade> out_cascades) noexcept;
+
+}  // namespace vne::math
@@ -8,12 +8,16 @@
 
 #pragma once
 
+#include "core/affine.h"
 #include "core/constants.h"
 #include "core/mat.h"
 #include "core/quat.h"
 #include "core/types.h"
 #include "core/vec.h"
 
+#include <cmath>
+#include <span>
+
 namespace vne::math {
 
 /**
@@ -57,6 +61,49 @@ struct TransformComponents {
     }
 };
 
+/**
+ * @struct AffineComponents
+ * @brief Decomposed general affine transform (Translation, Rotation, symmetric Stretch).
+ *
+ * Produced by decomposeAffine(). The linear part is factored as M = R * S
+ * (polar decomposition) where R is a proper rotation and S is symmetric:
+ *
+ *     S = | scale.x  shear.x  shear.y |
+ *         | shear.x  scale.y  shear.z |
+ *         | shear.y  shear.z  scale.z |
+ *
+ * For matrices without shear, shear is zero and the result matches decompose().
+ */
+struct AffineComponents {
+    Vec3f translation{Vec3f::zero()};   ///< Translation component
+    Quatf rotation{Quatf::identity()};  ///< Rotation component (always a proper rotation)
+    Vec3f scale{1.0f, 1.0f, 1.0f};      ///< Diagonal of the stretch
+    Vec3f shear{Vec3f::zero()};         ///< Off-diagonal of the stretch (xy, xz, yz)
+
+    /**
+     * @brief Returns the symmetric stretch matrix S.
+     */
+    [[nodiscard]] Mat3f stretch() const noexcept {
+        return Mat3f(Vec3f(scale.x(), shear.x(), shear.y()),
+                     Vec3f(shear.x(), scale.y(), shear.z()),
+                     Vec3f(shear.y(), shear.z(), scale.z()));
+    }
+
+    /**
+     * @brief Returns true if the shear factors are non-zero beyond `epsilon`.
+     */
+    [[nodiscard]] bool hasShear(float epsilon = kFloatEpsilon) const noexcept {
+        return std::abs(shear.x()) > epsilon || std::abs(shear.y()) > epsilon || std::abs(shear.z()) > epsilon;
+    }
+
+    /**
+     * @brief Drops the shear terms, keeping translation, rotation, and scale.
+     */
+    [[nodiscard]] TransformComponents toTransformComponents() const noexcept {
+        return TransformComponents(translation, rotation, scale);
+    }
+};
+
 // ============================================================================
 // Matrix Decomposition
 // ============================================================================
@@ -73,8 +120,8 @@ struct TransformComponents {
  * @param matrix The 4x4 transformation matrix to decompose
  * @return TransformComponents containing translation, rotation, and scale
  *
- * @note For matrices with shear, consider using decompose_affine() which
- *       handles the general affine case.
+ * @note For matrices with shear, use decomposeAffine() which handles the
+ *       general affine case.
  */
 [[nodiscard]] inline TransformComponents decompose(const Mat4f& matrix) noexcept {
     TransformComponents result;
@@ -111,6 +158,35 @@ struct TransformComponents {
     return result;
 }
 
+/**
+ * @brief Decomposes a general affine matrix, including shear.
+ *
+ * Factors the upper-left 3x3 as R * S with the polar decomposition, computed by
+ * Higham's scaled Newton iteration (R <- (g*R + R^-T / g) / 2). R is the nearest
+ * rotation to the linear part, so the result is well defined for sheared input
+ * where decompose() is not.
+ *
+ * Reflections (negative determinant) are carried by the stretch: R stays a
+ * proper rotation and S becomes negative definite. Singular linear parts have
+ * no unique polar factor; for those the result falls back to decompose() with
+ * zero shear.
+ *
+ * @param matrix The affine transformation matrix (bottom row is ignored)
+ * @return AffineComponents such that compose(result) reproduces @p matrix
+ */
+[[nodiscard]] AffineComponents decomposeAffine(const Mat4f& matrix) noexcept;
+
+/**
+ * @brief Decomposes many affine matrices at once (see decomposeAffine(const Mat4f&)).
+ *
+ * Runs the polar iteration on four matrices per SIMD block. Spans must have the
+ * same size; in release builds only the smallest common size is processed.
+ *
+ * @param matrices Input matrices
+ * @param out Receives the components per matrix
+ */
+void decomposeAffine(std::span<const Mat4f> matrices, std::span<AffineComponents> out) noexcept;
+
 /**
  * @brief Composes a 4x4 transformation matrix from TRS components.
  *
@@ -147,6 +223,99 @@ struct TransformComponents {
     return compose(components.translation, components.rotation, components.scale);
 }
 
+/**
+ * @brief Composes a 4x4 transformation matrix from AffineComponents (T * R * S).
+ *
+ * @param components The affine components, typically from decomposeAffine()
+ * @return The composed 4x4 transformation matrix
+ */
+[[nodiscard]] inline Mat4f compose(const AffineComponents& components) noexcept {
+    const Mat3f linear = components.rotation.toMatrix3() * components.stretch();
+    const Vec3f& t = components.translation;
+    return Mat4f(Vec4f(linear[0], 0.0f), Vec4f(linear[1], 0.0f), Vec4f(linear[2], 0.0f), Vec4f(t, 1.0f));
+}
+
+/**
+ * @brief Composes a compact 3x4 affine transform from TRS components.
+ *
+ * Same result as compose() without the constant bottom row.
+ *
+ * @param translation Translation vector
+ * @param rotation Rotation quaternion
+ * @param scale Scale vector
+ * @return The composed affine transform
+ */
+[[nodiscard]] inline Affine3f composeAffine(const Vec3f& translation,
+                                            const Quatf& rotation,
+                                            const Vec3f& scale) noexcept {
+    return Affine3f::fromTrs(translation, rotation, scale);
+}
+
+/**
+ * @brief Composes a compact 3x4 affine transform from TransformComponents.
+ *
+ * @param components The transform components
+ * @return The composed affine transform
+ */
+[[nodiscard]] inline Affine3f composeAffine(const TransformComponents& components) noexcept {
+    return Affine3f::fromTrs(components.translation, components.rotation, components.scale);
+}
+
+/**
+ * @brief Decomposes a compact 3x4 affine transform into TRS components.
+ *
+ * Same assumptions as decompose(const Mat4f&): no shear.
+ *
+ * @param affine The affine transform to decompose
+ * @return TransformComponents containing translation, rotation, and scale
+ */
+[[nodiscard]] inline TransformComponents decompose(const Affine3f& affine) noexcept {
+    return decompose(affine.toMat4());
+}
+
+// ============================================================================
+// Batch Composition
+// ============================================================================
+
+/**
+ * @brief Composes many TRS transforms at once (structure-of-arrays input).
+ *
+ * Equivalent to calling compose(translations[i], rotations[i], scales[i]) for
+ * every element, but processes four transforms per iteration with SIMD and
+ * builds the rotation basis directly from the quaternion.
+ *
+ * All spans must have the same size; in release builds only the smallest
+ * common size is processed.
+ *
+ * @param translations Translation per transform
+ * @param rotations Rotation per transform (expected to be normalized)
+ * @param scales Scale per transform
+ * @param out Receives the composed matrices
+ */
+void compose(std::span<const Vec3f> translations,
+             std::span<const Quatf> rotations,
+             std::span<const Vec3f> scales,
+             std::span<Mat4f> out) noexcept;
+
+/**
+ * @brief Decomposes many matrices into TRS components (structure-of-arrays output).
+ *
+ * Equivalent to calling decompose(matrices[i]) for every element, with the same
+ * handling of reflections (negative scale.x) and zero-length axes.
+ *
+ * All spans must have the same size; in release builds only the smallest
+ * common size is processed.
+ *
+ * @param matrices Input matrices (affine, without shear)
+ * @param translations Receives the translation per matrix
+ * @param rotations Receives the rotation per matrix
+ * @param scales Receives the scale per matrix
+ */
+void decompose(std::span<const Mat4f> matrices,
+               std::span<Vec3f> translations,
+               std::span<Quatf> rotations,
+               std::span<Vec3f> scales) noexcept;
+
 // ============================================================================
 // Transform Utilities
 // ============================================================================
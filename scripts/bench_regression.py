@@ -0,0 +1,379 @@
+#!/usr/bin/env python3
+"""
+VneMath Benchmark Regression Check
+
+Runs vnemath_bench with repetitions and compares every benchmark against a
+stored baseline. A benchmark regresses when all of these hold:
+
+  * its median time grew by more than --threshold,
+  * a one-sided Mann-Whitney U test says the new samples are slower
+    (p < --alpha), and
+  * the bootstrap confidence interval of the median ratio lies entirely
+    above 1.
+
+Requiring all three keeps noisy single-sample outliers and statistically
+real but negligible shifts from failing the check. Only the Python standard
+library is used; nothing touches the network.
+
+Usage:
+    python scripts/bench_regression.py --bench <vnemath_bench> --baseline <baseline.json> [options]
+    python scripts/bench_regression.py --current <results.json> --baseline <baseline.json> [options]
+
+Examples:
+    # Compare a fresh run against the committed baseline
+    python scripts/bench_regression.py --bench build/bin/vnemath_bench \\
+        --baseline benchmarks/baselines/vnemath_bench.json
+
+    # Record a new baseline on this machine
+    python scripts/bench_regression.py --bench build/bin/vnemath_bench \\
+        --baseline benchmarks/baselines/vnemath_bench.json --update
+
+    # Compare results saved earlier with --benchmark_out (needs repetitions)
+    python scripts/bench_regression.py --current results.json \\
+        --baseline benchmarks/baselines/vnemath_bench.json
+
+Exit codes:
+    0  no regression
+    1  at least one regression (or a missing benchmark with --strict)
+    2  usage error, no baseline samples, a baseline from a different build
+       type, or the benchmark run failed
+"""
+
+import argparse
+import datetime
+import json
+import math
+import random
+import re
+import statistics
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+
+BASELINE_FORMAT = 1
+BOOTSTRAP_SEED = 0x5EED
+BOOTSTRAP_RESAMPLES = 2000
+EXACT_U_LIMIT = 400  # Largest n1 * n2 for the exact U distribution
+
+TIME_UNIT_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+CONTEXT_KEYS = ("host_name", "num_cpus", "mhz_per_cpu", "cpu_scaling_enabled", "library_build_type", "date")
+NO_BASELINE_HINT = "record a baseline with vnemath_bench_baseline first (or run this script with --update)"
+
+
+# ============================================================================
+# Loading samples
+# ============================================================================
+
+def run_benchmarks(bench, bench_filter, repetitions, min_time):
+    """Runs the benchmark binary and returns its Google Benchmark JSON."""
+    with tempfile.TemporaryDirectory() as tmp:
+        out = Path(tmp) / "results.json"
+        command = [
+            str(bench),
+            f"--benchmark_filter={bench_filter}",
+            f"--benchmark_repetitions={repetitions}",
+            "--benchmark_enable_random_interleaving=true",
+            f"--benchmark_out={out}",
+            "--benchmark_out_format=json",
+        ]
+        if min_time is not None:
+            command.append(f"--benchmark_min_time={min_time}")
+        print("Running: " + " ".join(command), flush=True)
+        result = subprocess.run(command, stdout=subprocess.DEVNULL, check=False)
+        if result.returncode != 0 or not out.exists():
+            raise RuntimeError(f"{bench} exited with code {result.returncode}")
+        return json.loads(out.read_text())
+
+
+def samples_from_gbench(results, metric):
+    """Per-repetition times in nanoseconds, keyed by benchmark name; aggregates are skipped."""
+    samples = {}
+    for entry in results.get("benchmarks", []):
+        if entry.get("run_type", "iteration") != "iteration" or entry.get("error_occurred"):
+            continue
+        name = entry.get("run_name", entry["name"])
+        scale = TIME_UNIT_NS[entry.get("time_unit", "ns")]
+        samples.setdefault(name, []).append(entry[metric] * scale)
+    return samples
+
+
+def load_samples(path, metric):
+    """Reads either a baseline written by --update or raw Google Benchmark JSON."""
+    data = json.loads(Path(path).read_text())
+    if data.get("format") == BASELINE_FORMAT:
+        if data.get("metric", metric) != metric:
+            print(f"warning: {path} stores {data['metric']}, comparing against {metric}", file=sys.stderr)
+        return {name: entry["samples_ns"] for name, entry in data["benchmarks"].items()}, data.get("context", {})
+    return samples_from_gbench(data, metric), data.get("context", {})
+
+
+def write_baseline(path, samples, context, metric):
+    """Writes the compact baseline: context plus the raw samples of each benchmark."""
+    baseline = {
+        "format": BASELINE_FORMAT,
+        "metric": metric,
+        "recorded": datetime.datetime.now(datetime.timezone.utc).strftime("%Y-%m-%dT%H:%M:%SZ"),
+        "context": {key: context[key] for key in CONTEXT_KEYS if key in context},
+        "benchmarks": {
+            name: {"samples_ns": [round(value, 3) for value in values]}
+            for name, values in sorted(samples.items())
+        },
+    }
+    Path(path).parent.mkdir(parents=True, exist_ok=True)
+    Path(path).write_text(json.dumps(baseline, indent=2) + "\n")
+
+
+# ============================================================================
+# Statistics
+# ============================================================================
+
+def rank(values):
+    """Average ranks (1-based) and the tie-correction term sum(t^3 - t)."""
+    order = sorted(range(len(values)), key=lambda i: values[i])
+    ranks = [0.0] * len(values)
+    ties = 0.0
+    i = 0
+    while i < len(order):
+        j = i
+        while j + 1 < len(order) and values[order[j + 1]] == values[order[i]]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[order[k]] = (i + j) / 2.0 + 1.0
+        t = j - i + 1
+        ties += t ** 3 - t
+        i = j + 1
+    return ranks, ties
+
+
+def exact_u_cdf(n1, n2):
+    """P(U <= u) for every u under the null hypothesis, without ties."""
+    # counts[a][b][u]: orderings of a and b samples with statistic u, built up one sample at a time
+    counts = [[None] * (n2 + 1) for _ in range(n1 + 1)]
+    for a in range(n1 + 1):
+        for b in range(n2 + 1):
+            if a == 0 or b == 0:
+                counts[a][b] = [1]
+                continue
+            # The largest value is either from the first sample (adds b to U) or from the second
+            with_first = [0] * b + counts[a - 1][b]
+            with_second = counts[a][b - 1]
+            size = max(len(with_first), len(with_second))
+            counts[a][b] = [
+                (with_first[u] if u < len(with_first) else 0) + (with_second[u] if u < len(with_second) else 0)
+                for u in range(size)
+            ]
+    total = math.comb(n1 + n2, n1)
+    cdf = []
+    running = 0
+    for count in counts[n1][n2]:
+        running += count
+        cdf.append(running / total)
+    return cdf
+
+
+def mann_whitney_greater(current, baseline):
+    """One-sided Mann-Whitney U test that current tends to be larger than baseline.
+
+    Returns (U, p). Uses the exact null distribution for small samples without
+    ties and the tie-corrected normal approximation otherwise.
+    """
+    n1, n2 = len(current), len(baseline)
+    ranks, ties = rank(list(current) + list(baseline))
+    u = sum(ranks[:n1]) - n1 * (n1 + 1) / 2.0
+
+    if ties == 0 and n1 * n2 <= EXACT_U_LIMIT:
+        cdf = exact_u_cdf(n1, n2)
+        # P(U >= u) = 1 - P(U <= u - 1)
+        below = int(round(u)) - 1
+        p = 1.0 - (cdf[below] if below >= 0 else 0.0)
+        return u, min(max(p, 0.0), 1.0)
+
+    n = n1 + n2
+    mean = n1 * n2 / 2.0
+    variance = n1 * n2 / 12.0 * ((n + 1) - ties / (n * (n - 1)))
+    if variance <= 0.0:
+        return u, 1.0
+    z = (u - mean - 0.5) / math.sqrt(variance)  # Continuity correction
+    return u, 0.5 * math.erfc(z / math.sqrt(2.0))
+
+
+def median_ratio_interval(current, baseline, confidence, rng):
+    """Percentile bootstrap interval of median(current) / median(baseline)."""
+    ratios = []
+    for _ in range(BOOTSTRAP_RESAMPLES):
+        c = statistics.median(rng.choices(current, k=len(current)))
+        b = statistics.median(rng.choices(baseline, k=len(baseline)))
+        if b > 0.0:
+            ratios.append(c / b)
+    ratios.sort()
+    tail = (1.0 - confidence) / 2.0
+    low = ratios[int(math.floor(tail * (len(ratios) - 1)))]
+    high = ratios[int(math.ceil((1.0 - tail) * (len(ratios) - 1)))]
+    return low, high
+
+
+# ============================================================================
+# Comparison
+# ============================================================================
+
+def compare(baseline, current, threshold, alpha, confidence, min_samples):
+    """Classifies every benchmark of the baseline."""
+    rng = random.Random(BOOTSTRAP_SEED)
+    rows = []
+    for name in sorted(baseline):
+        if name not in current:
+            rows.append({"name": name, "verdict": "missing"})
+            continue
+        base, cur = baseline[name], current[name]
+        if len(base) < min_samples or len(cur) < min_samples:
+            rows.append({"name": name, "verdict": "too few samples"})
+            continue
+
+        ratio = statistics.median(cur) / statistics.median(base)
+        _, p_slower = mann_whitney_greater(cur, base)
+        _, p_faster = mann_whitney_greater(base, cur)
+        low, high = median_ratio_interval(cur, base, confidence, rng)
+
+        verdict = "ok"
+        if ratio > 1.0 + threshold and p_slower < alpha and low > 1.0:
+            verdict = "REGRESSION"
+        elif ratio < 1.0 - threshold and p_faster < alpha and high < 1.0:
+            verdict = "improved"
+        rows.append({
+            "name": name,
+            "baseline_ns": statistics.median(base),
+            "current_ns": statistics.median(cur),
+            "change": ratio - 1.0,
+            "ci": [low - 1.0, high - 1.0],
+            "p_slower": p_slower,
+            "verdict": verdict,
+        })
+    return rows
+
+
+def print_report(rows, confidence):
+    """Prints one line per benchmark, worst change first."""
+    width = max([len(row["name"]) for row in rows] + [9])
+    pct = int(round(confidence * 100))
+    print(f"{'Benchmark':<{width}}  {'Base ns':>12}  {'New ns':>12}  {'Change':>8}  "
+          f"{f'{pct}% CI':>19}  {'p':>8}  Verdict")
+    measured = sorted((r for r in rows if "change" in r), key=lambda r: -r["change"])
+    for row in measured:
+        ci = f"[{row['ci'][0]:+7.1%}, {row['ci'][1]:+7.1%}]"
+        print(f"{row['name']:<{width}}  {row['baseline_ns']:>12.1f}  {row['current_ns']:>12.1f}  "
+              f"{row['change']:>+8.1%}  {ci:>19}  {row['p_slower']:>8.4f}  {row['verdict']}")
+    for row in rows:
+        if "change" not in row:
+            print(f"{row['name']:<{width}}  {'-':>12}  {'-':>12}  {'-':>8}  {'-':>19}  {'-':>8}  {row['verdict']}")
+
+
+def names_filter(names):
+    """A --benchmark_filter regular expression matching exactly the given benchmarks."""
+    return "^(" + "|".join(re.escape(name) for name in sorted(names)) + ")$"
+
+
+def main():
+    """Main function."""
+    parser = argparse.ArgumentParser(
+        description="Compare vnemath_bench results against a stored baseline",
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog="""
+Examples:
+  python scripts/bench_regression.py --bench build/bin/vnemath_bench --baseline benchmarks/baselines/vnemath_bench.json
+  python scripts/bench_regression.py --bench build/bin/vnemath_bench --baseline b.json --update --filter "MatFixture"
+  python scripts/bench_regression.py --current results.json --baseline b.json --threshold 0.10
+        """
+    )
+
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument('--bench', help='Path to the vnemath_bench executable to run')
+    source.add_argument('--current', help='Google Benchmark JSON from an earlier run (with repetitions)')
+
+    parser.add_argument('--baseline', required=True, help='Baseline JSON to compare against or to write')
+    parser.add_argument('--update', action='store_true',
+                        help='Record the run as the new baseline instead of comparing')
+    parser.add_argument('--filter', default=None,
+                        help='Benchmarks to run (regex); defaults to those in the baseline')
+    parser.add_argument('--repetitions', type=int, default=10, help='Samples per benchmark (default: 10)')
+    parser.add_argument('--min-time', default=None, help='Seconds per sample, passed to --benchmark_min_time')
+    parser.add_argument('--metric', choices=['real_time', 'cpu_time'], default='real_time',
+                        help='Time to compare (default: real_time)')
+    parser.add_argument('--threshold', type=float, default=0.05,
+                        help='Relative slowdown of the median that counts as a regression (default: 0.05)')
+    parser.add_argument('--alpha', type=float, default=0.01, help='Significance level (default: 0.01)')
+    parser.add_argument('--confidence', type=float, default=0.95,
+                        help='Confidence level of the interval (default: 0.95)')
+    parser.add_argument('--strict', action='store_true', help='Fail when a baseline benchmark did not run')
+    parser.add_argument('--report', help='Also write the comparison as JSON to this file')
+
+    args = parser.parse_args()
+
+    if args.repetitions < 3:
+        print("Error: at least 3 repetitions are needed for the statistics", file=sys.stderr)
+        sys.exit(2)
+
+    baseline_samples, baseline_context = {}, {}
+    if not args.update:
+        if not Path(args.baseline).exists():
+            print(f"Error: baseline {args.baseline} not found; {NO_BASELINE_HINT}", file=sys.stderr)
+            sys.exit(2)
+        baseline_samples, baseline_context = load_samples(args.baseline, args.metric)
+        if not baseline_samples:
+            print(f"Error: baseline {args.baseline} has no samples; {NO_BASELINE_HINT}", file=sys.stderr)
+            sys.exit(2)
+
+    try:
+        if args.bench:
+            bench_filter = args.filter or (names_filter(baseline_samples) if baseline_samples else ".")
+            results = run_benchmarks(args.bench, bench_filter, args.repetitions, args.min_time)
+            current_samples, current_context = samples_from_gbench(results, args.metric), results.get("context", {})
+        else:
+            current_samples, current_context = load_samples(args.current, args.metric)
+    except (OSError, RuntimeError, ValueError) as error:
+        print(f"Error: {error}", file=sys.stderr)
+        sys.exit(2)
+
+    if args.update:
+        if not current_samples:
+            print("Error: no benchmark results to record", file=sys.stderr)
+            sys.exit(2)
+        write_baseline(args.baseline, current_samples, current_context, args.metric)
+        print(f"Recorded {len(current_samples)} benchmarks in {args.baseline}")
+        if current_context.get("library_build_type") != "release" or current_context.get("num_cpus", 0) < 2:
+            print("warning: record baselines from a Release build on a quiet machine with at least 2 CPUs",
+                  file=sys.stderr)
+        sys.exit(0)
+
+    # Debug and release timings differ by far more than any threshold, so the comparison would be meaningless
+    base_type = baseline_context.get("library_build_type")
+    current_type = current_context.get("library_build_type")
+    if base_type and current_type and base_type != current_type:
+        print(f"Error: the baseline is a {base_type} build but this run is a {current_type} build; "
+              "re-record the baseline from the same build type", file=sys.stderr)
+        sys.exit(2)
+
+    for key in ("host_name", "num_cpus"):
+        if key in baseline_context and key in current_context and baseline_context[key] != current_context[key]:
+            print(f"warning: {key} differs from the baseline ({baseline_context[key]} vs {current_context[key]});"
+                  " timings may not be comparable", file=sys.stderr)
+
+    rows = compare(baseline_samples, current_samples, args.threshold, args.alpha, args.confidence, 3)
+    print_report(rows, args.confidence)
+
+    if args.report:
+        Path(args.report).write_text(json.dumps(rows, indent=2) + "\n")
+
+    regressions = [row for row in rows if row["verdict"] == "REGRESSION"]
+    missing = [row for row in rows if row["verdict"] in ("missing", "too few samples")]
+    improved = [row for row in rows if row["verdict"] == "improved"]
+    print(f"\n{len(rows)} benchmarks: {len(regressions)} regressed, {len(improved)} improved, "
+          f"{len(missing)} without results (threshold {args.threshold:.0%}, alpha {args.alpha})")
+
+    if regressions or (args.strict and missing):
+        sys.exit(1)
+    sys.exit(0)
+
+
+if __name__ == "__main__":
+    main()
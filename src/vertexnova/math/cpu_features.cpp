@@ -0,0 +1,327 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Corresponding header
+#include "vertexnova/math/cpu_features.h"
+
+// Project headers
+#include "vertexnova/math/simd/dispatch.h"
+
+// Standard library includes
+#include <atomic>
+#include <cstdlib>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define VNE_MATH_CPU_X86 1
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define VNE_MATH_CPU_AARCH64 1
+#endif
+
+namespace vne::math {
+
+namespace {
+
+/// Environment variable that overrides the detected level.
+constexpr const char* kSimdEnvVar = "VNE_MATH_SIMD";
+
+/// Levels tried by bestSimdLevel(), best first.
+constexpr SimdLevel kPreferredLevels[] = {
+    SimdLevel::eAvx512, SimdLevel::eAvx2, SimdLevel::eSse42, SimdLevel::eSse2, SimdLevel::eNeon};
+
+// ============================================================================
+// Detection
+// ============================================================================
+
+#if defined(VNE_MATH_CPU_X86)
+// CPUID leaf 1, ECX and EDX
+constexpr uint32_t kSse2Bit = 1u << 26;
+constexpr uint32_t kSse41Bit = 1u << 19;
+constexpr uint32_t kSse42Bit = 1u << 20;
+constexpr uint32_t kFmaBit = 1u << 12;
+constexpr uint32_t kOsxsaveBit = 1u << 27;
+constexpr uint32_t kAvxBit = 1u << 28;
+
+// CPUID leaf 7, EBX
+constexpr uint32_t kAvx2Bit = 1u << 5;
+constexpr uint32_t kAvx512fBit = 1u << 16;
+constexpr uint32_t kAvx512vlBit = 1u << 31;
+
+// XCR0 state components the OS must save: XMM and YMM, then opmask and ZMM
+constexpr uint64_t kYmmState = 0x6;
+constexpr uint64_t kZmmState = 0xE6;
+
+struct CpuidRegs {
+    uint32_t eax{0};
+    uint32_t ebx{0};
+    uint32_t ecx{0};
+    uint32_t edx{0};
+};
+
+[[nodiscard]] CpuidRegs cpuid(uint32_t leaf, uint32_t subleaf) noexcept {
+    CpuidRegs r;
+#if defined(_MSC_VER) && !defined(__clang__)
+    int regs[4];
+    __cpuidex(regs, static_cast<int>(leaf), static_cast<int>(subleaf));
+    r.eax = static_cast<uint32_t>(regs[0]);
+    r.ebx = static_cast<uint32_t>(regs[1]);
+    r.ecx = static_cast<uint32_t>(regs[2]);
+    r.edx = static_cast<uint32_t>(regs[3]);
+#else
+    __cpuid_count(leaf, subleaf, r.eax, r.ebx, r.ecx, r.edx);
+#endif
+    return r;
+}
+
+/// XCR0: which register states the OS saves on context switch. Requires OSXSAVE.
+[[nodiscard]] uint64_t readXcr0() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+    return _xgetbv(0);
+#else
+    uint32_t eax = 0;
+    uint32_t edx = 0;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+#endif
+
+[[nodiscard]] CpuFeatures detectCpuFeatures() noexcept {
+    CpuFeatures f;
+#if defined(VNE_MATH_CPU_X86)
+    const uint32_t max_leaf = cpuid(0, 0).eax;
+    if (max_leaf < 1) {
+        return f;
+    }
+    const CpuidRegs leaf1 = cpuid(1, 0);
+    f.sse2 = (leaf1.edx & kSse2Bit) != 0;
+    f.sse41 = (leaf1.ecx & kSse41Bit) != 0;
+    f.sse42 = (leaf1.ecx & kSse42Bit) != 0;
+
+    // AVX and AVX-512 instructions fault unless the OS saves the wider registers
+    const uint64_t xcr0 = (leaf1.ecx & kOsxsaveBit) != 0 ? readXcr0() : 0;
+    const bool os_ymm = (xcr0 & kYmmState) == kYmmState;
+    const bool os_zmm = (xcr0 & kZmmState) == kZmmState;
+    f.avx = os_ymm && (leaf1.ecx & kAvxBit) != 0;
+    f.fma = f.avx && (leaf1.ecx & kFmaBit) != 0;
+
+    if (max_leaf >= 7) {
+        const CpuidRegs leaf7 = cpuid(7, 0);
+        f.avx2 = f.avx && (leaf7.ebx & kAvx2Bit) != 0;
+        f.avx512f = os_zmm && (leaf7.ebx & kAvx512fBit) != 0;
+        f.avx512vl = f.avx512f && (leaf7.ebx & kAvx512vlBit) != 0;
+    }
+#elif defined(VNE_MATH_CPU_AARCH64)
+    // Advanced SIMD is mandatory on AArch64
+    f.neon = true;
+#endif
+    return f;
+}
+
+// ============================================================================
+// Level Selection
+// ============================================================================
+
+[[nodiscard]] bool cpuSupports(SimdLevel level, const CpuFeatures& f) noexcept {
+    switch (level) {
+        case SimdLevel::eScalar:
+            return true;
+        case SimdLevel::eSse2:
+            return f.sse2;
+        case SimdLevel::eSse42:
+            return f.sse2 && f.sse41 && f.sse42;
+        case SimdLevel::eAvx2:
+            return f.sse42 && f.avx2 && f.fma;
+        case SimdLevel::eAvx512:
+            return f.avx2 && f.fma && f.avx512f && f.avx512vl;
+        case SimdLevel::eNeon:
+            return f.neon;
+        default:
+            return false;
+    }
+}
+
+[[nodiscard]] const simd::BatchKernels* kernelsFor(SimdLevel level) noexcept {
+    switch (level) {
+        case SimdLevel::eScalar:
+            return simd::scalarKernels();
+        case SimdLevel::eSse2:
+            return simd::sse2Kernels();
+        case SimdLevel::eSse42:
+            return simd::sse42Kernels();
+        case SimdLevel::eAvx2:
+            return simd::avx2Kernels();
+        case SimdLevel::eAvx512:
+            return simd::avx512Kernels();
+        case SimdLevel::eNeon:
+            return simd::neonKernels();
+        default:
+            return nullptr;
+    }
+}
+
+/// Next level to try when @p level is unavailable; every chain ends at eScalar.
+[[nodiscard]] SimdLevel lowerLevel(SimdLevel level) noexcept {
+    switch (level) {
+        case SimdLevel::eAvx512:
+            return SimdLevel::eAvx2;
+        case SimdLevel::eAvx2:
+            return SimdLevel::eSse42;
+        case SimdLevel::eSse42:
+            return SimdLevel::eSse2;
+        default:
+            return SimdLevel::eScalar;
+    }
+}
+
+[[nodiscard]] SimdLevel clampToSupported(SimdLevel level) noexcept {
+    while (!isSimdLevelSupported(level)) {
+        level = lowerLevel(level);
+    }
+    return level;
+}
+
+/// Level named by VNE_MATH_SIMD, if set to a known name.
+[[nodiscard]] std::optional<SimdLevel> environmentSimdLevel() noexcept {
+#if defined(_MSC_VER)
+    char* value = nullptr;
+    size_t length = 0;
+    if (_dupenv_s(&value, &length, kSimdEnvVar) != 0 || value == nullptr) {
+        return std::nullopt;
+    }
+    const std::optional<SimdLevel> level = parseSimdLevel(value);
+    std::free(value);
+    return level;
+#else
+    const char* value = std::getenv(kSimdEnvVar);
+    return value != nullptr ? parseSimdLevel(value) : std::nullopt;
+#endif
+}
+
+/**
+ * Active level and its kernel table. Both are read on every batch call and
+ * written only by setSimdLevel(), so relaxed loads of the table are enough:
+ * each table is immutable and lives for the whole program.
+ */
+class Dispatch {
+   public:
+    Dispatch() noexcept {
+        const std::optional<SimdLevel> requested = environmentSimdLevel();
+        select(requested ? clampToSupported(*requested) : bestSimdLevel());
+    }
+
+    void select(SimdLevel level) noexcept {
+        kernels_.store(kernelsFor(level), std::memory_order_relaxed);
+        level_.store(level, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] SimdLevel level() const noexcept { return level_.load(std::memory_order_relaxed); }
+
+    [[nodiscard]] const simd::BatchKernels& kernels() const noexcept {
+        return *kernels_.load(std::memory_order_relaxed);
+    }
+
+   private:
+    std::atomic<const simd::BatchKernels*> kernels_{nullptr};
+    std::atomic<SimdLevel> level_{SimdLevel::eScalar};
+};
+
+[[nodiscard]] Dispatch& dispatch() noexcept {
+    static Dispatch instance;
+    return instance;
+}
+
+[[nodiscard]] char toLowerAscii(char c) noexcept {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+[[nodiscard]] bool equalsIgnoreCase(std::string_view a, std::string_view b) noexcept {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (toLowerAscii(a[i]) != toLowerAscii(b[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+const CpuFeatures& cpuFeatures() noexcept {
+    static const CpuFeatures features = detectCpuFeatures();
+    return features;
+}
+
+bool isSimdLevelSupported(SimdLevel level) noexcept {
+    return cpuSupports(level, cpuFeatures()) && kernelsFor(level) != nullptr;
+}
+
+SimdLevel bestSimdLevel() noexcept {
+    for (const SimdLevel level : kPreferredLevels) {
+        if (isSimdLevelSupported(level)) {
+            return level;
+        }
+    }
+    return SimdLevel::eScalar;
+}
+
+SimdLevel activeSimdLevel() noexcept {
+    return dispatch().level();
+}
+
+bool setSimdLevel(SimdLevel level) noexcept {
+    if (!isSimdLevelSupported(level)) {
+        return false;
+    }
+    dispatch().select(level);
+    return true;
+}
+
+std::optional<SimdLevel> parseSimdLevel(std::string_view name) noexcept {
+    struct Alias {
+        std::string_view name;
+        SimdLevel level;
+    };
+    static constexpr Alias kAliases[] = {{"scalar", SimdLevel::eScalar},
+                                         {"sse2", SimdLevel::eSse2},
+                                         {"sse4.2", SimdLevel::eSse42},
+                                         {"sse42", SimdLevel::eSse42},
+                                         {"avx2", SimdLevel::eAvx2},
+                                         {"avx512", SimdLevel::eAvx512},
+                                         {"avx512f", SimdLevel::eAvx512},
+                                         {"neon", SimdLevel::eNeon}};
+    for (const Alias& alias : kAliases) {
+        if (equalsIgnoreCase(name, alias.name)) {
+            return alias.level;
+        }
+    }
+    return std::nullopt;
+}
+
+namespace simd {
+
+const BatchKernels& batchKernels() noexcept {
+    return dispatch().kernels();
+}
+
+}  // namespace simd
+
+}  // namespace vne::math
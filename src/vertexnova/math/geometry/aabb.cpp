@@ -12,10 +12,22 @@
 // Project includes
 #include "vertexnova/math/geometry/aabb.h"
 
+// Project headers
+#include "vertexnova/common/macros.h"
 #include "vertexnova/math/core/math_utils.h"
+#include "vertexnova/math/instrumentation.h"
+#include "vertexnova/math/simd/dispatch.h"
+
+// Standard library includes
+#include <algorithm>
+#include <cmath>
 
 namespace vne::math {
 
+// The batch transform reads and writes Aabb as six packed floats: min xyz, max xyz.
+static_assert(sizeof(Aabb) == 6 * sizeof(float), "Aabb must be tightly packed");
+static_assert(sizeof(Mat4f) == 16 * sizeof(float), "Mat4f must be tightly packed");
+
 namespace {
 constexpr float kHalf = 0.5f;
 constexpr float kSurfaceAreaMultiplier = 2.0f;
@@ -109,6 +121,23 @@ void Aabb::translate(const Vec3f& offset) noexcept {
     max_ += offset;
 }
 
+Aabb Aabb::transformed(const Mat4f& matrix) const noexcept {
+    if (!isValid()) {
+        return *this;
+    }
+
+    const Vec3f c = center();
+    const Vec3f e = halfExtents();
+    Vec3f new_center;
+    Vec3f new_extent;
+    for (int i = 0; i < 3; ++i) {
+        new_center[i] = matrix[3][i] + matrix[0][i] * c.x() + matrix[1][i] * c.y() + matrix[2][i] * c.z();
+        new_extent[i] = std::abs(matrix[0][i]) * e.x() + std::abs(matrix[1][i]) * e.y()
+                        + std::abs(matrix[2][i]) * e.z();
+    }
+    return {new_center - new_extent, new_center + new_extent};
+}
+
 void Aabb::reset() noexcept {
     min_ = Vec3f(kFloatMax, kFloatMax, kFloatMax);
     max_ = Vec3f(-kFloatMax, -kFloatMax, -kFloatMax);
@@ -181,4 +210,29 @@ std::ostream& operator<<(std::ostream& os, const Aabb& aabb) {
     return os << "Aabb: [min: " << aabb.min() << ", max: " << aabb.max() << "]";
 }
 
+void transformAabbs(std::span<const Aabb> boxes, std::span<const Mat4f> matrices, std::span<Aabb> out) noexcept {
+    VNE_ASSERT_MSG(matrices.size() >= boxes.size() && out.size() >= boxes.size(),
+                   "transformAabbs: matrices or out smaller than boxes");
+    const size_t count = std::min({boxes.size(), matrices.size(), out.size()});
+    VNE_MATH_PROBE_SCOPE(Probe::eTransformAabbs, count);
+
+    const auto kernel = simd::batchKernels().transform_aabbs4;
+
+    size_t i = 0;
+    for (; i + simd::kBlockSize <= count; i += simd::kBlockSize) {
+        kernel(reinterpret_cast<const float*>(&boxes[i]), matrices[i].ptr(), reinterpret_cast<float*>(&out[i]));
+    }
+    if (i < count) {
+        // Pad the tail; the unused lanes hold invalid boxes, which pass through
+        Aabb tail_boxes[simd::kBlockSize];
+        Mat4f tail_matrices[simd::kBlockSize];
+        Aabb tail_out[simd::kBlockSize];
+        const size_t rest = count - i;
+        std::copy_n(&boxes[i], rest, tail_boxes);
+        std::copy_n(&matrices[i], rest, tail_matrices);
+        kernel(reinterpret_cast<const float*>(tail_boxes), tail_matrices[0].ptr(), reinterpret_cast<float*>(tail_out));
+        std::copy_n(tail_out, rest, &out[i]);
+    }
+}
+
 }  // namespace vne::math
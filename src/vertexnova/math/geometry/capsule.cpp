@@ -206,43 +206,8 @@ float Capsule::signedDistanceToPoint(const Vec3f& point) const noexcept {
 bool Capsule::intersects(const Capsule& other) const noexcept {
     // Two capsules intersect if the distance between their segments
     // is less than the sum of their radii
-    LineSegment seg1 = segment();
-    LineSegment seg2 = other.segment();
-
-    // Find closest points between segments
-    Vec3f dir1 = seg1.direction();
-    Vec3f dir2 = seg2.direction();
-    Vec3f w = seg1.start - seg2.start;
-
-    float a = dir1.dot(dir1);
-    float b = dir1.dot(dir2);
-    float c = dir2.dot(dir2);
-    float d = dir1.dot(w);
-    float e = dir2.dot(w);
-
-    float denom = a * c - b * b;
-    float s = 0.0f;
-    float t = 0.0f;
-
-    if (isZero(denom)) {
-        // Parallel segments
-        s = 0.0f;
-        t = (b > c ? d / b : e / c);
-    } else {
-        s = (b * e - c * d) / denom;
-        t = (a * e - b * d) / denom;
-    }
-
-    s = clamp(s, 0.0f, 1.0f);
-    t = clamp(t, 0.0f, 1.0f);
-
-    Vec3f closest1 = seg1.getPoint(s);
-    Vec3f closest2 = seg2.getPoint(t);
-
-    float dist_sq = (closest1 - closest2).lengthSquared();
     float sum_radii = radius_ + other.radius_;
-
-    return dist_sq <= sum_radii * sum_radii;
+    return segment().squaredDistanceToSegment(other.segment()) <= sum_radii * sum_radii;
 }
 
 bool Capsule::intersects(const Sphere& sphere) const noexcept {
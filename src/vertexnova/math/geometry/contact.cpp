@@ -0,0 +1,637 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Corresponding header
+#include "vertexnova/math/geometry/contact.h"
+
+// Project headers
+#include "vertexnova/common/macros.h"
+#include "vertexnova/math/geometry/gjk.h"
+#include "vertexnova/math/instrumentation.h"
+#include "vertexnova/math/geometry/line_segment.h"
+
+// Standard library includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace vne::math {
+
+namespace {
+
+/// Squared length below which a cross product of two box axes counts as parallel.
+constexpr float kParallelAxisEpsilon = 1e-6f;
+
+/// Another axis must beat the current one by this factor of its separation to be chosen...
+constexpr float kAxisRelativeTolerance = 0.95f;
+
+/// ...plus this fraction of the smallest half-extent, so resting boxes keep a stable face.
+constexpr float kAxisAbsoluteTolerance = 0.01f;
+
+/// Two capsule axes are parallel when the sine of their angle is below this.
+constexpr float kParallelSine = 1e-3f;
+
+/// A capsule is clipped to a box face when the normal is within this cosine of the face normal.
+constexpr float kFaceAlignment = 0.995f;
+
+/// A quad clipped by four planes has at most eight vertices.
+constexpr uint32_t kMaxClipVertices = 8;
+
+struct ClipPolygon {
+    std::array<Vec3f, kMaxClipVertices> v;
+    uint32_t count{0};
+};
+
+/// Sutherland-Hodgman: keeps the part of the polygon where dot(n, p) <= d.
+ClipPolygon clipPolygon(const ClipPolygon& in, const Vec3f& n, float d) noexcept {
+    ClipPolygon out;
+    for (uint32_t i = 0; i < in.count; ++i) {
+        const Vec3f& p = in.v[i];
+        const Vec3f& q = in.v[(i + 1) % in.count];
+        const float dp = n.dot(p) - d;
+        const float dq = n.dot(q) - d;
+        if (dp <= 0.0f) {
+            out.v[out.count++] = p;
+        }
+        if ((dp < 0.0f && dq > 0.0f) || (dp > 0.0f && dq < 0.0f)) {
+            out.v[out.count++] = p + (q - p) * (dp / (dp - dq));
+        }
+    }
+    return out;
+}
+
+/// Any unit vector perpendicular to v (v need not be normalized).
+Vec3f anyPerpendicular(const Vec3f& v) noexcept {
+    const Vec3f axis = std::abs(v.x()) < 0.57735f ? Vec3f::xAxis() : Vec3f::yAxis();
+    const Vec3f perp = v.cross(axis);
+    const float length = perp.length();
+    return length > 0.0f ? perp / length : Vec3f::zAxis();
+}
+
+/// +1 for non-negative values, -1 otherwise.
+float signOf(float value) noexcept {
+    return value >= 0.0f ? 1.0f : -1.0f;
+}
+
+/**
+ * Keeps at most four of the candidate points: the deepest, the one furthest
+ * from it, the one spanning the largest triangle with those two, and the one
+ * adding the most area outside that triangle.
+ */
+void reduceContacts(const Vec3f* positions,
+                    const float* depths,
+                    uint32_t count,
+                    const Vec3f& normal,
+                    ContactManifold& out) noexcept {
+    if (count <= ContactManifold::kMaxPoints) {
+        for (uint32_t i = 0; i < count; ++i) {
+            out.addPoint(positions[i], depths[i]);
+        }
+        return;
+    }
+
+    auto signed_area = [&](uint32_t a, uint32_t b, uint32_t c) {
+        return (positions[b] - positions[a]).cross(positions[c] - positions[a]).dot(normal);
+    };
+
+    uint32_t i0 = 0;
+    for (uint32_t i = 1; i < count; ++i) {
+        i0 = depths[i] > depths[i0] ? i : i0;
+    }
+    uint32_t i1 = i0;
+    float best = -1.0f;
+    for (uint32_t i = 0; i < count; ++i) {
+        const float dist_sq = (positions[i] - positions[i0]).lengthSquared();
+        if (dist_sq > best) {
+            best = dist_sq;
+            i1 = i;
+        }
+    }
+    // Orient the triangle counter-clockwise around the normal
+    uint32_t i2 = i0;
+    best = 0.0f;
+    for (uint32_t i = 0; i < count; ++i) {
+        const float area = std::abs(signed_area(i0, i1, i));
+        if (area > best) {
+            best = area;
+            i2 = i;
+        }
+    }
+    if (signed_area(i0, i1, i2) < 0.0f) {
+        std::swap(i0, i1);
+    }
+    uint32_t i3 = count;
+    best = 0.0f;
+    for (uint32_t i = 0; i < count; ++i) {
+        const float added = std::max({-signed_area(i0, i1, i), -signed_area(i1, i2, i), -signed_area(i2, i0, i)});
+        if (added > best) {
+            best = added;
+            i3 = i;
+        }
+    }
+
+    out.addPoint(positions[i0], depths[i0]);
+    out.addPoint(positions[i1], depths[i1]);
+    if (i2 != i0 && i2 != i1) {
+        out.addPoint(positions[i2], depths[i2]);
+    }
+    if (i3 < count) {
+        out.addPoint(positions[i3], depths[i3]);
+    }
+}
+
+/**
+ * Clips the incident box's face against the reference face and fills the
+ * manifold. The reference face has outward normal sign * axis @p ref_axis of
+ * @p reference; @p reference_is_a tells which box of the pair it is.
+ */
+void clipBoxFaces(const Obb& reference,
+                  uint32_t ref_axis,
+                  float sign,
+                  const Obb& incident,
+                  bool reference_is_a,
+                  ContactManifold& out) noexcept {
+    const Mat3f& rr = reference.rotationMatrix();
+    const Mat3f& ri = incident.rotationMatrix();
+    const Vec3f& hr = reference.halfExtents();
+    const Vec3f& hi = incident.halfExtents();
+    const Vec3f face_normal = rr[ref_axis] * sign;
+
+    // Incident face: the face of the other box most anti-parallel to the reference normal
+    uint32_t inc_axis = 0;
+    float best = -1.0f;
+    for (uint32_t j = 0; j < 3; ++j) {
+        const float d = std::abs(ri[j].dot(face_normal));
+        if (d > best) {
+            best = d;
+            inc_axis = j;
+        }
+    }
+    const float inc_sign = -signOf(ri[inc_axis].dot(face_normal));
+    const Vec3f inc_center = incident.center() + ri[inc_axis] * (inc_sign * hi[inc_axis]);
+    const uint32_t u_axis = (inc_axis + 1) % 3;
+    const uint32_t v_axis = (inc_axis + 2) % 3;
+    const Vec3f u = ri[u_axis] * hi[u_axis];
+    const Vec3f v = ri[v_axis] * hi[v_axis];
+
+    ClipPolygon polygon;
+    polygon.count = 4;
+    polygon.v[0] = inc_center + u + v;
+    polygon.v[1] = inc_center - u + v;
+    polygon.v[2] = inc_center - u - v;
+    polygon.v[3] = inc_center + u - v;
+
+    // Side planes of the reference face
+    for (uint32_t k = 1; k < 3 && polygon.count > 0; ++k) {
+        const uint32_t side = (ref_axis + k) % 3;
+        const float offset = rr[side].dot(reference.center());
+        polygon = clipPolygon(polygon, rr[side], offset + hr[side]);
+        polygon = clipPolygon(polygon, -rr[side], -offset + hr[side]);
+    }
+
+    // Keep the points below the reference face; contact positions go on B's surface
+    const float face_offset = face_normal.dot(reference.center()) + hr[ref_axis];
+    std::array<Vec3f, kMaxClipVertices> positions;
+    std::array<float, kMaxClipVertices> depths;
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < polygon.count; ++i) {
+        const float separation = face_normal.dot(polygon.v[i]) - face_offset;
+        if (separation <= 0.0f) {
+            positions[count] = reference_is_a ? polygon.v[i] : polygon.v[i] - face_normal * separation;
+            depths[count] = -separation;
+            ++count;
+        }
+    }
+
+    out.normal = reference_is_a ? face_normal : -face_normal;
+    reduceContacts(positions.data(), depths.data(), count, out.normal, out);
+}
+
+/**
+ * Minimum translation of an intersecting segment and box over the SAT axes:
+ * the three box faces and the segment crossed with each box edge. Sweeping
+ * the segment by a sphere adds @p radius along every axis, so the same axis
+ * is the capsule's.
+ */
+void segmentBoxPenetration(const LineSegment& segment, float radius, const Obb& box, ContactManifold& out) noexcept {
+    const Mat3f& basis = box.rotationMatrix();
+    const Vec3f& half = box.halfExtents();
+    const Vec3f half_dir = segment.direction() * 0.5f;
+    const Vec3f t = segment.midpoint() - box.center();
+
+    float face_sep = -std::numeric_limits<float>::max();
+    uint32_t face = 0;
+    for (uint32_t i = 0; i < 3; ++i) {
+        const float sep = std::abs(t.dot(basis[i])) - half[i] - std::abs(half_dir.dot(basis[i]));
+        if (sep > face_sep) {
+            face_sep = sep;
+            face = i;
+        }
+    }
+
+    float edge_sep = -std::numeric_limits<float>::max();
+    uint32_t edge = 0;
+    Vec3f edge_axis = Vec3f::zero();
+    for (uint32_t i = 0; i < 3; ++i) {
+        Vec3f axis = half_dir.cross(basis[i]);
+        const float length_sq = axis.lengthSquared();
+        if (length_sq < kParallelAxisEpsilon * half_dir.lengthSquared()) {
+            continue;
+        }
+        axis /= std::sqrt(length_sq);
+        const float sep = std::abs(t.dot(axis))
+                          - (half[0] * std::abs(axis.dot(basis[0])) + half[1] * std::abs(axis.dot(basis[1]))
+                             + half[2] * std::abs(axis.dot(basis[2])));
+        if (sep > edge_sep) {
+            edge_sep = sep;
+            edge = i;
+            edge_axis = axis;
+        }
+    }
+
+    const float abs_tolerance = kAxisAbsoluteTolerance * half.minComponent();
+    if (edge_sep > kAxisRelativeTolerance * face_sep + abs_tolerance) {
+        // Segment across a box edge: closest points of the segment and the edge facing it
+        out.normal = edge_axis * -signOf(t.dot(edge_axis));
+        Vec3f on_edge = box.center();
+        for (uint32_t k = 0; k < 3; ++k) {
+            if (k != edge) {
+                on_edge -= basis[k] * (signOf(basis[k].dot(out.normal)) * half[k]);
+            }
+        }
+        Vec3f on_segment;
+        Vec3f on_box;
+        segment.closestPoints(LineSegment(on_edge - basis[edge] * half[edge], on_edge + basis[edge] * half[edge]),
+                              on_segment,
+                              on_box);
+        out.addPoint(on_box, radius - edge_sep);
+        return;
+    }
+
+    // Face: the deeper segment end, moved onto the face
+    out.normal = basis[face] * -signOf(t.dot(basis[face]));
+    const Vec3f deepest = segment.direction().dot(out.normal) >= 0.0f ? segment.end : segment.start;
+    const float separation = (box.center() - deepest).dot(out.normal) - half[face];
+    out.addPoint(deepest + out.normal * separation, radius - separation);
+}
+
+/// Single contact from a GJK / EPA penetration query, for configurations clipping misses.
+bool penetrationContact(const ConvexShape& a, const ConvexShape& b, ContactManifold& out) noexcept {
+    const PenetrationResult result = penetration(a, b);
+    if (!result.intersecting) {
+        return false;
+    }
+    out.normal = result.normal;
+    out.addPoint(result.point_b, result.depth);
+    return true;
+}
+
+template <typename ShapeA, typename ShapeB>
+size_t generatePairContacts(std::span<const ShapeA> shapes_a,
+                            std::span<const ShapeB> shapes_b,
+                            std::span<const ContactPair> pairs,
+                            std::span<ContactManifold> out) noexcept {
+    VNE_ASSERT_MSG(out.size() >= pairs.size(), "generateContacts: out smaller than pairs");
+    const size_t count = std::min(pairs.size(), out.size());
+    VNE_MATH_PROBE_SCOPE(Probe::eContacts, count);
+
+    size_t touching = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const ContactPair& pair = pairs[i];
+        VNE_ASSERT_MSG(pair.a < shapes_a.size() && pair.b < shapes_b.size(), "generateContacts: pair out of range");
+        if (pair.a >= shapes_a.size() || pair.b >= shapes_b.size()) {
+            out[i].clear();
+            continue;
+        }
+        touching += generateContacts(shapes_a[pair.a], shapes_b[pair.b], out[i]) ? 1 : 0;
+    }
+    return touching;
+}
+
+}  // namespace
+
+// ============================================================================
+// Pair Queries
+// ============================================================================
+
+bool generateContacts(const Obb& a, const Obb& b, ContactManifold& out) noexcept {
+    out.clear();
+
+    const Mat3f& ra = a.rotationMatrix();
+    const Mat3f& rb = b.rotationMatrix();
+    const Vec3f& ha = a.halfExtents();
+    const Vec3f& hb = b.halfExtents();
+    const Vec3f t = b.center() - a.center();
+
+    // |dot(A_i, B_j)|, shared by all face axes
+    float abs_r[3][3];
+    for (uint32_t i = 0; i < 3; ++i) {
+        for (uint32_t j = 0; j < 3; ++j) {
+            abs_r[i][j] = std::abs(ra[i].dot(rb[j]));
+        }
+    }
+
+    // Face axes of A
+    float face_a_sep = -std::numeric_limits<float>::max();
+    uint32_t face_a = 0;
+    for (uint32_t i = 0; i < 3; ++i) {
+        const float sep = std::abs(t.dot(ra[i])) - ha[i]
+                          - (hb[0] * abs_r[i][0] + hb[1] * abs_r[i][1] + hb[2] * abs_r[i][2]);
+        if (sep > 0.0f) {
+            return false;
+        }
+        if (sep > face_a_sep) {
+            face_a_sep = sep;
+            face_a = i;
+        }
+    }
+
+    // Face axes of B
+    float face_b_sep = -std::numeric_limits<float>::max();
+    uint32_t face_b = 0;
+    for (uint32_t j = 0; j < 3; ++j) {
+        const float sep = std::abs(t.dot(rb[j])) - hb[j]
+                          - (ha[0] * abs_r[0][j] + ha[1] * abs_r[1][j] + ha[2] * abs_r[2][j]);
+        if (sep > 0.0f) {
+            return false;
+        }
+        if (sep > face_b_sep) {
+            face_b_sep = sep;
+            face_b = j;
+        }
+    }
+
+    // Edge axes A_i x B_j
+    float edge_sep = -std::numeric_limits<float>::max();
+    uint32_t edge_a = 0;
+    uint32_t edge_b = 0;
+    Vec3f edge_axis = Vec3f::zero();
+    for (uint32_t i = 0; i < 3; ++i) {
+        for (uint32_t j = 0; j < 3; ++j) {
+            Vec3f axis = ra[i].cross(rb[j]);
+            const float length_sq = axis.lengthSquared();
+            if (length_sq < kParallelAxisEpsilon) {
+                continue;
+            }
+            axis /= std::sqrt(length_sq);
+            float radius = 0.0f;
+            for (uint32_t k = 0; k < 3; ++k) {
+                radius += ha[k] * std::abs(axis.dot(ra[k])) + hb[k] * std::abs(axis.dot(rb[k]));
+            }
+            const float sep = std::abs(t.dot(axis)) - radius;
+            if (sep > 0.0f) {
+                return false;
+            }
+            if (sep > edge_sep) {
+                edge_sep = sep;
+                edge_a = i;
+                edge_b = j;
+                edge_axis = axis;
+            }
+        }
+    }
+
+    const float abs_tolerance = kAxisAbsoluteTolerance * std::min(ha.minComponent(), hb.minComponent());
+    bool use_face_b = face_b_sep > kAxisRelativeTolerance * face_a_sep + abs_tolerance;
+    const float face_sep = use_face_b ? face_b_sep : face_a_sep;
+
+    if (edge_sep > kAxisRelativeTolerance * face_sep + abs_tolerance) {
+        // Edge-edge: closest points of the supporting edges
+        const Vec3f normal = edge_axis * signOf(t.dot(edge_axis));
+        Vec3f pa = a.center();
+        Vec3f pb = b.center();
+        for (uint32_t k = 0; k < 3; ++k) {
+            if (k != edge_a) {
+                pa += ra[k] * (signOf(ra[k].dot(normal)) * ha[k]);
+            }
+            if (k != edge_b) {
+                pb -= rb[k] * (signOf(rb[k].dot(normal)) * hb[k]);
+            }
+        }
+        const LineSegment edge_on_a(pa - ra[edge_a] * ha[edge_a], pa + ra[edge_a] * ha[edge_a]);
+        const LineSegment edge_on_b(pb - rb[edge_b] * hb[edge_b], pb + rb[edge_b] * hb[edge_b]);
+        Vec3f closest_a;
+        Vec3f closest_b;
+        edge_on_a.closestPoints(edge_on_b, closest_a, closest_b);
+        out.normal = normal;
+        out.addPoint(closest_b, -edge_sep);
+        return true;
+    }
+
+    if (use_face_b) {
+        clipBoxFaces(b, face_b, -signOf(t.dot(rb[face_b])), a, false, out);
+    } else {
+        clipBoxFaces(a, face_a, signOf(t.dot(ra[face_a])), b, true, out);
+    }
+    return !out.empty() || penetrationContact(a, b, out);
+}
+
+bool generateContacts(const Capsule& a, const Capsule& b, ContactManifold& out) noexcept {
+    out.clear();
+
+    const LineSegment seg_a = a.segment();
+    const LineSegment seg_b = b.segment();
+    Vec3f pa;
+    Vec3f pb;
+    const float dist_sq = seg_a.closestPoints(seg_b, pa, pb);
+    const float radius = a.radius() + b.radius();
+    if (dist_sq > radius * radius) {
+        return false;
+    }
+
+    const Vec3f dir_a = seg_a.direction();
+    const Vec3f dir_b = seg_b.direction();
+    const float distance = std::sqrt(dist_sq);
+    if (distance > std::numeric_limits<float>::epsilon() * radius) {
+        out.normal = (pb - pa) / distance;
+    } else {
+        // Segments touch: separate along their common perpendicular
+        const Vec3f cross = dir_a.cross(dir_b);
+        const float length = cross.length();
+        out.normal = length > 0.0f ? cross / length : anyPerpendicular(dir_a.lengthSquared() > 0.0f ? dir_a : dir_b);
+    }
+
+    // Parallel capsules: one point at each end of the overlap
+    const float len_sq_a = dir_a.lengthSquared();
+    const float len_sq_b = dir_b.lengthSquared();
+    if (len_sq_a > 0.0f && len_sq_b > 0.0f
+        && dir_a.cross(dir_b).lengthSquared() <= kParallelSine * kParallelSine * len_sq_a * len_sq_b) {
+        const float t0 = (seg_b.start - seg_a.start).dot(dir_a) / len_sq_a;
+        const float t1 = (seg_b.end - seg_a.start).dot(dir_a) / len_sq_a;
+        const float lo = clamp(std::min(t0, t1), 0.0f, 1.0f);
+        const float hi = clamp(std::max(t0, t1), 0.0f, 1.0f);
+        if ((hi - lo) * (hi - lo) * len_sq_a > kParallelSine * radius * radius) {
+            for (const float s : {lo, hi}) {
+                const Vec3f p = seg_a.getPoint(s);
+                const Vec3f q = seg_b.closestPoint(p);
+                const float depth = radius - (q - p).dot(out.normal);
+                if (depth >= 0.0f) {
+                    out.addPoint(q - out.normal * b.radius(), depth);
+                }
+            }
+            if (out.count == 2) {
+                return true;
+            }
+            out.clear();
+        }
+    }
+
+    out.addPoint(pb - out.normal * b.radius(), radius - distance);
+    return true;
+}
+
+bool generateContacts(const Sphere& a, const Obb& b, ContactManifold& out) noexcept {
+    out.clear();
+
+    const Mat3f& basis = b.rotationMatrix();
+    const Vec3f& half = b.halfExtents();
+    const Vec3f d = a.center() - b.center();
+
+    // Center in box space
+    const Vec3f local(d.dot(basis[0]), d.dot(basis[1]), d.dot(basis[2]));
+    const Vec3f clamped(clamp(local.x(), -half.x(), half.x()),
+                        clamp(local.y(), -half.y(), half.y()),
+                        clamp(local.z(), -half.z(), half.z()));
+
+    if (clamped != local) {
+        const Vec3f closest = b.center() + basis[0] * clamped.x() + basis[1] * clamped.y() + basis[2] * clamped.z();
+        const Vec3f offset = closest - a.center();
+        const float dist_sq = offset.lengthSquared();
+        if (dist_sq > a.radius() * a.radius()) {
+            return false;
+        }
+        const float distance = std::sqrt(dist_sq);
+        out.normal = offset / distance;
+        out.addPoint(closest, a.radius() - distance);
+        return true;
+    }
+
+    // Center inside: push out through the nearest face
+    uint32_t axis = 0;
+    float face_dist = half[0] - std::abs(local[0]);
+    for (uint32_t i = 1; i < 3; ++i) {
+        const float dist = half[i] - std::abs(local[i]);
+        if (dist < face_dist) {
+            face_dist = dist;
+            axis = i;
+        }
+    }
+    out.normal = basis[axis] * -signOf(local[axis]);
+    out.addPoint(a.center() - out.normal * face_dist, a.radius() + face_dist);
+    return true;
+}
+
+bool generateContacts(const Capsule& a, const Obb& b, ContactManifold& out) noexcept {
+    out.clear();
+
+    const LineSegment core = a.segment();
+    const GjkResult result = gjkDistance(core, b);
+    if (result.intersecting) {
+        // Segment inside the box: both are polytopes, so SAT finds the exact minimum translation
+        segmentBoxPenetration(core, a.radius(), b, out);
+    } else {
+        if (result.distance > a.radius()) {
+            return false;
+        }
+        out.normal = result.normal;
+        out.addPoint(result.point_b, a.radius() - result.distance);
+    }
+
+    // Normal along a face normal: clip the segment to that face for a second point
+    const Mat3f& basis = b.rotationMatrix();
+    const Vec3f& half = b.halfExtents();
+    uint32_t axis = 0;
+    float alignment = -1.0f;
+    for (uint32_t i = 0; i < 3; ++i) {
+        const float d = std::abs(basis[i].dot(out.normal));
+        if (d > alignment) {
+            alignment = d;
+            axis = i;
+        }
+    }
+    if (alignment < kFaceAlignment) {
+        return true;
+    }
+
+    // Face of B looking at A, then the part of the segment over it
+    const Vec3f face_normal = basis[axis] * -signOf(basis[axis].dot(out.normal));
+    const Vec3f start = core.start - b.center();
+    const Vec3f dir = core.direction();
+    float t_min = 0.0f;
+    float t_max = 1.0f;
+    for (uint32_t k = 1; k < 3; ++k) {
+        const uint32_t side = (axis + k) % 3;
+        const float p = start.dot(basis[side]);
+        const float q = dir.dot(basis[side]);
+        if (std::abs(q) <= std::numeric_limits<float>::min()) {
+            if (std::abs(p) > half[side]) {
+                return true;
+            }
+            continue;
+        }
+        const float t0 = (-half[side] - p) / q;
+        const float t1 = (half[side] - p) / q;
+        t_min = std::max(t_min, std::min(t0, t1));
+        t_max = std::min(t_max, std::max(t0, t1));
+    }
+    if (t_max - t_min <= std::numeric_limits<float>::epsilon()) {
+        return true;
+    }
+
+    ContactManifold clipped;
+    clipped.normal = -face_normal;
+    for (const float t : {t_min, t_max}) {
+        const Vec3f p = core.getPoint(t);
+        const float separation = (p - b.center()).dot(face_normal) - half[axis];
+        const float depth = a.radius() - separation;
+        if (depth >= 0.0f) {
+            clipped.addPoint(p - face_normal * separation, depth);
+        }
+    }
+    if (clipped.count == 2) {
+        out = clipped;
+    }
+    return true;
+}
+
+// ============================================================================
+// Batch Queries
+// ============================================================================
+
+size_t generateContacts(std::span<const Obb> shapes_a,
+                        std::span<const Obb> shapes_b,
+                        std::span<const ContactPair> pairs,
+                        std::span<ContactManifold> out) noexcept {
+    return generatePairContacts(shapes_a, shapes_b, pairs, out);
+}
+
+size_t generateContacts(std::span<const Capsule> shapes_a,
+                        std::span<const Capsule> shapes_b,
+                        std::span<const ContactPair> pairs,
+                        std::span<ContactManifold> out) noexcept {
+    return generatePairContacts(shapes_a, shapes_b, pairs, out);
+}
+
+size_t generateContacts(std::span<const Sphere> shapes_a,
+                        std::span<const Obb> shapes_b,
+                        std::span<const ContactPair> pairs,
+                        std::span<ContactManifold> out) noexcept {
+    return generatePairContacts(shapes_a, shapes_b, pairs, out);
+}
+
+size_t generateContacts(std::span<const Capsule> shapes_a,
+                        std::span<const Obb> shapes_b,
+                        std::span<const ContactPair> pairs,
+                        std::span<ContactManifold> out) noexcept {
+    return generatePairContacts(shapes_a, shapes_b, pairs, out);
+}
+
+}  // namespace vne::math
@@ -0,0 +1,552 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Corresponding header
+#include "vertexnova/math/geometry/convex_hull.h"
+
+// Project headers
+#include "vertexnova/common/macros.h"
+#include "vertexnova/math/core/constants.h"
+
+// Standard library includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace vne::math {
+
+namespace {
+
+/// End of an outside set, and "no face" in the face links
+constexpr uint32_t kNone = std::numeric_limits<uint32_t>::max();
+
+/// Hull tolerance in multiples of float epsilon times the input extent (the qhull convention)
+constexpr float kToleranceScale = 3.0f;
+
+/// Twice the signed area of the triangle (o, a, b); positive when counter-clockwise
+[[nodiscard]] double cross(const Vec2f& o, const Vec2f& a, const Vec2f& b) noexcept {
+    return (static_cast<double>(a.x()) - o.x()) * (static_cast<double>(b.y()) - o.y())
+           - (static_cast<double>(a.y()) - o.y()) * (static_cast<double>(b.x()) - o.x());
+}
+
+/// Andrew's monotone chain over points, sorted through order
+void monotoneChain(std::span<const Vec2f> points, std::vector<uint32_t>& order, std::vector<uint32_t>& hull) {
+    hull.clear();
+    const auto count = static_cast<uint32_t>(points.size());
+    if (count == 0) {
+        return;
+    }
+
+    order.resize(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&points](uint32_t a, uint32_t b) {
+        const Vec2f& pa = points[a];
+        const Vec2f& pb = points[b];
+        return pa.x() < pb.x() || (pa.x() == pb.x() && (pa.y() < pb.y() || (pa.y() == pb.y() && a < b)));
+    });
+
+    // Lower chain left to right, then upper chain right to left; both keep left turns
+    // only. Equal points sort by index, so each chain keeps the lowest index of a group
+    for (uint32_t i = 0; i < count; ++i) {
+        const Vec2f& p = points[order[i]];
+        if (!hull.empty() && points[hull.back()] == p) {
+            continue;
+        }
+        while (hull.size() >= 2 && cross(points[hull[hull.size() - 2]], points[hull.back()], p) <= 0.0) {
+            hull.pop_back();
+        }
+        hull.push_back(order[i]);
+    }
+    const size_t lower_size = hull.size() + 1;
+    for (uint32_t i = count - 1; i-- > 0;) {
+        const Vec2f& p = points[order[i]];
+        // Walking backwards, a group of equal points is entered at its highest index
+        if (points[hull.back()] == p || (i > 0 && points[order[i - 1]] == p)) {
+            continue;
+        }
+        while (hull.size() >= lower_size && cross(points[hull[hull.size() - 2]], points[hull.back()], p) <= 0.0) {
+            hull.pop_back();
+        }
+        hull.push_back(order[i]);
+    }
+    // The upper chain ends on the first point again
+    if (hull.size() > 1) {
+        hull.pop_back();
+    }
+}
+
+}  // namespace
+
+// ============================================================================
+// Quickhull
+// ============================================================================
+
+/**
+ * Quickhull over the buffers of a HullScratch. Faces are triangles linked to
+ * their three neighbours; each face owns a singly linked list of the points
+ * above it, threaded through next_point_.
+ */
+struct HullBuilder {
+    using Face = HullScratch::Face;
+    using HorizonEdge = HullScratch::HorizonEdge;
+    using VisitFrame = HullScratch::VisitFrame;
+
+    HullScratch& s;
+    std::span<const Vec3f> points;
+    float tolerance{0.0f};
+    uint32_t visit{0};
+
+    [[nodiscard]] float distance(const Face& face, const Vec3f& p) const noexcept {
+        return face.normal.dot(p) - face.offset;
+    }
+
+    /// Slot of the edge of face that runs from a to b
+    [[nodiscard]] static uint32_t edgeSlot(const Face& face, uint32_t a, uint32_t b) noexcept {
+        for (uint32_t i = 0; i < 3; ++i) {
+            if (face.vertex[i] == a && face.vertex[(i + 1) % 3] == b) {
+                return i;
+            }
+        }
+        return kNone;
+    }
+
+    uint32_t addFace(uint32_t a, uint32_t b, uint32_t c) {
+        Face face{};
+        face.vertex[0] = a;
+        face.vertex[1] = b;
+        face.vertex[2] = c;
+        face.neighbor[0] = face.neighbor[1] = face.neighbor[2] = kNone;
+        const Vec3f n = (points[b] - points[a]).cross(points[c] - points[a]);
+        const float length = n.length();
+        // A sliver keeps a zero normal: no point is ever above it
+        face.normal = length > 0.0f ? n / length : Vec3f::zero();
+        face.offset = face.normal.dot(points[a]);
+        face.outside = kNone;
+        face.furthest = kNone;
+        face.furthest_distance = 0.0f;
+        face.visit = 0;
+        face.alive = true;
+
+        if (!s.free_faces_.empty()) {
+            const uint32_t slot = s.free_faces_.back();
+            s.free_faces_.pop_back();
+            s.faces_[slot] = face;
+            return slot;
+        }
+        s.faces_.push_back(face);
+        return static_cast<uint32_t>(s.faces_.size() - 1);
+    }
+
+    /// Adds point to the outside set of the face it is farthest above, if any
+    void assign(uint32_t point, std::span<const uint32_t> candidates) noexcept {
+        float best_distance = tolerance;
+        uint32_t best = kNone;
+        for (const uint32_t f : candidates) {
+            const float d = distance(s.faces_[f], points[point]);
+            if (d > best_distance) {
+                best_distance = d;
+                best = f;
+            }
+        }
+        if (best == kNone) {
+            return;  // Inside or on the hull
+        }
+        Face& face = s.faces_[best];
+        s.next_point_[point] = face.outside;
+        face.outside = point;
+        if (best_distance > face.furthest_distance) {
+            face.furthest_distance = best_distance;
+            face.furthest = point;
+        }
+    }
+
+    /**
+     * Marks every face the eye sees, starting from a face known to see it, and
+     * records the horizon. Entering each neighbour through the shared edge and
+     * walking its other edges in winding order emits the horizon as a closed
+     * counter-clockwise loop.
+     */
+    void findHorizon(uint32_t start, const Vec3f& eye) {
+        s.visible_.clear();
+        s.horizon_.clear();
+        s.stack_.clear();
+        s.faces_[start].visit = visit;
+        s.visible_.push_back(start);
+        s.stack_.push_back(VisitFrame{start, 0, 0});
+
+        while (!s.stack_.empty()) {
+            VisitFrame& frame = s.stack_.back();
+            if (frame.step == 3) {
+                s.stack_.pop_back();
+                continue;
+            }
+            const uint32_t face = frame.face;
+            const uint32_t edge = (frame.start + frame.step) % 3;
+            ++frame.step;
+
+            const uint32_t neighbor = s.faces_[face].neighbor[edge];
+            Face& other = s.faces_[neighbor];
+            if (other.visit == visit) {
+                continue;
+            }
+            if (distance(other, eye) > tolerance) {
+                other.visit = visit;
+                s.visible_.push_back(neighbor);
+                const Face& from = s.faces_[face];
+                const uint32_t back = edgeSlot(other, from.vertex[(edge + 1) % 3], from.vertex[edge]);
+                // The shared edge leads back to a visited face; skip it
+                s.stack_.push_back(VisitFrame{neighbor, back, 1});
+            } else {
+                const Face& from = s.faces_[face];
+                s.horizon_.push_back(HorizonEdge{from.vertex[edge], from.vertex[(edge + 1) % 3], face, edge});
+            }
+        }
+    }
+
+    /// True if each horizon edge starts where the previous one ends
+    [[nodiscard]] bool horizonIsLoop() const noexcept {
+        const size_t count = s.horizon_.size();
+        if (count < 3) {
+            return false;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            if (s.horizon_[i].b != s.horizon_[(i + 1) % count].a) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Replaces the faces the eye sees with a cone of faces from the horizon to the eye
+    void addPoint(uint32_t eye_index) {
+        // Gather the outside points of the visible faces before their slots are recycled
+        uint32_t orphans = kNone;
+        for (const uint32_t f : s.visible_) {
+            Face& face = s.faces_[f];
+            for (uint32_t p = face.outside; p != kNone;) {
+                const uint32_t next = s.next_point_[p];
+                if (p != eye_index) {
+                    s.next_point_[p] = orphans;
+                    orphans = p;
+                }
+                p = next;
+            }
+            face.alive = false;
+        }
+        // Switch each horizon edge over to the face that stays
+        for (HorizonEdge& edge : s.horizon_) {
+            edge.face = s.faces_[edge.face].neighbor[edge.edge];
+            edge.edge = edgeSlot(s.faces_[edge.face], edge.b, edge.a);
+        }
+        for (const uint32_t f : s.visible_) {
+            s.free_faces_.push_back(f);
+        }
+
+        s.new_faces_.clear();
+        for (const HorizonEdge& edge : s.horizon_) {
+            const uint32_t f = addFace(edge.a, edge.b, eye_index);
+            s.faces_[f].neighbor[0] = edge.face;
+            s.faces_[edge.face].neighbor[edge.edge] = f;
+            s.new_faces_.push_back(f);
+        }
+        const size_t count = s.new_faces_.size();
+        for (size_t i = 0; i < count; ++i) {
+            const uint32_t f = s.new_faces_[i];
+            const uint32_t next = s.new_faces_[(i + 1) % count];
+            s.faces_[f].neighbor[1] = next;
+            s.faces_[next].neighbor[2] = f;
+        }
+
+        for (uint32_t p = orphans; p != kNone;) {
+            const uint32_t next = s.next_point_[p];
+            assign(p, s.new_faces_);
+            p = next;
+        }
+        for (const uint32_t f : s.new_faces_) {
+            if (s.faces_[f].outside != kNone) {
+                s.pending_.push_back(f);
+            }
+        }
+    }
+
+    /// Removes point from the outside set of face
+    void dropPoint(uint32_t face_index, uint32_t point) noexcept {
+        Face& face = s.faces_[face_index];
+        uint32_t* link = &face.outside;
+        while (*link != kNone && *link != point) {
+            link = &s.next_point_[*link];
+        }
+        if (*link == point) {
+            *link = s.next_point_[point];
+        }
+        face.furthest = kNone;
+        face.furthest_distance = 0.0f;
+        for (uint32_t p = face.outside; p != kNone; p = s.next_point_[p]) {
+            const float d = distance(face, points[p]);
+            if (d > face.furthest_distance) {
+                face.furthest_distance = d;
+                face.furthest = p;
+            }
+        }
+    }
+
+    /// Builds the hull of points spanning a volume from the tetrahedron (i0, i1, i2, i3)
+    void build(uint32_t i0, uint32_t i1, uint32_t i2, uint32_t i3) {
+        s.faces_.clear();
+        s.free_faces_.clear();
+        s.pending_.clear();
+        s.next_point_.assign(points.size(), kNone);
+
+        // (i0, i1, i2) must face away from i3
+        const Vec3f n = (points[i1] - points[i0]).cross(points[i2] - points[i0]);
+        if (n.dot(points[i3] - points[i0]) > 0.0f) {
+            std::swap(i1, i2);
+        }
+        const uint32_t tetra[4] = {
+            addFace(i0, i1, i2),
+            addFace(i0, i3, i1),
+            addFace(i1, i3, i2),
+            addFace(i2, i3, i0),
+        };
+        for (const uint32_t a : tetra) {
+            for (const uint32_t b : tetra) {
+                if (a == b) {
+                    continue;
+                }
+                Face& fa = s.faces_[a];
+                for (uint32_t e = 0; e < 3; ++e) {
+                    if (edgeSlot(s.faces_[b], fa.vertex[(e + 1) % 3], fa.vertex[e]) != kNone) {
+                        fa.neighbor[e] = b;
+                    }
+                }
+            }
+        }
+
+        const auto count = static_cast<uint32_t>(points.size());
+        for (uint32_t p = 0; p < count; ++p) {
+            if (p != i0 && p != i1 && p != i2 && p != i3) {
+                assign(p, tetra);
+            }
+        }
+        for (const uint32_t f : tetra) {
+            if (s.faces_[f].outside != kNone) {
+                s.pending_.push_back(f);
+            }
+        }
+
+        while (!s.pending_.empty()) {
+            const uint32_t f = s.pending_.back();
+            if (!s.faces_[f].alive || s.faces_[f].outside == kNone) {
+                s.pending_.pop_back();
+                continue;
+            }
+            const uint32_t eye = s.faces_[f].furthest;
+            ++visit;
+            findHorizon(f, points[eye]);
+            if (!horizonIsLoop()) {
+                // Rounding left the visible region with a hole; treat the eye as on the hull
+                dropPoint(f, eye);
+                continue;
+            }
+            s.pending_.pop_back();
+            addPoint(eye);
+        }
+    }
+
+    /// Writes the live faces, their edges and vertices
+    void emit(ConvexHull& hull) const {
+        for (const Face& face : s.faces_) {
+            if (!face.alive) {
+                continue;
+            }
+            for (uint32_t i = 0; i < 3; ++i) {
+                hull.triangles.push_back(face.vertex[i]);
+                // Each edge appears in two faces, once in each direction
+                const uint32_t a = face.vertex[i];
+                const uint32_t b = face.vertex[(i + 1) % 3];
+                if (a < b) {
+                    hull.edges.push_back(a);
+                    hull.edges.push_back(b);
+                }
+            }
+        }
+        hull.vertices.assign(hull.triangles.begin(), hull.triangles.end());
+        std::sort(hull.vertices.begin(), hull.vertices.end());
+        hull.vertices.erase(std::unique(hull.vertices.begin(), hull.vertices.end()), hull.vertices.end());
+    }
+
+    /// 2D hull, sorting through the scratch
+    static void chain(std::span<const Vec2f> points, std::vector<uint32_t>& hull, HullScratch& scratch) {
+        monotoneChain(points, scratch.order_, hull);
+    }
+
+    /// Two-sided triangulation of the 2D hull of coplanar points
+    void buildFlat(const Vec3f& origin, const Vec3f& normal, const Vec3f& u_axis, ConvexHull& hull) {
+        const Vec3f v_axis = normal.cross(u_axis);
+        s.projected_.resize(points.size());
+        for (size_t i = 0; i < points.size(); ++i) {
+            const Vec3f d = points[i] - origin;
+            s.projected_[i] = Vec2f(d.dot(u_axis), d.dot(v_axis));
+        }
+        std::vector<uint32_t>& ring = hull.vertices;
+        monotoneChain(s.projected_, s.order_, ring);
+        const size_t count = ring.size();
+        if (count < 3) {
+            ring.clear();
+            return;
+        }
+        // Counter-clockwise in (u, v) faces along normal; the reversed fan faces the other way
+        for (size_t i = 1; i + 1 < count; ++i) {
+            hull.triangles.insert(hull.triangles.end(), {ring[0], ring[i], ring[i + 1]});
+        }
+        for (size_t i = 1; i + 1 < count; ++i) {
+            hull.triangles.insert(hull.triangles.end(), {ring[0], ring[i + 1], ring[i]});
+        }
+        for (size_t i = 0; i < count; ++i) {
+            const uint32_t a = ring[i];
+            const uint32_t b = ring[(i + 1) % count];
+            hull.edges.insert(hull.edges.end(), {std::min(a, b), std::max(a, b)});
+        }
+        for (size_t i = 2; i + 1 < count; ++i) {
+            // Fan diagonals, shared by both sides
+            hull.edges.insert(hull.edges.end(), {std::min(ring[0], ring[i]), std::max(ring[0], ring[i])});
+        }
+        std::sort(ring.begin(), ring.end());
+    }
+};
+
+// ============================================================================
+// HullScratch
+// ============================================================================
+
+void HullScratch::reserve(size_t point_count) {
+    order_.reserve(point_count);
+    projected_.reserve(point_count);
+    next_point_.reserve(point_count);
+}
+
+size_t HullScratch::capacity() const noexcept {
+    return order_.capacity() * sizeof(uint32_t) + projected_.capacity() * sizeof(Vec2f)
+           + faces_.capacity() * sizeof(Face) + free_faces_.capacity() * sizeof(uint32_t)
+           + pending_.capacity() * sizeof(uint32_t) + next_point_.capacity() * sizeof(uint32_t)
+           + visible_.capacity() * sizeof(uint32_t) + stack_.capacity() * sizeof(VisitFrame)
+           + horizon_.capacity() * sizeof(HorizonEdge) + new_faces_.capacity() * sizeof(uint32_t);
+}
+
+// ============================================================================
+// 2D Hull
+// ============================================================================
+
+void convexHull(std::span<const Vec2f> points, std::vector<uint32_t>& hull, HullScratch& scratch) {
+    VNE_ASSERT_MSG(points.size() < kNone, "convexHull: too many points");
+    HullBuilder::chain(points, hull, scratch);
+}
+
+std::vector<uint32_t> convexHull(std::span<const Vec2f> points) {
+    HullScratch scratch;
+    std::vector<uint32_t> hull;
+    convexHull(points, hull, scratch);
+    return hull;
+}
+
+// ============================================================================
+// 3D Hull
+// ============================================================================
+
+void convexHull(std::span<const Vec3f> points, ConvexHull& hull, HullScratch& scratch) {
+    hull.clear();
+    VNE_ASSERT_MSG(points.size() < kNone, "convexHull: too many points");
+    const auto count = static_cast<uint32_t>(std::min<size_t>(points.size(), kNone - 1));
+    if (count < 3) {
+        return;
+    }
+    points = points.first(count);
+
+    // Extreme points along each axis seed the tetrahedron and scale the tolerance
+    uint32_t extremes[6] = {0, 0, 0, 0, 0, 0};
+    Vec3f max_abs = Vec3f::zero();
+    for (uint32_t i = 0; i < count; ++i) {
+        const Vec3f& p = points[i];
+        for (int axis = 0; axis < 3; ++axis) {
+            if (p[axis] < points[extremes[axis]][axis]) {
+                extremes[axis] = i;
+            }
+            if (p[axis] > points[extremes[axis + 3]][axis]) {
+                extremes[axis + 3] = i;
+            }
+        }
+        max_abs = max_abs.componentMax(p.abs());
+    }
+    HullBuilder builder{scratch, points};
+    builder.tolerance = kToleranceScale * kFloatEpsilon * (max_abs.x() + max_abs.y() + max_abs.z());
+    const float tolerance = builder.tolerance;
+
+    // Most distant pair of extremes
+    uint32_t i0 = extremes[0];
+    uint32_t i1 = extremes[3];
+    float best = 0.0f;
+    for (int a = 0; a < 6; ++a) {
+        for (int b = a + 1; b < 6; ++b) {
+            const float d = (points[extremes[a]] - points[extremes[b]]).lengthSquared();
+            if (d > best) {
+                best = d;
+                i0 = extremes[a];
+                i1 = extremes[b];
+            }
+        }
+    }
+    if (best <= tolerance * tolerance) {
+        return;  // All points coincide
+    }
+
+    // Farthest from the line, then farthest from the plane
+    const Vec3f line = (points[i1] - points[i0]).normalized();
+    uint32_t i2 = i0;
+    best = 0.0f;
+    for (uint32_t i = 0; i < count; ++i) {
+        const float d = (points[i] - points[i0]).cross(line).lengthSquared();
+        if (d > best) {
+            best = d;
+            i2 = i;
+        }
+    }
+    if (best <= tolerance * tolerance) {
+        return;  // Collinear
+    }
+    const Vec3f normal = (points[i1] - points[i0]).cross(points[i2] - points[i0]).normalized();
+    uint32_t i3 = i0;
+    best = 0.0f;
+    for (uint32_t i = 0; i < count; ++i) {
+        const float d = std::abs(normal.dot(points[i] - points[i0]));
+        if (d > best) {
+            best = d;
+            i3 = i;
+        }
+    }
+    if (best <= tolerance) {
+        builder.buildFlat(points[i0], normal, line, hull);
+        return;
+    }
+
+    builder.build(i0, i1, i2, i3);
+    builder.emit(hull);
+}
+
+ConvexHull convexHull(std::span<const Vec3f> points) {
+    HullScratch scratch;
+    ConvexHull hull;
+    convexHull(points, hull, scratch);
+    return hull;
+}
+
+}  // namespace vne::math
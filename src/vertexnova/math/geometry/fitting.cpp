@@ -0,0 +1,705 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Corresponding header
+#include "vertexnova/math/geometry/fitting.h"
+
+// Project headers
+#include "vertexnova/common/macros.h"
+#include "vertexnova/math/core/constants.h"
+#include "vertexnova/math/core/types.h"
+#include "vertexnova/math/simd/float4.h"
+
+// Standard library includes
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace vne::math {
+
+namespace {
+
+/// Seed of the shuffle that makes Welzl's algorithm expected linear time
+constexpr uint32_t kWelzlSeed = 0x5A17u;
+
+/// Relative slack on the squared radius before a point counts as outside a Welzl ball
+constexpr double kWelzlTolerance = 1e-6;
+
+/// Relative size below which a triangle or tetrahedron is treated as flat
+constexpr double kDegenerateTolerance = 1e-10;
+
+/// Cyclic Jacobi sweeps for the 3x3 covariance; converges in well under this
+constexpr int kJacobiSweeps = 16;
+
+/// Slab padding of fitKdop(), in ulps of the largest coordinate
+constexpr float kSlabPadUlps = 8.0f;
+
+/// Points per index chunk, so lane indices stay exactly representable as float
+constexpr size_t kIndexChunk = size_t{1} << 24;
+
+// ============================================================================
+// SIMD Extremes
+// ============================================================================
+
+/// Smallest and largest projection onto each axis, with the points that attain them
+struct Extremes {
+    float min[Kdop::kMaxAxes];
+    float max[Kdop::kMaxAxes];
+    size_t min_index[Kdop::kMaxAxes];
+    size_t max_index[Kdop::kMaxAxes];
+};
+
+/**
+ * Projects every point onto up to kMaxAxes axes and reduces to min/max.
+ *
+ * Four points are loaded per iteration and projected onto all axes while in
+ * registers; per-lane minima and maxima (and, if requested, the lane's point
+ * index) are kept in registers and reduced across lanes once per chunk.
+ */
+template <bool kTrackIndices>
+void projectExtremes(std::span<const Vec3f> points, const Vec3f* axes, uint32_t axis_count, Extremes& out) noexcept {
+    using simd::Float4;
+
+    for (uint32_t k = 0; k < axis_count; ++k) {
+        out.min[k] = kFloatMax;
+        out.max[k] = -kFloatMax;
+        out.min_index[k] = 0;
+        out.max_index[k] = 0;
+    }
+    Float4 ax[Kdop::kMaxAxes];
+    Float4 ay[Kdop::kMaxAxes];
+    Float4 az[Kdop::kMaxAxes];
+    for (uint32_t k = 0; k < axis_count; ++k) {
+        ax[k] = simd::broadcast(axes[k].x());
+        ay[k] = simd::broadcast(axes[k].y());
+        az[k] = simd::broadcast(axes[k].z());
+    }
+
+    const float* src = reinterpret_cast<const float*>(points.data());
+    const size_t block_end = points.size() - points.size() % simd::kLanes;
+    for (size_t chunk = 0; chunk < block_end; chunk += kIndexChunk) {
+        const size_t chunk_end = std::min(block_end, chunk + kIndexChunk);
+        Float4 lo[Kdop::kMaxAxes];
+        Float4 hi[Kdop::kMaxAxes];
+        Float4 lo_index[Kdop::kMaxAxes];
+        Float4 hi_index[Kdop::kMaxAxes];
+        for (uint32_t k = 0; k < axis_count; ++k) {
+            lo[k] = simd::broadcast(kFloatMax);
+            hi[k] = simd::broadcast(-kFloatMax);
+            lo_index[k] = simd::zero();
+            hi_index[k] = simd::zero();
+        }
+
+        Float4 index = simd::set(0.0f, 1.0f, 2.0f, 3.0f);
+        const Float4 step = simd::broadcast(static_cast<float>(simd::kLanes));
+        for (size_t i = chunk; i < chunk_end; i += simd::kLanes) {
+            Float4 x;
+            Float4 y;
+            Float4 z;
+            simd::loadXyz(src + 3 * i, x, y, z);
+            for (uint32_t k = 0; k < axis_count; ++k) {
+                const Float4 d = simd::madd(az[k], z, simd::madd(ay[k], y, ax[k] * x));
+                if constexpr (kTrackIndices) {
+                    const Float4 below = simd::cmpLt(d, lo[k]);
+                    const Float4 above = simd::cmpGt(d, hi[k]);
+                    lo[k] = simd::select(below, d, lo[k]);
+                    hi[k] = simd::select(above, d, hi[k]);
+                    lo_index[k] = simd::select(below, index, lo_index[k]);
+                    hi_index[k] = simd::select(above, index, hi_index[k]);
+                } else {
+                    lo[k] = simd::min(lo[k], d);
+                    hi[k] = simd::max(hi[k], d);
+                }
+            }
+            if constexpr (kTrackIndices) {
+                index = index + step;
+            }
+        }
+
+        for (uint32_t k = 0; k < axis_count; ++k) {
+            for (int lane = 0; lane < simd::kLanes; ++lane) {
+                const float lo_value = simd::lane(lo[k], lane);
+                const float hi_value = simd::lane(hi[k], lane);
+                if (lo_value < out.min[k]) {
+                    out.min[k] = lo_value;
+                    out.min_index[k] = chunk + static_cast<size_t>(simd::lane(lo_index[k], lane));
+                }
+                if (hi_value > out.max[k]) {
+                    out.max[k] = hi_value;
+                    out.max_index[k] = chunk + static_cast<size_t>(simd::lane(hi_index[k], lane));
+                }
+            }
+        }
+    }
+
+    for (size_t i = block_end; i < points.size(); ++i) {
+        for (uint32_t k = 0; k < axis_count; ++k) {
+            const float d = axes[k].dot(points[i]);
+            if (d < out.min[k]) {
+                out.min[k] = d;
+                out.min_index[k] = i;
+            }
+            if (d > out.max[k]) {
+                out.max[k] = d;
+                out.max_index[k] = i;
+            }
+        }
+    }
+}
+
+/// The seven 14-DOP axes
+void dop14Axes(Vec3f axes[7]) noexcept {
+    for (uint32_t k = 0; k < 7; ++k) {
+        axes[k] = Kdop::axis(DopType::eDop14, k);
+    }
+}
+
+// ============================================================================
+// Welzl Helpers
+// ============================================================================
+
+/// Ball in double precision; radius_sq < 0 encloses nothing
+struct Ball {
+    Vec3d center{0.0, 0.0, 0.0};
+    double radius_sq{-1.0};
+};
+
+[[nodiscard]] Vec3d toDouble(const Vec3f& v) noexcept {
+    return Vec3d(v.x(), v.y(), v.z());
+}
+
+[[nodiscard]] bool isOutside(const Ball& ball, const Vec3f& point) noexcept {
+    const double d_sq = (toDouble(point) - ball.center).lengthSquared();
+    return d_sq > ball.radius_sq * (1.0 + kWelzlTolerance);
+}
+
+[[nodiscard]] Ball ballOfTwo(const Vec3d& a, const Vec3d& b) noexcept {
+    return {(a + b) * 0.5, (b - a).lengthSquared() * 0.25};
+}
+
+[[nodiscard]] bool containsAll(const Ball& ball, const Vec3d* p, uint32_t n) noexcept {
+    for (uint32_t i = 0; i < n; ++i) {
+        if ((p[i] - ball.center).lengthSquared() > ball.radius_sq * (1.0 + kWelzlTolerance)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Smallest ball through three points (their circumcircle); collinear points give the ball of the farthest pair
+[[nodiscard]] Ball circumBall(const Vec3d& p0, const Vec3d& p1, const Vec3d& p2) noexcept {
+    const Vec3d a = p1 - p0;
+    const Vec3d b = p2 - p0;
+    const Vec3d axb = a.cross(b);
+    const double denom = 2.0 * axb.lengthSquared();
+    if (denom <= kDegenerateTolerance * a.lengthSquared() * b.lengthSquared()) {
+        Ball best = ballOfTwo(p0, p1);
+        for (const Ball& candidate : {ballOfTwo(p0, p2), ballOfTwo(p1, p2)}) {
+            if (candidate.radius_sq > best.radius_sq) {
+                best = candidate;
+            }
+        }
+        return best;
+    }
+    const Vec3d offset = (b.cross(axb) * a.lengthSquared() + axb.cross(a) * b.lengthSquared()) / denom;
+    return {p0 + offset, offset.lengthSquared()};
+}
+
+/// Smallest ball enclosing up to four points by trying every subset as the boundary
+[[nodiscard]] Ball smallestEnclosing(const Vec3d* p, uint32_t n) noexcept {
+    Ball best;
+    best.radius_sq = std::numeric_limits<double>::max();
+    for (uint32_t i = 0; i < n; ++i) {
+        for (uint32_t j = i + 1; j < n; ++j) {
+            const Ball pair = ballOfTwo(p[i], p[j]);
+            if (pair.radius_sq < best.radius_sq && containsAll(pair, p, n)) {
+                best = pair;
+            }
+            for (uint32_t k = j + 1; k < n; ++k) {
+                const Ball triple = circumBall(p[i], p[j], p[k]);
+                if (triple.radius_sq < best.radius_sq && containsAll(triple, p, n)) {
+                    best = triple;
+                }
+            }
+        }
+    }
+    return best;
+}
+
+/// Smallest ball with every support point on its boundary
+[[nodiscard]] Ball ballFromSupport(const Vec3f* support, uint32_t n) noexcept {
+    switch (n) {
+        case 0:
+            return {};
+        case 1:
+            return {toDouble(support[0]), 0.0};
+        case 2:
+            return ballOfTwo(toDouble(support[0]), toDouble(support[1]));
+        case 3:
+            return circumBall(toDouble(support[0]), toDouble(support[1]), toDouble(support[2]));
+        default:
+            break;
+    }
+    const Vec3d p[4] = {toDouble(support[0]), toDouble(support[1]), toDouble(support[2]), toDouble(support[3])};
+    const Vec3d a = p[1] - p[0];
+    const Vec3d b = p[2] - p[0];
+    const Vec3d c = p[3] - p[0];
+    const double det = 2.0 * a.dot(b.cross(c));
+    const double scale = std::sqrt(a.lengthSquared() * b.lengthSquared() * c.lengthSquared());
+    if (std::abs(det) <= kDegenerateTolerance * scale) {
+        return smallestEnclosing(p, 4);
+    }
+    const Vec3d offset =
+        (b.cross(c) * a.lengthSquared() + c.cross(a) * b.lengthSquared() + a.cross(b) * c.lengthSquared()) / det;
+    return {p[0] + offset, offset.lengthSquared()};
+}
+
+/// Welzl's recursion in Gärtner's move-to-front form; depth is bounded by the four support points
+Ball welzl(std::vector<Vec3f>& points, size_t end, Vec3f* support, uint32_t support_count) noexcept {
+    Ball ball = ballFromSupport(support, support_count);
+    if (support_count == 4) {
+        return ball;
+    }
+    for (size_t i = 0; i < end; ++i) {
+        if (isOutside(ball, points[i])) {
+            support[support_count] = points[i];
+            ball = welzl(points, i, support, support_count + 1);
+            std::rotate(points.begin(), points.begin() + static_cast<std::ptrdiff_t>(i),
+                        points.begin() + static_cast<std::ptrdiff_t>(i + 1));
+        }
+    }
+    return ball;
+}
+
+// ============================================================================
+// Oriented Box Helpers
+// ============================================================================
+
+/// Eigenvectors of a symmetric 3x3 matrix by cyclic Jacobi rotations, sorted by decreasing eigenvalue
+void symmetricEigenvectors(double a[3][3], Vec3d out_vectors[3]) noexcept {
+    double v[3][3] = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+    for (int sweep = 0; sweep < kJacobiSweeps; ++sweep) {
+        const double off = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+        const double diag = a[0][0] * a[0][0] + a[1][1] * a[1][1] + a[2][2] * a[2][2];
+        if (off <= 1e-24 * diag || off == 0.0) {
+            break;
+        }
+        for (int p = 0; p < 2; ++p) {
+            for (int q = p + 1; q < 3; ++q) {
+                if (a[p][q] == 0.0) {
+                    continue;
+                }
+                const double theta = (a[q][q] - a[p][p]) / (2.0 * a[p][q]);
+                const double t = (theta >= 0.0 ? 1.0 : -1.0) / (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+                const double c = 1.0 / std::sqrt(t * t + 1.0);
+                const double s = t * c;
+                for (int k = 0; k < 3; ++k) {
+                    const double akp = a[k][p];
+                    const double akq = a[k][q];
+                    a[k][p] = c * akp - s * akq;
+                    a[k][q] = s * akp + c * akq;
+                }
+                for (int k = 0; k < 3; ++k) {
+                    const double apk = a[p][k];
+                    const double aqk = a[q][k];
+                    a[p][k] = c * apk - s * aqk;
+                    a[q][k] = s * apk + c * aqk;
+                }
+                for (int k = 0; k < 3; ++k) {
+                    const double vkp = v[k][p];
+                    const double vkq = v[k][q];
+                    v[k][p] = c * vkp - s * vkq;
+                    v[k][q] = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+
+    int order[3] = {0, 1, 2};
+    std::sort(order, order + 3, [&a](int lhs, int rhs) { return a[lhs][lhs] > a[rhs][rhs]; });
+    for (int k = 0; k < 3; ++k) {
+        out_vectors[k] = Vec3d(v[0][order[k]], v[1][order[k]], v[2][order[k]]);
+    }
+}
+
+/// Completes a unit vector to a right-handed orthonormal basis
+void basisFromAxis(const Vec3f& u, Vec3f axes[3]) noexcept {
+    const Vec3f helper = std::abs(u.x()) < 0.6f ? Vec3f(1.0f, 0.0f, 0.0f) : Vec3f(0.0f, 1.0f, 0.0f);
+    axes[0] = u;
+    axes[1] = u.cross(helper).normalized();
+    axes[2] = axes[0].cross(axes[1]);
+}
+
+/// Surface-area measure (up to a constant factor) of the box around @p points along orthonormal @p axes
+[[nodiscard]] float boxAreaMeasure(const Vec3f* points, uint32_t count, const Vec3f axes[3]) noexcept {
+    float extent[3];
+    for (int k = 0; k < 3; ++k) {
+        float lo = kFloatMax;
+        float hi = -kFloatMax;
+        for (uint32_t i = 0; i < count; ++i) {
+            const float d = axes[k].dot(points[i]);
+            lo = std::min(lo, d);
+            hi = std::max(hi, d);
+        }
+        extent[k] = hi - lo;
+    }
+    return extent[0] * extent[1] + extent[1] * extent[2] + extent[2] * extent[0];
+}
+
+/// Tight box along right-handed orthonormal axes
+[[nodiscard]] Obb fitObbToAxes(std::span<const Vec3f> points, const Vec3f axes[3]) noexcept {
+    Extremes extremes;
+    projectExtremes<false>(points, axes, 3, extremes);
+    Vec3f center = Vec3f::zero();
+    Vec3f half_extents;
+    for (int k = 0; k < 3; ++k) {
+        center += axes[k] * (0.5f * (extremes.min[k] + extremes.max[k]));
+        half_extents[k] = 0.5f * (extremes.max[k] - extremes.min[k]);
+    }
+    return Obb(center, half_extents, Mat3f(axes[0], axes[1], axes[2]));
+}
+
+/**
+ * Tries the three edges of triangle (a, b, c) as box axes, with the triangle
+ * normal as the second axis, and keeps the best by area over @p points.
+ */
+void tryTriangleAxes(const Vec3f& a,
+                     const Vec3f& b,
+                     const Vec3f& c,
+                     const Vec3f* points,
+                     uint32_t count,
+                     Vec3f best_axes[3],
+                     float& best_area) noexcept {
+    const Vec3f normal = (b - a).cross(c - a);
+    const float normal_length = normal.length();
+    if (!(normal_length > kFloatEpsilon)) {
+        return;
+    }
+    const Vec3f n = normal / normal_length;
+    for (const Vec3f& edge : {b - a, c - b, a - c}) {
+        const float edge_length = edge.length();
+        if (!(edge_length > kFloatEpsilon)) {
+            continue;
+        }
+        const Vec3f u = edge / edge_length;
+        const Vec3f axes[3] = {u, n, u.cross(n)};
+        const float area = boxAreaMeasure(points, count, axes);
+        if (area < best_area) {
+            best_area = area;
+            std::copy(axes, axes + 3, best_axes);
+        }
+    }
+}
+
+[[nodiscard]] MeshBounds fitMesh(std::span<const Vec3f> points, const FitOptions& options) {
+    MeshBounds bounds;
+    bounds.dop = fitKdop(points, options.dop);
+    bounds.aabb = points.empty() ? Aabb() : bounds.dop.getAabb();
+    bounds.sphere = options.sphere == SphereFit::eWelzl ? fitSphereWelzl(points) : fitSphereRitter(points);
+    bounds.obb = options.obb == ObbFit::eDito ? fitObbDito(points) : fitObbPca(points);
+    return bounds;
+}
+
+}  // namespace
+
+// ============================================================================
+// Spheres
+// ============================================================================
+
+Sphere fitSphereRitter(std::span<const Vec3f> points) noexcept {
+    if (points.empty()) {
+        return Sphere();
+    }
+
+    // Most distant pair of extreme points over the 14-DOP axes
+    Vec3f axes[7];
+    dop14Axes(axes);
+    Extremes extremes;
+    projectExtremes<true>(points, axes, 7, extremes);
+    Vec3f a = points[extremes.min_index[0]];
+    Vec3f b = points[extremes.max_index[0]];
+    for (uint32_t k = 1; k < 7; ++k) {
+        const Vec3f& lo = points[extremes.min_index[k]];
+        const Vec3f& hi = points[extremes.max_index[k]];
+        if ((hi - lo).lengthSquared() > (b - a).lengthSquared()) {
+            a = lo;
+            b = hi;
+        }
+    }
+
+    Vec3f center = (a + b) * 0.5f;
+    float radius = (b - a).length() * 0.5f;
+    for (const Vec3f& p : points) {
+        const float d_sq = (p - center).lengthSquared();
+        if (d_sq > radius * radius) {
+            const float d = std::sqrt(d_sq);
+            const float grown = 0.5f * (radius + d);
+            center += (p - center) * ((grown - radius) / d);
+            radius = grown;
+        }
+    }
+    return Sphere(center, radius);
+}
+
+Sphere fitSphereWelzl(std::span<const Vec3f> points) {
+    if (points.empty()) {
+        return Sphere();
+    }
+
+    std::vector<Vec3f> shuffled(points.begin(), points.end());
+    std::shuffle(shuffled.begin(), shuffled.end(), std::minstd_rand(kWelzlSeed));
+    Vec3f support[4];
+    const Ball ball = welzl(shuffled, shuffled.size(), support, 0);
+
+    // Round to float and grow over anything the tolerance or rounding let slip
+    const Vec3f center(static_cast<float>(ball.center.x()),
+                       static_cast<float>(ball.center.y()),
+                       static_cast<float>(ball.center.z()));
+    float radius_sq = static_cast<float>(std::max(ball.radius_sq, 0.0));
+    for (const Vec3f& p : points) {
+        radius_sq = std::max(radius_sq, (p - center).lengthSquared());
+    }
+    return Sphere(center, std::sqrt(radius_sq));
+}
+
+// ============================================================================
+// Oriented Boxes
+// ============================================================================
+
+Obb fitObbPca(std::span<const Vec3f> points) noexcept {
+    if (points.empty()) {
+        return Obb();
+    }
+
+    Vec3d mean(0.0, 0.0, 0.0);
+    for (const Vec3f& p : points) {
+        mean += toDouble(p);
+    }
+    mean /= static_cast<double>(points.size());
+    double covariance[3][3] = {};
+    for (const Vec3f& p : points) {
+        const Vec3d d = toDouble(p) - mean;
+        for (int r = 0; r < 3; ++r) {
+            for (int c = r; c < 3; ++c) {
+                covariance[r][c] += d[r] * d[c];
+            }
+        }
+    }
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < r; ++c) {
+            covariance[r][c] = covariance[c][r];
+        }
+    }
+
+    Vec3d eigenvectors[3];
+    symmetricEigenvectors(covariance, eigenvectors);
+    Vec3f axes[3];
+    axes[0] = Vec3f(static_cast<float>(eigenvectors[0].x()),
+                    static_cast<float>(eigenvectors[0].y()),
+                    static_cast<float>(eigenvectors[0].z()))
+                  .normalized();
+    Vec3f second(static_cast<float>(eigenvectors[1].x()),
+                 static_cast<float>(eigenvectors[1].y()),
+                 static_cast<float>(eigenvectors[1].z()));
+    second = (second - axes[0] * axes[0].dot(second)).normalized();
+    axes[1] = second;
+    axes[2] = axes[0].cross(axes[1]);
+    return fitObbToAxes(points, axes);
+}
+
+Obb fitObbDito(std::span<const Vec3f> points) noexcept {
+    if (points.empty()) {
+        return Obb();
+    }
+
+    Vec3f dop_axes[7];
+    dop14Axes(dop_axes);
+    Extremes extremes;
+    projectExtremes<true>(points, dop_axes, 7, extremes);
+    Vec3f extreme_points[14];
+    for (uint32_t k = 0; k < 7; ++k) {
+        extreme_points[2 * k] = points[extremes.min_index[k]];
+        extreme_points[2 * k + 1] = points[extremes.max_index[k]];
+    }
+
+    // The coordinate slabs are exact over all points, so the AABB is the baseline to beat
+    const Vec3f aabb_min(extremes.min[0], extremes.min[1], extremes.min[2]);
+    const Vec3f aabb_max(extremes.max[0], extremes.max[1], extremes.max[2]);
+    const Vec3f aabb_size = aabb_max - aabb_min;
+    const float aabb_area = aabb_size.x() * aabb_size.y() + aabb_size.y() * aabb_size.z() +
+                            aabb_size.z() * aabb_size.x();
+    const Obb aabb_box((aabb_min + aabb_max) * 0.5f, aabb_size * 0.5f);
+
+    // Base triangle: the most distant extreme pair, then the extreme point farthest from that line
+    uint32_t pair = 0;
+    for (uint32_t k = 1; k < 7; ++k) {
+        if ((extreme_points[2 * k + 1] - extreme_points[2 * k]).lengthSquared() >
+            (extreme_points[2 * pair + 1] - extreme_points[2 * pair]).lengthSquared()) {
+            pair = k;
+        }
+    }
+    const Vec3f p0 = extreme_points[2 * pair];
+    const Vec3f p1 = extreme_points[2 * pair + 1];
+    const Vec3f e0 = p1 - p0;
+    const float e0_length_sq = e0.lengthSquared();
+    if (!(e0_length_sq > kFloatEpsilon * kFloatEpsilon)) {
+        return aabb_box;  // All points coincide
+    }
+
+    Vec3f p2 = p0;
+    float best_line_distance = 0.0f;
+    for (const Vec3f& q : extreme_points) {
+        const Vec3f w = q - p0;
+        const float line_distance = (w - e0 * (w.dot(e0) / e0_length_sq)).lengthSquared();
+        if (line_distance > best_line_distance) {
+            best_line_distance = line_distance;
+            p2 = q;
+        }
+    }
+
+    Vec3f best_axes[3];
+    float best_area = kFloatMax;
+    if (!(best_line_distance > kFloatEpsilon * e0_length_sq)) {
+        // Collinear: any basis around the line is as good as another
+        basisFromAxis(e0 / std::sqrt(e0_length_sq), best_axes);
+    } else {
+        tryTriangleAxes(p0, p1, p2, extreme_points, 14, best_axes, best_area);
+
+        // Ditetrahedron: the extreme points on each side of the base triangle
+        const Vec3f n = e0.cross(p2 - p0).normalized();
+        float lo = 0.0f;
+        float hi = 0.0f;
+        Vec3f q_lo = p0;
+        Vec3f q_hi = p0;
+        for (const Vec3f& q : extreme_points) {
+            const float d = n.dot(q - p0);
+            if (d < lo) {
+                lo = d;
+                q_lo = q;
+            }
+            if (d > hi) {
+                hi = d;
+                q_hi = q;
+            }
+        }
+        const float flat = kFloatEpsilon * std::sqrt(e0_length_sq);
+        for (const auto& [q, height] : {std::pair{q_lo, -lo}, std::pair{q_hi, hi}}) {
+            if (height > flat) {
+                tryTriangleAxes(p0, p1, q, extreme_points, 14, best_axes, best_area);
+                tryTriangleAxes(p1, p2, q, extreme_points, 14, best_axes, best_area);
+                tryTriangleAxes(p2, p0, q, extreme_points, 14, best_axes, best_area);
+            }
+        }
+    }
+
+    const Obb box = fitObbToAxes(points, best_axes);
+    const Vec3f size = box.size();
+    const float area = size.x() * size.y() + size.y() * size.z() + size.z() * size.x();
+    return area < aabb_area ? box : aabb_box;
+}
+
+// ============================================================================
+// k-DOPs
+// ============================================================================
+
+Kdop fitKdop(std::span<const Vec3f> points, DopType type) noexcept {
+    Kdop dop(type);
+    if (points.empty()) {
+        return dop;
+    }
+    Vec3f axes[Kdop::kMaxAxes];
+    for (uint32_t slot = 0; slot < dop.axisCount(); ++slot) {
+        axes[slot] = Kdop::axis(type, slot);
+    }
+    Extremes extremes;
+    projectExtremes<false>(points, axes, dop.axisCount(), extremes);
+
+    // Kdop::contains() may round a projection differently (e.g. with FMA
+    // contraction), so widen every slab by a few ulps of the coordinate size.
+    float magnitude = 0.0f;
+    for (uint32_t slot = 0; slot < 3; ++slot) {
+        magnitude = std::max({magnitude, std::abs(extremes.min[slot]), std::abs(extremes.max[slot])});
+    }
+    const float pad = kSlabPadUlps * kFloatEpsilon * magnitude;
+    for (uint32_t slot = 0; slot < dop.axisCount(); ++slot) {
+        dop.setSlab(slot, extremes.min[slot] - pad, extremes.max[slot] + pad);
+    }
+    return dop;
+}
+
+// ============================================================================
+// Many Meshes
+// ============================================================================
+
+void fitBounds(std::span<const std::span<const Vec3f>> meshes,
+               std::span<MeshBounds> out,
+               const FitOptions& options) {
+    VNE_ASSERT_MSG(out.size() >= meshes.size(), "fitBounds: output span is smaller than the mesh span");
+    const size_t count = std::min(meshes.size(), out.size());
+
+    uint32_t thread_count = options.thread_count;
+    if (thread_count == 0) {
+        thread_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    thread_count = static_cast<uint32_t>(std::min<size_t>(thread_count, count));
+    if (thread_count <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = fitMesh(meshes[i], options);
+        }
+        return;
+    }
+
+    // Meshes vary widely in size, so hand them out one at a time rather than in fixed ranges
+    std::atomic<size_t> next{0};
+    // An exception escaping a thread body calls std::terminate, so the first one is kept
+    // and rethrown on the calling thread once every worker has stopped
+    std::mutex error_mutex;
+    std::exception_ptr error;
+    const auto worker = [&]() {
+        try {
+            for (size_t i = next.fetch_add(1, std::memory_order_relaxed); i < count;
+                 i = next.fetch_add(1, std::memory_order_relaxed)) {
+                out[i] = fitMesh(meshes[i], options);
+            }
+        } catch (...) {
+            next.store(count, std::memory_order_relaxed);  // Stop handing out meshes
+            const std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    try {
+        threads.reserve(thread_count - 1);
+        for (uint32_t t = 1; t < thread_count; ++t) {
+            threads.emplace_back(worker);
+        }
+    } catch (...) {
+        // Could not start every worker; the ones already running and this thread share the meshes
+    }
+    worker();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+}  // namespace vne::math
@@ -12,17 +12,35 @@
 // Project includes
 #include "vertexnova/math/geometry/frustum.h"
 
+#include "vertexnova/common/macros.h"
 #include "vertexnova/math/core/mat.h"
 #include "vertexnova/math/geometry/aabb.h"
 #include "vertexnova/math/geometry/sphere.h"
+#include "vertexnova/math/instrumentation.h"
+#include "vertexnova/math/simd/dispatch.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
 
 namespace vne::math {
 
+// The batch cull reads Aabb as six packed floats: min xyz, max xyz.
+static_assert(sizeof(Aabb) == 6 * sizeof(float), "Aabb must be tightly packed");
+
 namespace {
 constexpr uint32_t kAabbCornerCount = 8;
+constexpr uint32_t kMaxPlanes = 6;
 }  // namespace
 
 void Frustum::extractFromMatrix(const Mat4x4f& mat) noexcept {
+    extractFromMatrix(mat, ClipSpaceDepth::eNegativeOneToOne);
+}
+
+void Frustum::extractFromMatrix(const Mat4x4f& mat,
+                                ClipSpaceDepth depth,
+                                DepthMode mode,
+                                bool with_far_plane) noexcept {
     // Gribb/Hartmann plane extraction method
     // Reference: http://www.cs.otago.ac.nz/postgrads/alexis/planeExtraction.pdf
     Vec4f row0 = mat.getRow(0);
@@ -38,14 +56,25 @@ void Frustum::extractFromMatrix(const Mat4x4f& mat) noexcept {
     bottom_ = Plane(Vec4f(row3 + row1));
     // Top plane: row3 - row1
     top_ = Plane(Vec4f(row3 - row1));
-    // Near plane: row3 + row2
-    near_ = Plane(Vec4f(row3 + row2));
-    // Far plane: row3 - row2
-    far_ = Plane(Vec4f(row3 - row2));
+
+    // Depth bounds: -w <= z <= w for [-1,1], 0 <= z <= w for [0,1].
+    // Reverse-Z puts the near plane on the upper bound.
+    Vec4f lower = depth == ClipSpaceDepth::eZeroToOne ? row2 : Vec4f(row3 + row2);
+    Vec4f upper = row3 - row2;
+    if (isReversedDepth(mode)) {
+        std::swap(lower, upper);
+    }
+    near_ = Plane(lower);
+
+    // An infinite projection yields a far plane with a zero normal; drop it.
+    has_far_ = with_far_plane && !hasInfiniteFar(mode);
+    far_ = has_far_ ? Plane(upper) : Plane(Vec3f::zero(), std::numeric_limits<float>::max());
 
     // Normalize all planes
     near_.normalize();
-    far_.normalize();
+    if (has_far_) {
+        far_.normalize();
+    }
     left_.normalize();
     right_.normalize();
     bottom_.normalize();
@@ -53,21 +82,22 @@ void Frustum::extractFromMatrix(const Mat4x4f& mat) noexcept {
 }
 
 bool Frustum::contains(const Vec3f& point, float eps) const noexcept {
+    VNE_MATH_PROBE_COUNT(Probe::eFrustumTest);
     // A point is inside the frustum if it's on the positive side of all planes
-    return near_.isOnPositiveSide(point, eps) && far_.isOnPositiveSide(point, eps) && left_.isOnPositiveSide(point, eps)
+    return near_.isOnPositiveSide(point, eps) && left_.isOnPositiveSide(point, eps)
            && right_.isOnPositiveSide(point, eps) && bottom_.isOnPositiveSide(point, eps)
-           && top_.isOnPositiveSide(point, eps);
+           && top_.isOnPositiveSide(point, eps)
+           && (!has_far_ || far_.isOnPositiveSide(point, eps));
 }
 
 bool Frustum::intersects(const Sphere& sphere) const noexcept {
+    VNE_MATH_PROBE_COUNT(Probe::eFrustumTest);
     // A sphere intersects the frustum if it's not completely outside any plane
     const Vec3f& center = sphere.center();
     float radius = sphere.radius();
 
     if (near_.signedDistance(center) < -radius)
         return false;
-    if (far_.signedDistance(center) < -radius)
-        return false;
     if (left_.signedDistance(center) < -radius)
         return false;
     if (right_.signedDistance(center) < -radius)
@@ -76,16 +106,22 @@ bool Frustum::intersects(const Sphere& sphere) const noexcept {
         return false;
     if (top_.signedDistance(center) < -radius)
         return false;
+    if (has_far_ && far_.signedDistance(center) < -radius)
+        return false;
 
     return true;
 }
 
 bool Frustum::intersects(const Aabb& aabb) const noexcept {
+    VNE_MATH_PROBE_COUNT(Probe::eFrustumTest);
     // For each plane, check if the AABB is completely outside
     // Use the "p-vertex" method: check the corner most aligned with the plane normal
-    const Plane* planes[] = {&near_, &far_, &left_, &right_, &bottom_, &top_};
+    // The far plane goes last so a 5-plane frustum simply stops early
+    const Plane* planes[] = {&near_, &left_, &right_, &bottom_, &top_, &far_};
+    const uint32_t plane_count = planeCount();
 
-    for (const Plane* plane : planes) {
+    for (uint32_t i = 0; i < plane_count; ++i) {
+        const Plane* plane = planes[i];
         // Find the positive vertex (p-vertex) - the corner furthest in the direction of the normal
         Vec3f p_vertex;
         p_vertex.x() = (plane->normal.x() >= 0) ? aabb.max().x() : aabb.min().x();
@@ -102,13 +138,14 @@ bool Frustum::intersects(const Aabb& aabb) const noexcept {
 }
 
 bool Frustum::containsFully(const Sphere& sphere) const noexcept {
+    VNE_MATH_PROBE_COUNT(Probe::eFrustumTest);
     const Vec3f& center = sphere.center();
     float radius = sphere.radius();
 
     // Sphere is fully inside if its entire volume is on the positive side of all planes
     if (near_.signedDistance(center) < radius)
         return false;
-    if (far_.signedDistance(center) < radius)
+    if (has_far_ && far_.signedDistance(center) < radius)
         return false;
     if (left_.signedDistance(center) < radius)
         return false;
@@ -123,10 +160,18 @@ bool Frustum::containsFully(const Sphere& sphere) const noexcept {
 }
 
 bool Frustum::containsFully(const Aabb& aabb) const noexcept {
-    // Check all 8 corners of the AABB
+    VNE_MATH_PROBE_COUNT(Probe::eFrustumTest);
+    // All 8 corners must pass contains(); the planes are tested here directly so the
+    // instrumentation counts one query rather than eight
+    const Plane* planes[] = {&near_, &left_, &right_, &bottom_, &top_, &far_};
+    const uint32_t plane_count = planeCount();
+
     for (uint32_t i = 0; i < kAabbCornerCount; ++i) {
-        if (!contains(aabb.corner(i))) {
-            return false;
+        const Vec3f corner = aabb.corner(i);
+        for (uint32_t p = 0; p < plane_count; ++p) {
+            if (!planes[p]->isOnPositiveSide(corner)) {
+                return false;
+            }
         }
     }
     return true;
@@ -134,7 +179,7 @@ bool Frustum::containsFully(const Aabb& aabb) const noexcept {
 
 bool Frustum::operator==(const Frustum& other) const noexcept {
     return near_ == other.near_ && far_ == other.far_ && left_ == other.left_ && right_ == other.right_
-           && bottom_ == other.bottom_ && top_ == other.top_;
+           && bottom_ == other.bottom_ && top_ == other.top_ && has_far_ == other.has_far_;
 }
 
 bool Frustum::operator!=(const Frustum& other) const noexcept {
@@ -146,4 +191,51 @@ std::ostream& operator<<(std::ostream& os, const Frustum& frustum) {
               << ", right: " << frustum.right_ << ", bottom: " << frustum.bottom_ << ", top: " << frustum.top_ << "]";
 }
 
+// ============================================================================
+// Batch Culling
+// ============================================================================
+
+size_t intersects(const Frustum& frustum, std::span<const Aabb> boxes, std::span<uint8_t> out_visible) noexcept {
+    VNE_ASSERT_MSG(out_visible.size() >= boxes.size(), "intersects: out_visible smaller than boxes");
+    const size_t count = std::min(boxes.size(), out_visible.size());
+    VNE_MATH_PROBE_SCOPE(Probe::eFrustumCull, count);
+
+    // Same plane order as Frustum::intersects(const Aabb&): the far plane last
+    const Plane* planes[kMaxPlanes] = {&frustum.nearPlane(),
+                                       &frustum.leftPlane(),
+                                       &frustum.rightPlane(),
+                                       &frustum.bottomPlane(),
+                                       &frustum.topPlane(),
+                                       &frustum.farPlane()};
+    const uint32_t plane_count = frustum.planeCount();
+    float packed[4 * kMaxPlanes];
+    for (uint32_t i = 0; i < plane_count; ++i) {
+        packed[4 * i + 0] = planes[i]->normal.x();
+        packed[4 * i + 1] = planes[i]->normal.y();
+        packed[4 * i + 2] = planes[i]->normal.z();
+        packed[4 * i + 3] = planes[i]->d;
+    }
+
+    const auto kernel = simd::batchKernels().cull_aabbs4;
+    size_t visible = 0;
+    for (size_t base = 0; base < count; base += simd::kBlockSize) {
+        const size_t block = std::min(simd::kBlockSize, count - base);
+        int mask;
+        if (block == simd::kBlockSize) {
+            mask = kernel(packed, plane_count, reinterpret_cast<const float*>(&boxes[base]));
+        } else {
+            // Pad the tail; extra lanes are not written
+            Aabb tail[simd::kBlockSize];
+            std::copy_n(&boxes[base], block, tail);
+            mask = kernel(packed, plane_count, reinterpret_cast<const float*>(tail));
+        }
+        for (size_t k = 0; k < block; ++k) {
+            const bool hit = ((mask >> k) & 1) != 0;
+            out_visible[base + k] = hit ? 1 : 0;
+            visible += hit ? 1 : 0;
+        }
+    }
+    return visible;
+}
+
 }  // namespace vne::math
@@ -0,0 +1,894 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Corresponding header
+#include "vertexnova/math/geometry/gjk.h"
+
+// Project headers
+#include "vertexnova/common/macros.h"
+#include "vertexnova/math/simd/float4.h"
+
+// Standard library includes
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <limits>
+
+namespace vne::math {
+
+namespace {
+
+/// GJK gives up after this many support evaluations (it normally needs < 10).
+constexpr uint32_t kGjkMaxIterations = 64;
+
+/// GJK stops once an iteration improves the squared distance by less than this fraction.
+constexpr float kGjkRelativeTolerance = 1e-6f;
+
+/// Squared distance (relative to the simplex size) below which the origin counts as touched.
+constexpr float kGjkContainmentTolerance = 1e-10f;
+
+/// EPA stops once a new support point lies within this distance of the closest face.
+constexpr float kEpaTolerance = 1e-4f;
+
+/// Fixed EPA polytope capacity; when it fills up the best face so far is returned.
+constexpr uint32_t kEpaMaxVertices = 64;
+constexpr uint32_t kEpaMaxFaces = 128;
+constexpr uint32_t kEpaMaxHorizonEdges = 64;
+
+/// Minkowski difference vertex with the two shape points it came from.
+struct SimplexVertex {
+    Vec3f w;    ///< a - b
+    Vec3f a;    ///< Support point on A
+    Vec3f b;    ///< Support point on B
+    Vec3f dir;  ///< Direction A's support was evaluated along
+};
+
+struct Simplex {
+    std::array<SimplexVertex, 4> v;
+    std::array<float, 4> lambda{};  ///< Barycentric weights of the closest point
+    uint32_t count{0};
+};
+
+/// Which support function the GJK loop samples.
+enum class SupportMode : uint8_t {
+    eCore,  ///< Cores only; margins handled by the caller
+    eFull,  ///< Whole shapes, margins included
+};
+
+[[nodiscard]] SimplexVertex makeVertex(const ConvexShape& a,
+                                       const ConvexShape& b,
+                                       const Vec3f& dir,
+                                       SupportMode mode) noexcept {
+    SimplexVertex vertex;
+    vertex.dir = dir;
+    if (mode == SupportMode::eCore) {
+        vertex.a = a.coreSupport(dir);
+        vertex.b = b.coreSupport(-dir);
+    } else {
+        vertex.a = a.support(dir);
+        vertex.b = b.support(-dir);
+    }
+    vertex.w = vertex.a - vertex.b;
+    return vertex;
+}
+
+/// Keeps the listed vertices (ascending indices) with the given weights.
+void reduce(Simplex& s, std::initializer_list<uint32_t> indices, std::initializer_list<float> weights) noexcept {
+    uint32_t n = 0;
+    auto weight = weights.begin();
+    for (uint32_t index : indices) {
+        s.v[n] = s.v[index];
+        s.lambda[n] = *weight++;
+        ++n;
+    }
+    s.count = n;
+}
+
+// Closest point to the origin on the simplex (Ericson, Real-Time Collision
+// Detection 5.1). Each solver reduces the simplex to the smallest feature
+// containing that point and stores its barycentric weights.
+
+[[nodiscard]] Vec3f solveSegment(Simplex& s) noexcept {
+    const Vec3f a = s.v[0].w;
+    const Vec3f ab = s.v[1].w - a;
+    const float t = -a.dot(ab);
+    if (t <= 0.0f) {
+        reduce(s, {0}, {1.0f});
+        return a;
+    }
+    const float denom = ab.lengthSquared();
+    if (t >= denom) {
+        reduce(s, {1}, {1.0f});
+        return s.v[0].w;
+    }
+    const float u = t / denom;
+    s.lambda[0] = 1.0f - u;
+    s.lambda[1] = u;
+    return a + ab * u;
+}
+
+[[nodiscard]] Vec3f solveTriangle(Simplex& s) noexcept {
+    const Vec3f a = s.v[0].w;
+    const Vec3f b = s.v[1].w;
+    const Vec3f c = s.v[2].w;
+    const Vec3f ab = b - a;
+    const Vec3f ac = c - a;
+
+    const float d1 = -ab.dot(a);
+    const float d2 = -ac.dot(a);
+    if (d1 <= 0.0f && d2 <= 0.0f) {
+        reduce(s, {0}, {1.0f});
+        return a;
+    }
+
+    const float d3 = -ab.dot(b);
+    const float d4 = -ac.dot(b);
+    if (d3 >= 0.0f && d4 <= d3) {
+        reduce(s, {1}, {1.0f});
+        return b;
+    }
+
+    const float vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+        const float v = d1 / (d1 - d3);
+        reduce(s, {0, 1}, {1.0f - v, v});
+        return a + ab * v;
+    }
+
+    const float d5 = -ab.dot(c);
+    const float d6 = -ac.dot(c);
+    if (d6 >= 0.0f && d5 <= d6) {
+        reduce(s, {2}, {1.0f});
+        return c;
+    }
+
+    const float vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+        const float w = d2 / (d2 - d6);
+        reduce(s, {0, 2}, {1.0f - w, w});
+        return a + ac * w;
+    }
+
+    const float va = d3 * d6 - d5 * d4;
+    if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
+        const float w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        reduce(s, {1, 2}, {1.0f - w, w});
+        return b + (c - b) * w;
+    }
+
+    const float sum = va + vb + vc;
+    if (sum <= std::numeric_limits<float>::min()) {
+        // Collinear vertices: the hull is the longest edge
+        const float ab_sq = ab.lengthSquared();
+        const float ac_sq = ac.lengthSquared();
+        const float bc_sq = (c - b).lengthSquared();
+        if (ab_sq >= ac_sq && ab_sq >= bc_sq) {
+            reduce(s, {0, 1}, {0.0f, 0.0f});
+        } else if (ac_sq >= bc_sq) {
+            reduce(s, {0, 2}, {0.0f, 0.0f});
+        } else {
+            reduce(s, {1, 2}, {0.0f, 0.0f});
+        }
+        return solveSegment(s);
+    }
+
+    const float denom = 1.0f / sum;
+    const float v = vb * denom;
+    const float w = vc * denom;
+    s.lambda[0] = 1.0f - v - w;
+    s.lambda[1] = v;
+    s.lambda[2] = w;
+    return a + ab * v + ac * w;
+}
+
+/// @return true if the tetrahedron encloses the origin (the simplex is left untouched)
+[[nodiscard]] bool solveTetrahedron(Simplex& s, Vec3f& closest) noexcept {
+    // Faces as vertex triples, each followed by the opposite vertex
+    static constexpr uint32_t kFaces[4][4] = {{0, 1, 2, 3}, {0, 2, 3, 1}, {0, 3, 1, 2}, {1, 3, 2, 0}};
+
+    float scale = 0.0f;
+    for (uint32_t i = 0; i < 4; ++i) {
+        scale = std::max(scale, s.v[i].w.lengthSquared());
+    }
+
+    float best = std::numeric_limits<float>::max();
+    bool outside_any = false;
+    Simplex best_simplex;
+    for (const auto& face : kFaces) {
+        const Vec3f& p = s.v[face[0]].w;
+        const Vec3f n = (s.v[face[1]].w - p).cross(s.v[face[2]].w - p);
+        const float sign_origin = -p.dot(n);
+        const float sign_opposite = (s.v[face[3]].w - p).dot(n);
+        // A flat tetrahedron has no inside; searching every face still finds the closest point
+        const bool degenerate = sign_opposite * sign_opposite <= kGjkContainmentTolerance * scale * scale * scale;
+        if (!degenerate && sign_origin * sign_opposite >= 0.0f) {
+            continue;
+        }
+        outside_any = true;
+
+        Simplex face_simplex;
+        face_simplex.v = {s.v[face[0]], s.v[face[1]], s.v[face[2]], s.v[face[2]]};
+        face_simplex.count = 3;
+        const Vec3f q = solveTriangle(face_simplex);
+        const float dist = q.lengthSquared();
+        if (dist < best) {
+            best = dist;
+            best_simplex = face_simplex;
+            closest = q;
+        }
+    }
+
+    if (!outside_any) {
+        return true;
+    }
+    s = best_simplex;
+    return false;
+}
+
+/// Solves the current simplex. @return true if it encloses the origin.
+[[nodiscard]] bool solve(Simplex& s, Vec3f& closest) noexcept {
+    switch (s.count) {
+        case 1:
+            s.lambda[0] = 1.0f;
+            closest = s.v[0].w;
+            return false;
+        case 2:
+            closest = solveSegment(s);
+            return false;
+        case 3:
+            closest = solveTriangle(s);
+            return false;
+        default:
+            return solveTetrahedron(s, closest);
+    }
+}
+
+[[nodiscard]] Vec3f witnessA(const Simplex& s) noexcept {
+    Vec3f p = Vec3f::zero();
+    for (uint32_t i = 0; i < s.count; ++i) {
+        p += s.v[i].a * s.lambda[i];
+    }
+    return p;
+}
+
+[[nodiscard]] Vec3f witnessB(const Simplex& s) noexcept {
+    Vec3f p = Vec3f::zero();
+    for (uint32_t i = 0; i < s.count; ++i) {
+        p += s.v[i].b * s.lambda[i];
+    }
+    return p;
+}
+
+struct GjkRun {
+    Simplex simplex;
+    Vec3f v{Vec3f::zero()};  ///< Closest point of the Minkowski difference to the origin
+    uint32_t iterations{0};
+    bool intersecting{false};
+    bool separated{false};  ///< Early exit: a separating axis beyond the margins was found
+};
+
+/**
+ * Van den Bergen's GJK loop.
+ *
+ * @param separation_margin When >= 0, stop as soon as a support plane shows the
+ *        cores are further apart than this (boolean queries)
+ */
+[[nodiscard]] GjkRun runGjk(const ConvexShape& a,
+                            const ConvexShape& b,
+                            const GjkCache* cache,
+                            SupportMode mode,
+                            float separation_margin) noexcept {
+    GjkRun run;
+    Simplex& s = run.simplex;
+
+    if (cache != nullptr && cache->count > 0) {
+        for (uint32_t i = 0; i < std::min(cache->count, 4u); ++i) {
+            const SimplexVertex vertex = makeVertex(a, b, cache->directions[i], mode);
+            ++run.iterations;
+            // Directions that now hit the same support point would make the simplex degenerate
+            bool duplicate = false;
+            for (uint32_t j = 0; j < s.count; ++j) {
+                duplicate = duplicate || s.v[j].w == vertex.w;
+            }
+            if (!duplicate) {
+                s.v[s.count++] = vertex;
+            }
+        }
+        if (solve(s, run.v)) {
+            run.intersecting = true;
+            return run;
+        }
+    } else {
+        run.v = a.interiorPoint() - b.interiorPoint();
+        if (run.v.lengthSquared() <= std::numeric_limits<float>::min()) {
+            run.v = Vec3f::xAxis();
+        }
+    }
+
+    const bool early_out = separation_margin >= 0.0f;
+    // The cold-start direction is not a simplex point, so the first step always counts as progress
+    float dist_sq = s.count > 0 ? run.v.lengthSquared() : std::numeric_limits<float>::max();
+    while (run.iterations < kGjkMaxIterations) {
+        const SimplexVertex vertex = makeVertex(a, b, -run.v, mode);
+        ++run.iterations;
+
+        const float vw = run.v.dot(vertex.w);
+        if (early_out && vw > 0.0f && vw * vw > separation_margin * separation_margin * run.v.lengthSquared()) {
+            run.separated = true;
+            return run;
+        }
+        if (s.count > 0 && dist_sq - vw <= kGjkRelativeTolerance * dist_sq) {
+            break;
+        }
+        bool duplicate = false;
+        for (uint32_t i = 0; i < s.count; ++i) {
+            duplicate = duplicate || s.v[i].w == vertex.w;
+        }
+        if (duplicate) {
+            break;
+        }
+
+        s.v[s.count++] = vertex;
+        Vec3f closest;
+        if (solve(s, closest)) {
+            run.intersecting = true;
+            return run;
+        }
+
+        float scale = 0.0f;
+        for (uint32_t i = 0; i < s.count; ++i) {
+            scale = std::max(scale, s.v[i].w.lengthSquared());
+        }
+        const float new_dist_sq = closest.lengthSquared();
+        run.v = closest;
+        if (new_dist_sq <= kGjkContainmentTolerance * scale) {
+            run.intersecting = true;
+            return run;
+        }
+        if (new_dist_sq >= dist_sq) {
+            // No progress: rounding has taken over, the current simplex is the answer
+            break;
+        }
+        dist_sq = new_dist_sq;
+    }
+    return run;
+}
+
+void storeCache(GjkCache* cache, const Simplex& s) noexcept {
+    if (cache == nullptr) {
+        return;
+    }
+    cache->count = s.count;
+    for (uint32_t i = 0; i < s.count; ++i) {
+        cache->directions[i] = s.v[i].dir;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// EPA
+// ----------------------------------------------------------------------------
+
+struct EpaFace {
+    std::array<uint32_t, 3> index;
+    Vec3f normal;    ///< Outward unit normal
+    float distance;  ///< Distance from the origin to the face plane
+};
+
+struct EpaEdge {
+    uint32_t from;
+    uint32_t to;
+};
+
+class EpaPolytope {
+   public:
+    [[nodiscard]] bool addFace(uint32_t i0, uint32_t i1, uint32_t i2) noexcept {
+        if (face_count_ == kEpaMaxFaces) {
+            return false;
+        }
+        const Vec3f& p = vertices_[i0].w;
+        Vec3f n = (vertices_[i1].w - p).cross(vertices_[i2].w - p);
+        const float length = n.length();
+        EpaFace& face = faces_[face_count_++];
+        face.index = {i0, i1, i2};
+        if (length > std::numeric_limits<float>::min()) {
+            face.normal = n / length;
+            face.distance = face.normal.dot(p);
+        } else {
+            // Sliver face: never the closest, removed once a neighbor expands
+            face.normal = Vec3f::zero();
+            face.distance = std::numeric_limits<float>::max();
+        }
+        return true;
+    }
+
+    [[nodiscard]] uint32_t addVertex(const SimplexVertex& vertex) noexcept {
+        vertices_[vertex_count_] = vertex;
+        return vertex_count_++;
+    }
+
+    [[nodiscard]] bool full() const noexcept { return vertex_count_ == kEpaMaxVertices; }
+
+    [[nodiscard]] const EpaFace& closestFace() const noexcept {
+        uint32_t best = 0;
+        for (uint32_t i = 1; i < face_count_; ++i) {
+            if (faces_[i].distance < faces_[best].distance) {
+                best = i;
+            }
+        }
+        return faces_[best];
+    }
+
+    /// Removes every face @p point can see and stitches the horizon to it.
+    [[nodiscard]] bool expand(uint32_t point) noexcept {
+        const Vec3f& w = vertices_[point].w;
+        std::array<EpaEdge, kEpaMaxHorizonEdges> horizon;
+        uint32_t edge_count = 0;
+
+        for (uint32_t f = 0; f < face_count_;) {
+            const EpaFace& face = faces_[f];
+            const bool visible = face.distance == std::numeric_limits<float>::max()
+                                 || face.normal.dot(w - vertices_[face.index[0]].w) > 0.0f;
+            if (!visible) {
+                ++f;
+                continue;
+            }
+            for (uint32_t e = 0; e < 3; ++e) {
+                const EpaEdge edge{face.index[e], face.index[(e + 1) % 3]};
+                // An edge shared by two removed faces appears once in each direction
+                bool shared = false;
+                for (uint32_t h = 0; h < edge_count; ++h) {
+                    if (horizon[h].from == edge.to && horizon[h].to == edge.from) {
+                        horizon[h] = horizon[--edge_count];
+                        shared = true;
+                        break;
+                    }
+                }
+                if (!shared) {
+                    if (edge_count == kEpaMaxHorizonEdges) {
+                        return false;
+                    }
+                    horizon[edge_count++] = edge;
+                }
+            }
+            faces_[f] = faces_[--face_count_];
+        }
+
+        for (uint32_t h = 0; h < edge_count; ++h) {
+            if (!addFace(horizon[h].from, horizon[h].to, point)) {
+                return false;
+            }
+        }
+        return face_count_ > 0;
+    }
+
+    [[nodiscard]] const SimplexVertex& vertex(uint32_t i) const noexcept { return vertices_[i]; }
+
+   private:
+    std::array<SimplexVertex, kEpaMaxVertices> vertices_;
+    std::array<EpaFace, kEpaMaxFaces> faces_;
+    uint32_t vertex_count_{0};
+    uint32_t face_count_{0};
+};
+
+/// Grows a touching simplex (fewer than four vertices) into a tetrahedron.
+[[nodiscard]] bool blowUpSimplex(Simplex& s, const ConvexShape& a, const ConvexShape& b) noexcept {
+    constexpr float kMinSpread = 1e-6f;
+    const std::array<Vec3f, 3> axes = {Vec3f::xAxis(), Vec3f::yAxis(), Vec3f::zAxis()};
+
+    if (s.count == 1) {
+        for (const Vec3f& axis : axes) {
+            for (float sign : {1.0f, -1.0f}) {
+                const SimplexVertex vertex = makeVertex(a, b, axis * sign, SupportMode::eFull);
+                if ((vertex.w - s.v[0].w).lengthSquared() > kMinSpread) {
+                    s.v[s.count++] = vertex;
+                    break;
+                }
+            }
+            if (s.count == 2) {
+                break;
+            }
+        }
+    }
+    if (s.count == 2) {
+        const Vec3f d = (s.v[1].w - s.v[0].w).normalized();
+        // Any axis at least ~55 degrees away from the line
+        Vec3f seed = Vec3f::zAxis();
+        if (std::abs(d.x()) < 0.57f) {
+            seed = Vec3f::xAxis();
+        } else if (std::abs(d.y()) < 0.57f) {
+            seed = Vec3f::yAxis();
+        }
+        const Vec3f e1 = d.cross(seed).normalized();
+        const Vec3f e2 = d.cross(e1);
+        for (const Vec3f& dir : {e1, -e1, e2, -e2}) {
+            const SimplexVertex vertex = makeVertex(a, b, dir, SupportMode::eFull);
+            const Vec3f off_line = (vertex.w - s.v[0].w) - d * d.dot(vertex.w - s.v[0].w);
+            if (off_line.lengthSquared() > kMinSpread) {
+                s.v[s.count++] = vertex;
+                break;
+            }
+        }
+    }
+    if (s.count == 3) {
+        const Vec3f n = (s.v[1].w - s.v[0].w).cross(s.v[2].w - s.v[0].w).normalized();
+        for (const Vec3f& dir : {n, -n}) {
+            const SimplexVertex vertex = makeVertex(a, b, dir, SupportMode::eFull);
+            if (std::abs(n.dot(vertex.w - s.v[0].w)) > kMinSpread) {
+                s.v[s.count++] = vertex;
+                break;
+            }
+        }
+    }
+    return s.count == 4;
+}
+
+[[nodiscard]] PenetrationResult runEpa(const Simplex& tetrahedron,
+                                       const ConvexShape& a,
+                                       const ConvexShape& b) noexcept {
+    EpaPolytope polytope;
+    for (uint32_t i = 0; i < 4; ++i) {
+        static_cast<void>(polytope.addVertex(tetrahedron.v[i]));
+    }
+    // Wind every face so its normal points away from the opposite vertex
+    static constexpr uint32_t kFaces[4][4] = {{0, 1, 2, 3}, {0, 3, 1, 2}, {0, 2, 3, 1}, {1, 3, 2, 0}};
+    for (const auto& f : kFaces) {
+        const Vec3f& p = tetrahedron.v[f[0]].w;
+        const Vec3f n = (tetrahedron.v[f[1]].w - p).cross(tetrahedron.v[f[2]].w - p);
+        const bool flip = n.dot(tetrahedron.v[f[3]].w - p) > 0.0f;
+        static_cast<void>(flip ? polytope.addFace(f[0], f[2], f[1]) : polytope.addFace(f[0], f[1], f[2]));
+    }
+
+    EpaFace face = polytope.closestFace();
+    for (uint32_t iteration = 0; iteration < kEpaMaxVertices; ++iteration) {
+        if (face.distance == std::numeric_limits<float>::max() || polytope.full()) {
+            break;
+        }
+        const SimplexVertex vertex = makeVertex(a, b, face.normal, SupportMode::eFull);
+        if (face.normal.dot(vertex.w) - face.distance <= kEpaTolerance) {
+            break;
+        }
+        if (!polytope.expand(polytope.addVertex(vertex))) {
+            break;
+        }
+        face = polytope.closestFace();
+    }
+
+    PenetrationResult result;
+    result.intersecting = true;
+    if (face.distance == std::numeric_limits<float>::max()) {
+        // Degenerate polytope (flat shapes): touching with no usable normal
+        return result;
+    }
+    result.depth = std::max(face.distance, 0.0f);
+    result.normal = face.normal;
+
+    // Barycentric coordinates of the origin's projection on the face
+    const SimplexVertex& v0 = polytope.vertex(face.index[0]);
+    const SimplexVertex& v1 = polytope.vertex(face.index[1]);
+    const SimplexVertex& v2 = polytope.vertex(face.index[2]);
+    const Vec3f p = face.normal * face.distance;
+    const Vec3f e0 = v1.w - v0.w;
+    const Vec3f e1 = v2.w - v0.w;
+    const Vec3f ep = p - v0.w;
+    const float d00 = e0.dot(e0);
+    const float d01 = e0.dot(e1);
+    const float d11 = e1.dot(e1);
+    const float d20 = ep.dot(e0);
+    const float d21 = ep.dot(e1);
+    const float denom = d00 * d11 - d01 * d01;
+    float l1 = 0.0f;
+    float l2 = 0.0f;
+    if (std::abs(denom) > std::numeric_limits<float>::min()) {
+        l1 = (d11 * d20 - d01 * d21) / denom;
+        l2 = (d00 * d21 - d01 * d20) / denom;
+    }
+    const float l0 = 1.0f - l1 - l2;
+    result.point_a = v0.a * l0 + v1.a * l1 + v2.a * l2;
+    result.point_b = v0.b * l0 + v1.b * l1 + v2.b * l2;
+    return result;
+}
+
+}  // namespace
+
+// ============================================================================
+// Support Functions
+// ============================================================================
+
+Vec3f support(const LineSegment& segment, const Vec3f& direction) noexcept {
+    return direction.dot(segment.end - segment.start) > 0.0f ? segment.end : segment.start;
+}
+
+Vec3f support(const Triangle& triangle, const Vec3f& direction) noexcept {
+    const float d0 = direction.dot(triangle.v0);
+    const float d1 = direction.dot(triangle.v1);
+    const float d2 = direction.dot(triangle.v2);
+    if (d0 >= d1 && d0 >= d2) {
+        return triangle.v0;
+    }
+    return d1 >= d2 ? triangle.v1 : triangle.v2;
+}
+
+Vec3f support(const Aabb& aabb, const Vec3f& direction) noexcept {
+    return {direction.x() >= 0.0f ? aabb.max().x() : aabb.min().x(),
+            direction.y() >= 0.0f ? aabb.max().y() : aabb.min().y(),
+            direction.z() >= 0.0f ? aabb.max().z() : aabb.min().z()};
+}
+
+Vec3f support(const Obb& obb, const Vec3f& direction) noexcept {
+    const Mat3f& basis = obb.rotationMatrix();
+    Vec3f result = obb.center();
+    for (int i = 0; i < 3; ++i) {
+        const float extent = obb.halfExtents()[i];
+        result += basis[i] * (direction.dot(basis[i]) >= 0.0f ? extent : -extent);
+    }
+    return result;
+}
+
+Vec3f support(const Sphere& sphere, const Vec3f& direction) noexcept {
+    const float length = direction.length();
+    if (length <= std::numeric_limits<float>::min()) {
+        return sphere.center();
+    }
+    return sphere.center() + direction * (sphere.radius() / length);
+}
+
+Vec3f support(const Capsule& capsule, const Vec3f& direction) noexcept {
+    const Vec3f core = support(LineSegment(capsule.start(), capsule.end()), direction);
+    const float length = direction.length();
+    if (length <= std::numeric_limits<float>::min()) {
+        return core;
+    }
+    return core + direction * (capsule.radius() / length);
+}
+
+Vec3f support(const ConvexPointSet& set, const Vec3f& direction) noexcept {
+    using simd::Float4;
+
+    VNE_ASSERT_MSG(!set.points.empty(), "support: empty ConvexPointSet");
+    if (set.points.empty()) {
+        return Vec3f::zero();
+    }
+
+    static_assert(sizeof(Vec3f) == 3 * sizeof(float), "Vec3f must be tightly packed");
+    const auto* p = reinterpret_cast<const float*>(set.points.data());
+    const size_t count = set.points.size();
+
+    float best = -std::numeric_limits<float>::max();
+    size_t best_index = 0;
+    size_t i = 0;
+    if (count >= simd::kLanes) {
+        const Float4 dx = simd::broadcast(direction.x());
+        const Float4 dy = simd::broadcast(direction.y());
+        const Float4 dz = simd::broadcast(direction.z());
+        // Lane indices are tracked as floats, exact up to 2^24 points
+        Float4 best_dot = simd::broadcast(-std::numeric_limits<float>::max());
+        Float4 best_lane_index = simd::zero();
+        Float4 index = simd::set(0.0f, 1.0f, 2.0f, 3.0f);
+        const Float4 step = simd::broadcast(static_cast<float>(simd::kLanes));
+        for (; i + simd::kLanes <= count; i += simd::kLanes) {
+            Float4 x;
+            Float4 y;
+            Float4 z;
+            simd::loadXyz(p + 3 * i, x, y, z);
+            const Float4 d = simd::madd(x, dx, simd::madd(y, dy, z * dz));
+            const Float4 better = simd::cmpGt(d, best_dot);
+            best_dot = simd::select(better, d, best_dot);
+            best_lane_index = simd::select(better, index, best_lane_index);
+            index = index + step;
+        }
+        for (int lane = 0; lane < simd::kLanes; ++lane) {
+            if (simd::lane(best_dot, lane) > best) {
+                best = simd::lane(best_dot, lane);
+                best_index = static_cast<size_t>(simd::lane(best_lane_index, lane));
+            }
+        }
+    }
+    for (; i < count; ++i) {
+        const float d = direction.dot(set.points[i]);
+        if (d > best) {
+            best = d;
+            best_index = i;
+        }
+    }
+    return set.points[best_index];
+}
+
+// ============================================================================
+// ConvexShape
+// ============================================================================
+
+ConvexShape::ConvexShape(const Vec3f& point) noexcept
+    : shape_(&point)
+    , type_(Type::ePoint) {}
+
+ConvexShape::ConvexShape(const LineSegment& segment) noexcept
+    : shape_(&segment)
+    , type_(Type::eSegment) {}
+
+ConvexShape::ConvexShape(const Triangle& triangle) noexcept
+    : shape_(&triangle)
+    , type_(Type::eTriangle) {}
+
+ConvexShape::ConvexShape(const Aabb& aabb) noexcept
+    : shape_(&aabb)
+    , type_(Type::eAabb) {}
+
+ConvexShape::ConvexShape(const Obb& obb) noexcept
+    : shape_(&obb)
+    , type_(Type::eObb) {}
+
+ConvexShape::ConvexShape(const Sphere& sphere) noexcept
+    : shape_(&sphere)
+    , margin_(sphere.radius())
+    , type_(Type::eSphere) {}
+
+ConvexShape::ConvexShape(const Capsule& capsule) noexcept
+    : shape_(&capsule)
+    , margin_(capsule.radius())
+    , type_(Type::eCapsule) {}
+
+ConvexShape::ConvexShape(const ConvexPointSet& set) noexcept
+    : shape_(&set)
+    , type_(Type::ePointSet) {}
+
+Vec3f ConvexShape::coreSupport(const Vec3f& direction) const noexcept {
+    return untranslatedCoreSupport(direction) + offset_;
+}
+
+Vec3f ConvexShape::interiorPoint() const noexcept {
+    return untranslatedInteriorPoint() + offset_;
+}
+
+Vec3f ConvexShape::untranslatedCoreSupport(const Vec3f& direction) const noexcept {
+    switch (type_) {
+        case Type::ePoint:
+            return *static_cast<const Vec3f*>(shape_);
+        case Type::eSegment:
+            return vne::math::support(*static_cast<const LineSegment*>(shape_), direction);
+        case Type::eTriangle:
+            return vne::math::support(*static_cast<const Triangle*>(shape_), direction);
+        case Type::eAabb:
+            return vne::math::support(*static_cast<const Aabb*>(shape_), direction);
+        case Type::eObb:
+            return vne::math::support(*static_cast<const Obb*>(shape_), direction);
+        case Type::eSphere:
+            return static_cast<const Sphere*>(shape_)->center();
+        case Type::eCapsule: {
+            const auto* capsule = static_cast<const Capsule*>(shape_);
+            return vne::math::support(LineSegment(capsule->start(), capsule->end()), direction);
+        }
+        case Type::ePointSet:
+            return vne::math::support(*static_cast<const ConvexPointSet*>(shape_), direction);
+    }
+    return Vec3f::zero();
+}
+
+Vec3f ConvexShape::support(const Vec3f& direction) const noexcept {
+    const Vec3f core = coreSupport(direction);
+    if (margin_ <= 0.0f) {
+        return core;
+    }
+    const float length = direction.length();
+    if (length <= std::numeric_limits<float>::min()) {
+        return core;
+    }
+    return core + direction * (margin_ / length);
+}
+
+Vec3f ConvexShape::untranslatedInteriorPoint() const noexcept {
+    switch (type_) {
+        case Type::ePoint:
+            return *static_cast<const Vec3f*>(shape_);
+        case Type::eSegment: {
+            const auto* segment = static_cast<const LineSegment*>(shape_);
+            return (segment->start + segment->end) * 0.5f;
+        }
+        case Type::eTriangle:
+            return static_cast<const Triangle*>(shape_)->centroid();
+        case Type::eAabb:
+            return static_cast<const Aabb*>(shape_)->center();
+        case Type::eObb:
+            return static_cast<const Obb*>(shape_)->center();
+        case Type::eSphere:
+            return static_cast<const Sphere*>(shape_)->center();
+        case Type::eCapsule:
+            return static_cast<const Capsule*>(shape_)->center();
+        case Type::ePointSet: {
+            const auto* set = static_cast<const ConvexPointSet*>(shape_);
+            return set->points.empty() ? Vec3f::zero() : set->points.front();
+        }
+    }
+    return Vec3f::zero();
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+GjkResult gjkDistance(const ConvexShape& a, const ConvexShape& b, GjkCache* cache) noexcept {
+    const GjkRun run = runGjk(a, b, cache, SupportMode::eCore, -1.0f);
+    storeCache(cache, run.simplex);
+
+    GjkResult result;
+    result.iterations = run.iterations;
+    if (run.intersecting) {
+        result.intersecting = true;
+        return result;
+    }
+
+    const float core_distance = run.v.length();
+    const float margins = a.margin() + b.margin();
+    if (core_distance <= margins) {
+        result.intersecting = true;
+        return result;
+    }
+
+    // run.v points from B's closest point to A's
+    result.normal = -run.v / core_distance;
+    result.distance = core_distance - margins;
+    result.point_a = witnessA(run.simplex) + result.normal * a.margin();
+    result.point_b = witnessB(run.simplex) - result.normal * b.margin();
+    return result;
+}
+
+bool gjkIntersects(const ConvexShape& a, const ConvexShape& b, GjkCache* cache) noexcept {
+    const float margins = a.margin() + b.margin();
+    const GjkRun run = runGjk(a, b, cache, SupportMode::eCore, margins);
+    storeCache(cache, run.simplex);
+    if (run.separated) {
+        return false;
+    }
+    return run.intersecting || run.v.lengthSquared() <= margins * margins;
+}
+
+PenetrationResult penetration(const ConvexShape& a, const ConvexShape& b, GjkCache* cache) noexcept {
+    const GjkRun core = runGjk(a, b, cache, SupportMode::eCore, -1.0f);
+    storeCache(cache, core.simplex);
+
+    PenetrationResult result;
+    const float margins = a.margin() + b.margin();
+    if (!core.intersecting) {
+        const float core_distance = core.v.length();
+        if (core_distance > margins) {
+            return result;
+        }
+        if (core_distance > kEpaTolerance) {
+            // Only the margins overlap: the cores' closest points give the answer
+            result.intersecting = true;
+            result.normal = -core.v / core_distance;
+            result.depth = margins - core_distance;
+            result.point_a = witnessA(core.simplex) + result.normal * a.margin();
+            result.point_b = witnessB(core.simplex) - result.normal * b.margin();
+            return result;
+        }
+    }
+
+    // The cores overlap: rebuild the simplex on the full shapes, seeded with the core directions
+    GjkCache seed;
+    storeCache(&seed, core.simplex);
+    GjkRun full = runGjk(a, b, &seed, SupportMode::eFull, -1.0f);
+    if (!full.intersecting && full.v.lengthSquared() > kEpaTolerance * kEpaTolerance) {
+        // Rounding disagreement between the two runs: the shapes barely touch
+        result.intersecting = true;
+        const float length = full.v.length();
+        result.normal = -full.v / length;
+        result.point_a = witnessA(full.simplex);
+        result.point_b = witnessB(full.simplex);
+        return result;
+    }
+    if (full.simplex.count < 4 && !blowUpSimplex(full.simplex, a, b)) {
+        result.intersecting = true;
+        return result;
+    }
+    return runEpa(full.simplex, a, b);
+}
+
+}  // namespace vne::math
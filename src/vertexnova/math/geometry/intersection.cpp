@@ -0,0 +1,419 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Corresponding header
+#include "vertexnova/math/geometry/intersection.h"
+
+// Project headers
+#include "vertexnova/common/macros.h"
+#include "vertexnova/math/instrumentation.h"
+#include "vertexnova/math/simd/float4.h"
+
+// Standard library includes
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+namespace vne::math {
+
+// The batch ray cast reads Aabb as six packed floats: min xyz, max xyz.
+static_assert(sizeof(Aabb) == 6 * sizeof(float), "Aabb must be tightly packed");
+
+namespace {
+
+/// Per-ray constants broadcast once for the whole batch
+struct RayLanes {
+    simd::Float4 origin[3];
+    simd::Float4 inv_direction[3];
+    simd::Float4 exit_scale;
+    simd::Float4 max_distance;
+};
+
+/**
+ * Slab test of one ray against four boxes, one per SIMD lane.
+ *
+ * Boxes are read as floats 0-3 and 2-5 and transposed, as in the AABB batch
+ * transform. Every lane shares the ray's direction signs, so the near and far
+ * planes are chosen per axis rather than per lane. The interval is updated
+ * with compare-and-select instead of min/max: a NaN slab distance then never
+ * wins a comparison and leaves the interval unchanged on every backend.
+ *
+ * @return Lane mask of the boxes hit; @p out_enter receives their entry distances
+ */
+simd::Float4 intersectBlock(const Aabb* boxes,
+                            const PrecomputedRay& ray,
+                            const RayLanes& lanes,
+                            simd::Float4& out_enter) noexcept {
+    using simd::Float4;
+
+    const float* b[simd::kLanes];
+    for (int k = 0; k < simd::kLanes; ++k) {
+        b[k] = reinterpret_cast<const float*>(&boxes[k]);
+    }
+    Float4 bounds[2][3];  // bounds[0] = min xyz, bounds[1] = max xyz
+    Float4 max_x_low = simd::load(b[3]);
+    bounds[0][0] = simd::load(b[0]);
+    bounds[0][1] = simd::load(b[1]);
+    bounds[0][2] = simd::load(b[2]);
+    simd::transpose(bounds[0][0], bounds[0][1], bounds[0][2], max_x_low);
+    Float4 min_z_high = simd::load(b[0] + 2);
+    bounds[1][0] = simd::load(b[1] + 2);
+    bounds[1][1] = simd::load(b[2] + 2);
+    bounds[1][2] = simd::load(b[3] + 2);
+    simd::transpose(min_z_high, bounds[1][0], bounds[1][1], bounds[1][2]);
+
+    Float4 enter = simd::zero();
+    Float4 exit = lanes.max_distance;
+    for (int k = 0; k < 3; ++k) {
+        const Float4 near = (bounds[ray.sign[k]][k] - lanes.origin[k]) * lanes.inv_direction[k];
+        const Float4 far = (bounds[1 - ray.sign[k]][k] - lanes.origin[k]) * lanes.inv_direction[k] * lanes.exit_scale;
+        enter = simd::select(simd::cmpGt(near, enter), near, enter);
+        exit = simd::select(simd::cmpLt(far, exit), far, exit);
+    }
+    out_enter = enter;
+    return simd::cmpLe(enter, exit);
+}
+
+/**
+ * Watertight ray-triangle test (Woop, Benthin, Wald 2013).
+ *
+ * The vertices are moved into a frame where the ray starts at the origin and
+ * runs along +kz; the signs of the 2D edge functions u, v, w then decide the
+ * hit exactly as a rasterizer's would. Edge functions that round to zero are
+ * recomputed in double precision so a shared edge is owned consistently.
+ *
+ * @param out_t Hit distance
+ * @param out_u Barycentric weight of v1
+ * @param out_v Barycentric weight of v2
+ * @param out_det Signed determinant; positive for front faces
+ */
+bool intersectWatertight(const PrecomputedRay& ray,
+                         const Vec3f& v0,
+                         const Vec3f& v1,
+                         const Vec3f& v2,
+                         float max_distance,
+                         bool cull_backface,
+                         float& out_t,
+                         float& out_u,
+                         float& out_v,
+                         float& out_det) noexcept {
+    const uint32_t kx = ray.axes[0];
+    const uint32_t ky = ray.axes[1];
+    const uint32_t kz = ray.axes[2];
+    const Vec3f a = v0 - ray.origin;
+    const Vec3f b = v1 - ray.origin;
+    const Vec3f c = v2 - ray.origin;
+
+    const float ax = a[kx] - ray.shear.x() * a[kz];
+    const float ay = a[ky] - ray.shear.y() * a[kz];
+    const float bx = b[kx] - ray.shear.x() * b[kz];
+    const float by = b[ky] - ray.shear.y() * b[kz];
+    const float cx = c[kx] - ray.shear.x() * c[kz];
+    const float cy = c[ky] - ray.shear.y() * c[kz];
+
+    float u = cx * by - cy * bx;
+    float v = ax * cy - ay * cx;
+    float w = bx * ay - by * ax;
+    if (u == 0.0f || v == 0.0f || w == 0.0f) {
+        u = static_cast<float>(static_cast<double>(cx) * by - static_cast<double>(cy) * bx);
+        v = static_cast<float>(static_cast<double>(ax) * cy - static_cast<double>(ay) * cx);
+        w = static_cast<float>(static_cast<double>(bx) * ay - static_cast<double>(by) * ax);
+    }
+
+    // Inside when all edge functions agree in sign (zero counts as either)
+    const bool front = u >= 0.0f && v >= 0.0f && w >= 0.0f;
+    const bool back = u <= 0.0f && v <= 0.0f && w <= 0.0f;
+    if (!(front || (back && !cull_backface))) {
+        return false;
+    }
+    const float det = u + v + w;
+    if (det == 0.0f) {
+        return false;
+    }
+
+    // Distance scaled by det; compared before dividing
+    const float scaled_t = u * (ray.shear.z() * a[kz]) + v * (ray.shear.z() * b[kz]) + w * (ray.shear.z() * c[kz]);
+    const float signed_t = det < 0.0f ? -scaled_t : scaled_t;
+    if (signed_t < 0.0f || signed_t > max_distance * std::abs(det)) {
+        return false;
+    }
+
+    const float inv_det = 1.0f / det;
+    out_t = scaled_t * inv_det;
+    out_u = v * inv_det;
+    out_v = w * inv_det;
+    out_det = det;
+    return true;
+}
+
+/// Builds the hit record for a watertight result.
+RayHit makeTriangleHit(const PrecomputedRay& ray, const Triangle& triangle, float t, float u, float v, float det) noexcept {
+    RayHit hit;
+    hit.distance = t;
+    hit.point = ray.getPoint(t);
+    hit.normal = det > 0.0f ? triangle.unitNormal() : -triangle.unitNormal();
+    hit.uv = Vec2f(u, v);
+    return hit;
+}
+
+}  // namespace
+
+// ============================================================================
+// Ray-Triangle Intersection
+// ============================================================================
+
+RayHit intersect(const PrecomputedRay& ray, const Triangle& triangle, float max_distance, bool cull_backface) noexcept {
+    VNE_MATH_PROBE_COUNT(Probe::eRayTest);
+    float t;
+    float u;
+    float v;
+    float det;
+    if (!intersectWatertight(ray, triangle.v0, triangle.v1, triangle.v2, max_distance, cull_backface, t, u, v, det)) {
+        return RayHit::none();
+    }
+    return makeTriangleHit(ray, triangle, t, u, v, det);
+}
+
+// ============================================================================
+// Batch Ray Casting
+// ============================================================================
+
+size_t intersect(const PrecomputedRay& ray,
+                 std::span<const Aabb> boxes,
+                 std::span<float> out_distances,
+                 float max_distance) noexcept {
+    VNE_ASSERT_MSG(out_distances.size() >= boxes.size(), "intersect: out_distances smaller than boxes");
+    const size_t count = std::min(boxes.size(), out_distances.size());
+    VNE_MATH_PROBE_SCOPE(Probe::eRayBatch, count);
+
+    RayLanes lanes;
+    for (int k = 0; k < 3; ++k) {
+        lanes.origin[k] = simd::broadcast(ray.origin[k]);
+        lanes.inv_direction[k] = simd::broadcast(ray.inv_direction[k]);
+    }
+    lanes.exit_scale = simd::broadcast(detail::kSlabExitScale);
+    lanes.max_distance = simd::broadcast(max_distance);
+    const simd::Float4 miss = simd::broadcast(-1.0f);
+
+    size_t hits = 0;
+    size_t i = 0;
+    for (; i + simd::kLanes <= count; i += simd::kLanes) {
+        simd::Float4 enter;
+        const simd::Float4 hit = intersectBlock(&boxes[i], ray, lanes, enter);
+        simd::store(&out_distances[i], simd::select(hit, enter, miss));
+        hits += static_cast<size_t>(std::popcount(static_cast<uint32_t>(simd::moveMask(hit))));
+    }
+    for (; i < count; ++i) {
+        float t_enter;
+        float t_exit;
+        int enter_axis;
+        int exit_axis;
+        const bool hit = detail::slabInterval(ray, boxes[i], t_enter, t_exit, enter_axis, exit_axis)
+                         && t_exit >= 0.0f && t_enter <= max_distance;
+        out_distances[i] = hit ? std::max(t_enter, 0.0f) : -1.0f;
+        hits += hit ? 1 : 0;
+    }
+    return hits;
+}
+
+size_t packTriangles(std::span<const Triangle> triangles, std::span<TrianglePacket> out) noexcept {
+    constexpr size_t kWidth = TrianglePacket::kWidth;
+    const size_t needed = (triangles.size() + kWidth - 1) / kWidth;
+    VNE_ASSERT_MSG(out.size() >= needed, "packTriangles: out smaller than (triangles + 3) / 4");
+    const size_t count = std::min(needed, out.size());
+
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    for (size_t p = 0; p < count; ++p) {
+        for (size_t lane = 0; lane < kWidth; ++lane) {
+            const size_t i = p * kWidth + lane;
+            const Vec3f* vertices[3] = {nullptr, nullptr, nullptr};
+            if (i < triangles.size()) {
+                vertices[0] = &triangles[i].v0;
+                vertices[1] = &triangles[i].v1;
+                vertices[2] = &triangles[i].v2;
+            }
+            for (int vertex = 0; vertex < 3; ++vertex) {
+                for (int axis = 0; axis < 3; ++axis) {
+                    out[p].v[vertex][axis][lane] = vertices[vertex] ? (*vertices[vertex])[axis] : nan;
+                }
+            }
+        }
+    }
+    return count;
+}
+
+size_t packTriangles(std::span<const Vec3f> vertices,
+                     std::span<const uint32_t> indices,
+                     std::span<TrianglePacket> out) noexcept {
+    VNE_ASSERT_MSG(indices.size() % 3 == 0, "packTriangles: index count is not a multiple of 3");
+    constexpr size_t kWidth = TrianglePacket::kWidth;
+    const size_t triangle_count = indices.size() / 3;
+    const size_t needed = (triangle_count + kWidth - 1) / kWidth;
+    VNE_ASSERT_MSG(out.size() >= needed, "packTriangles: out smaller than (triangles + 3) / 4");
+    const size_t count = std::min(needed, out.size());
+
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    for (size_t p = 0; p < count; ++p) {
+        for (size_t lane = 0; lane < kWidth; ++lane) {
+            const size_t i = p * kWidth + lane;
+            for (size_t vertex = 0; vertex < 3; ++vertex) {
+                const bool valid = i < triangle_count && indices[3 * i + vertex] < vertices.size();
+                VNE_ASSERT_MSG(i >= triangle_count || valid, "packTriangles: triangle index out of range");
+                for (int axis = 0; axis < 3; ++axis) {
+                    out[p].v[vertex][axis][lane] = valid ? vertices[indices[3 * i + vertex]][axis] : nan;
+                }
+            }
+        }
+    }
+    return count;
+}
+
+RayHit intersect(const PrecomputedRay& ray,
+                 std::span<const TrianglePacket> packets,
+                 uint32_t& out_index,
+                 float max_distance,
+                 bool cull_backface) noexcept {
+    using simd::Float4;
+    constexpr int kWidth = static_cast<int>(TrianglePacket::kWidth);
+    static_assert(kWidth == simd::kLanes, "TrianglePacket width must match the SIMD width");
+    VNE_MATH_PROBE_SCOPE(Probe::eRayBatch, packets.size());
+
+    const uint32_t kx = ray.axes[0];
+    const uint32_t ky = ray.axes[1];
+    const uint32_t kz = ray.axes[2];
+    const Float4 origin[3] = {simd::broadcast(ray.origin[kx]),
+                              simd::broadcast(ray.origin[ky]),
+                              simd::broadcast(ray.origin[kz])};
+    const Float4 shear_x = simd::broadcast(ray.shear.x());
+    const Float4 shear_y = simd::broadcast(ray.shear.y());
+    const Float4 shear_z = simd::broadcast(ray.shear.z());
+    const Float4 zero = simd::zero();
+    const Float4 one = simd::broadcast(1.0f);
+    const Float4 sign_bit = simd::broadcast(-0.0f);
+    const Float4 max_t = simd::broadcast(max_distance);
+
+    // Per-lane closest hit; strictly-less updates keep the earliest triangle on ties
+    Float4 best_t = simd::broadcast(std::nextafter(max_distance, std::numeric_limits<float>::infinity()));
+    Float4 best_u = zero;
+    Float4 best_v = zero;
+    Float4 best_det = zero;
+    Float4 best_index = simd::broadcast(-1.0f);
+
+    for (size_t p = 0; p < packets.size(); ++p) {
+        const TrianglePacket& packet = packets[p];
+
+        // Sheared 2D positions and scaled depths of the three vertices
+        Float4 px[3];
+        Float4 py[3];
+        Float4 pz[3];
+        for (int vertex = 0; vertex < 3; ++vertex) {
+            const Float4 dz = simd::load(packet.v[vertex][kz]) - origin[2];
+            px[vertex] = (simd::load(packet.v[vertex][kx]) - origin[0]) - shear_x * dz;
+            py[vertex] = (simd::load(packet.v[vertex][ky]) - origin[1]) - shear_y * dz;
+            pz[vertex] = shear_z * dz;
+        }
+        const Float4 u = px[2] * py[1] - py[2] * px[1];
+        const Float4 v = px[0] * py[2] - py[0] * px[2];
+        const Float4 w = px[1] * py[0] - py[1] * px[0];
+
+        // NaN padding lanes fail every comparison below and are never hits
+        const Float4 front = simd::cmpGe(u, zero) & simd::cmpGe(v, zero) & simd::cmpGe(w, zero);
+        const Float4 back = simd::cmpLe(u, zero) & simd::cmpLe(v, zero) & simd::cmpLe(w, zero);
+        const Float4 inside = cull_backface ? front : (front | back);
+
+        const Float4 det = u + v + w;
+        const Float4 scaled_t = u * pz[0] + v * pz[1] + w * pz[2];
+        const Float4 det_sign = det & sign_bit;
+        const Float4 signed_t = scaled_t ^ det_sign;
+        const Float4 abs_det = det ^ det_sign;
+        const Float4 inv_det = one / det;
+        const Float4 t = scaled_t * inv_det;
+
+        const Float4 exact_zero = simd::cmpEq(u, zero) | simd::cmpEq(v, zero) | simd::cmpEq(w, zero);
+        Float4 hit = inside & simd::andNot(simd::cmpEq(det, zero), simd::cmpGe(signed_t, zero));
+        hit = hit & simd::cmpLe(signed_t, max_t * abs_det) & simd::cmpLt(t, best_t);
+        hit = simd::andNot(exact_zero, hit);
+
+        best_t = simd::select(hit, t, best_t);
+        best_u = simd::select(hit, v * inv_det, best_u);
+        best_v = simd::select(hit, w * inv_det, best_v);
+        best_det = simd::select(hit, det, best_det);
+        best_index = simd::select(hit, simd::broadcast(static_cast<float>(p * kWidth)), best_index);
+
+        // Rare: an edge function rounded to zero, redo those lanes with the scalar fallback
+        if (simd::anyTrue(exact_zero)) {
+            alignas(16) float lanes[5][kWidth];
+            simd::store(lanes[0], best_t);
+            simd::store(lanes[1], best_u);
+            simd::store(lanes[2], best_v);
+            simd::store(lanes[3], best_det);
+            simd::store(lanes[4], best_index);
+            const int zero_lanes = simd::moveMask(exact_zero);
+            for (int lane = 0; lane < kWidth; ++lane) {
+                if ((zero_lanes & (1 << lane)) == 0) {
+                    continue;
+                }
+                const Triangle triangle = packet.triangle(static_cast<size_t>(lane));
+                float lane_t;
+                float lane_u;
+                float lane_v;
+                float lane_det;
+                if (intersectWatertight(
+                        ray, triangle.v0, triangle.v1, triangle.v2, max_distance, cull_backface, lane_t, lane_u, lane_v, lane_det)
+                    && lane_t < lanes[0][lane]) {
+                    lanes[0][lane] = lane_t;
+                    lanes[1][lane] = lane_u;
+                    lanes[2][lane] = lane_v;
+                    lanes[3][lane] = lane_det;
+                    lanes[4][lane] = static_cast<float>(p * kWidth);
+                }
+            }
+            best_t = simd::load(lanes[0]);
+            best_u = simd::load(lanes[1]);
+            best_v = simd::load(lanes[2]);
+            best_det = simd::load(lanes[3]);
+            best_index = simd::load(lanes[4]);
+        }
+    }
+
+    // Closest lane; on equal distances the lower triangle index wins
+    int best_lane = -1;
+    float closest = 0.0f;
+    size_t closest_index = 0;
+    for (int lane = 0; lane < kWidth; ++lane) {
+        const float lane_index = simd::lane(best_index, lane);
+        if (lane_index < 0.0f) {
+            continue;
+        }
+        const float lane_t = simd::lane(best_t, lane);
+        const size_t index = static_cast<size_t>(lane_index) + static_cast<size_t>(lane);
+        if (best_lane < 0 || lane_t < closest || (lane_t == closest && index < closest_index)) {
+            best_lane = lane;
+            closest = lane_t;
+            closest_index = index;
+        }
+    }
+    if (best_lane < 0) {
+        return RayHit::none();
+    }
+
+    out_index = static_cast<uint32_t>(closest_index);
+    const Triangle triangle = packets[closest_index / kWidth].triangle(closest_index % kWidth);
+    return makeTriangleHit(ray,
+                           triangle,
+                           closest,
+                           simd::lane(best_u, best_lane),
+                           simd::lane(best_v, best_lane),
+                           simd::lane(best_det, best_lane));
+}
+
+}  // namespace vne::math
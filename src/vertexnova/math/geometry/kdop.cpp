@@ -0,0 +1,188 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Project includes
+#include "vertexnova/math/geometry/kdop.h"
+
+// Project headers
+#include "vertexnova/common/macros.h"
+#include "vertexnova/math/core/constants.h"
+
+// Standard library includes
+#include <algorithm>
+
+namespace vne::math {
+
+namespace {
+
+/// Every axis any k-DOP type uses: coordinate axes, cube diagonals, edge diagonals
+constexpr float kAxes[Kdop::kMaxAxes][3] = {
+    {1.0f, 0.0f, 0.0f},
+    {0.0f, 1.0f, 0.0f},
+    {0.0f, 0.0f, 1.0f},
+    {1.0f, 1.0f, 1.0f},
+    {1.0f, 1.0f, -1.0f},
+    {1.0f, -1.0f, 1.0f},
+    {1.0f, -1.0f, -1.0f},
+    {1.0f, 1.0f, 0.0f},
+    {1.0f, -1.0f, 0.0f},
+    {1.0f, 0.0f, 1.0f},
+    {1.0f, 0.0f, -1.0f},
+    {0.0f, 1.0f, 1.0f},
+    {0.0f, 1.0f, -1.0f},
+};
+
+/// Index into kAxes of each slot; the 18-DOP skips the cube diagonals
+[[nodiscard]] uint32_t axisTableIndex(DopType type, uint32_t slot) noexcept {
+    if (type == DopType::eDop18 && slot >= 3) {
+        return slot + 4;
+    }
+    return slot;
+}
+
+[[nodiscard]] float project(DopType type, uint32_t slot, const Vec3f& point) noexcept {
+    const float* a = kAxes[axisTableIndex(type, slot)];
+    return a[0] * point.x() + a[1] * point.y() + a[2] * point.z();
+}
+
+}  // namespace
+
+// ============================================================================
+// Constructors
+// ============================================================================
+
+Kdop::Kdop(DopType type) noexcept
+    : type_(type) {
+    reset();
+}
+
+// ============================================================================
+// Axes
+// ============================================================================
+
+uint32_t Kdop::axisCount(DopType type) noexcept {
+    switch (type) {
+        case DopType::eDop14:
+            return 7;
+        case DopType::eDop18:
+            return 9;
+        case DopType::eDop26:
+            return 13;
+    }
+    return 3;
+}
+
+Vec3f Kdop::axis(DopType type, uint32_t slot) noexcept {
+    VNE_ASSERT_MSG(slot < axisCount(type), "Kdop::axis: slot out of range");
+    const float* a = kAxes[axisTableIndex(type, std::min(slot, axisCount(type) - 1))];
+    return Vec3f(a[0], a[1], a[2]);
+}
+
+// ============================================================================
+// Accessors
+// ============================================================================
+
+float Kdop::min(uint32_t slot) const noexcept {
+    VNE_ASSERT_MSG(slot < axisCount(), "Kdop::min: slot out of range");
+    return min_[std::min(slot, kMaxAxes - 1)];
+}
+
+float Kdop::max(uint32_t slot) const noexcept {
+    VNE_ASSERT_MSG(slot < axisCount(), "Kdop::max: slot out of range");
+    return max_[std::min(slot, kMaxAxes - 1)];
+}
+
+void Kdop::setSlab(uint32_t slot, float min, float max) noexcept {
+    VNE_ASSERT_MSG(slot < axisCount(), "Kdop::setSlab: slot out of range");
+    if (slot >= axisCount()) {
+        return;
+    }
+    min_[slot] = min;
+    max_[slot] = max;
+}
+
+// ============================================================================
+// Modification Methods
+// ============================================================================
+
+void Kdop::expand(const Vec3f& point) noexcept {
+    for (uint32_t slot = 0; slot < axisCount(); ++slot) {
+        const float d = project(type_, slot, point);
+        min_[slot] = std::min(min_[slot], d);
+        max_[slot] = std::max(max_[slot], d);
+    }
+}
+
+void Kdop::expand(const Kdop& other) noexcept {
+    VNE_ASSERT_MSG(other.type_ == type_, "Kdop::expand: k-DOP types differ");
+    if (other.type_ != type_) {
+        return;
+    }
+    for (uint32_t slot = 0; slot < axisCount(); ++slot) {
+        min_[slot] = std::min(min_[slot], other.min_[slot]);
+        max_[slot] = std::max(max_[slot], other.max_[slot]);
+    }
+}
+
+void Kdop::reset() noexcept {
+    std::fill(std::begin(min_), std::end(min_), kFloatMax);
+    std::fill(std::begin(max_), std::end(max_), -kFloatMax);
+}
+
+// ============================================================================
+// Query Methods
+// ============================================================================
+
+bool Kdop::isValid() const noexcept {
+    for (uint32_t slot = 0; slot < axisCount(); ++slot) {
+        if (!(min_[slot] <= max_[slot])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Kdop::contains(const Vec3f& point) const noexcept {
+    for (uint32_t slot = 0; slot < axisCount(); ++slot) {
+        const float d = project(type_, slot, point);
+        if (d < min_[slot] || d > max_[slot]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Kdop::intersects(const Kdop& other) const noexcept {
+    VNE_ASSERT_MSG(other.type_ == type_, "Kdop::intersects: k-DOP types differ");
+    // Different types still share the coordinate slabs
+    const uint32_t count = other.type_ == type_ ? axisCount() : 3;
+    for (uint32_t slot = 0; slot < count; ++slot) {
+        // Strict, like Aabb::intersects: touching slabs do not overlap
+        if (min_[slot] >= other.max_[slot] || max_[slot] <= other.min_[slot]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Aabb Kdop::getAabb() const noexcept {
+    return Aabb(Vec3f(min_[0], min_[1], min_[2]), Vec3f(max_[0], max_[1], max_[2]));
+}
+
+std::ostream& operator<<(std::ostream& os, const Kdop& dop) {
+    os << "Kdop" << 2 * dop.axisCount() << ": [";
+    for (uint32_t slot = 0; slot < dop.axisCount(); ++slot) {
+        os << (slot == 0 ? "" : ", ") << "(" << dop.min(slot) << ", " << dop.max(slot) << ")";
+    }
+    return os << "]";
+}
+
+}  // namespace vne::math
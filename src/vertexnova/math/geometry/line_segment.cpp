@@ -57,6 +57,53 @@ float LineSegment::squaredDistanceToPoint(const Vec3f& point) const noexcept {
     return (point - closestPoint(point)).lengthSquared();
 }
 
+// Segment queries
+float LineSegment::closestPoints(const LineSegment& other, Vec3f& out_point, Vec3f& out_other_point) const noexcept {
+    const Vec3f d1 = direction();
+    const Vec3f d2 = other.direction();
+    const Vec3f r = start - other.start;
+    const float a = d1.lengthSquared();
+    const float e = d2.lengthSquared();
+    const float f = d2.dot(r);
+
+    float s = 0.0f;
+    float t = 0.0f;
+    if (isZero(a) && isZero(e)) {
+        // Both segments are points
+    } else if (isZero(a)) {
+        t = clamp(f / e, 0.0f, 1.0f);
+    } else {
+        const float c = d1.dot(r);
+        if (isZero(e)) {
+            s = clamp(-c / a, 0.0f, 1.0f);
+        } else {
+            // Closest points of the infinite lines, then clamp s and recompute t for it;
+            // if t had to be clamped, s is recomputed for the clamped t (Ericson 5.1.9)
+            const float b = d1.dot(d2);
+            const float denom = a * e - b * b;
+            s = denom > 0.0f ? clamp((b * f - c * e) / denom, 0.0f, 1.0f) : 0.0f;
+            t = (b * s + f) / e;
+            if (t < 0.0f) {
+                t = 0.0f;
+                s = clamp(-c / a, 0.0f, 1.0f);
+            } else if (t > 1.0f) {
+                t = 1.0f;
+                s = clamp((b - c) / a, 0.0f, 1.0f);
+            }
+        }
+    }
+
+    out_point = start + d1 * s;
+    out_other_point = other.start + d2 * t;
+    return (out_point - out_other_point).lengthSquared();
+}
+
+float LineSegment::squaredDistanceToSegment(const LineSegment& other) const noexcept {
+    Vec3f point;
+    Vec3f other_point;
+    return closestPoints(other, point, other_point);
+}
+
 // Validation
 bool LineSegment::isDegenerate(float epsilon) const noexcept {
     return lengthSquared() < epsilon * epsilon;
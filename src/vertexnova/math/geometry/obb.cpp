@@ -12,15 +12,76 @@
 // Corresponding header
 #include "vertexnova/math/geometry/obb.h"
 
+// Project headers
+#include "vertexnova/common/macros.h"
 #include "vertexnova/math/core/math_utils.h"
 #include "vertexnova/math/geometry/aabb.h"
+#include "vertexnova/math/instrumentation.h"
+#include "vertexnova/math/simd/float4.h"
+
+// Standard library includes
+#include <algorithm>
+#include <cmath>
 
 namespace vne::math {
 
 namespace {
 constexpr float kHalf = 0.5f;
 constexpr float kSurfaceAreaMultiplier = 2.0f;
-constexpr uint32_t kCornerCount = 8;
+
+/// Added to the absolute rotation terms so that near-parallel edge pairs,
+/// whose cross product is close to zero, cannot report a false separation.
+constexpr float kParallelEpsilon = 1e-6f;
+
+/**
+ * Gottschalk's 15-axis SAT with box B expressed in box A's frame.
+ *
+ * @param r r[i][j] = A_i . B_j
+ * @param t Center of B minus center of A, in A's frame
+ * @param ea Half-extents of A
+ * @param eb Half-extents of B
+ */
+[[nodiscard]] bool satOverlap(const float (&r)[3][3], const float (&t)[3], const Vec3f& ea, const Vec3f& eb) noexcept {
+    float abs_r[3][3];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            abs_r[i][j] = std::abs(r[i][j]) + kParallelEpsilon;
+        }
+    }
+
+    // Face axes of A
+    for (int i = 0; i < 3; ++i) {
+        const float rb = eb[0] * abs_r[i][0] + eb[1] * abs_r[i][1] + eb[2] * abs_r[i][2];
+        if (std::abs(t[i]) > ea[i] + rb) {
+            return false;
+        }
+    }
+
+    // Face axes of B
+    for (int j = 0; j < 3; ++j) {
+        const float ra = ea[0] * abs_r[0][j] + ea[1] * abs_r[1][j] + ea[2] * abs_r[2][j];
+        if (std::abs(t[0] * r[0][j] + t[1] * r[1][j] + t[2] * r[2][j]) > ra + eb[j]) {
+            return false;
+        }
+    }
+
+    // Edge-edge axes A_i x B_j
+    for (int i = 0; i < 3; ++i) {
+        const int i1 = (i + 1) % 3;
+        const int i2 = (i + 2) % 3;
+        for (int j = 0; j < 3; ++j) {
+            const int j1 = (j + 1) % 3;
+            const int j2 = (j + 2) % 3;
+            const float ra = ea[i1] * abs_r[i2][j] + ea[i2] * abs_r[i1][j];
+            const float rb = eb[j1] * abs_r[i][j2] + eb[j2] * abs_r[i][j1];
+            if (std::abs(t[i2] * r[i1][j] - t[i1] * r[i2][j]) > ra + rb) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 }  // namespace
 
 // Constructors
@@ -29,12 +90,16 @@ Obb::Obb() noexcept = default;
 Obb::Obb(const Vec3f& center, const Vec3f& half_extents, const Quatf& orientation) noexcept
     : center_(center)
     , half_extents_(half_extents)
-    , orientation_(orientation) {}
+    , orientation_(orientation) {
+    updateBasis();
+}
 
 Obb::Obb(const Vec3f& center, const Vec3f& half_extents, const Mat3f& rotation) noexcept
     : center_(center)
     , half_extents_(half_extents)
-    , orientation_(Quatf::fromMatrix(rotation)) {}
+    , orientation_(Quatf::fromMatrix(rotation)) {
+    updateBasis();
+}
 
 // Static factory methods
 Obb Obb::fromAabb(const Aabb& aabb) noexcept {
@@ -66,38 +131,36 @@ const Vec3f& Obb::halfExtents() const noexcept {
 
 void Obb::setOrientation(const Quatf& orientation) noexcept {
     orientation_ = orientation;
+    updateBasis();
 }
 
 const Quatf& Obb::orientation() const noexcept {
     return orientation_;
 }
 
-Mat3f Obb::rotationMatrix() const noexcept {
-    return orientation_.toMatrix3();
+const Mat3f& Obb::rotationMatrix() const noexcept {
+    return basis_;
+}
+
+void Obb::updateBasis() noexcept {
+    basis_ = orientation_.toMatrix3();
 }
 
 // Local axes
 Vec3f Obb::axisX() const noexcept {
-    return orientation_.rotate(Vec3f::xAxis());
+    return basis_[0];
 }
 
 Vec3f Obb::axisY() const noexcept {
-    return orientation_.rotate(Vec3f::yAxis());
+    return basis_[1];
 }
 
 Vec3f Obb::axisZ() const noexcept {
-    return orientation_.rotate(Vec3f::zAxis());
+    return basis_[2];
 }
 
 Vec3f Obb::axis(uint32_t index) const noexcept {
-    switch (index) {
-        case 0:
-            return axisX();
-        case 1:
-            return axisY();
-        default:
-            return axisZ();
-    }
+    return basis_[std::min(index, 2u)];
 }
 
 // Computed properties
@@ -143,14 +206,12 @@ Vec3f Obb::corner(uint32_t index) const noexcept {
 }
 
 Aabb Obb::getAabb() const noexcept {
-    Vec3f corners[kCornerCount];
-    getCorners(corners);
-
-    Aabb result;
-    for (uint32_t i = 0; i < kCornerCount; ++i) {
-        result.expand(corners[i]);
+    Vec3f extent;
+    for (int i = 0; i < 3; ++i) {
+        extent[i] = std::abs(basis_[0][i]) * half_extents_.x() + std::abs(basis_[1][i]) * half_extents_.y()
+                    + std::abs(basis_[2][i]) * half_extents_.z();
     }
-    return result;
+    return {center_ - extent, center_ + extent};
 }
 
 // Modification methods
@@ -161,6 +222,7 @@ void Obb::translate(const Vec3f& offset) noexcept {
 void Obb::rotate(const Quatf& rotation) noexcept {
     center_ = rotation.rotate(center_);
     orientation_ = rotation * orientation_;
+    updateBasis();
 }
 
 void Obb::scale(float factor) noexcept {
@@ -193,6 +255,7 @@ void Obb::transform(const Mat4f& matrix) noexcept {
 
     Mat3f rot(col0, col1, col2);
     orientation_ = Quatf::fromMatrix(rot);
+    updateBasis();
     half_extents_.x() *= scale_factors.x();
     half_extents_.y() *= scale_factors.y();
     half_extents_.z() *= scale_factors.z();
@@ -205,7 +268,8 @@ bool Obb::isValid() const noexcept {
 
 bool Obb::contains(const Vec3f& point) const noexcept {
     // Transform point to local space
-    Vec3f local = orientation_.inverse().rotate(point - center_);
+    const Vec3f d = point - center_;
+    const Vec3f local(d.dot(basis_[0]), d.dot(basis_[1]), d.dot(basis_[2]));
 
     return std::abs(local.x()) <= half_extents_.x() && std::abs(local.y()) <= half_extents_.y()
            && std::abs(local.z()) <= half_extents_.z();
@@ -213,7 +277,8 @@ bool Obb::contains(const Vec3f& point) const noexcept {
 
 Vec3f Obb::closestPoint(const Vec3f& point) const noexcept {
     // Transform point to local space
-    Vec3f local = orientation_.inverse().rotate(point - center_);
+    const Vec3f d = point - center_;
+    Vec3f local(d.dot(basis_[0]), d.dot(basis_[1]), d.dot(basis_[2]));
 
     // Clamp to box extents
     local.x() = clamp(local.x(), -half_extents_.x(), half_extents_.x());
@@ -221,7 +286,7 @@ Vec3f Obb::closestPoint(const Vec3f& point) const noexcept {
     local.z() = clamp(local.z(), -half_extents_.z(), half_extents_.z());
 
     // Transform back to world space
-    return center_ + orientation_.rotate(local);
+    return center_ + basis_ * local;
 }
 
 float Obb::squaredDistanceToPoint(const Vec3f& point) const noexcept {
@@ -233,67 +298,28 @@ float Obb::distanceToPoint(const Vec3f& point) const noexcept {
 }
 
 bool Obb::intersects(const Obb& other) const noexcept {
-    // Separating Axis Theorem (SAT) for OBB-OBB intersection
-    // Test 15 potential separating axes:
-    // - 3 axes from this OBB
-    // - 3 axes from other OBB
-    // - 9 cross products of axes from both
-
-    Vec3f axes_a[3] = {axisX(), axisY(), axisZ()};
-    Vec3f axes_b[3] = {other.axisX(), other.axisY(), other.axisZ()};
-
-    Vec3f t = other.center_ - center_;
-
-    // For each axis, compute the projection of the separation vector
-    // and compare to the sum of projected half-extents
-
-    auto testAxis = [&](const Vec3f& axis) -> bool {
-        if (axis.lengthSquared() < kFloatEpsilon) {
-            return true;  // Degenerate axis, skip
-        }
-
-        Vec3f normalized_axis = axis.normalized();
-
-        // Project half-extents of both boxes onto axis
-        float proj_a = std::abs(axes_a[0].dot(normalized_axis)) * half_extents_.x()
-                       + std::abs(axes_a[1].dot(normalized_axis)) * half_extents_.y()
-                       + std::abs(axes_a[2].dot(normalized_axis)) * half_extents_.z();
-
-        float proj_b = std::abs(axes_b[0].dot(normalized_axis)) * other.half_extents_.x()
-                       + std::abs(axes_b[1].dot(normalized_axis)) * other.half_extents_.y()
-                       + std::abs(axes_b[2].dot(normalized_axis)) * other.half_extents_.z();
-
-        float dist = std::abs(t.dot(normalized_axis));
-
-        return dist <= proj_a + proj_b;
-    };
-
-    // Test axes from this OBB
-    for (const auto& axis : axes_a) {
-        if (!testAxis(axis))
-            return false;
-    }
-
-    // Test axes from other OBB
-    for (const auto& axis : axes_b) {
-        if (!testAxis(axis))
-            return false;
-    }
-
-    // Test cross products
-    for (const auto& axis_a : axes_a) {
-        for (const auto& axis_b : axes_b) {
-            if (!testAxis(axis_a.cross(axis_b)))
-                return false;
+    float r[3][3];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            r[i][j] = basis_[i].dot(other.basis_[j]);
         }
     }
-
-    return true;
+    const Vec3f d = other.center_ - center_;
+    const float t[3] = {d.dot(basis_[0]), d.dot(basis_[1]), d.dot(basis_[2])};
+    return satOverlap(r, t, half_extents_, other.half_extents_);
 }
 
 bool Obb::intersects(const Aabb& aabb) const noexcept {
-    Obb aabb_obb = fromAabb(aabb);
-    return intersects(aabb_obb);
+    // B's axes are the world axes, so A_i . B_j is component j of A_i
+    float r[3][3];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            r[i][j] = basis_[i][j];
+        }
+    }
+    const Vec3f d = aabb.center() - center_;
+    const float t[3] = {d.dot(basis_[0]), d.dot(basis_[1]), d.dot(basis_[2])};
+    return satOverlap(r, t, half_extents_, aabb.halfExtents());
 }
 
 // Comparison operators
@@ -315,4 +341,96 @@ std::ostream& operator<<(std::ostream& os, const Obb& obb) {
               << ", orientation: " << obb.orientation() << "]";
 }
 
+// ============================================================================
+// Batch Intersection
+// ============================================================================
+
+size_t intersects(const Obb& query, std::span<const Obb> candidates, std::span<uint8_t> out_hits) noexcept {
+    using simd::Float4;
+
+    VNE_ASSERT_MSG(out_hits.size() >= candidates.size(), "intersects: out_hits smaller than candidates");
+    const size_t count = std::min(candidates.size(), out_hits.size());
+    VNE_MATH_PROBE_SCOPE(Probe::eObbBatch, count);
+
+    const Mat3f& a = query.rotationMatrix();
+    const Vec3f& ac = query.center();
+    const Float4 ea[3] = {simd::broadcast(query.halfExtents().x()),
+                          simd::broadcast(query.halfExtents().y()),
+                          simd::broadcast(query.halfExtents().z())};
+    const Float4 eps = simd::broadcast(kParallelEpsilon);
+
+    size_t hits = 0;
+    for (size_t base = 0; base < count; base += simd::kLanes) {
+        // Pad the tail by repeating the last candidate; extra lanes are not written
+        const Obb* lanes[simd::kLanes];
+        for (size_t k = 0; k < simd::kLanes; ++k) {
+            lanes[k] = &candidates[std::min(base + k, count - 1)];
+        }
+        auto gather = [&lanes](auto&& component) {
+            return simd::set(component(*lanes[0]), component(*lanes[1]), component(*lanes[2]), component(*lanes[3]));
+        };
+
+        Float4 eb[3];
+        Float4 d[3];
+        Float4 b_axes[3][3];  // b_axes[j][k] = component k of B_j
+        for (int k = 0; k < 3; ++k) {
+            eb[k] = gather([k](const Obb& o) { return o.halfExtents()[k]; });
+            d[k] = gather([k](const Obb& o) { return o.center()[k]; }) - simd::broadcast(ac[k]);
+            for (int j = 0; j < 3; ++j) {
+                b_axes[j][k] = gather([j, k](const Obb& o) { return o.rotationMatrix()[j][k]; });
+            }
+        }
+
+        // r[i][j] = A_i . B_j and t = d in A's frame
+        Float4 r[3][3];
+        Float4 abs_r[3][3];
+        Float4 t[3];
+        for (int i = 0; i < 3; ++i) {
+            const Float4 ax = simd::broadcast(a[i][0]);
+            const Float4 ay = simd::broadcast(a[i][1]);
+            const Float4 az = simd::broadcast(a[i][2]);
+            for (int j = 0; j < 3; ++j) {
+                r[i][j] = simd::madd(ax, b_axes[j][0], simd::madd(ay, b_axes[j][1], az * b_axes[j][2]));
+                abs_r[i][j] = simd::abs(r[i][j]) + eps;
+            }
+            t[i] = simd::madd(ax, d[0], simd::madd(ay, d[1], az * d[2]));
+        }
+
+        // Mask of lanes for which a separating axis has been found
+        Float4 separated = simd::zero();
+        for (int i = 0; i < 3; ++i) {
+            const Float4 rb = simd::madd(eb[0], abs_r[i][0], simd::madd(eb[1], abs_r[i][1], eb[2] * abs_r[i][2]));
+            separated = separated | simd::cmpGt(simd::abs(t[i]), ea[i] + rb);
+        }
+        for (int j = 0; j < 3; ++j) {
+            const Float4 ra = simd::madd(ea[0], abs_r[0][j], simd::madd(ea[1], abs_r[1][j], ea[2] * abs_r[2][j]));
+            const Float4 dist = simd::madd(t[0], r[0][j], simd::madd(t[1], r[1][j], t[2] * r[2][j]));
+            separated = separated | simd::cmpGt(simd::abs(dist), ra + eb[j]);
+        }
+        if (!simd::allTrue(separated)) {
+            for (int i = 0; i < 3; ++i) {
+                const int i1 = (i + 1) % 3;
+                const int i2 = (i + 2) % 3;
+                for (int j = 0; j < 3; ++j) {
+                    const int j1 = (j + 1) % 3;
+                    const int j2 = (j + 2) % 3;
+                    const Float4 ra = simd::madd(ea[i1], abs_r[i2][j], ea[i2] * abs_r[i1][j]);
+                    const Float4 rb = simd::madd(eb[j1], abs_r[i][j2], eb[j2] * abs_r[i][j1]);
+                    const Float4 dist = t[i2] * r[i1][j] - t[i1] * r[i2][j];
+                    separated = separated | simd::cmpGt(simd::abs(dist), ra + rb);
+                }
+            }
+        }
+
+        const int separated_bits = simd::moveMask(separated);
+        const size_t block = std::min<size_t>(simd::kLanes, count - base);
+        for (size_t k = 0; k < block; ++k) {
+            const bool hit = ((separated_bits >> k) & 1) == 0;
+            out_hits[base + k] = hit ? 1 : 0;
+            hits += hit ? 1 : 0;
+        }
+    }
+    return hits;
+}
+
 }  // namespace vne::math
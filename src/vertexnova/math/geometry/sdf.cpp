@@ -0,0 +1,754 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Corresponding header
+#include "vertexnova/math/geometry/sdf.h"
+
+// Project headers
+#include "vertexnova/common/macros.h"
+#include "vertexnova/math/core/constants.h"
+#include "vertexnova/math/geometry/triangle.h"
+#include "vertexnova/math/instrumentation.h"
+#include "vertexnova/math/simd/float4.h"
+
+// Standard library includes
+#include <array>
+#include <limits>
+
+namespace vne::math {
+
+namespace {
+
+/// Triangles per BVH leaf
+constexpr uint32_t kLeafSize = 4;
+
+/// A BVH node is summarized by its dipole once the query point is this many node radii away
+constexpr float kDipoleBeta = 2.0f;
+
+constexpr float kInfinity = std::numeric_limits<float>::infinity();
+
+// ============================================================================
+// Scalar Helpers
+// ============================================================================
+
+[[nodiscard]] float length2(float x, float y) noexcept {
+    return std::sqrt(x * x + y * y);
+}
+
+[[nodiscard]] float cappedConeDistance(float qx,
+                                       float qy,
+                                       float half_height,
+                                       float bottom_radius,
+                                       float top_radius) noexcept {
+    // Quilez's capped cone in the (radial, axial) half plane
+    const float k2x = top_radius - bottom_radius;
+    const float k2y = 2.0f * half_height;
+    const float k2_sq = k2x * k2x + k2y * k2y;
+    const float inv_k2_sq = k2_sq > 0.0f ? 1.0f / k2_sq : 0.0f;
+
+    const float ca_x = qx - std::min(qx, qy < 0.0f ? bottom_radius : top_radius);
+    const float ca_y = std::abs(qy) - half_height;
+    const float t = std::clamp(((top_radius - qx) * k2x + (half_height - qy) * k2y) * inv_k2_sq, 0.0f, 1.0f);
+    const float cb_x = qx - top_radius + k2x * t;
+    const float cb_y = qy - half_height + k2y * t;
+    const float s = (cb_x < 0.0f && ca_y < 0.0f) ? -1.0f : 1.0f;
+    return s * std::sqrt(std::min(ca_x * ca_x + ca_y * ca_y, cb_x * cb_x + cb_y * cb_y));
+}
+
+[[nodiscard]] float primitiveDistance(SdfPrimitive::Type type, const Vec4f& params, const Vec3f& p) noexcept {
+    switch (type) {
+        case SdfPrimitive::Type::eSphere:
+            return sdfSphere(p, params.x());
+        case SdfPrimitive::Type::eBox:
+            return sdfBox(p, params.xyz());
+        case SdfPrimitive::Type::eRoundedBox:
+            return sdfRoundedBox(p, params.xyz(), params.w());
+        case SdfPrimitive::Type::eTorus:
+            return sdfTorus(p, params.x(), params.y());
+        case SdfPrimitive::Type::eCylinder:
+            return sdfCylinder(p, params.x(), params.y());
+        case SdfPrimitive::Type::eCone:
+            return sdfCone(p, params.x(), params.y(), params.z());
+    }
+    return kInfinity;
+}
+
+// ============================================================================
+// SIMD Lanes
+// ============================================================================
+
+/// One primitive's transform and dimensions broadcast to every lane
+struct PrimitiveLanes {
+    SdfPrimitive::Type type;
+    simd::Float4 rotation[3][3];  // rotation[row][col] of the world-to-local matrix
+    simd::Float4 center[3];
+    simd::Float4 params[4];
+    simd::Float4 cone_k2[2];      // (top - bottom, 2 * half_height)
+    simd::Float4 cone_inv_k2_sq;  // 1 / |cone_k2|^2, or 0 for a degenerate cone
+};
+
+[[nodiscard]] PrimitiveLanes makeLanes(const SdfPrimitive& primitive) noexcept {
+    PrimitiveLanes lanes;
+    lanes.type = primitive.type;
+    const Mat3f to_local = primitive.orientation.conjugate().toMatrix3();
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) {
+            lanes.rotation[r][c] = simd::broadcast(to_local[c][r]);
+        }
+        lanes.center[r] = simd::broadcast(primitive.center[r]);
+    }
+
+    Vec4f params = primitive.params;
+    if (primitive.type == SdfPrimitive::Type::eRoundedBox) {
+        params.w() = std::clamp(params.w(), 0.0f, std::min({params.x(), params.y(), params.z()}));
+    }
+    for (int k = 0; k < 4; ++k) {
+        lanes.params[k] = simd::broadcast(params[k]);
+    }
+
+    const float k2x = params.z() - params.y();
+    const float k2y = 2.0f * params.x();
+    const float k2_sq = k2x * k2x + k2y * k2y;
+    lanes.cone_k2[0] = simd::broadcast(k2x);
+    lanes.cone_k2[1] = simd::broadcast(k2y);
+    lanes.cone_inv_k2_sq = simd::broadcast(k2_sq > 0.0f ? 1.0f / k2_sq : 0.0f);
+    return lanes;
+}
+
+[[nodiscard]] simd::Float4 length3(simd::Float4 x, simd::Float4 y, simd::Float4 z) noexcept {
+    return simd::sqrt(simd::madd(x, x, simd::madd(y, y, z * z)));
+}
+
+/// Box distance from the per-axis excess q = |p| - half_extents
+[[nodiscard]] simd::Float4 boxFromExcess(simd::Float4 qx, simd::Float4 qy, simd::Float4 qz) noexcept {
+    const simd::Float4 zero = simd::zero();
+    const simd::Float4 outside = length3(simd::max(qx, zero), simd::max(qy, zero), simd::max(qz, zero));
+    return outside + simd::min(simd::max(qx, simd::max(qy, qz)), zero);
+}
+
+/// Mirrors the scalar sdf*() functions lane by lane
+[[nodiscard]] simd::Float4 distanceLanes(const PrimitiveLanes& lanes,
+                                         simd::Float4 wx,
+                                         simd::Float4 wy,
+                                         simd::Float4 wz) noexcept {
+    using simd::Float4;
+
+    const Float4 dx = wx - lanes.center[0];
+    const Float4 dy = wy - lanes.center[1];
+    const Float4 dz = wz - lanes.center[2];
+    const auto& m = lanes.rotation;
+    const Float4 x = simd::madd(m[0][0], dx, simd::madd(m[0][1], dy, m[0][2] * dz));
+    const Float4 y = simd::madd(m[1][0], dx, simd::madd(m[1][1], dy, m[1][2] * dz));
+    const Float4 z = simd::madd(m[2][0], dx, simd::madd(m[2][1], dy, m[2][2] * dz));
+    const Float4 zero = simd::zero();
+
+    switch (lanes.type) {
+        case SdfPrimitive::Type::eSphere:
+            return length3(x, y, z) - lanes.params[0];
+        case SdfPrimitive::Type::eBox:
+            return boxFromExcess(simd::abs(x) - lanes.params[0],
+                                 simd::abs(y) - lanes.params[1],
+                                 simd::abs(z) - lanes.params[2]);
+        case SdfPrimitive::Type::eRoundedBox: {
+            const Float4 r = lanes.params[3];
+            return boxFromExcess(simd::abs(x) - lanes.params[0] + r,
+                                 simd::abs(y) - lanes.params[1] + r,
+                                 simd::abs(z) - lanes.params[2] + r) -
+                   r;
+        }
+        case SdfPrimitive::Type::eTorus: {
+            const Float4 qx = simd::sqrt(simd::madd(x, x, z * z)) - lanes.params[0];
+            return simd::sqrt(simd::madd(qx, qx, y * y)) - lanes.params[1];
+        }
+        case SdfPrimitive::Type::eCylinder: {
+            const Float4 qx = simd::sqrt(simd::madd(x, x, z * z)) - lanes.params[1];
+            const Float4 qy = simd::abs(y) - lanes.params[0];
+            const Float4 ox = simd::max(qx, zero);
+            const Float4 oy = simd::max(qy, zero);
+            return simd::min(simd::max(qx, qy), zero) + simd::sqrt(simd::madd(ox, ox, oy * oy));
+        }
+        case SdfPrimitive::Type::eCone: {
+            const Float4 h = lanes.params[0];
+            const Float4 bottom = lanes.params[1];
+            const Float4 top = lanes.params[2];
+            const Float4 qx = simd::sqrt(simd::madd(x, x, z * z));
+            const Float4 qy = y;
+
+            const Float4 cap_radius = simd::select(simd::cmpLt(qy, zero), bottom, top);
+            const Float4 ca_x = qx - simd::min(qx, cap_radius);
+            const Float4 ca_y = simd::abs(qy) - h;
+            const Float4 proj = simd::madd(top - qx, lanes.cone_k2[0], (h - qy) * lanes.cone_k2[1]);
+            const Float4 t = simd::min(simd::max(proj * lanes.cone_inv_k2_sq, zero), simd::broadcast(1.0f));
+            const Float4 cb_x = simd::madd(lanes.cone_k2[0], t, qx - top);
+            const Float4 cb_y = simd::madd(lanes.cone_k2[1], t, qy - h);
+            const Float4 inside = simd::cmpLt(cb_x, zero) & simd::cmpLt(ca_y, zero);
+            const Float4 s = simd::select(inside, simd::broadcast(-1.0f), simd::broadcast(1.0f));
+            return s * simd::sqrt(simd::min(simd::madd(ca_x, ca_x, ca_y * ca_y), simd::madd(cb_x, cb_x, cb_y * cb_y)));
+        }
+    }
+    return simd::broadcast(kInfinity);
+}
+
+[[nodiscard]] simd::Float4 smoothUnionLanes(simd::Float4 a, simd::Float4 b, float k) noexcept {
+    if (k <= 0.0f) {
+        return simd::min(a, b);
+    }
+    const simd::Float4 kk = simd::broadcast(k);
+    const simd::Float4 h = simd::max(kk - simd::abs(a - b), simd::zero()) * simd::broadcast(1.0f / k);
+    return simd::min(a, b) - h * h * kk * simd::broadcast(0.25f);
+}
+
+/**
+ * Runs @p kernel over the points four at a time.
+ *
+ * The kernel maps the x, y, z registers of four points to their distances.
+ * A partial last block is padded with copies of its final point.
+ */
+template <typename Kernel>
+void forEachBlock(std::span<const Vec3f> points, std::span<float> out, Kernel&& kernel) noexcept {
+    VNE_ASSERT_MSG(out.size() >= points.size(), "evaluate: output span is smaller than the point span");
+    const size_t count = std::min(points.size(), out.size());
+    VNE_MATH_PROBE_SCOPE(Probe::eSdfEvaluate, count);
+    const float* src = reinterpret_cast<const float*>(points.data());
+
+    size_t i = 0;
+    for (; i + simd::kLanes <= count; i += simd::kLanes) {
+        simd::Float4 x;
+        simd::Float4 y;
+        simd::Float4 z;
+        simd::loadXyz(src + 3 * i, x, y, z);
+        simd::store(out.data() + i, kernel(x, y, z));
+    }
+    if (i < count) {
+        std::array<Vec3f, simd::kLanes> tail;
+        for (size_t k = 0; k < tail.size(); ++k) {
+            tail[k] = points[std::min(i + k, count - 1)];
+        }
+        simd::Float4 x;
+        simd::Float4 y;
+        simd::Float4 z;
+        simd::loadXyz(reinterpret_cast<const float*>(tail.data()), x, y, z);
+        alignas(16) float result[simd::kLanes];
+        simd::store(result, kernel(x, y, z));
+        std::copy(result, result + (count - i), out.data() + i);
+    }
+}
+
+// ============================================================================
+// Mesh BVH
+// ============================================================================
+
+/// Squared distance from p to a triangle by Voronoi regions (Ericson 5.1.5), without barycentric solves
+[[nodiscard]] float squaredDistanceToTriangle(const Vec3f& p, const Triangle& tri) noexcept {
+    const Vec3f ab = tri.v1 - tri.v0;
+    const Vec3f ac = tri.v2 - tri.v0;
+    const Vec3f ap = p - tri.v0;
+    const float d1 = ab.dot(ap);
+    const float d2 = ac.dot(ap);
+    if (d1 <= 0.0f && d2 <= 0.0f) {
+        return ap.lengthSquared();
+    }
+    const Vec3f bp = p - tri.v1;
+    const float d3 = ab.dot(bp);
+    const float d4 = ac.dot(bp);
+    if (d3 >= 0.0f && d4 <= d3) {
+        return bp.lengthSquared();
+    }
+    const float vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+        return (ap - ab * (d1 / (d1 - d3))).lengthSquared();
+    }
+    const Vec3f cp = p - tri.v2;
+    const float d5 = ab.dot(cp);
+    const float d6 = ac.dot(cp);
+    if (d6 >= 0.0f && d5 <= d6) {
+        return cp.lengthSquared();
+    }
+    const float vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+        return (ap - ac * (d2 / (d2 - d6))).lengthSquared();
+    }
+    const float va = d3 * d6 - d5 * d4;
+    if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
+        return (bp - (tri.v2 - tri.v1) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)))).lengthSquared();
+    }
+    const float denom = va + vb + vc;
+    if (!(denom > 0.0f)) {
+        return tri.squaredDistanceToPoint(p);  // Degenerate triangle
+    }
+    const float v = vb / denom;
+    const float w = vc / denom;
+    return (ap - ab * v - ac * w).lengthSquared();
+}
+
+/**
+ * BVH over a triangle soup with the moments needed for fast winding numbers.
+ *
+ * Each node keeps the area-weighted normal sum of its triangles and the
+ * area-weighted centroid, so a distant node acts as a single dipole
+ * (Barill et al. 2018, first-order term).
+ */
+class MeshBvh {
+   public:
+    MeshBvh(std::span<const Vec3f> vertices, std::span<const uint32_t> indices) {
+        const size_t triangle_count = indices.size() / 3;
+        triangles_.reserve(triangle_count);
+        for (size_t t = 0; t < triangle_count; ++t) {
+            const uint32_t a = indices[3 * t + 0];
+            const uint32_t b = indices[3 * t + 1];
+            const uint32_t c = indices[3 * t + 2];
+            if (a >= vertices.size() || b >= vertices.size() || c >= vertices.size()) {
+                VNE_ASSERT_MSG(false, "SdfVolume::bake: triangle index out of range");
+                continue;
+            }
+            triangles_.emplace_back(vertices[a], vertices[b], vertices[c]);
+        }
+        if (!triangles_.empty()) {
+            nodes_.reserve(2 * triangles_.size() / kLeafSize + 1);
+            build(0, static_cast<uint32_t>(triangles_.size()));
+        }
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return triangles_.empty(); }
+
+    [[nodiscard]] Aabb bounds() const noexcept { return nodes_.empty() ? Aabb() : nodes_[0].bounds; }
+
+    /// Squared distance to the closest triangle
+    [[nodiscard]] float closestSquaredDistance(const Vec3f& p) const noexcept {
+        float best = kInfinity;
+        uint32_t stack[64];
+        uint32_t top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+            const Node& node = nodes_[stack[--top]];
+            if (node.bounds.squaredDistanceToPoint(p) >= best) {
+                continue;
+            }
+            if (node.right == 0) {
+                for (uint32_t t = node.first; t < node.first + node.count; ++t) {
+                    best = std::min(best, squaredDistanceToTriangle(p, triangles_[t]));
+                }
+                continue;
+            }
+            // Visit the nearer child first so its hits prune the other
+            const uint32_t left = static_cast<uint32_t>(&node - nodes_.data()) + 1;
+            const float d_left = nodes_[left].bounds.squaredDistanceToPoint(p);
+            const float d_right = nodes_[node.right].bounds.squaredDistanceToPoint(p);
+            if (d_left < d_right) {
+                stack[top++] = node.right;
+                stack[top++] = left;
+            } else {
+                stack[top++] = left;
+                stack[top++] = node.right;
+            }
+        }
+        return best;
+    }
+
+    /// Generalized winding number: about 1 inside a closed mesh, 0 outside
+    [[nodiscard]] float windingNumber(const Vec3f& p) const noexcept {
+        float solid_angle = 0.0f;
+        uint32_t stack[64];
+        uint32_t top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+            const uint32_t index = stack[--top];
+            const Node& node = nodes_[index];
+            const Vec3f r = node.dipole_center - p;
+            const float dist_sq = r.lengthSquared();
+            if (dist_sq > kDipoleBeta * kDipoleBeta * node.radius * node.radius) {
+                solid_angle += r.dot(node.area_normal) / (dist_sq * std::sqrt(dist_sq));
+                continue;
+            }
+            if (node.right == 0) {
+                for (uint32_t t = node.first; t < node.first + node.count; ++t) {
+                    solid_angle += triangleSolidAngle(triangles_[t], p);
+                }
+                continue;
+            }
+            stack[top++] = index + 1;
+            stack[top++] = node.right;
+        }
+        return solid_angle / (4.0f * kPi);
+    }
+
+   private:
+    struct Node {
+        Aabb bounds;
+        Vec3f area_normal;    // Sum of 0.5 * cross(e1, e2) over the triangles
+        Vec3f dipole_center;  // Area-weighted centroid
+        float radius{0.0f};   // Largest distance from dipole_center to a vertex
+        uint32_t first{0};
+        uint32_t count{0};
+        uint32_t right{0};    // Index of the right child; the left child follows its parent; 0 for leaves
+    };
+
+    /// Van Oosterom and Strackee's signed solid angle of a triangle seen from p
+    [[nodiscard]] static float triangleSolidAngle(const Triangle& tri, const Vec3f& p) noexcept {
+        const Vec3f a = tri.v0 - p;
+        const Vec3f b = tri.v1 - p;
+        const Vec3f c = tri.v2 - p;
+        const float la = a.length();
+        const float lb = b.length();
+        const float lc = c.length();
+        const float det = a.dot(b.cross(c));
+        const float denom = la * lb * lc + a.dot(b) * lc + a.dot(c) * lb + b.dot(c) * la;
+        return 2.0f * std::atan2(det, denom);
+    }
+
+    /// Builds the subtree over triangles_[first, first + count) by median split on the widest centroid axis
+    uint32_t build(uint32_t first, uint32_t count) {
+        const auto index = static_cast<uint32_t>(nodes_.size());
+        nodes_.emplace_back();
+
+        Aabb bounds;
+        Aabb centroid_bounds;
+        Vec3f area_normal = Vec3f::zero();
+        Vec3f weighted_center = Vec3f::zero();
+        float area_sum = 0.0f;
+        for (uint32_t t = first; t < first + count; ++t) {
+            const Triangle& tri = triangles_[t];
+            bounds.expand(tri.v0);
+            bounds.expand(tri.v1);
+            bounds.expand(tri.v2);
+            centroid_bounds.expand(tri.centroid());
+            const Vec3f n = tri.normal() * 0.5f;
+            const float area = n.length();
+            area_normal += n;
+            weighted_center += tri.centroid() * area;
+            area_sum += area;
+        }
+        const Vec3f dipole_center = area_sum > 0.0f ? weighted_center / area_sum : bounds.center();
+        float radius_sq = 0.0f;
+        for (uint32_t t = first; t < first + count; ++t) {
+            const Triangle& tri = triangles_[t];
+            radius_sq = std::max({radius_sq,
+                                  (tri.v0 - dipole_center).lengthSquared(),
+                                  (tri.v1 - dipole_center).lengthSquared(),
+                                  (tri.v2 - dipole_center).lengthSquared()});
+        }
+
+        uint32_t right = 0;
+        if (count > kLeafSize) {
+            const Vec3f extent = centroid_bounds.size();
+            int axis = 0;
+            if (extent.y() > extent[axis]) {
+                axis = 1;
+            }
+            if (extent.z() > extent[axis]) {
+                axis = 2;
+            }
+            const uint32_t half = count / 2;
+            std::nth_element(triangles_.begin() + first,
+                             triangles_.begin() + first + half,
+                             triangles_.begin() + first + count,
+                             [axis](const Triangle& lhs, const Triangle& rhs) {
+                                 return lhs.centroid()[axis] < rhs.centroid()[axis];
+                             });
+            build(first, half);
+            right = build(first + half, count - half);
+        }
+
+        Node& node = nodes_[index];
+        node.bounds = bounds;
+        node.area_normal = area_normal;
+        node.dipole_center = dipole_center;
+        node.radius = std::sqrt(radius_sq);
+        node.first = first;
+        node.count = count;
+        node.right = right;
+        return index;
+    }
+
+    std::vector<Triangle> triangles_;
+    std::vector<Node> nodes_;
+};
+
+/**
+ * Signed distances along a row of @p count samples starting at @p start, @p step apart in X.
+ *
+ * No surface lies closer to a sample than its unsigned distance, so when that
+ * distance exceeds the step the next sample is on the same side and reuses the
+ * sign. Only samples near the surface pay for a winding-number query.
+ */
+void signedDistanceRow(const MeshBvh& bvh, const Vec3f& start, float step, uint32_t count, float* out) noexcept {
+    float previous = 0.0f;
+    bool inside = false;
+    for (uint32_t x = 0; x < count; ++x) {
+        const Vec3f p = start + Vec3f(step * static_cast<float>(x), 0.0f, 0.0f);
+        const float distance = std::sqrt(bvh.closestSquaredDistance(p));
+        if (x == 0 || previous <= step) {
+            inside = bvh.windingNumber(p) > 0.5f;
+        }
+        out[x] = inside ? -distance : distance;
+        previous = distance;
+    }
+}
+
+/// Trilinear interpolation in a grid with x-fastest strides (1, sy, sz)
+[[nodiscard]] float trilinear(const float* base, size_t sy, size_t sz, float fx, float fy, float fz) noexcept {
+    const float c00 = lerp(base[0], base[1], fx);
+    const float c10 = lerp(base[sy], base[sy + 1], fx);
+    const float c01 = lerp(base[sz], base[sz + 1], fx);
+    const float c11 = lerp(base[sz + sy], base[sz + sy + 1], fx);
+    return lerp(lerp(c00, c10, fy), lerp(c01, c11, fy), fz);
+}
+
+}  // namespace
+
+// ============================================================================
+// Primitives
+// ============================================================================
+
+float sdfSphere(const Vec3f& p, float radius) noexcept {
+    return p.length() - radius;
+}
+
+float sdfBox(const Vec3f& p, const Vec3f& half_extents) noexcept {
+    const Vec3f q = p.abs() - half_extents;
+    const Vec3f outside = Vec3f::max(q, Vec3f::zero());
+    return outside.length() + std::min(std::max({q.x(), q.y(), q.z()}), 0.0f);
+}
+
+float sdfRoundedBox(const Vec3f& p, const Vec3f& half_extents, float radius) noexcept {
+    const float r = std::clamp(radius, 0.0f, std::min({half_extents.x(), half_extents.y(), half_extents.z()}));
+    return sdfBox(p, half_extents - Vec3f(r, r, r)) - r;
+}
+
+float sdfTorus(const Vec3f& p, float major_radius, float minor_radius) noexcept {
+    return length2(length2(p.x(), p.z()) - major_radius, p.y()) - minor_radius;
+}
+
+float sdfCylinder(const Vec3f& p, float half_height, float radius) noexcept {
+    const float qx = length2(p.x(), p.z()) - radius;
+    const float qy = std::abs(p.y()) - half_height;
+    return std::min(std::max(qx, qy), 0.0f) + length2(std::max(qx, 0.0f), std::max(qy, 0.0f));
+}
+
+float sdfCone(const Vec3f& p, float half_height, float bottom_radius, float top_radius) noexcept {
+    return cappedConeDistance(length2(p.x(), p.z()), p.y(), half_height, bottom_radius, top_radius);
+}
+
+// ============================================================================
+// Placed Primitives and Batch Evaluation
+// ============================================================================
+
+SdfPrimitive SdfPrimitive::sphere(const Vec3f& center, float radius) noexcept {
+    return {Type::eSphere, center, Quatf::identity(), Vec4f(radius, 0.0f, 0.0f, 0.0f)};
+}
+
+SdfPrimitive SdfPrimitive::box(const Vec3f& center, const Vec3f& half_extents, const Quatf& orientation) noexcept {
+    return {Type::eBox, center, orientation, Vec4f(half_extents, 0.0f)};
+}
+
+SdfPrimitive SdfPrimitive::roundedBox(const Vec3f& center,
+                                      const Vec3f& half_extents,
+                                      float radius,
+                                      const Quatf& orientation) noexcept {
+    return {Type::eRoundedBox, center, orientation, Vec4f(half_extents, radius)};
+}
+
+SdfPrimitive SdfPrimitive::torus(const Vec3f& center,
+                                 float major_radius,
+                                 float minor_radius,
+                                 const Quatf& orientation) noexcept {
+    return {Type::eTorus, center, orientation, Vec4f(major_radius, minor_radius, 0.0f, 0.0f)};
+}
+
+SdfPrimitive SdfPrimitive::cylinder(const Vec3f& center,
+                                    float half_height,
+                                    float radius,
+                                    const Quatf& orientation) noexcept {
+    return {Type::eCylinder, center, orientation, Vec4f(half_height, radius, 0.0f, 0.0f)};
+}
+
+SdfPrimitive SdfPrimitive::cone(const Vec3f& center,
+                                float half_height,
+                                float bottom_radius,
+                                float top_radius,
+                                const Quatf& orientation) noexcept {
+    return {Type::eCone, center, orientation, Vec4f(half_height, bottom_radius, top_radius, 0.0f)};
+}
+
+float SdfPrimitive::distance(const Vec3f& point) const noexcept {
+    return primitiveDistance(type, params, orientation.conjugate().rotate(point - center));
+}
+
+void evaluate(const SdfPrimitive& primitive, std::span<const Vec3f> points, std::span<float> out) noexcept {
+    const PrimitiveLanes lanes = makeLanes(primitive);
+    forEachBlock(points, out, [&lanes](simd::Float4 x, simd::Float4 y, simd::Float4 z) {
+        return distanceLanes(lanes, x, y, z);
+    });
+}
+
+void evaluate(std::span<const SdfPrimitive> primitives,
+              std::span<const Vec3f> points,
+              std::span<float> out,
+              float smoothness) noexcept {
+    std::vector<PrimitiveLanes> lanes;
+    lanes.reserve(primitives.size());
+    for (const SdfPrimitive& primitive : primitives) {
+        lanes.push_back(makeLanes(primitive));
+    }
+    forEachBlock(points, out, [&lanes, smoothness](simd::Float4 x, simd::Float4 y, simd::Float4 z) {
+        simd::Float4 result = simd::broadcast(kInfinity);
+        for (const PrimitiveLanes& primitive : lanes) {
+            result = smoothUnionLanes(result, distanceLanes(primitive, x, y, z), smoothness);
+        }
+        return result;
+    });
+}
+
+// ============================================================================
+// Sparse Brick Volumes
+// ============================================================================
+
+SdfVolume SdfVolume::bake(std::span<const Vec3f> vertices,
+                          std::span<const uint32_t> indices,
+                          const SdfBakeSettings& settings) {
+    VNE_ASSERT_MSG(settings.voxel_size > 0.0f, "SdfVolume::bake: voxel_size must be positive");
+    VNE_ASSERT_MSG(settings.brick_size > 0, "SdfVolume::bake: brick_size must be positive");
+    VNE_ASSERT_MSG(indices.size() % 3 == 0, "SdfVolume::bake: index count must be a multiple of 3");
+    if (!(settings.voxel_size > 0.0f) || settings.brick_size == 0) {
+        return {};
+    }
+    const MeshBvh bvh(vertices, indices);
+    if (bvh.empty()) {
+        return {};
+    }
+
+    SdfVolume volume;
+    volume.voxel_size_ = settings.voxel_size;
+    volume.brick_size_ = settings.brick_size;
+
+    // Round the padded mesh bounds up to whole bricks, keeping them centered
+    const float padding = std::max(settings.padding, 0.0f);
+    const Aabb mesh_bounds = bvh.bounds();
+    const Vec3f padded_size = mesh_bounds.size() + Vec3f(2.0f * padding, 2.0f * padding, 2.0f * padding);
+    const float brick_extent = settings.voxel_size * static_cast<float>(settings.brick_size);
+    Vec3f grid_size;
+    for (int k = 0; k < 3; ++k) {
+        volume.bricks_[k] = std::max(1u, static_cast<uint32_t>(std::ceil(padded_size[k] / brick_extent)));
+        grid_size[k] = brick_extent * static_cast<float>(volume.bricks_[k]);
+    }
+    volume.bounds_ = Aabb::fromCenterAndSize(mesh_bounds.center(), grid_size);
+    const Vec3f origin = volume.bounds_.min();
+
+    // Coarse field at the brick corners, used outside the narrow band
+    const uint32_t cx = volume.bricks_[0] + 1;
+    const uint32_t cy = volume.bricks_[1] + 1;
+    const uint32_t cz = volume.bricks_[2] + 1;
+    volume.corners_.resize(static_cast<size_t>(cx) * cy * cz);
+    for (uint32_t z = 0; z < cz; ++z) {
+        for (uint32_t y = 0; y < cy; ++y) {
+            const Vec3f start = origin + Vec3f(0.0f, static_cast<float>(y), static_cast<float>(z)) * brick_extent;
+            float* row = volume.corners_.data() + (static_cast<size_t>(z) * cy + y) * cx;
+            signedDistanceRow(bvh, start, brick_extent, cx, row);
+        }
+    }
+
+    // Distance is 1-Lipschitz, so a brick whose center is farther than its
+    // half diagonal plus the band cannot contain a point inside the band.
+    const uint32_t side = settings.brick_size + 1;
+    const size_t brick_samples = static_cast<size_t>(side) * side * side;
+    const float half_diagonal = 0.5f * brick_extent * std::sqrt(3.0f);
+    const float band = std::max(settings.narrow_band, 0.0f);
+    volume.brick_index_.assign(static_cast<size_t>(volume.bricks_[0]) * volume.bricks_[1] * volume.bricks_[2], -1);
+    int32_t allocated = 0;
+    for (uint32_t bz = 0; bz < volume.bricks_[2]; ++bz) {
+        for (uint32_t by = 0; by < volume.bricks_[1]; ++by) {
+            for (uint32_t bx = 0; bx < volume.bricks_[0]; ++bx) {
+                const Vec3f brick_min =
+                    origin +
+                    Vec3f(static_cast<float>(bx), static_cast<float>(by), static_cast<float>(bz)) * brick_extent;
+                const Vec3f brick_center = brick_min + Vec3f(0.5f, 0.5f, 0.5f) * brick_extent;
+                if (std::sqrt(bvh.closestSquaredDistance(brick_center)) > half_diagonal + band) {
+                    continue;
+                }
+
+                volume.brick_index_[(static_cast<size_t>(bz) * volume.bricks_[1] + by) * volume.bricks_[0] + bx] =
+                    allocated++;
+                const size_t base = volume.samples_.size();
+                volume.samples_.resize(base + brick_samples);
+                for (uint32_t z = 0; z < side; ++z) {
+                    for (uint32_t y = 0; y < side; ++y) {
+                        const Vec3f start =
+                            brick_min + Vec3f(0.0f, static_cast<float>(y), static_cast<float>(z)) * settings.voxel_size;
+                        signedDistanceRow(bvh,
+                                          start,
+                                          settings.voxel_size,
+                                          side,
+                                          volume.samples_.data() + base + (static_cast<size_t>(z) * side + y) * side);
+                    }
+                }
+            }
+        }
+    }
+    return volume;
+}
+
+float SdfVolume::sample(const Vec3f& point) const noexcept {
+    if (empty()) {
+        return std::numeric_limits<float>::max();
+    }
+
+    const Vec3f clamped = Vec3f::max(Vec3f::min(point, bounds_.max()), bounds_.min());
+    const float outside = (point - clamped).length();
+
+    // Position in brick units
+    const float brick_extent = voxel_size_ * static_cast<float>(brick_size_);
+    const Vec3f g = (clamped - bounds_.min()) / brick_extent;
+    uint32_t brick[3];
+    float f[3];
+    for (int k = 0; k < 3; ++k) {
+        brick[k] = std::min(static_cast<uint32_t>(std::max(g[k], 0.0f)), bricks_[k] - 1);
+        f[k] = std::clamp(g[k] - static_cast<float>(brick[k]), 0.0f, 1.0f);
+    }
+
+    const int32_t block = brick_index_[(static_cast<size_t>(brick[2]) * bricks_[1] + brick[1]) * bricks_[0] + brick[0]];
+    if (block < 0) {
+        const size_t cx = bricks_[0] + 1;
+        const size_t cy = bricks_[1] + 1;
+        const float* base = corners_.data() + (brick[2] * cy + brick[1]) * cx + brick[0];
+        return trilinear(base, cx, cx * cy, f[0], f[1], f[2]) + outside;
+    }
+
+    const size_t side = brick_size_ + 1;
+    size_t cell[3];
+    float t[3];
+    for (int k = 0; k < 3; ++k) {
+        const float local = f[k] * static_cast<float>(brick_size_);
+        cell[k] = std::min(static_cast<size_t>(local), static_cast<size_t>(brick_size_ - 1));
+        t[k] = std::clamp(local - static_cast<float>(cell[k]), 0.0f, 1.0f);
+    }
+    const float* base =
+        samples_.data() + static_cast<size_t>(block) * side * side * side + (cell[2] * side + cell[1]) * side + cell[0];
+    return trilinear(base, side, side * side, t[0], t[1], t[2]) + outside;
+}
+
+void SdfVolume::sample(std::span<const Vec3f> points, std::span<float> out) const noexcept {
+    VNE_ASSERT_MSG(out.size() >= points.size(), "SdfVolume::sample: output span is smaller than the point span");
+    const size_t count = std::min(points.size(), out.size());
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = sample(points[i]);
+    }
+}
+
+size_t SdfVolume::allocatedBrickCount() const noexcept {
+    const size_t side = brick_size_ + 1;
+    return side == 1 ? 0 : samples_.size() / (side * side * side);
+}
+
+size_t SdfVolume::memoryUsage() const noexcept {
+    return samples_.size() * sizeof(float) + corners_.size() * sizeof(float) + brick_index_.size() * sizeof(int32_t);
+}
+
+}  // namespace vne::math
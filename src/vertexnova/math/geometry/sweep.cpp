@@ -0,0 +1,492 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Corresponding header
+#include "vertexnova/math/geometry/sweep.h"
+
+// Project headers
+#include "vertexnova/common/macros.h"
+#include "vertexnova/math/instrumentation.h"
+#include "vertexnova/math/simd/float4.h"
+
+// Standard library includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace vne::math {
+
+namespace {
+
+/// Conservative advancement gives up after this many steps (it normally needs < 5).
+constexpr uint32_t kToiMaxIterations = 32;
+
+/// A motion this close to parallel to an edge (sine squared) cannot hit the edge's side.
+constexpr float kParallelEdgeEpsilon = 1e-8f;
+
+constexpr float kInfinity = std::numeric_limits<float>::infinity();
+
+/// Earliest t in [0, 1] at which origin + motion * t comes within radius of point, or -1.
+/// The start is assumed to be outside the radius.
+float sweepSpherePoint(const Vec3f& origin, const Vec3f& motion, const Vec3f& point, float radius) noexcept {
+    const Vec3f m = origin - point;
+    const float a = motion.lengthSquared();
+    const float b = m.dot(motion);
+    if (b >= 0.0f || a <= std::numeric_limits<float>::min()) {
+        return -1.0f;  // Moving away, or not moving
+    }
+    const float c = m.lengthSquared() - radius * radius;
+    const float discriminant = b * b - a * c;
+    if (discriminant < 0.0f) {
+        return -1.0f;
+    }
+    const float t = (-b - std::sqrt(discriminant)) / a;
+    return t <= 1.0f ? std::max(t, 0.0f) : -1.0f;
+}
+
+/// Earliest t in [0, 1] at which origin + motion * t comes within radius of the side of
+/// segment p-q (the ends are left to sweepSpherePoint), or -1.
+float sweepSphereEdge(const Vec3f& origin,
+                      const Vec3f& motion,
+                      const Vec3f& p,
+                      const Vec3f& q,
+                      float radius,
+                      Vec3f& out_point) noexcept {
+    const Vec3f d = q - p;
+    const Vec3f m = origin - p;
+    const float dd = d.dot(d);
+    const float md = m.dot(d);
+    const float nd = motion.dot(d);
+    const float nn = motion.dot(motion);
+
+    // Quadratic in t for the distance to the infinite line, scaled by dd
+    const float a = dd * nn - nd * nd;
+    if (a <= kParallelEdgeEpsilon * dd * nn) {
+        return -1.0f;
+    }
+    const float b = dd * motion.dot(m) - nd * md;
+    const float c = dd * m.dot(m) - md * md - radius * radius * dd;
+    if (b >= 0.0f || c <= 0.0f) {
+        return -1.0f;  // Moving away from the line, or already within reach of it past an end
+    }
+    const float discriminant = b * b - a * c;
+    if (discriminant < 0.0f) {
+        return -1.0f;
+    }
+    const float t = (-b - std::sqrt(discriminant)) / a;
+    if (t > 1.0f) {
+        return -1.0f;
+    }
+    const float s = (md + t * nd) / dd;
+    if (s < 0.0f || s > 1.0f) {
+        return -1.0f;
+    }
+    out_point = p + d * s;
+    return t;
+}
+
+/// Bounds of a sphere moving over the given part of its motion.
+void sweptBounds(const Vec3f& center, const Vec3f& motion, float radius, Vec3f& out_min, Vec3f& out_max) noexcept {
+    const Vec3f end = center + motion;
+    const Vec3f r(radius, radius, radius);
+    out_min = center.componentMin(end) - r;
+    out_max = center.componentMax(end) + r;
+}
+
+/// True if the box [min_a, max_a] overlaps [min_b, max_b].
+bool boundsOverlap(const Vec3f& min_a, const Vec3f& max_a, const Vec3f& min_b, const Vec3f& max_b) noexcept {
+    return min_a.x() <= max_b.x() && max_a.x() >= min_b.x() && min_a.y() <= max_b.y() && max_a.y() >= min_b.y()
+           && min_a.z() <= max_b.z() && max_a.z() >= min_b.z();
+}
+
+/**
+ * Slab test of one moving box against four obstacles, one per SIMD lane.
+ *
+ * Obstacles are read as floats 0-3 and 2-5 and transposed, as in the AABB
+ * batch transform. Lanes that hit earlier than @p best_time replace it and
+ * their index. The arithmetic matches the scalar sweep() exactly, so the
+ * scalar re-run on the winner agrees.
+ */
+void sweepAabbBlock(const Aabb* obstacles,
+                    simd::Float4 first_index,
+                    const Vec3f& center,
+                    const Vec3f& half,
+                    const Vec3f& motion,
+                    simd::Float4& best_time,
+                    simd::Float4& best_index) noexcept {
+    using simd::Float4;
+
+    const float* o[simd::kLanes];
+    for (int k = 0; k < simd::kLanes; ++k) {
+        o[k] = reinterpret_cast<const float*>(&obstacles[k]);
+    }
+    Float4 lo[3];
+    Float4 hi[3];
+    Float4 max_x_low = simd::load(o[3]);
+    lo[0] = simd::load(o[0]);
+    lo[1] = simd::load(o[1]);
+    lo[2] = simd::load(o[2]);
+    simd::transpose(lo[0], lo[1], lo[2], max_x_low);
+    Float4 min_z_high = simd::load(o[0] + 2);
+    hi[0] = simd::load(o[1] + 2);
+    hi[1] = simd::load(o[2] + 2);
+    hi[2] = simd::load(o[3] + 2);
+    simd::transpose(min_z_high, hi[0], hi[1], hi[2]);
+
+    Float4 enter = simd::zero();
+    Float4 exit = simd::broadcast(1.0f);
+    for (int k = 0; k < 3; ++k) {
+        const Float4 lo_k = lo[k] - simd::broadcast(half[k]) - simd::broadcast(center[k]);
+        const Float4 hi_k = hi[k] + simd::broadcast(half[k]) - simd::broadcast(center[k]);
+        if (motion[k] != 0.0f) {
+            const Float4 inv = simd::broadcast(1.0f / motion[k]);
+            const Float4 t0 = lo_k * inv;
+            const Float4 t1 = hi_k * inv;
+            enter = simd::max(enter, simd::min(t0, t1));
+            exit = simd::min(exit, simd::max(t0, t1));
+        } else {
+            const Float4 inside = simd::cmpLe(lo_k, simd::zero()) & simd::cmpGe(hi_k, simd::zero());
+            exit = simd::select(inside, exit, simd::broadcast(-1.0f));
+        }
+    }
+
+    const Float4 hit = simd::cmpLe(enter, exit) & simd::cmpLt(enter, best_time);
+    best_time = simd::select(hit, enter, best_time);
+    best_index = simd::select(hit, first_index, best_index);
+}
+
+template <typename Body, typename Sweep>
+size_t sweepBodies(std::span<const Body> bodies,
+                   std::span<const Vec3f> motions,
+                   std::span<SweepHit> out,
+                   Sweep&& sweep_one) noexcept {
+    VNE_ASSERT_MSG(motions.size() >= bodies.size() && out.size() >= bodies.size(),
+                   "sweep: motions or out smaller than bodies");
+    const size_t count = std::min({bodies.size(), motions.size(), out.size()});
+    VNE_MATH_PROBE_SCOPE(Probe::eSweep, count);
+
+    size_t hits = 0;
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = sweep_one(bodies[i], motions[i]);
+        hits += out[i].valid() ? 1 : 0;
+    }
+    return hits;
+}
+
+}  // namespace
+
+// ============================================================================
+// Swept Sphere
+// ============================================================================
+
+SweepHit sweep(const Sphere& sphere, const Vec3f& motion, const Triangle& triangle) noexcept {
+    const Vec3f& center = sphere.center();
+    const float radius = sphere.radius();
+
+    // Already touching
+    const Vec3f closest = triangle.closestPoint(center);
+    const Vec3f offset = center - closest;
+    const float dist_sq = offset.lengthSquared();
+    Vec3f normal = triangle.unitNormal();
+    if (dist_sq <= radius * radius) {
+        SweepHit hit;
+        hit.time = 0.0f;
+        hit.point = closest;
+        if (dist_sq > 0.0f) {
+            hit.normal = offset / std::sqrt(dist_sq);
+        } else {
+            hit.normal = normal.dot(motion) > 0.0f ? -normal : normal;
+        }
+        return hit;
+    }
+
+    // Face: the sphere reaches the plane at a point inside the triangle
+    float plane_dist = offset.dot(normal);
+    if (plane_dist < 0.0f) {
+        normal = -normal;
+        plane_dist = -plane_dist;
+    }
+    const float approach = -motion.dot(normal);
+    if (approach > 0.0f && plane_dist > radius) {
+        const float t = (plane_dist - radius) / approach;
+        if (t <= 1.0f) {
+            const Vec3f point = center + motion * t - normal * radius;
+            if (triangle.contains(point)) {
+                return SweepHit{t, point, normal, 0};
+            }
+        }
+    }
+
+    // Otherwise the first contact is on the boundary: an edge side or a vertex
+    float best = kInfinity;
+    Vec3f best_point;
+    const Vec3f* vertices[3] = {&triangle.v0, &triangle.v1, &triangle.v2};
+    for (int i = 0; i < 3; ++i) {
+        Vec3f point;
+        const float t = sweepSphereEdge(center, motion, *vertices[i], *vertices[(i + 1) % 3], radius, point);
+        if (t >= 0.0f && t < best) {
+            best = t;
+            best_point = point;
+        }
+        const float tv = sweepSpherePoint(center, motion, *vertices[i], radius);
+        if (tv >= 0.0f && tv < best) {
+            best = tv;
+            best_point = *vertices[i];
+        }
+    }
+    if (best == kInfinity) {
+        return SweepHit::none();
+    }
+    return SweepHit{best, best_point, (center + motion * best - best_point).normalized(), 0};
+}
+
+SweepHit sweep(const Sphere& sphere,
+               const Vec3f& motion,
+               std::span<const Vec3f> vertices,
+               std::span<const uint32_t> indices) noexcept {
+    VNE_ASSERT_MSG(indices.size() % 3 == 0, "sweep: index count is not a multiple of 3");
+
+    Vec3f sweep_min;
+    Vec3f sweep_max;
+    sweptBounds(sphere.center(), motion, sphere.radius(), sweep_min, sweep_max);
+
+    SweepHit best = SweepHit::none();
+    for (size_t i = 0; i + 3 <= indices.size(); i += 3) {
+        if (indices[i] >= vertices.size() || indices[i + 1] >= vertices.size() || indices[i + 2] >= vertices.size()) {
+            VNE_ASSERT_MSG(false, "sweep: triangle index out of range");
+            continue;
+        }
+        const Triangle triangle(vertices[indices[i]], vertices[indices[i + 1]], vertices[indices[i + 2]]);
+        const Vec3f tri_min = triangle.v0.componentMin(triangle.v1).componentMin(triangle.v2);
+        const Vec3f tri_max = triangle.v0.componentMax(triangle.v1).componentMax(triangle.v2);
+        if (!boundsOverlap(sweep_min, sweep_max, tri_min, tri_max)) {
+            continue;
+        }
+
+        const SweepHit hit = sweep(sphere, motion, triangle);
+        if (hit && (!best || hit.time < best.time)) {
+            best = hit;
+            best.index = static_cast<uint32_t>(i / 3);
+            if (best.time == 0.0f) {
+                break;
+            }
+            // Later triangles only matter if they are hit sooner
+            sweptBounds(sphere.center(), motion * best.time, sphere.radius(), sweep_min, sweep_max);
+        }
+    }
+    return best;
+}
+
+// ============================================================================
+// Swept AABB
+// ============================================================================
+
+SweepHit sweep(const Aabb& box, const Vec3f& motion, const Aabb& obstacle) noexcept {
+    const Vec3f center = box.center();
+    const Vec3f half = box.halfExtents();
+
+    // Ray cast of the center against the obstacle grown by the box
+    float enter = -kInfinity;
+    float exit = kInfinity;
+    int enter_axis = -1;
+    Vec3f lo;
+    Vec3f hi;
+    for (int k = 0; k < 3; ++k) {
+        lo[k] = obstacle.min()[k] - half[k] - center[k];
+        hi[k] = obstacle.max()[k] + half[k] - center[k];
+        if (motion[k] != 0.0f) {
+            const float inv = 1.0f / motion[k];
+            const float t0 = std::min(lo[k] * inv, hi[k] * inv);
+            const float t1 = std::max(lo[k] * inv, hi[k] * inv);
+            if (t0 > enter) {
+                enter = t0;
+                enter_axis = k;
+            }
+            exit = std::min(exit, t1);
+        } else if (lo[k] > 0.0f || hi[k] < 0.0f) {
+            return SweepHit::none();
+        }
+    }
+    if (std::max(enter, 0.0f) > std::min(exit, 1.0f)) {
+        return SweepHit::none();
+    }
+
+    SweepHit hit;
+    hit.time = std::max(enter, 0.0f);
+    hit.normal = Vec3f::zero();
+    if (enter > 0.0f) {
+        hit.normal[enter_axis] = motion[enter_axis] > 0.0f ? -1.0f : 1.0f;
+    } else {
+        // Overlapping at the start: push out along the axis of least penetration
+        int axis = 0;
+        float depth = kInfinity;
+        for (int k = 0; k < 3; ++k) {
+            const float k_depth = std::min(-lo[k], hi[k]);
+            if (k_depth < depth) {
+                depth = k_depth;
+                axis = k;
+            }
+        }
+        hit.normal[axis] = -lo[axis] < hi[axis] ? -1.0f : 1.0f;
+    }
+    hit.point = (center + motion * hit.time).componentMax(obstacle.min()).componentMin(obstacle.max());
+    return hit;
+}
+
+// ============================================================================
+// Swept Capsule
+// ============================================================================
+
+SweepHit sweep(const Capsule& capsule, const Vec3f& motion, const Obb& obstacle, float tolerance) noexcept {
+    return timeOfImpact(capsule, motion, obstacle, Vec3f::zero(), tolerance);
+}
+
+// ============================================================================
+// Conservative Advancement
+// ============================================================================
+
+SweepHit timeOfImpact(const ConvexShape& a,
+                      const Vec3f& motion_a,
+                      const ConvexShape& b,
+                      const Vec3f& motion_b,
+                      float tolerance) noexcept {
+    const Vec3f relative = motion_a - motion_b;
+
+    GjkCache cache;
+    SweepHit hit;
+    float t = 0.0f;
+    for (uint32_t iteration = 0; iteration < kToiMaxIterations; ++iteration) {
+        const ConvexShape moved_a = a.translated(motion_a * t);
+        const ConvexShape moved_b = b.translated(motion_b * t);
+        const GjkResult result = gjkDistance(moved_a, moved_b, &cache);
+        if (result.intersecting) {
+            if (iteration == 0) {
+                const PenetrationResult overlap = penetration(moved_a, moved_b, &cache);
+                return SweepHit{0.0f, overlap.point_b, -overlap.normal, 0};
+            }
+            // Rounding landed exactly on contact: keep the previous step's witness
+            hit.time = t;
+            return hit;
+        }
+
+        hit.time = t;
+        hit.point = result.point_b;
+        hit.normal = -result.normal;
+        if (result.distance <= tolerance) {
+            return hit;
+        }
+
+        // The gap shrinks at most this fast; separating pairs never meet
+        const float approach = relative.dot(result.normal);
+        if (approach <= 0.0f) {
+            return SweepHit::none();
+        }
+        t += result.distance / approach;
+        if (t > 1.0f) {
+            return SweepHit::none();
+        }
+    }
+    return hit;
+}
+
+// ============================================================================
+// Batch Sweeps Against a Static World
+// ============================================================================
+
+size_t sweep(std::span<const Sphere> spheres,
+             std::span<const Vec3f> motions,
+             std::span<const Vec3f> vertices,
+             std::span<const uint32_t> indices,
+             std::span<SweepHit> out) noexcept {
+    return sweepBodies(spheres, motions, out, [&](const Sphere& sphere, const Vec3f& motion) {
+        return sweep(sphere, motion, vertices, indices);
+    });
+}
+
+size_t sweep(std::span<const Aabb> boxes,
+             std::span<const Vec3f> motions,
+             std::span<const Aabb> world,
+             std::span<SweepHit> out) noexcept {
+    using simd::Float4;
+
+    return sweepBodies(boxes, motions, out, [&](const Aabb& box, const Vec3f& motion) {
+        const Vec3f center = box.center();
+        const Vec3f half = box.halfExtents();
+
+        // Earliest entry time and obstacle index per lane; indices travel as floats
+        Float4 best_time = simd::broadcast(kInfinity);
+        Float4 best_index = simd::zero();
+        size_t j = 0;
+        for (; j + simd::kLanes <= world.size(); j += simd::kLanes) {
+            const auto base = static_cast<float>(j);
+            sweepAabbBlock(&world[j],
+                           simd::set(base, base + 1.0f, base + 2.0f, base + 3.0f),
+                           center,
+                           half,
+                           motion,
+                           best_time,
+                           best_index);
+        }
+
+        float time = kInfinity;
+        size_t index = 0;
+        for (int k = 0; k < simd::kLanes; ++k) {
+            const float lane_time = simd::lane(best_time, k);
+            const auto lane_index = static_cast<size_t>(simd::lane(best_index, k));
+            if (lane_time < time || (lane_time == time && lane_index < index)) {
+                time = lane_time;
+                index = lane_index;
+            }
+        }
+
+        SweepHit best = time < kInfinity ? sweep(box, motion, world[index]) : SweepHit::none();
+        best.index = static_cast<uint32_t>(index);
+        for (; j < world.size(); ++j) {
+            const SweepHit hit = sweep(box, motion, world[j]);
+            if (hit && (!best || hit.time < best.time)) {
+                best = hit;
+                best.index = static_cast<uint32_t>(j);
+            }
+        }
+        return best;
+    });
+}
+
+size_t sweep(std::span<const Capsule> capsules,
+             std::span<const Vec3f> motions,
+             std::span<const Obb> world,
+             std::span<SweepHit> out,
+             float tolerance) noexcept {
+    return sweepBodies(capsules, motions, out, [&](const Capsule& capsule, const Vec3f& motion) {
+        const Aabb bounds = capsule.getAabb();
+        Vec3f sweep_min = bounds.min().componentMin(bounds.min() + motion);
+        Vec3f sweep_max = bounds.max().componentMax(bounds.max() + motion);
+
+        SweepHit best = SweepHit::none();
+        for (size_t j = 0; j < world.size(); ++j) {
+            const Aabb obstacle = world[j].getAabb();
+            if (!boundsOverlap(sweep_min, sweep_max, obstacle.min(), obstacle.max())) {
+                continue;
+            }
+            const SweepHit hit = sweep(capsule, motion, world[j], tolerance);
+            if (hit && (!best || hit.time < best.time)) {
+                best = hit;
+                best.index = static_cast<uint32_t>(j);
+                // Later obstacles only matter if they are hit sooner
+                sweep_min = bounds.min().componentMin(bounds.min() + motion * best.time);
+                sweep_max = bounds.max().componentMax(bounds.max() + motion * best.time);
+            }
+        }
+        return best;
+    });
+}
+
+}  // namespace vne::math
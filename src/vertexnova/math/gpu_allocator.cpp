@@ -0,0 +1,148 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Corresponding header
+#include "vertexnova/math/gpu_allocator.h"
+
+// Project headers
+#include "vertexnova/common/macros.h"
+
+// Standard library includes
+#include <algorithm>
+
+namespace vne::math {
+
+// Allocations only reserve address ranges; the data written into them is
+// published to the GPU by the caller's submit, so relaxed atomics suffice.
+
+namespace {
+
+[[nodiscard]] [[maybe_unused]] bool isPowerOfTwo(size_t value) noexcept {
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+/// Smallest offset >= @p offset inside the region whose buffer offset is aligned.
+[[nodiscard]] size_t alignInRegion(size_t offset, size_t buffer_offset, size_t alignment) noexcept {
+    return gpu::alignUp(buffer_offset + offset, alignment) - buffer_offset;
+}
+
+}  // namespace
+
+// ============================================================================
+// GpuLinearAllocator
+// ============================================================================
+
+GpuLinearAllocator::GpuLinearAllocator(std::span<std::byte> memory,
+                                       size_t buffer_offset,
+                                       size_t min_alignment) noexcept
+    : memory_(memory)
+    , buffer_offset_(buffer_offset)
+    , min_alignment_(min_alignment) {
+    VNE_ASSERT_MSG(isPowerOfTwo(min_alignment), "GpuLinearAllocator: alignment must be a power of two");
+}
+
+GpuAllocation GpuLinearAllocator::allocate(size_t size, size_t alignment) noexcept {
+    alignment = std::max(alignment, min_alignment_);
+    VNE_ASSERT_MSG(isPowerOfTwo(alignment), "GpuLinearAllocator: alignment must be a power of two");
+    const size_t capacity = memory_.size();
+    if (size == 0 || size > capacity) {
+        return {};
+    }
+
+    size_t head = head_.load(std::memory_order_relaxed);
+    for (;;) {
+        const size_t offset = alignInRegion(head, buffer_offset_, alignment);
+        if (offset > capacity - size) {
+            return {};
+        }
+        if (head_.compare_exchange_weak(head, offset + size, std::memory_order_relaxed)) {
+            return {memory_.subspan(offset, size), buffer_offset_ + offset, size};
+        }
+    }
+}
+
+void GpuLinearAllocator::reset() noexcept {
+    head_.store(0, std::memory_order_relaxed);
+}
+
+size_t GpuLinearAllocator::used() const noexcept {
+    return std::min(head_.load(std::memory_order_relaxed), memory_.size());
+}
+
+// ============================================================================
+// GpuRingAllocator
+// ============================================================================
+
+GpuRingAllocator::GpuRingAllocator(std::span<std::byte> memory,
+                                   uint32_t frames_in_flight,
+                                   size_t buffer_offset,
+                                   size_t min_alignment) noexcept
+    : memory_(memory)
+    , buffer_offset_(buffer_offset)
+    , min_alignment_(min_alignment)
+    , frames_in_flight_(std::clamp(frames_in_flight, 1u, kMaxFramesInFlight)) {
+    VNE_ASSERT_MSG(frames_in_flight >= 1 && frames_in_flight <= kMaxFramesInFlight,
+                   "GpuRingAllocator: frames_in_flight out of range");
+    VNE_ASSERT_MSG(isPowerOfTwo(min_alignment), "GpuRingAllocator: alignment must be a power of two");
+}
+
+void GpuRingAllocator::beginFrame() noexcept {
+    frame_ends_[frame_] = head_.load(std::memory_order_relaxed);
+    frame_ = (frame_ + 1) % frames_in_flight_;
+    // Everything up to where this slot's previous frame stopped is free again
+    tail_.store(std::max(tail_.load(std::memory_order_relaxed), frame_ends_[frame_]), std::memory_order_relaxed);
+}
+
+GpuAllocation GpuRingAllocator::allocate(size_t size, size_t alignment) noexcept {
+    alignment = std::max(alignment, min_alignment_);
+    VNE_ASSERT_MSG(isPowerOfTwo(alignment), "GpuRingAllocator: alignment must be a power of two");
+    const size_t capacity = memory_.size();
+    if (size == 0 || size > capacity) {
+        return {};
+    }
+    const size_t wrapped_start = alignInRegion(0, buffer_offset_, alignment);
+    if (wrapped_start > capacity - size) {
+        return {};
+    }
+
+    uint64_t head = head_.load(std::memory_order_relaxed);
+    for (;;) {
+        const uint64_t tail = tail_.load(std::memory_order_relaxed);
+        const auto position = static_cast<size_t>(head % capacity);
+        uint64_t lap_start = head - position;
+        size_t offset = alignInRegion(position, buffer_offset_, alignment);
+        if (offset > capacity - size) {
+            // Does not fit before the end: skip the remainder and start the next lap
+            lap_start += capacity;
+            offset = wrapped_start;
+        }
+        const uint64_t end = lap_start + offset + size;
+        if (end - tail > capacity) {
+            return {};
+        }
+        if (head_.compare_exchange_weak(head, end, std::memory_order_relaxed)) {
+            return {memory_.subspan(offset, size), buffer_offset_ + offset, size};
+        }
+    }
+}
+
+void GpuRingAllocator::reset() noexcept {
+    head_.store(0, std::memory_order_relaxed);
+    tail_.store(0, std::memory_order_relaxed);
+    frame_ends_.fill(0);
+    frame_ = 0;
+}
+
+size_t GpuRingAllocator::used() const noexcept {
+    return static_cast<size_t>(head_.load(std::memory_order_relaxed) - tail_.load(std::memory_order_relaxed));
+}
+
+}  // namespace vne::math
@@ -0,0 +1,342 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Corresponding header
+#include "vertexnova/math/gpu_instance.h"
+
+// Project headers
+#include "vertexnova/common/macros.h"
+#include "vertexnova/math/instrumentation.h"
+#include "vertexnova/math/simd/dispatch.h"
+#include "vertexnova/math/simd/float4.h"
+
+// Standard library includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace vne::math {
+
+// The batch kernels read TransformComponents as 10 packed floats:
+// translation (0-2), rotation xyzw (3-6), scale (7-9).
+static_assert(sizeof(Mat4f) == 16 * sizeof(float), "Mat4f must be tightly packed");
+static_assert(sizeof(GpuAffine3f) == 12 * sizeof(float), "GpuAffine3f must be three packed rows");
+static_assert(sizeof(TransformComponents) == 10 * sizeof(float), "TransformComponents must be tightly packed");
+static_assert(offsetof(TransformComponents, rotation) == 3 * sizeof(float), "unexpected TransformComponents layout");
+static_assert(offsetof(TransformComponents, scale) == 7 * sizeof(float), "unexpected TransformComponents layout");
+
+namespace {
+
+using simd::Float4;
+
+/// The three smallest quaternion components lie in [-kQuatRange, kQuatRange].
+constexpr float kQuatRange = 0.70710678f;
+
+/// Largest 10-bit code.
+constexpr float kQuatMaxCode = 1023.0f;
+
+/// Maps [-kQuatRange, kQuatRange] to [0, 1023]; the extra 0.5 rounds on truncation.
+constexpr float kQuatScale = 0.5f * kQuatMaxCode / kQuatRange;
+constexpr float kQuatBias = 0.5f * kQuatMaxCode + 0.5f;
+
+[[nodiscard]] uint32_t quantizeComponent(float v) noexcept {
+    return static_cast<uint32_t>(std::clamp(v * kQuatScale + kQuatBias, 0.0f, kQuatMaxCode));
+}
+
+[[nodiscard]] float dequantizeComponent(uint32_t code) noexcept {
+    return (static_cast<float>(code) / kQuatMaxCode * 2.0f - 1.0f) * kQuatRange;
+}
+
+[[nodiscard]] uint32_t packScaleXy(const float* s) noexcept {
+    return static_cast<uint32_t>(packHalf(s[0])) | (static_cast<uint32_t>(packHalf(s[1])) << 16);
+}
+
+/// Loads the floats of four consecutive TransformComponents starting at element offset @p at.
+[[nodiscard]] Float4 loadComponents(const float* base, int k, int at) noexcept {
+    return simd::load(base + 10 * k + at);
+}
+
+/**
+ * Packs four rotations with the same largest-component selection and
+ * quantization as packQuaternion().
+ */
+void packRotationBlock(const float* c, uint32_t* out) noexcept {
+    Float4 qx = loadComponents(c, 0, 3);
+    Float4 qy = loadComponents(c, 1, 3);
+    Float4 qz = loadComponents(c, 2, 3);
+    Float4 qw = loadComponents(c, 3, 3);
+    simd::transpose(qx, qy, qz, qw);
+
+    const Float4 ax = simd::abs(qx);
+    const Float4 ay = simd::abs(qy);
+    const Float4 az = simd::abs(qz);
+    const Float4 aw = simd::abs(qw);
+    const Float4 largest = simd::max(simd::max(ax, ay), simd::max(az, aw));
+
+    // Ties go to the lowest index, like the scalar loop
+    const Float4 is_x = simd::cmpEq(ax, largest);
+    const Float4 is_y = simd::andNot(is_x, simd::cmpEq(ay, largest));
+    const Float4 is_xy = is_x | is_y;
+    const Float4 is_z = simd::andNot(is_xy, simd::cmpEq(az, largest));
+    const Float4 is_w = simd::andNot(is_xy | is_z, simd::cmpEq(aw, aw));
+
+    const Float4 dropped = simd::select(is_x, qx, simd::select(is_y, qy, simd::select(is_z, qz, qw)));
+    const Float4 flip = simd::cmpLt(dropped, simd::zero());
+
+    const Float4 a = simd::select(is_x, qy, qx);
+    const Float4 b = simd::select(is_xy, qz, qy);
+    const Float4 c3 = simd::select(is_w, qz, qw);
+
+    const Float4 scale = simd::broadcast(kQuatScale);
+    const Float4 bias = simd::broadcast(kQuatBias);
+    const Float4 lo = simd::zero();
+    const Float4 hi = simd::broadcast(kQuatMaxCode);
+    auto quantize = [&](Float4 v) {
+        v = simd::select(flip, -v, v);
+        return simd::min(simd::max(v * scale + bias, lo), hi);
+    };
+
+    alignas(16) float qa[simd::kLanes];
+    alignas(16) float qb[simd::kLanes];
+    alignas(16) float qc[simd::kLanes];
+    simd::store(qa, quantize(a));
+    simd::store(qb, quantize(b));
+    simd::store(qc, quantize(c3));
+
+    const int mask_y = simd::moveMask(is_y);
+    const int mask_z = simd::moveMask(is_z);
+    const int mask_w = simd::moveMask(is_w);
+    for (int k = 0; k < simd::kLanes; ++k) {
+        const uint32_t index = ((mask_y >> k) & 1) ? 1u : ((mask_z >> k) & 1) ? 2u : ((mask_w >> k) & 1) ? 3u : 0u;
+        out[k] = (index << 30) | (static_cast<uint32_t>(qa[k]) << 20) | (static_cast<uint32_t>(qb[k]) << 10)
+                 | static_cast<uint32_t>(qc[k]);
+    }
+}
+
+void packTrsBlock(const TransformComponents* components, GpuInstanceTrs* out) noexcept {
+    const auto* c = reinterpret_cast<const float*>(components);
+    uint32_t rotations[simd::kLanes];
+    packRotationBlock(c, rotations);
+
+    for (int k = 0; k < simd::kLanes; ++k) {
+        const float* s = components[k].scale.ptr();
+        out[k].position = components[k].translation;
+        out[k].rotation = rotations[k];
+        out[k].scale_xy = packScaleXy(s);
+        out[k].scale_z = packHalf(s[2]);
+    }
+}
+
+/// Decomposes four matrices with the dispatched kernel, then packs them with packTrsBlock.
+void decomposeTrsBlock(const Mat4f* matrices, GpuInstanceTrs* out, const simd::BatchKernels& kernels) noexcept {
+    static_assert(simd::kBlockSize == static_cast<std::size_t>(simd::kLanes), "kernel blocks must match the lanes");
+    Vec3f translations[simd::kLanes];
+    Quatf rotations[simd::kLanes];
+    Vec3f scales[simd::kLanes];
+    kernels.decompose4(matrices[0].ptr(), translations[0].ptr(), &rotations[0].x, scales[0].ptr());
+
+    TransformComponents components[simd::kLanes];
+    for (int k = 0; k < simd::kLanes; ++k) {
+        components[k] = TransformComponents(translations[k], rotations[k], scales[k]);
+    }
+    packTrsBlock(components, out);
+}
+
+/**
+ * Composes four TRS transforms into 3x4 rows. The basis matches
+ * Affine3f::fromTrs and the batch compose().
+ */
+void composeAffineBlock(const TransformComponents* components, GpuAffine3f* out) noexcept {
+    const auto* c = reinterpret_cast<const float*>(components);
+
+    // Three overlapping 4-float loads per element cover all ten floats
+    // without reading past its end: (t.xyz, q.x), (q.yzw, s.x), (q.w, s.xyz).
+    Float4 tx = loadComponents(c, 0, 0);
+    Float4 ty = loadComponents(c, 1, 0);
+    Float4 tz = loadComponents(c, 2, 0);
+    Float4 qx = loadComponents(c, 3, 0);
+    simd::transpose(tx, ty, tz, qx);
+
+    Float4 qy = loadComponents(c, 0, 4);
+    Float4 qz = loadComponents(c, 1, 4);
+    Float4 qw = loadComponents(c, 2, 4);
+    Float4 sx = loadComponents(c, 3, 4);
+    simd::transpose(qy, qz, qw, sx);
+
+    Float4 unused0 = loadComponents(c, 0, 6);
+    Float4 unused1 = loadComponents(c, 1, 6);
+    Float4 sy = loadComponents(c, 2, 6);
+    Float4 sz = loadComponents(c, 3, 6);
+    simd::transpose(unused0, unused1, sy, sz);
+
+    const Float4 one = simd::broadcast(1.0f);
+    const Float4 two = simd::broadcast(2.0f);
+
+    const Float4 xx = qx * qx;
+    const Float4 yy = qy * qy;
+    const Float4 zz = qz * qz;
+    const Float4 xy = qx * qy;
+    const Float4 xz = qx * qz;
+    const Float4 yz = qy * qz;
+    const Float4 wx = qw * qx;
+    const Float4 wy = qw * qy;
+    const Float4 wz = qw * qz;
+
+    // Row r = (column0[r], column1[r], column2[r], t[r]) of the scaled rotation
+    Float4 r0x = (one - two * (yy + zz)) * sx;
+    Float4 r0y = two * (xy - wz) * sy;
+    Float4 r0z = two * (xz + wy) * sz;
+    Float4 r1x = two * (xy + wz) * sx;
+    Float4 r1y = (one - two * (xx + zz)) * sy;
+    Float4 r1z = two * (yz - wx) * sz;
+    Float4 r2x = two * (xz - wy) * sx;
+    Float4 r2y = two * (yz + wx) * sy;
+    Float4 r2z = (one - two * (xx + yy)) * sz;
+
+    // SoA -> AoS: after transposing, register k holds that row of instance k
+    simd::transpose(r0x, r0y, r0z, tx);
+    simd::transpose(r1x, r1y, r1z, ty);
+    simd::transpose(r2x, r2y, r2z, tz);
+
+    const Float4 row0[4] = {r0x, r0y, r0z, tx};
+    const Float4 row1[4] = {r1x, r1y, r1z, ty};
+    const Float4 row2[4] = {r2x, r2y, r2z, tz};
+    for (int k = 0; k < simd::kLanes; ++k) {
+        auto* rows = reinterpret_cast<float*>(&out[k]);
+        simd::store(rows, row0[k]);
+        simd::store(rows + 4, row1[k]);
+        simd::store(rows + 8, row2[k]);
+    }
+}
+
+/// Runs a four-wide kernel over @p count elements, padding the tail to a full block.
+template<typename In, typename Out, typename Kernel>
+void forEachBlock(std::span<const In> in, std::span<Out> out, std::size_t count, Kernel kernel) noexcept {
+    const std::size_t full = count - count % simd::kLanes;
+    for (std::size_t i = 0; i < full; i += simd::kLanes) {
+        kernel(&in[i], &out[i]);
+    }
+    if (full == count) {
+        return;
+    }
+
+    std::array<In, simd::kLanes> src{};
+    std::array<Out, simd::kLanes> dst{};
+    const std::size_t tail = count - full;
+    std::copy_n(in.begin() + static_cast<std::ptrdiff_t>(full), tail, src.begin());
+    kernel(src.data(), dst.data());
+    std::copy_n(dst.begin(), tail, out.begin() + static_cast<std::ptrdiff_t>(full));
+}
+
+}  // namespace
+
+uint32_t packQuaternion(const Quatf& q) noexcept {
+    const float c[4] = {q.x, q.y, q.z, q.w};
+    uint32_t largest = 0;
+    for (uint32_t i = 1; i < 4; ++i) {
+        if (std::abs(c[i]) > std::abs(c[largest])) {
+            largest = i;
+        }
+    }
+    const float sign = c[largest] < 0.0f ? -1.0f : 1.0f;
+
+    uint32_t bits = largest << 30;
+    int shift = 20;
+    for (uint32_t i = 0; i < 4; ++i) {
+        if (i != largest) {
+            bits |= quantizeComponent(c[i] * sign) << shift;
+            shift -= 10;
+        }
+    }
+    return bits;
+}
+
+Quatf unpackQuaternion(uint32_t bits) noexcept {
+    const float a = dequantizeComponent((bits >> 20) & 1023u);
+    const float b = dequantizeComponent((bits >> 10) & 1023u);
+    const float c = dequantizeComponent(bits & 1023u);
+    const float largest = std::sqrt(std::max(0.0f, 1.0f - a * a - b * b - c * c));
+    switch (bits >> 30) {
+        case 0:
+            return Quatf(largest, a, b, c);
+        case 1:
+            return Quatf(a, largest, b, c);
+        case 2:
+            return Quatf(a, b, largest, c);
+        default:
+            return Quatf(a, b, c, largest);
+    }
+}
+
+GpuInstanceTrs packInstanceTrs(const TransformComponents& components) noexcept {
+    // Straight to the block kernel: a single instance is not a packing batch
+    GpuInstanceTrs result;
+    forEachBlock(
+        std::span<const TransformComponents>(&components, 1), std::span<GpuInstanceTrs>(&result, 1), 1, packTrsBlock);
+    return result;
+}
+
+TransformComponents unpackInstanceTrs(const GpuInstanceTrs& instance) noexcept {
+    TransformComponents result;
+    result.translation = instance.position;
+    result.rotation = unpackQuaternion(instance.rotation);
+    result.scale = Vec3f(unpackHalf(static_cast<uint16_t>(instance.scale_xy & 0xFFFFu)),
+                         unpackHalf(static_cast<uint16_t>(instance.scale_xy >> 16)),
+                         unpackHalf(static_cast<uint16_t>(instance.scale_z & 0xFFFFu)));
+    return result;
+}
+
+void packInstances(std::span<const Mat4f> matrices, std::span<GpuAffine3f> out) noexcept {
+    VNE_ASSERT_MSG(matrices.size() == out.size(), "packInstances: span sizes must match");
+    const std::size_t count = std::min(matrices.size(), out.size());
+    VNE_MATH_PROBE_SCOPE(Probe::eInstancePacking, count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const float* m = matrices[i].ptr();
+        Float4 r0 = simd::load(m);
+        Float4 r1 = simd::load(m + 4);
+        Float4 r2 = simd::load(m + 8);
+        Float4 r3 = simd::load(m + 12);
+        simd::transpose(r0, r1, r2, r3);
+
+        auto* rows = reinterpret_cast<float*>(&out[i]);
+        simd::store(rows, r0);
+        simd::store(rows + 4, r1);
+        simd::store(rows + 8, r2);
+    }
+}
+
+void packInstances(std::span<const TransformComponents> components, std::span<GpuAffine3f> out) noexcept {
+    VNE_ASSERT_MSG(components.size() == out.size(), "packInstances: span sizes must match");
+    VNE_MATH_PROBE_SCOPE(Probe::eInstancePacking, components.size());
+    forEachBlock(components, out, std::min(components.size(), out.size()), composeAffineBlock);
+}
+
+void packInstances(std::span<const TransformComponents> components, std::span<GpuInstanceTrs> out) noexcept {
+    VNE_ASSERT_MSG(components.size() == out.size(), "packInstances: span sizes must match");
+    VNE_MATH_PROBE_SCOPE(Probe::eInstancePacking, components.size());
+    forEachBlock(components, out, std::min(components.size(), out.size()), packTrsBlock);
+}
+
+void packInstances(std::span<const Mat4f> matrices, std::span<GpuInstanceTrs> out) noexcept {
+    VNE_ASSERT_MSG(matrices.size() == out.size(), "packInstances: span sizes must match");
+    const std::size_t count = std::min(matrices.size(), out.size());
+    VNE_MATH_PROBE_SCOPE(Probe::eInstancePacking, count);
+
+    // Calls the decompose kernel directly rather than the probed batch decompose()
+    const simd::BatchKernels& kernels = simd::batchKernels();
+    forEachBlock(matrices, out, count, [&kernels](const Mat4f* block, GpuInstanceTrs* packed) {
+        decomposeTrsBlock(block, packed, kernels);
+    });
+}
+
+}  // namespace vne::math
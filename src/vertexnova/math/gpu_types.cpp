@@ -0,0 +1,158 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Corresponding header
+#include "vertexnova/math/gpu_types.h"
+
+// Project headers
+#include "vertexnova/math/simd/float4.h"
+
+// Standard library includes
+#include <algorithm>
+#include <cstring>
+
+namespace vne::math {
+
+// The packer reads members as packed floats.
+static_assert(sizeof(Vec2f) == 2 * sizeof(float), "Vec2f must be tightly packed");
+static_assert(sizeof(Vec3f) == 3 * sizeof(float), "Vec3f must be tightly packed");
+static_assert(sizeof(Vec4f) == 4 * sizeof(float), "Vec4f must be tightly packed");
+static_assert(sizeof(Mat3f) == 9 * sizeof(float), "Mat3f must be tightly packed");
+static_assert(sizeof(Mat4f) == 16 * sizeof(float), "Mat4f must be tightly packed");
+
+namespace {
+
+/// Source bytes of one element of each type, used to step through arrays.
+[[nodiscard]] size_t sourceSize(GpuFieldType type) noexcept {
+    switch (type) {
+        case GpuFieldType::eVec2:
+            return sizeof(Vec2f);
+        case GpuFieldType::eVec3:
+            return sizeof(Vec3f);
+        case GpuFieldType::eVec4:
+            return sizeof(Vec4f);
+        case GpuFieldType::eMat3:
+            return sizeof(Mat3f);
+        case GpuFieldType::eMat4:
+            return sizeof(Mat4f);
+        default:
+            return sizeof(float);
+    }
+}
+
+/// Destination bytes one element store touches. vec3 and mat3 columns are
+/// stored as full vec4s; the extra lane lands in padding or is overwritten by
+/// the next member, which is written afterwards.
+[[nodiscard]] size_t storeSize(GpuFieldType type) noexcept {
+    switch (type) {
+        case GpuFieldType::eVec3:
+        case GpuFieldType::eVec4:
+            return 16;
+        case GpuFieldType::eMat3:
+            return 48;
+        case GpuFieldType::eMat4:
+            return 64;
+        case GpuFieldType::eVec2:
+            return 8;
+        default:
+            return 4;
+    }
+}
+
+/// Widens three floats to a vec4 slot without reading past the source.
+[[nodiscard]] simd::Float4 loadVec3(const float* p) noexcept {
+    return simd::set(p[0], p[1], p[2], 0.0f);
+}
+
+void writeElement(GpuFieldType type, const std::byte* src, std::byte* dst) noexcept {
+    const auto* s = reinterpret_cast<const float*>(src);
+    auto* d = reinterpret_cast<float*>(dst);
+    switch (type) {
+        case GpuFieldType::eVec3:
+            simd::store(d, loadVec3(s));
+            break;
+        case GpuFieldType::eVec4:
+            simd::store(d, simd::load(s));
+            break;
+        case GpuFieldType::eMat3:
+            simd::store(d, loadVec3(s));
+            simd::store(d + 4, loadVec3(s + 3));
+            simd::store(d + 8, loadVec3(s + 6));
+            break;
+        case GpuFieldType::eMat4:
+            simd::store(d, simd::load(s));
+            simd::store(d + 4, simd::load(s + 4));
+            simd::store(d + 8, simd::load(s + 8));
+            simd::store(d + 12, simd::load(s + 12));
+            break;
+        case GpuFieldType::eVec2:
+            std::memcpy(dst, src, 8);
+            break;
+        default:
+            // Scalars (float / int / uint) are a single 4-byte move
+            std::memcpy(dst, src, 4);
+            break;
+    }
+}
+
+/// End of the last byte the packer writes inside one block.
+[[nodiscard]] size_t blockExtent(std::span<const GpuFieldLayout> fields) noexcept {
+    size_t extent = 0;
+    for (const GpuFieldLayout& field : fields) {
+        const size_t last = field.count > 1 ? (field.count - 1) * size_t{field.array_stride} : 0;
+        extent = std::max(extent, field.offset + last + storeSize(field.type));
+    }
+    return extent;
+}
+
+}  // namespace
+
+void packGpuBlocks(std::span<const GpuFieldLayout> fields,
+                   std::span<const GpuFieldSource> sources,
+                   size_t count,
+                   std::span<std::byte> dst,
+                   size_t dst_stride) noexcept {
+    VNE_ASSERT_MSG(sources.size() == fields.size(), "packGpuBlocks: need one source per field");
+    if (count == 0 || sources.size() < fields.size()) {
+        return;
+    }
+
+    const size_t extent = blockExtent(fields);
+    VNE_ASSERT_MSG(count == 1 || dst_stride >= extent, "packGpuBlocks: stride is smaller than one block");
+    VNE_ASSERT_MSG(dst.size() >= (count - 1) * dst_stride + extent, "packGpuBlocks: destination too small");
+    if (dst.size() < extent) {
+        return;
+    }
+    if (dst_stride > 0) {
+        count = std::min(count, (dst.size() - extent) / dst_stride + 1);
+    }
+
+    // One block at a time so each block's cache lines are written together,
+    // which keeps write-combined mappings streaming.
+    for (size_t i = 0; i < count; ++i) {
+        std::byte* block = dst.data() + i * dst_stride;
+        for (size_t f = 0; f < fields.size(); ++f) {
+            const GpuFieldLayout& field = fields[f];
+            const auto* src = static_cast<const std::byte*>(sources[f].data) + i * sources[f].stride;
+            std::byte* out = block + field.offset;
+            if (field.count == 1) {
+                writeElement(field.type, src, out);
+                continue;
+            }
+            const size_t src_step = sourceSize(field.type);
+            for (uint32_t e = 0; e < field.count; ++e) {
+                writeElement(field.type, src + e * src_step, out + size_t{e} * field.array_stride);
+            }
+        }
+    }
+}
+
+}  // namespace vne::math
@@ -0,0 +1,273 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Corresponding header
+#include "vertexnova/math/instrumentation.h"
+
+// Standard library includes
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace vne::math {
+
+namespace {
+
+/// Trace events each thread buffers before dropping new ones.
+constexpr std::size_t kMaxTraceEventsPerThread = 1u << 16;
+
+struct TraceEvent {
+    uint64_t start{0};     ///< Nanoseconds since the registry was created
+    uint64_t duration{0};  ///< Nanoseconds
+    uint64_t items{0};
+    Probe probe{Probe::eCount};
+};
+
+/**
+ * Counters owned by one thread. Only that thread writes them, so an increment
+ * is a relaxed load and store rather than a read-modify-write; the atomics
+ * only make the concurrent reads in instrumentationSnapshot() well defined.
+ */
+struct ThreadState {
+    std::array<std::atomic<uint64_t>, kProbeCount> calls{};
+    std::array<std::atomic<uint64_t>, kProbeCount> items{};
+    std::array<std::atomic<uint64_t>, kProbeCount> nanoseconds{};
+
+    /// Totals at the last reset; guarded by the registry mutex
+    std::array<ProbeStats, kProbeCount> baseline{};
+    uint32_t id{0};
+
+    std::mutex trace_mutex;
+    std::vector<TraceEvent> events;
+    uint64_t dropped{0};
+};
+
+void add(std::atomic<uint64_t>& counter, uint64_t value) noexcept {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+/**
+ * Every thread that has hit a probe. Blocks are kept until the process exits
+ * so a snapshot still includes threads that have finished.
+ */
+class Registry {
+   public:
+    [[nodiscard]] ThreadState& registerThread() {
+        const std::lock_guard lock(mutex_);
+        auto& state = threads_.emplace_back(std::make_unique<ThreadState>());
+        state->id = static_cast<uint32_t>(threads_.size());
+        return *state;
+    }
+
+    [[nodiscard]] InstrumentationSnapshot snapshot() const {
+        const std::lock_guard lock(mutex_);
+        InstrumentationSnapshot result;
+        result.threads = static_cast<uint32_t>(threads_.size());
+        for (const auto& state : threads_) {
+            for (std::size_t p = 0; p < kProbeCount; ++p) {
+                ProbeStats& out = result.probes[p];
+                out.calls += state->calls[p].load(std::memory_order_relaxed) - state->baseline[p].calls;
+                out.items += state->items[p].load(std::memory_order_relaxed) - state->baseline[p].items;
+                out.nanoseconds +=
+                    state->nanoseconds[p].load(std::memory_order_relaxed) - state->baseline[p].nanoseconds;
+            }
+            const std::lock_guard trace_lock(state->trace_mutex);
+            result.dropped_events += state->dropped;
+        }
+        return result;
+    }
+
+    void reset() {
+        const std::lock_guard lock(mutex_);
+        for (const auto& state : threads_) {
+            for (std::size_t p = 0; p < kProbeCount; ++p) {
+                state->baseline[p].calls = state->calls[p].load(std::memory_order_relaxed);
+                state->baseline[p].items = state->items[p].load(std::memory_order_relaxed);
+                state->baseline[p].nanoseconds = state->nanoseconds[p].load(std::memory_order_relaxed);
+            }
+            const std::lock_guard trace_lock(state->trace_mutex);
+            state->events.clear();
+            state->dropped = 0;
+        }
+    }
+
+    /// Calls @p fn with each thread's id and events while holding that thread's trace lock
+    template<typename Fn>
+    void forEachTrace(Fn&& fn) const {
+        const std::lock_guard lock(mutex_);
+        for (const auto& state : threads_) {
+            const std::lock_guard trace_lock(state->trace_mutex);
+            fn(state->id, state->events);
+        }
+    }
+
+    /// Keeps @p hooks alive for the rest of the process so in-flight scopes never dangle
+    [[nodiscard]] const InstrumentationHooks* retainHooks(const InstrumentationHooks& hooks) {
+        const std::lock_guard lock(mutex_);
+        return hooks_.emplace_back(std::make_unique<InstrumentationHooks>(hooks)).get();
+    }
+
+    [[nodiscard]] uint64_t now() const noexcept {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch_).count());
+    }
+
+    std::atomic<bool> recording{false};
+    std::atomic<const InstrumentationHooks*> hooks{nullptr};
+
+   private:
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<ThreadState>> threads_;
+    std::vector<std::unique_ptr<InstrumentationHooks>> hooks_;
+    std::chrono::steady_clock::time_point epoch_{std::chrono::steady_clock::now()};
+};
+
+/// Never destroyed: detached threads may still run probes during static destruction.
+[[nodiscard]] Registry& registry() {
+    static Registry* instance = new Registry;
+    return *instance;
+}
+
+thread_local ThreadState* t_state = nullptr;
+
+[[nodiscard]] ThreadState& threadState() {
+    if (t_state == nullptr) {
+        t_state = &registry().registerThread();
+    }
+    return *t_state;
+}
+
+void recordEvent(ThreadState& state, const TraceEvent& event) noexcept {
+    const std::lock_guard lock(state.trace_mutex);
+    if (state.events.size() >= kMaxTraceEventsPerThread) {
+        ++state.dropped;
+        return;
+    }
+    try {
+        state.events.push_back(event);
+    } catch (...) {
+        ++state.dropped;
+    }
+}
+
+/// Writes @p ns as microseconds with three decimals.
+void writeMicros(std::ostream& os, uint64_t ns) {
+    const uint64_t fraction = ns % 1000;
+    os << ns / 1000 << '.' << static_cast<char>('0' + fraction / 100) << static_cast<char>('0' + fraction / 10 % 10)
+       << static_cast<char>('0' + fraction % 10);
+}
+
+}  // namespace
+
+// ============================================================================
+// Snapshots
+// ============================================================================
+
+InstrumentationSnapshot operator-(const InstrumentationSnapshot& a, const InstrumentationSnapshot& b) noexcept {
+    InstrumentationSnapshot result;
+    result.threads = a.threads;
+    result.dropped_events = a.dropped_events - b.dropped_events;
+    for (std::size_t p = 0; p < kProbeCount; ++p) {
+        result.probes[p].calls = a.probes[p].calls - b.probes[p].calls;
+        result.probes[p].items = a.probes[p].items - b.probes[p].items;
+        result.probes[p].nanoseconds = a.probes[p].nanoseconds - b.probes[p].nanoseconds;
+    }
+    return result;
+}
+
+InstrumentationSnapshot instrumentationSnapshot() {
+    return registry().snapshot();
+}
+
+void resetInstrumentation() {
+    registry().reset();
+}
+
+// ============================================================================
+// Tracing
+// ============================================================================
+
+void setTraceRecording(bool enabled) noexcept {
+    registry().recording.store(enabled, std::memory_order_relaxed);
+}
+
+bool isTraceRecording() noexcept {
+    return registry().recording.load(std::memory_order_relaxed);
+}
+
+void writeChromeTrace(std::ostream& os) {
+    os << "{\"traceEvents\":[";
+    bool first = true;
+    registry().forEachTrace([&](uint32_t tid, const std::vector<TraceEvent>& events) {
+        for (const TraceEvent& event : events) {
+            os << (first ? "\n" : ",\n") << "{\"name\":\"" << probeName(event.probe)
+               << "\",\"cat\":\"vnemath\",\"ph\":\"X\",\"ts\":";
+            writeMicros(os, event.start);
+            os << ",\"dur\":";
+            writeMicros(os, event.duration);
+            os << ",\"pid\":0,\"tid\":" << tid << ",\"args\":{\"items\":" << event.items << "}}";
+            first = false;
+        }
+    });
+    os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+void setInstrumentationHooks(const InstrumentationHooks& hooks) {
+    Registry& r = registry();
+    const bool empty = hooks.zone_begin == nullptr && hooks.zone_end == nullptr;
+    r.hooks.store(empty ? nullptr : r.retainHooks(hooks), std::memory_order_release);
+}
+
+// ============================================================================
+// Probes
+// ============================================================================
+
+ProbeScope::ProbeScope(Probe probe, uint64_t items) noexcept
+    : hooks_(registry().hooks.load(std::memory_order_acquire))
+    , items_(items)
+    , start_(0)
+    , probe_(probe) {
+    if (hooks_ != nullptr && hooks_->zone_begin != nullptr) {
+        token_ = hooks_->zone_begin(probe, hooks_->user_data);
+    }
+    // Read last so the hook's own cost is not attributed to the batch
+    start_ = registry().now();
+}
+
+ProbeScope::~ProbeScope() {
+    Registry& r = registry();
+    const uint64_t duration = r.now() - start_;
+    ThreadState& state = threadState();
+    const auto p = static_cast<std::size_t>(probe_);
+    add(state.calls[p], 1);
+    add(state.items[p], items_);
+    add(state.nanoseconds[p], duration);
+
+    if (r.recording.load(std::memory_order_relaxed)) {
+        recordEvent(state, {start_, duration, items_, probe_});
+    }
+    if (hooks_ != nullptr && hooks_->zone_end != nullptr) {
+        hooks_->zone_end(probe_, token_, items_, hooks_->user_data);
+    }
+}
+
+namespace detail {
+
+void countProbe(Probe probe) noexcept {
+    add(threadState().calls[static_cast<std::size_t>(probe)], 1);
+}
+
+}  // namespace detail
+
+}  // namespace vne::math
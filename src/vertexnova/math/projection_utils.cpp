@@ -0,0 +1,206 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Corresponding header
+#include "vertexnova/math/projection_utils.h"
+
+// Project headers
+#include "vertexnova/common/macros.h"
+#include "vertexnova/math/instrumentation.h"
+#include "vertexnova/math/simd/float4.h"
+
+// Standard library includes
+#include <algorithm>
+
+namespace vne::math {
+
+// The batch kernels reinterpret the arrays as packed floats.
+static_assert(sizeof(Vec3f) == 3 * sizeof(float), "Vec3f must be tightly packed");
+static_assert(sizeof(Mat4f) == 16 * sizeof(float), "Mat4f must be tightly packed");
+
+namespace {
+
+using simd::Float4;
+
+/// A matrix with every element broadcast across the lanes, indexed [col][row].
+struct BroadcastMat4 {
+    Float4 m[4][4];
+
+    explicit BroadcastMat4(const Mat4f& mat) noexcept {
+        for (int c = 0; c < 4; ++c) {
+            for (int r = 0; r < 4; ++r) {
+                m[c][r] = simd::broadcast(mat[c][r]);
+            }
+        }
+    }
+
+    /// Row r of mat * (x, y, z, 1) for four points.
+    [[nodiscard]] Float4 row(int r, Float4 x, Float4 y, Float4 z) const noexcept {
+        return simd::madd(m[0][r], x, simd::madd(m[1][r], y, simd::madd(m[2][r], z, m[3][r])));
+    }
+};
+
+/// A ScreenMapping with each component broadcast across the lanes.
+struct BroadcastMapping {
+    Float4 scale[3];
+    Float4 offset[3];
+
+    explicit BroadcastMapping(const ScreenMapping& mapping) noexcept {
+        for (int i = 0; i < 3; ++i) {
+            scale[i] = simd::broadcast(mapping.scale[i]);
+            offset[i] = simd::broadcast(mapping.offset[i]);
+        }
+    }
+};
+
+/**
+ * Projects four points. Lanes whose clip w is within kEpsilon of zero produce
+ * (0, 0, -1) like the scalar project(). Returns the lane mask of points in
+ * front of the camera (w > kEpsilon) in bits 0..3.
+ */
+int projectBlock(const float* p, const BroadcastMat4& mvp, const BroadcastMapping& mapping, float* out) noexcept {
+    Float4 px, py, pz;
+    simd::loadXyz(p, px, py, pz);
+
+    const Float4 cx = mvp.row(0, px, py, pz);
+    const Float4 cy = mvp.row(1, px, py, pz);
+    const Float4 cz = mvp.row(2, px, py, pz);
+    const Float4 cw = mvp.row(3, px, py, pz);
+
+    const Float4 one = simd::broadcast(1.0f);
+    const Float4 eps = simd::broadcast(kEpsilon<float>);
+    const Float4 degenerate = simd::cmpLe(simd::abs(cw), eps);
+    const Float4 inv_w = one / simd::select(degenerate, one, cw);
+
+    const Float4 sx = simd::madd(cx * inv_w, mapping.scale[0], mapping.offset[0]);
+    const Float4 sy = simd::madd(cy * inv_w, mapping.scale[1], mapping.offset[1]);
+    const Float4 sz = simd::madd(cz * inv_w, mapping.scale[2], mapping.offset[2]);
+
+    simd::storeXyz(out,
+                   simd::andNot(degenerate, sx),
+                   simd::andNot(degenerate, sy),
+                   simd::select(degenerate, -one, sz));
+    return simd::moveMask(simd::cmpGt(cw, eps));
+}
+
+/**
+ * Unprojects four screen points. Lanes whose homogeneous w is within kEpsilon
+ * of zero produce the origin like the scalar unproject().
+ */
+void unprojectBlock(const float* p,
+                    const BroadcastMat4& inv_mvp,
+                    const BroadcastMapping& inv_mapping,
+                    float* out) noexcept {
+    Float4 sx, sy, sz;
+    simd::loadXyz(p, sx, sy, sz);
+
+    const Float4 nx = simd::madd(sx, inv_mapping.scale[0], inv_mapping.offset[0]);
+    const Float4 ny = simd::madd(sy, inv_mapping.scale[1], inv_mapping.offset[1]);
+    const Float4 nz = simd::madd(sz, inv_mapping.scale[2], inv_mapping.offset[2]);
+
+    const Float4 wx = inv_mvp.row(0, nx, ny, nz);
+    const Float4 wy = inv_mvp.row(1, nx, ny, nz);
+    const Float4 wz = inv_mvp.row(2, nx, ny, nz);
+    const Float4 ww = inv_mvp.row(3, nx, ny, nz);
+
+    const Float4 one = simd::broadcast(1.0f);
+    const Float4 degenerate = simd::cmpLe(simd::abs(ww), simd::broadcast(kEpsilon<float>));
+    const Float4 inv_w = simd::andNot(degenerate, one / simd::select(degenerate, one, ww));
+
+    simd::storeXyz(out, wx * inv_w, wy * inv_w, wz * inv_w);
+}
+
+void writeVisibility(int bits, std::size_t count, uint8_t* out) noexcept {
+    for (std::size_t lane = 0; lane < count; ++lane) {
+        out[lane] = static_cast<uint8_t>((bits >> lane) & 1);
+    }
+}
+
+}  // namespace
+
+void projectPoints(std::span<const Vec3f> world_points,
+                   const Mat4f& mvp,
+                   const ScreenMapping& mapping,
+                   std::span<Vec3f> out_screen,
+                   std::span<uint8_t> out_visible) noexcept {
+    VNE_ASSERT_MSG(out_screen.size() == world_points.size(), "projectPoints: span sizes must match");
+    VNE_ASSERT_MSG(out_visible.empty() || out_visible.size() == world_points.size(),
+                   "projectPoints: visibility span must be empty or match the input size");
+    std::size_t count = std::min(world_points.size(), out_screen.size());
+    const bool want_visibility = !out_visible.empty();
+    if (want_visibility) {
+        count = std::min(count, out_visible.size());
+    }
+    VNE_MATH_PROBE_SCOPE(Probe::eProjectPoints, count);
+
+    const BroadcastMat4 m(mvp);
+    const BroadcastMapping map(mapping);
+
+    const std::size_t full = count - count % simd::kLanes;
+    for (std::size_t i = 0; i < full; i += simd::kLanes) {
+        const int bits = projectBlock(world_points[i].ptr(), m, map, out_screen[i].ptr());
+        if (want_visibility) {
+            writeVisibility(bits, simd::kLanes, &out_visible[i]);
+        }
+    }
+
+    if (full == count) {
+        return;
+    }
+
+    // Pad the tail to a full block so every element goes through the same kernel
+    Vec3f p[simd::kLanes];
+    Vec3f s[simd::kLanes];
+    const std::size_t tail = count - full;
+    std::copy_n(world_points.begin() + static_cast<std::ptrdiff_t>(full), tail, p);
+    const int bits = projectBlock(p[0].ptr(), m, map, s[0].ptr());
+    std::copy_n(s, tail, out_screen.begin() + static_cast<std::ptrdiff_t>(full));
+    if (want_visibility) {
+        writeVisibility(bits, tail, &out_visible[full]);
+    }
+}
+
+void unprojectPoints(std::span<const Vec3f> screen_points,
+                     const Mat4f& inv_mvp,
+                     const ScreenMapping& mapping,
+                     std::span<Vec3f> out_world) noexcept {
+    VNE_ASSERT_MSG(out_world.size() == screen_points.size(), "unprojectPoints: span sizes must match");
+    const std::size_t count = std::min(screen_points.size(), out_world.size());
+    VNE_MATH_PROBE_SCOPE(Probe::eUnprojectPoints, count);
+
+    // ndc = screen / scale - offset / scale
+    ScreenMapping inverse;
+    for (int i = 0; i < 3; ++i) {
+        inverse.scale[i] = 1.0f / mapping.scale[i];
+        inverse.offset[i] = -mapping.offset[i] * inverse.scale[i];
+    }
+
+    const BroadcastMat4 m(inv_mvp);
+    const BroadcastMapping map(inverse);
+
+    const std::size_t full = count - count % simd::kLanes;
+    for (std::size_t i = 0; i < full; i += simd::kLanes) {
+        unprojectBlock(screen_points[i].ptr(), m, map, out_world[i].ptr());
+    }
+
+    if (full == count) {
+        return;
+    }
+
+    Vec3f p[simd::kLanes];
+    Vec3f w[simd::kLanes];
+    const std::size_t tail = count - full;
+    std::copy_n(screen_points.begin() + static_cast<std::ptrdiff_t>(full), tail, p);
+    unprojectBlock(p[0].ptr(), m, map, w[0].ptr());
+    std::copy_n(w, tail, out_world.begin() + static_cast<std::ptrdiff_t>(full));
+}
+
+}  // namespace vne::math
@@ -0,0 +1,184 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Corresponding header
+#include "vertexnova/math/shadow_cascades.h"
+
+// Project headers
+#include "vertexnova/common/macros.h"
+
+// Standard library includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace vne::math {
+
+namespace {
+
+/// Stable-fit radii are rounded up to this fraction of a world unit so float
+/// noise in the slice geometry never changes the texel size.
+constexpr float kRadiusQuantum = 1.0f / 16.0f;
+
+/// |light_direction.y| above which world Y is too close to the light to serve as up.
+constexpr float kUpAxisThreshold = 0.99f;
+
+constexpr uint32_t kSliceCornerCount = 8;
+
+/// Light-space bounds of one cascade. Depth grows away from the light.
+struct LightBounds {
+    Vec3f min{std::numeric_limits<float>::max()};
+    Vec3f max{std::numeric_limits<float>::lowest()};
+
+    void expand(const Vec3f& p) noexcept {
+        min = Vec3f::min(min, p);
+        max = Vec3f::max(max, p);
+    }
+};
+
+/// Snaps [lo, hi] to whole texels. Keeping the width fixed preserves a stable
+/// texel size; otherwise both ends grow outward to the texel grid.
+void snapRange(float& lo, float& hi, uint32_t resolution, bool keep_width) noexcept {
+    const float width = hi - lo;
+    const float texel = width / static_cast<float>(resolution);
+    if (texel <= 0.0f) {
+        return;
+    }
+    lo = std::floor(lo / texel) * texel;
+    hi = keep_width ? lo + width : std::ceil(hi / texel) * texel;
+}
+
+}  // namespace
+
+void computeCascadeSplits(float z_near,
+                          float z_far,
+                          std::span<float> out_splits,
+                          CascadeSplitScheme scheme,
+                          float lambda) noexcept {
+    VNE_ASSERT_MSG(out_splits.size() >= 2, "computeCascadeSplits: need at least two boundaries");
+    VNE_ASSERT_MSG(z_near > 0.0f && z_far > z_near, "computeCascadeSplits: invalid depth range");
+    if (out_splits.size() < 2) {
+        return;
+    }
+
+    switch (scheme) {
+        case CascadeSplitScheme::eLinear:
+            lambda = 0.0f;
+            break;
+        case CascadeSplitScheme::eLogarithmic:
+            lambda = 1.0f;
+            break;
+        default:
+            lambda = std::clamp(lambda, 0.0f, 1.0f);
+            break;
+    }
+
+    const std::size_t cascades = out_splits.size() - 1;
+    const float ratio = z_far / z_near;
+    for (std::size_t i = 0; i <= cascades; ++i) {
+        const float t = static_cast<float>(i) / static_cast<float>(cascades);
+        const float log_split = z_near * std::pow(ratio, t);
+        const float linear_split = z_near + (z_far - z_near) * t;
+        out_splits[i] = lambda * log_split + (1.0f - lambda) * linear_split;
+    }
+
+    // Pin the ends exactly so adjacent cascades and the shadow distance agree
+    out_splits.front() = z_near;
+    out_splits.back() = z_far;
+}
+
+void computeShadowCascades(const CascadeCamera& camera,
+                           std::span<const float> splits,
+                           const ShadowCascadeSettings& settings,
+                           std::span<ShadowCascade> out_cascades) noexcept {
+    VNE_ASSERT_MSG(splits.size() == out_cascades.size() + 1,
+                   "computeShadowCascades: need one more split than cascades");
+    if (splits.size() < 2) {
+        return;
+    }
+    const std::size_t count = std::min(splits.size() - 1, out_cascades.size());
+
+    const GraphicsApi api = settings.api;
+    const ClipSpaceDepth clip_depth = getClipSpaceDepth(api);
+    const float light_depth_sign = getHandedness(api) == Handedness::eRight ? -1.0f : 1.0f;
+    const float camera_depth_sign = camera.handedness == Handedness::eRight ? -1.0f : 1.0f;
+    const uint32_t resolution = std::max(settings.resolution, 1u);
+    const bool stable = settings.fit == CascadeFitMode::eStable;
+
+    // One light orientation for every cascade: only the ortho window moves,
+    // which is what makes texel snapping effective.
+    const Vec3f light_dir = settings.light_direction.normalized();
+    const Vec3f up = std::abs(light_dir.y()) > kUpAxisThreshold ? Vec3f::zAxis() : Vec3f::yAxis();
+    const Mat4f light_view = Mat4f::lookAt(Vec3f::zero(), light_dir, up, api);
+
+    const Mat4f camera_to_world = camera.view.inverse();
+    const float tan_y = std::tan(camera.fov_y * 0.5f);
+    const float tan_x = tan_y * camera.aspect;
+    const float slant_sq = tan_x * tan_x + tan_y * tan_y;
+
+    auto to_light = [&](const Vec3f& camera_point) {
+        const Vec4f world = camera_to_world * Vec4f(camera_point, 1.0f);
+        const Vec4f light = light_view * Vec4f(world.xyz(), 1.0f);
+        return Vec3f(light.x(), light.y(), light.z() * light_depth_sign);
+    };
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const float slice_near = splits[i];
+        const float slice_far = splits[i + 1];
+
+        LightBounds bounds;
+        if (stable) {
+            // Minimal sphere around the slice: its size depends only on the
+            // projection, so it is identical however the camera is oriented.
+            float center_depth = 0.5f * (slice_far + slice_near) * (1.0f + slant_sq);
+            float radius;
+            if (center_depth >= slice_far) {
+                center_depth = slice_far;
+                radius = slice_far * std::sqrt(slant_sq);
+            } else {
+                const float to_far = slice_far - center_depth;
+                radius = std::sqrt(to_far * to_far + slice_far * slice_far * slant_sq);
+            }
+            radius = std::ceil(radius / kRadiusQuantum) * kRadiusQuantum;
+
+            const Vec3f center = to_light(Vec3f(0.0f, 0.0f, camera_depth_sign * center_depth));
+            bounds.min = center - Vec3f(radius);
+            bounds.max = center + Vec3f(radius);
+        } else {
+            for (uint32_t c = 0; c < kSliceCornerCount; ++c) {
+                const float depth = (c & 4u) ? slice_far : slice_near;
+                const float sx = (c & 1u) ? 1.0f : -1.0f;
+                const float sy = (c & 2u) ? 1.0f : -1.0f;
+                bounds.expand(to_light(Vec3f(sx * depth * tan_x, sy * depth * tan_y, camera_depth_sign * depth)));
+            }
+        }
+
+        if (settings.snap_to_texels) {
+            snapRange(bounds.min.x(), bounds.max.x(), resolution, stable);
+            snapRange(bounds.min.y(), bounds.max.y(), resolution, stable);
+        }
+
+        const float z_near = bounds.min.z() - settings.caster_extension;
+        const float z_far = bounds.max.z();
+
+        ShadowCascade& cascade = out_cascades[i];
+        cascade.view = light_view;
+        cascade.projection =
+            Mat4f::ortho(bounds.min.x(), bounds.max.x(), bounds.min.y(), bounds.max.y(), z_near, z_far, api);
+        cascade.view_projection = cascade.projection * light_view;
+        cascade.frustum.extractFromMatrix(cascade.view_projection, clip_depth);
+        cascade.split_near = slice_near;
+        cascade.split_far = slice_far;
+        cascade.texel_size = (bounds.max.x() - bounds.min.x()) / static_cast<float>(resolution);
+    }
+}
+
+}  // namespace vne::math
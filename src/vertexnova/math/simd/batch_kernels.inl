@@ -0,0 +1,466 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file batch_kernels.inl
+ * @brief Block kernels behind the dispatched batch APIs.
+ *
+ * Included once by each kernels_*.cpp, which defines VNE_MATH_SIMD_ISA and is
+ * compiled with that instruction set enabled. The kernels only see float4.h
+ * and raw float pointers: any other inline function pulled in here would be
+ * compiled with the wider instruction set and could be picked by the linker
+ * for callers on older CPUs.
+ */
+
+// Project headers
+#include "vertexnova/math/simd/dispatch.h"
+#include "vertexnova/math/simd/float4.h"
+
+namespace vne::math::simd {
+inline namespace VNE_MATH_SIMD_ISA {
+namespace {
+
+/// Upper bound on polar iterations; scaled Newton typically needs 6-9 in float.
+constexpr int kMaxPolarIterations = 24;
+
+/// Squared Frobenius step size below which the polar iteration has converged.
+constexpr float kPolarTolerance = 1e-10f;
+
+/// Step size below which the iteration switches from scaled to plain Newton.
+constexpr float kPolarScalingCutoff = 1e-4f;
+
+/// |det| relative to the product of column lengths below which a basis is singular.
+constexpr float kSingularRatio = 1e-6f;
+
+/// Floats per box: min xyz, max xyz.
+constexpr int kAabbFloats = 6;
+
+/// Floats per decomposeAffine result: translation, rotation, scale, shear.
+constexpr int kAffineFloats = 13;
+
+// ============================================================================
+// Shared Helpers
+// ============================================================================
+
+/**
+ * Loads four consecutive boxes as per-component registers.
+ *
+ * Each box is read as floats 0-3 (min xyz, max x) and 2-5 (min z, max xyz) so
+ * a transpose turns four boxes into per-component registers without reading
+ * past the box.
+ */
+void loadAabbSoa(const float* boxes, Float4 (&lo)[3], Float4 (&hi)[3]) noexcept {
+    Float4 lo_w = load(boxes + 3 * kAabbFloats);
+    lo[0] = load(boxes);
+    lo[1] = load(boxes + kAabbFloats);
+    lo[2] = load(boxes + 2 * kAabbFloats);
+    transpose(lo[0], lo[1], lo[2], lo_w);
+    Float4 hi_z = load(boxes + 2);
+    hi[0] = load(boxes + kAabbFloats + 2);
+    hi[1] = load(boxes + 2 * kAabbFloats + 2);
+    hi[2] = load(boxes + 3 * kAabbFloats + 2);
+    transpose(hi_z, hi[0], hi[1], hi[2]);
+}
+
+/**
+ * Loads four consecutive Mat4f as structure-of-arrays: cols[c][r] holds
+ * element (row r, column c) of all four matrices.
+ */
+void loadMat4Soa(const float* m, Float4 (&cols)[4][4]) noexcept {
+    for (int c = 0; c < 4; ++c) {
+        cols[c][0] = load(m + 4 * c);
+        cols[c][1] = load(m + 16 + 4 * c);
+        cols[c][2] = load(m + 32 + 4 * c);
+        cols[c][3] = load(m + 48 + 4 * c);
+        transpose(cols[c][0], cols[c][1], cols[c][2], cols[c][3]);
+    }
+}
+
+void cross3(const Float4 (&a)[3], const Float4 (&b)[3], Float4 (&out)[3]) noexcept {
+    out[0] = a[1] * b[2] - a[2] * b[1];
+    out[1] = a[2] * b[0] - a[0] * b[2];
+    out[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+[[nodiscard]] Float4 dot3(const Float4 (&a)[3], const Float4 (&b)[3]) noexcept {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+/**
+ * Converts an orthonormal basis (m[c][r] = row r of column c) to quaternions
+ * with the same case selection and tie-breaking as glm::quat_cast.
+ */
+void quatFromBasis(const Float4 (&m)[3][3], Float4& qx, Float4& qy, Float4& qz, Float4& qw) noexcept {
+    const Float4 m00 = m[0][0], m10 = m[0][1], m20 = m[0][2];
+    const Float4 m01 = m[1][0], m11 = m[1][1], m21 = m[1][2];
+    const Float4 m02 = m[2][0], m12 = m[2][1], m22 = m[2][2];
+
+    const Float4 four_w = m00 + m11 + m22;
+    const Float4 four_x = m00 - m11 - m22;
+    const Float4 four_y = m11 - m00 - m22;
+    const Float4 four_z = m22 - m00 - m11;
+
+    // Sequential strict-greater selection, same tie-breaking as the scalar path
+    Float4 biggest = four_w;
+    const Float4 pick_x = cmpGt(four_x, biggest);
+    biggest = select(pick_x, four_x, biggest);
+    const Float4 pick_y = cmpGt(four_y, biggest);
+    biggest = select(pick_y, four_y, biggest);
+    const Float4 pick_z = cmpGt(four_z, biggest);
+    biggest = select(pick_z, four_z, biggest);
+
+    const Float4 big = sqrt(biggest + broadcast(1.0f)) * broadcast(0.5f);
+    const Float4 mult = broadcast(0.25f) / big;
+
+    const Float4 a = (m21 - m12) * mult;
+    const Float4 b = (m02 - m20) * mult;
+    const Float4 c = (m10 - m01) * mult;
+    const Float4 d = (m10 + m01) * mult;
+    const Float4 e = (m02 + m20) * mult;
+    const Float4 f = (m21 + m12) * mult;
+
+    qx = a;
+    qy = b;
+    qz = c;
+    qw = big;
+    qx = select(pick_x, big, qx);
+    qy = select(pick_x, d, qy);
+    qz = select(pick_x, e, qz);
+    qw = select(pick_x, a, qw);
+    qx = select(pick_y, d, qx);
+    qy = select(pick_y, big, qy);
+    qz = select(pick_y, f, qz);
+    qw = select(pick_y, b, qw);
+    qx = select(pick_z, e, qx);
+    qy = select(pick_z, f, qy);
+    qz = select(pick_z, big, qz);
+    qw = select(pick_z, c, qw);
+}
+
+// ============================================================================
+// Bounding Boxes
+// ============================================================================
+
+/**
+ * Transforms four boxes at once, one box per SIMD lane. All loads happen
+ * before the first store, so @p out may alias @p boxes.
+ */
+void transformAabbs4(const float* boxes, const float* matrices, float* out) noexcept {
+    Float4 lo_in[3];
+    Float4 hi_in[3];
+    loadAabbSoa(boxes, lo_in, hi_in);
+    const Float4 min_x = lo_in[0], min_y = lo_in[1], min_z = lo_in[2];
+    const Float4 max_x = hi_in[0], max_y = hi_in[1], max_z = hi_in[2];
+
+    // m[c][r]: row r of column c for the four matrices
+    Float4 m[4][4];
+    loadMat4Soa(matrices, m);
+
+    const Float4 half = broadcast(0.5f);
+    const Float4 cx = (min_x + max_x) * half;
+    const Float4 cy = (min_y + max_y) * half;
+    const Float4 cz = (min_z + max_z) * half;
+    const Float4 ex = (max_x - min_x) * half;
+    const Float4 ey = (max_y - min_y) * half;
+    const Float4 ez = (max_z - min_z) * half;
+
+    Float4 new_min[3];
+    Float4 new_max[3];
+    for (int r = 0; r < 3; ++r) {
+        const Float4 center = madd(m[0][r], cx, madd(m[1][r], cy, madd(m[2][r], cz, m[3][r])));
+        const Float4 extent = madd(abs(m[0][r]), ex, madd(abs(m[1][r]), ey, abs(m[2][r]) * ez));
+        new_min[r] = center - extent;
+        new_max[r] = center + extent;
+    }
+
+    // Invalid boxes pass through unchanged
+    const Float4 valid = cmpLe(min_x, max_x) & cmpLe(min_y, max_y) & cmpLe(min_z, max_z);
+    Float4 lo0 = select(valid, new_min[0], min_x);
+    Float4 lo1 = select(valid, new_min[1], min_y);
+    Float4 lo2 = select(valid, new_min[2], min_z);
+    Float4 lo3 = select(valid, new_max[0], max_x);
+    Float4 hi0 = lo2;
+    Float4 hi1 = lo3;
+    Float4 hi2 = select(valid, new_max[1], max_y);
+    Float4 hi3 = select(valid, new_max[2], max_z);
+    transpose(lo0, lo1, lo2, lo3);
+    transpose(hi0, hi1, hi2, hi3);
+
+    const Float4 lo[kLanes] = {lo0, lo1, lo2, lo3};
+    const Float4 hi[kLanes] = {hi0, hi1, hi2, hi3};
+    for (int k = 0; k < kLanes; ++k) {
+        store(out + kAabbFloats * k, lo[k]);
+        store(out + kAabbFloats * k + 2, hi[k]);
+    }
+}
+
+/**
+ * Culls four boxes against a frustum with the p-vertex test of
+ * Frustum::intersects(const Aabb&). The normal is shared by all lanes, so the
+ * p-vertex corner is picked once per plane. Returns the mask of lanes that
+ * are not entirely behind any plane.
+ */
+int cullAabbs4(const float* planes, uint32_t plane_count, const float* boxes) noexcept {
+    Float4 lo[3];
+    Float4 hi[3];
+    loadAabbSoa(boxes, lo, hi);
+
+    const Float4 zero = simd::zero();
+    Float4 outside = cmpLt(zero, zero);
+    for (uint32_t i = 0; i < plane_count; ++i) {
+        const float* plane = planes + 4 * i;
+        Float4 dist = broadcast(plane[0]) * (plane[0] >= 0.0f ? hi[0] : lo[0]);
+        dist = dist + broadcast(plane[1]) * (plane[1] >= 0.0f ? hi[1] : lo[1]);
+        dist = dist + broadcast(plane[2]) * (plane[2] >= 0.0f ? hi[2] : lo[2]);
+        dist = dist + broadcast(plane[3]);
+        outside = outside | cmpLt(dist, zero);
+        if (allTrue(outside)) {
+            break;
+        }
+    }
+    return ~moveMask(outside) & 0xF;
+}
+
+// ============================================================================
+// Transform Decomposition
+// ============================================================================
+
+/**
+ * Composes four transforms. Inputs point at 4 consecutive elements, output at
+ * 4 consecutive matrices. The basis matches glm::mat3_cast.
+ */
+void compose4(const float* t, const float* q, const float* s, float* out) noexcept {
+    Float4 qx = load(q);
+    Float4 qy = load(q + 4);
+    Float4 qz = load(q + 8);
+    Float4 qw = load(q + 12);
+    transpose(qx, qy, qz, qw);
+
+    Float4 tx, ty, tz;
+    Float4 sx, sy, sz;
+    loadXyz(t, tx, ty, tz);
+    loadXyz(s, sx, sy, sz);
+
+    const Float4 one = broadcast(1.0f);
+    const Float4 two = broadcast(2.0f);
+
+    const Float4 xx = qx * qx;
+    const Float4 yy = qy * qy;
+    const Float4 zz = qz * qz;
+    const Float4 xy = qx * qy;
+    const Float4 xz = qx * qz;
+    const Float4 yz = qy * qz;
+    const Float4 wx = qw * qx;
+    const Float4 wy = qw * qy;
+    const Float4 wz = qw * qz;
+
+    // Column c, row r of the scaled rotation
+    Float4 c0x = (one - two * (yy + zz)) * sx;
+    Float4 c0y = two * (xy + wz) * sx;
+    Float4 c0z = two * (xz - wy) * sx;
+    Float4 c1x = two * (xy - wz) * sy;
+    Float4 c1y = (one - two * (xx + zz)) * sy;
+    Float4 c1z = two * (yz + wx) * sy;
+    Float4 c2x = two * (xz + wy) * sz;
+    Float4 c2y = two * (yz - wx) * sz;
+    Float4 c2z = (one - two * (xx + yy)) * sz;
+
+    // SoA -> AoS: after transposing, register k holds column c of matrix k.
+    Float4 c0w = zero();
+    Float4 c1w = zero();
+    Float4 c2w = zero();
+    Float4 c3w = one;
+    transpose(c0x, c0y, c0z, c0w);
+    transpose(c1x, c1y, c1z, c1w);
+    transpose(c2x, c2y, c2z, c2w);
+    transpose(tx, ty, tz, c3w);
+
+    const Float4 col0[4] = {c0x, c0y, c0z, c0w};
+    const Float4 col1[4] = {c1x, c1y, c1z, c1w};
+    const Float4 col2[4] = {c2x, c2y, c2z, c2w};
+    const Float4 col3[4] = {tx, ty, tz, c3w};
+    for (int k = 0; k < kLanes; ++k) {
+        float* m = out + 16 * k;
+        store(m, col0[k]);
+        store(m + 4, col1[k]);
+        store(m + 8, col2[k]);
+        store(m + 12, col3[k]);
+    }
+}
+
+/**
+ * Decomposes four matrices. Mirrors the scalar decompose(): column lengths as
+ * scale, reflection folded into scale.x, zero-length axes left unnormalized.
+ */
+void decompose4(const float* m, float* t, float* q, float* s) noexcept {
+    Float4 cols[4][4];
+    loadMat4Soa(m, cols);
+
+    const Float4 zero = simd::zero();
+    const Float4 one = broadcast(1.0f);
+    const Float4(&a)[4] = cols[0];
+    const Float4(&b)[4] = cols[1];
+    const Float4(&c)[4] = cols[2];
+
+    Float4 sx = sqrt(a[0] * a[0] + a[1] * a[1] + a[2] * a[2]);
+    const Float4 sy = sqrt(b[0] * b[0] + b[1] * b[1] + b[2] * b[2]);
+    const Float4 sz = sqrt(c[0] * c[0] + c[1] * c[1] + c[2] * c[2]);
+
+    // det = (col0 x col1) . col2
+    const Float4 det = (a[1] * b[2] - a[2] * b[1]) * c[0] + (a[2] * b[0] - a[0] * b[2]) * c[1]
+                       + (a[0] * b[1] - a[1] * b[0]) * c[2];
+    sx = select(cmpLt(det, zero), -sx, sx);
+
+    const Float4 inv_sx = select(cmpEq(sx, zero), one, one / sx);
+    const Float4 inv_sy = select(cmpEq(sy, zero), one, one / sy);
+    const Float4 inv_sz = select(cmpEq(sz, zero), one, one / sz);
+
+    const Float4 basis[3][3] = {{a[0] * inv_sx, a[1] * inv_sx, a[2] * inv_sx},
+                                {b[0] * inv_sy, b[1] * inv_sy, b[2] * inv_sy},
+                                {c[0] * inv_sz, c[1] * inv_sz, c[2] * inv_sz}};
+
+    Float4 qx, qy, qz, qw;
+    quatFromBasis(basis, qx, qy, qz, qw);
+
+    transpose(qx, qy, qz, qw);
+    store(q, qx);
+    store(q + 4, qy);
+    store(q + 8, qz);
+    store(q + 12, qw);
+
+    storeXyz(t, cols[3][0], cols[3][1], cols[3][2]);
+    storeXyz(s, sx, sy, sz);
+}
+
+/**
+ * Polar-decomposes four 3x3 bases (l[c][r]) into proper rotations q.
+ * Returns a lane bitmask of singular inputs, whose q is left as identity.
+ */
+int polarBlock(const Float4 (&l)[3][3], Float4 (&q)[3][3]) noexcept {
+    const Float4 zero = simd::zero();
+    const Float4 one = broadcast(1.0f);
+    const Float4 half = broadcast(0.5f);
+
+    Float4 c[3][3];
+    cross3(l[1], l[2], c[0]);
+    const Float4 det = dot3(l[0], c[0]);
+    const Float4 hadamard = sqrt(dot3(l[0], l[0]) * dot3(l[1], l[1]) * dot3(l[2], l[2]));
+    const Float4 singular = cmpLe(abs(det), hadamard * broadcast(kSingularRatio));
+
+    // Start from sign(det) * L so the iteration converges to a proper rotation
+    const Float4 sign = select(cmpLt(det, zero), -one, one);
+    for (int col = 0; col < 3; ++col) {
+        for (int row = 0; row < 3; ++row) {
+            const Float4 identity = row == col ? one : zero;
+            q[col][row] = select(singular, identity, l[col][row] * sign);
+        }
+    }
+
+    Float4 scaling = cmpEq(zero, zero);
+    for (int iter = 0; iter < kMaxPolarIterations; ++iter) {
+        // Columns of the cofactor matrix: det * Q^-T
+        cross3(q[1], q[2], c[0]);
+        cross3(q[2], q[0], c[1]);
+        cross3(q[0], q[1], c[2]);
+        const Float4 d = dot3(q[0], c[0]);
+
+        const Float4 norm_q = dot3(q[0], q[0]) + dot3(q[1], q[1]) + dot3(q[2], q[2]);
+        const Float4 norm_c = dot3(c[0], c[0]) + dot3(c[1], c[1]) + dot3(c[2], c[2]);
+
+        // Frobenius scaling: g = sqrt(|Q^-1| / |Q|)
+        Float4 gamma = sqrt(sqrt(norm_c / (d * d * norm_q)));
+        gamma = select(scaling, gamma, one);
+
+        const Float4 wq = half * gamma;
+        const Float4 wc = half / (gamma * d);
+
+        Float4 delta = zero;
+        for (int col = 0; col < 3; ++col) {
+            for (int row = 0; row < 3; ++row) {
+                const Float4 next = wq * q[col][row] + wc * c[col][row];
+                const Float4 step = next - q[col][row];
+                delta = delta + step * step;
+                q[col][row] = next;
+            }
+        }
+
+        if (allTrue(cmpLt(delta, broadcast(kPolarTolerance)))) {
+            break;
+        }
+        scaling = scaling & cmpGt(delta, broadcast(kPolarScalingCutoff));
+    }
+
+    return moveMask(singular);
+}
+
+/**
+ * Decomposes four affine matrices into kAffineFloats floats each.
+ * Returns a lane bitmask of singular inputs that the caller must patch.
+ */
+int decomposeAffine4(const float* m, float* out) noexcept {
+    Float4 cols[4][4];
+    loadMat4Soa(m, cols);
+
+    const Float4 l[3][3] = {{cols[0][0], cols[0][1], cols[0][2]},
+                            {cols[1][0], cols[1][1], cols[1][2]},
+                            {cols[2][0], cols[2][1], cols[2][2]}};
+    Float4 q[3][3];
+    const int singular = polarBlock(l, q);
+
+    // S = R^T L, symmetrized to absorb rounding
+    Float4 p[3][3];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            p[i][j] = dot3(q[i], l[j]);
+        }
+    }
+    const Float4 half = broadcast(0.5f);
+    const Float4 shear_xy = (p[0][1] + p[1][0]) * half;
+    const Float4 shear_xz = (p[0][2] + p[2][0]) * half;
+    const Float4 shear_yz = (p[1][2] + p[2][1]) * half;
+
+    Float4 qx, qy, qz, qw;
+    quatFromBasis(q, qx, qy, qz, qw);
+    const Float4 inv_len = broadcast(1.0f) / sqrt(qx * qx + qy * qy + qz * qz + qw * qw);
+    qx = qx * inv_len;
+    qy = qy * inv_len;
+    qz = qz * inv_len;
+    qw = qw * inv_len;
+
+    float lanes[kAffineFloats][kLanes];
+    const Float4 results[kAffineFloats] = {cols[3][0], cols[3][1], cols[3][2], qx, qy, qz, qw,
+                                           p[0][0], p[1][1], p[2][2], shear_xy, shear_xz, shear_yz};
+    for (int k = 0; k < kAffineFloats; ++k) {
+        store(lanes[k], results[k]);
+    }
+    for (int i = 0; i < kLanes; ++i) {
+        for (int k = 0; k < kAffineFloats; ++k) {
+            out[kAffineFloats * i + k] = lanes[k][i];
+        }
+    }
+    return singular;
+}
+
+// ============================================================================
+// Table
+// ============================================================================
+
+const BatchKernels kBatchKernels{
+    transformAabbs4,
+    compose4,
+    decompose4,
+    decomposeAffine4,
+    cullAabbs4,
+};
+
+}  // namespace
+}  // namespace VNE_MATH_SIMD_ISA
+}  // namespace vne::math::simd
@@ -0,0 +1,73 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file dispatch.h
+ * @brief Internal table of batch kernels selected at run time.
+ *
+ * The block kernels behind the batch APIs are compiled once per instruction
+ * set (kernels_*.cpp, each including batch_kernels.inl with its own compiler
+ * flags). batchKernels() returns the table for the level chosen by
+ * setSimdLevel(), the VNE_MATH_SIMD environment variable or CPU detection.
+ *
+ * Every kernel processes one block of four elements through raw float
+ * pointers so the table does not depend on any library type. The batch APIs
+ * pad their tails to a full block.
+ *
+ * This header is private to the library; public headers never include it.
+ */
+
+// Standard library includes
+#include <cstddef>
+#include <cstdint>
+
+namespace vne::math::simd {
+
+/// Elements processed by one kernel call.
+inline constexpr std::size_t kBlockSize = 4;
+
+/**
+ * @struct BatchKernels
+ * @brief One instruction set's implementation of every dispatched block kernel.
+ */
+struct BatchKernels {
+    /// 4 boxes (6 floats each) by 4 column-major matrices; @p out may alias @p boxes
+    void (*transform_aabbs4)(const float* boxes, const float* matrices, float* out) noexcept;
+
+    /// 4 translations (xyz), rotations (xyzw) and scales (xyz) to 4 matrices
+    void (*compose4)(const float* t, const float* q, const float* s, float* out) noexcept;
+
+    /// 4 matrices to translations, rotations and scales
+    void (*decompose4)(const float* m, float* t, float* q, float* s) noexcept;
+
+    /// 4 matrices to 13 floats each (translation, rotation, scale, shear); returns the singular-lane mask
+    int (*decompose_affine4)(const float* m, float* out) noexcept;
+
+    /// 4 boxes (6 floats each) against @p plane_count planes (nx ny nz d); returns the visible-lane mask
+    int (*cull_aabbs4)(const float* planes, uint32_t plane_count, const float* boxes) noexcept;
+};
+
+/// @name Per-ISA Tables
+/// Each returns nullptr when this build or target cannot compile that instruction set.
+/// @{
+[[nodiscard]] const BatchKernels* scalarKernels() noexcept;
+[[nodiscard]] const BatchKernels* sse2Kernels() noexcept;
+[[nodiscard]] const BatchKernels* sse42Kernels() noexcept;
+[[nodiscard]] const BatchKernels* avx2Kernels() noexcept;
+[[nodiscard]] const BatchKernels* avx512Kernels() noexcept;
+[[nodiscard]] const BatchKernels* neonKernels() noexcept;
+/// @}
+
+/// Table for the active SIMD level
+[[nodiscard]] const BatchKernels& batchKernels() noexcept;
+
+}  // namespace vne::math::simd
@@ -0,0 +1,513 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file float4.h
+ * @brief Internal 4-wide float SIMD abstraction used by the batch kernels.
+ *
+ * Backends are selected at compile time: SSE2 on x86/x64, NEON on AArch64,
+ * and a portable scalar fallback everywhere else. Define VNE_MATH_NO_SIMD to
+ * force the scalar fallback. When the translation unit is built with FMA or
+ * SSE4.1 enabled, madd() and select() use the fused and blend instructions.
+ *
+ * Everything is declared in an inline namespace named by VNE_MATH_SIMD_ISA
+ * (default: baseline). The runtime-dispatched kernels compile this header
+ * once per instruction set; distinct namespaces keep the linker from folding
+ * an AVX2 copy of an inline function into code that must run on any x86-64.
+ *
+ * This header is private to the library; public headers never include it.
+ */
+
+// Standard library includes
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if !defined(VNE_MATH_NO_SIMD) \
+    && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define VNE_MATH_SIMD_SSE2 1
+#include <emmintrin.h>
+#elif !defined(VNE_MATH_NO_SIMD) && (defined(__aarch64__) || defined(_M_ARM64))
+#define VNE_MATH_SIMD_NEON 1
+#include <arm_neon.h>
+#else
+#define VNE_MATH_SIMD_SCALAR 1
+#endif
+
+#if defined(VNE_MATH_SIMD_SSE2) && (defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__)))
+#define VNE_MATH_SIMD_FMA 1
+#include <immintrin.h>
+#endif
+
+#if defined(VNE_MATH_SIMD_SSE2) && (defined(__SSE4_1__) || (defined(_MSC_VER) && defined(__AVX__)))
+#define VNE_MATH_SIMD_SSE41 1
+#include <smmintrin.h>
+#endif
+
+#if !defined(VNE_MATH_SIMD_ISA)
+#define VNE_MATH_SIMD_ISA baseline
+#endif
+
+namespace vne::math::simd {
+inline namespace VNE_MATH_SIMD_ISA {
+
+/// Number of float lanes in a Float4 register.
+inline constexpr int kLanes = 4;
+
+/**
+ * @struct Float4
+ * @brief Four packed floats. Comparison results are lane masks (all bits set or clear).
+ */
+struct Float4 {
+#if defined(VNE_MATH_SIMD_SSE2)
+    __m128 v;
+#elif defined(VNE_MATH_SIMD_NEON)
+    float32x4_t v;
+#else
+    float v[4];
+#endif
+};
+
+// ============================================================================
+// Load / Store
+// ============================================================================
+
+/// Loads four floats from unaligned memory.
+[[nodiscard]] inline Float4 load(const float* p) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    return {_mm_loadu_ps(p)};
+#elif defined(VNE_MATH_SIMD_NEON)
+    return {vld1q_f32(p)};
+#else
+    return {{p[0], p[1], p[2], p[3]}};
+#endif
+}
+
+/// Stores four floats to unaligned memory.
+inline void store(float* p, Float4 a) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    _mm_storeu_ps(p, a.v);
+#elif defined(VNE_MATH_SIMD_NEON)
+    vst1q_f32(p, a.v);
+#else
+    std::memcpy(p, a.v, sizeof(a.v));
+#endif
+}
+
+/// Broadcasts a scalar to all lanes.
+[[nodiscard]] inline Float4 broadcast(float s) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    return {_mm_set1_ps(s)};
+#elif defined(VNE_MATH_SIMD_NEON)
+    return {vdupq_n_f32(s)};
+#else
+    return {{s, s, s, s}};
+#endif
+}
+
+/// Builds a register from four lanes (lane 0 first).
+[[nodiscard]] inline Float4 set(float a, float b, float c, float d) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    return {_mm_setr_ps(a, b, c, d)};
+#elif defined(VNE_MATH_SIMD_NEON)
+    const float tmp[4] = {a, b, c, d};
+    return {vld1q_f32(tmp)};
+#else
+    return {{a, b, c, d}};
+#endif
+}
+
+/// All lanes zero.
+[[nodiscard]] inline Float4 zero() noexcept {
+    return broadcast(0.0f);
+}
+
+/// Extracts lane @p i (slow path; intended for tails and tests).
+[[nodiscard]] inline float lane(Float4 a, int i) noexcept {
+    float tmp[4];
+    store(tmp, a);
+    return tmp[i];
+}
+
+// ============================================================================
+// Arithmetic
+// ============================================================================
+
+[[nodiscard]] inline Float4 operator+(Float4 a, Float4 b) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    return {_mm_add_ps(a.v, b.v)};
+#elif defined(VNE_MATH_SIMD_NEON)
+    return {vaddq_f32(a.v, b.v)};
+#else
+    return {{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}};
+#endif
+}
+
+[[nodiscard]] inline Float4 operator-(Float4 a, Float4 b) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    return {_mm_sub_ps(a.v, b.v)};
+#elif defined(VNE_MATH_SIMD_NEON)
+    return {vsubq_f32(a.v, b.v)};
+#else
+    return {{a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]}};
+#endif
+}
+
+[[nodiscard]] inline Float4 operator*(Float4 a, Float4 b) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    return {_mm_mul_ps(a.v, b.v)};
+#elif defined(VNE_MATH_SIMD_NEON)
+    return {vmulq_f32(a.v, b.v)};
+#else
+    return {{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}};
+#endif
+}
+
+[[nodiscard]] inline Float4 operator/(Float4 a, Float4 b) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    return {_mm_div_ps(a.v, b.v)};
+#elif defined(VNE_MATH_SIMD_NEON)
+    return {vdivq_f32(a.v, b.v)};
+#else
+    return {{a.v[0] / b.v[0], a.v[1] / b.v[1], a.v[2] / b.v[2], a.v[3] / b.v[3]}};
+#endif
+}
+
+[[nodiscard]] inline Float4 operator-(Float4 a) noexcept {
+    return zero() - a;
+}
+
+/// Returns a * b + c.
+[[nodiscard]] inline Float4 madd(Float4 a, Float4 b, Float4 c) noexcept {
+#if defined(VNE_MATH_SIMD_FMA)
+    return {_mm_fmadd_ps(a.v, b.v, c.v)};
+#elif defined(VNE_MATH_SIMD_NEON)
+    return {vfmaq_f32(c.v, a.v, b.v)};
+#else
+    return a * b + c;
+#endif
+}
+
+[[nodiscard]] inline Float4 min(Float4 a, Float4 b) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    return {_mm_min_ps(a.v, b.v)};
+#elif defined(VNE_MATH_SIMD_NEON)
+    return {vminq_f32(a.v, b.v)};
+#else
+    Float4 r;
+    for (int i = 0; i < kLanes; ++i) {
+        r.v[i] = a.v[i] < b.v[i] ? a.v[i] : b.v[i];
+    }
+    return r;
+#endif
+}
+
+[[nodiscard]] inline Float4 max(Float4 a, Float4 b) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    return {_mm_max_ps(a.v, b.v)};
+#elif defined(VNE_MATH_SIMD_NEON)
+    return {vmaxq_f32(a.v, b.v)};
+#else
+    Float4 r;
+    for (int i = 0; i < kLanes; ++i) {
+        r.v[i] = a.v[i] > b.v[i] ? a.v[i] : b.v[i];
+    }
+    return r;
+#endif
+}
+
+[[nodiscard]] inline Float4 sqrt(Float4 a) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    return {_mm_sqrt_ps(a.v)};
+#elif defined(VNE_MATH_SIMD_NEON)
+    return {vsqrtq_f32(a.v)};
+#else
+    return {{std::sqrt(a.v[0]), std::sqrt(a.v[1]), std::sqrt(a.v[2]), std::sqrt(a.v[3])}};
+#endif
+}
+
+[[nodiscard]] inline Float4 abs(Float4 a) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    return {_mm_andnot_ps(_mm_set1_ps(-0.0f), a.v)};
+#elif defined(VNE_MATH_SIMD_NEON)
+    return {vabsq_f32(a.v)};
+#else
+    return {{std::fabs(a.v[0]), std::fabs(a.v[1]), std::fabs(a.v[2]), std::fabs(a.v[3])}};
+#endif
+}
+
+// ============================================================================
+// Comparison and Masks
+// ============================================================================
+
+#if defined(VNE_MATH_SIMD_SCALAR)
+namespace detail {
+[[nodiscard]] inline float maskLane(bool b) noexcept {
+    const std::uint32_t bits = b ? 0xFFFFFFFFu : 0u;
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+[[nodiscard]] inline std::uint32_t bitsOf(float f) noexcept {
+    std::uint32_t bits;
+    std::memcpy(&bits, &f, sizeof(bits));
+    return bits;
+}
+
+[[nodiscard]] inline float fromBits(std::uint32_t bits) noexcept {
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+}  // namespace detail
+#endif
+
+[[nodiscard]] inline Float4 cmpLt(Float4 a, Float4 b) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    return {_mm_cmplt_ps(a.v, b.v)};
+#elif defined(VNE_MATH_SIMD_NEON)
+    return {vreinterpretq_f32_u32(vcltq_f32(a.v, b.v))};
+#else
+    Float4 r;
+    for (int i = 0; i < kLanes; ++i) {
+        r.v[i] = detail::maskLane(a.v[i] < b.v[i]);
+    }
+    return r;
+#endif
+}
+
+[[nodiscard]] inline Float4 cmpLe(Float4 a, Float4 b) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    return {_mm_cmple_ps(a.v, b.v)};
+#elif defined(VNE_MATH_SIMD_NEON)
+    return {vreinterpretq_f32_u32(vcleq_f32(a.v, b.v))};
+#else
+    Float4 r;
+    for (int i = 0; i < kLanes; ++i) {
+        r.v[i] = detail::maskLane(a.v[i] <= b.v[i]);
+    }
+    return r;
+#endif
+}
+
+[[nodiscard]] inline Float4 cmpGt(Float4 a, Float4 b) noexcept {
+    return cmpLt(b, a);
+}
+
+[[nodiscard]] inline Float4 cmpGe(Float4 a, Float4 b) noexcept {
+    return cmpLe(b, a);
+}
+
+[[nodiscard]] inline Float4 cmpEq(Float4 a, Float4 b) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    return {_mm_cmpeq_ps(a.v, b.v)};
+#elif defined(VNE_MATH_SIMD_NEON)
+    return {vreinterpretq_f32_u32(vceqq_f32(a.v, b.v))};
+#else
+    Float4 r;
+    for (int i = 0; i < kLanes; ++i) {
+        r.v[i] = detail::maskLane(a.v[i] == b.v[i]);
+    }
+    return r;
+#endif
+}
+
+[[nodiscard]] inline Float4 operator&(Float4 a, Float4 b) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    return {_mm_and_ps(a.v, b.v)};
+#elif defined(VNE_MATH_SIMD_NEON)
+    return {vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a.v), vreinterpretq_u32_f32(b.v)))};
+#else
+    Float4 r;
+    for (int i = 0; i < kLanes; ++i) {
+        r.v[i] = detail::fromBits(detail::bitsOf(a.v[i]) & detail::bitsOf(b.v[i]));
+    }
+    return r;
+#endif
+}
+
+[[nodiscard]] inline Float4 operator|(Float4 a, Float4 b) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    return {_mm_or_ps(a.v, b.v)};
+#elif defined(VNE_MATH_SIMD_NEON)
+    return {vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a.v), vreinterpretq_u32_f32(b.v)))};
+#else
+    Float4 r;
+    for (int i = 0; i < kLanes; ++i) {
+        r.v[i] = detail::fromBits(detail::bitsOf(a.v[i]) | detail::bitsOf(b.v[i]));
+    }
+    return r;
+#endif
+}
+
+[[nodiscard]] inline Float4 operator^(Float4 a, Float4 b) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    return {_mm_xor_ps(a.v, b.v)};
+#elif defined(VNE_MATH_SIMD_NEON)
+    return {vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a.v), vreinterpretq_u32_f32(b.v)))};
+#else
+    Float4 r;
+    for (int i = 0; i < kLanes; ++i) {
+        r.v[i] = detail::fromBits(detail::bitsOf(a.v[i]) ^ detail::bitsOf(b.v[i]));
+    }
+    return r;
+#endif
+}
+
+/// Returns a & ~mask (clears the lanes selected by @p mask).
+[[nodiscard]] inline Float4 andNot(Float4 mask, Float4 a) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    return {_mm_andnot_ps(mask.v, a.v)};
+#elif defined(VNE_MATH_SIMD_NEON)
+    return {vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(a.v), vreinterpretq_u32_f32(mask.v)))};
+#else
+    Float4 r;
+    for (int i = 0; i < kLanes; ++i) {
+        r.v[i] = detail::fromBits(detail::bitsOf(a.v[i]) & ~detail::bitsOf(mask.v[i]));
+    }
+    return r;
+#endif
+}
+
+/// Per-lane mask ? a : b.
+[[nodiscard]] inline Float4 select(Float4 mask, Float4 a, Float4 b) noexcept {
+#if defined(VNE_MATH_SIMD_SSE41)
+    return {_mm_blendv_ps(b.v, a.v, mask.v)};
+#elif defined(VNE_MATH_SIMD_SSE2)
+    return {_mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v))};
+#elif defined(VNE_MATH_SIMD_NEON)
+    return {vbslq_f32(vreinterpretq_u32_f32(mask.v), a.v, b.v)};
+#else
+    Float4 r;
+    for (int i = 0; i < kLanes; ++i) {
+        r.v[i] = detail::bitsOf(mask.v[i]) != 0u ? a.v[i] : b.v[i];
+    }
+    return r;
+#endif
+}
+
+/// Packs the sign bit of each lane into bits 0..3.
+[[nodiscard]] inline int moveMask(Float4 mask) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    return _mm_movemask_ps(mask.v);
+#elif defined(VNE_MATH_SIMD_NEON)
+    static const int32_t kShifts[4] = {0, 1, 2, 3};
+    const uint32x4_t sign = vshrq_n_u32(vreinterpretq_u32_f32(mask.v), 31);
+    return static_cast<int>(vaddvq_u32(vshlq_u32(sign, vld1q_s32(kShifts))));
+#else
+    int bits = 0;
+    for (int i = 0; i < kLanes; ++i) {
+        bits |= static_cast<int>(detail::bitsOf(mask.v[i]) >> 31) << i;
+    }
+    return bits;
+#endif
+}
+
+[[nodiscard]] inline bool anyTrue(Float4 mask) noexcept {
+    return moveMask(mask) != 0;
+}
+
+[[nodiscard]] inline bool allTrue(Float4 mask) noexcept {
+    return moveMask(mask) == 0xF;
+}
+
+// ============================================================================
+// Shuffles
+// ============================================================================
+
+/// In-place 4x4 transpose: rows become columns.
+inline void transpose(Float4& r0, Float4& r1, Float4& r2, Float4& r3) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    _MM_TRANSPOSE4_PS(r0.v, r1.v, r2.v, r3.v);
+#elif defined(VNE_MATH_SIMD_NEON)
+    const float32x4x2_t t01 = vtrnq_f32(r0.v, r1.v);
+    const float32x4x2_t t23 = vtrnq_f32(r2.v, r3.v);
+    r0.v = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+    r1.v = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+    r2.v = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+    r3.v = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+#else
+    Float4 in[4] = {r0, r1, r2, r3};
+    Float4* out[4] = {&r0, &r1, &r2, &r3};
+    for (int r = 0; r < kLanes; ++r) {
+        for (int c = 0; c < kLanes; ++c) {
+            out[r]->v[c] = in[c].v[r];
+        }
+    }
+#endif
+}
+
+/**
+ * @brief Loads four packed xyz triples (12 floats) and de-interleaves them.
+ *
+ * @param p Pointer to x0 y0 z0 x1 y1 z1 x2 y2 z2 x3 y3 z3
+ */
+inline void loadXyz(const float* p, Float4& x, Float4& y, Float4& z) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    const __m128 a = _mm_loadu_ps(p);      // x0 y0 z0 x1
+    const __m128 b = _mm_loadu_ps(p + 4);  // y1 z1 x2 y2
+    const __m128 c = _mm_loadu_ps(p + 8);  // z2 x3 y3 z3
+    const __m128 xa = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 0, 0));
+    const __m128 xb = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+    const __m128 ya = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+    const __m128 yb = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+    const __m128 za = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+    const __m128 zb = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0));
+    x.v = _mm_shuffle_ps(xa, xb, _MM_SHUFFLE(2, 0, 2, 0));
+    y.v = _mm_shuffle_ps(ya, yb, _MM_SHUFFLE(2, 0, 2, 0));
+    z.v = _mm_shuffle_ps(za, zb, _MM_SHUFFLE(2, 0, 2, 0));
+#elif defined(VNE_MATH_SIMD_NEON)
+    const float32x4x3_t v = vld3q_f32(p);
+    x.v = v.val[0];
+    y.v = v.val[1];
+    z.v = v.val[2];
+#else
+    for (int i = 0; i < kLanes; ++i) {
+        x.v[i] = p[3 * i + 0];
+        y.v[i] = p[3 * i + 1];
+        z.v[i] = p[3 * i + 2];
+    }
+#endif
+}
+
+/**
+ * @brief Interleaves three registers into four packed xyz triples (12 floats).
+ */
+inline void storeXyz(float* p, Float4 x, Float4 y, Float4 z) noexcept {
+#if defined(VNE_MATH_SIMD_SSE2)
+    const __m128 a0 = _mm_shuffle_ps(x.v, y.v, _MM_SHUFFLE(0, 0, 0, 0));  // x0 x0 y0 y0
+    const __m128 a1 = _mm_shuffle_ps(z.v, x.v, _MM_SHUFFLE(1, 1, 0, 0));  // z0 z0 x1 x1
+    const __m128 b0 = _mm_shuffle_ps(y.v, z.v, _MM_SHUFFLE(1, 1, 1, 1));  // y1 y1 z1 z1
+    const __m128 b1 = _mm_shuffle_ps(x.v, y.v, _MM_SHUFFLE(2, 2, 2, 2));  // x2 x2 y2 y2
+    const __m128 c0 = _mm_shuffle_ps(z.v, x.v, _MM_SHUFFLE(3, 3, 2, 2));  // z2 z2 x3 x3
+    const __m128 c1 = _mm_shuffle_ps(y.v, z.v, _MM_SHUFFLE(3, 3, 3, 3));  // y3 y3 z3 z3
+    _mm_storeu_ps(p, _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(p + 4, _mm_shuffle_ps(b0, b1, _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(p + 8, _mm_shuffle_ps(c0, c1, _MM_SHUFFLE(2, 0, 2, 0)));
+#elif defined(VNE_MATH_SIMD_NEON)
+    float32x4x3_t v;
+    v.val[0] = x.v;
+    v.val[1] = y.v;
+    v.val[2] = z.v;
+    vst3q_f32(p, v);
+#else
+    for (int i = 0; i < kLanes; ++i) {
+        p[3 * i + 0] = x.v[i];
+        p[3 * i + 1] = y.v[i];
+        p[3 * i + 2] = z.v[i];
+    }
+#endif
+}
+
+}  // namespace VNE_MATH_SIMD_ISA
+}  // namespace vne::math::simd
@@ -0,0 +1,34 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Batch kernels built with AVX2 and FMA (VEX encoding, fused multiply-add).
+// Compiled with -mavx2 -mfma or /arch:AVX2.
+
+// Project headers
+#include "vertexnova/math/simd/dispatch.h"
+
+#if !defined(VNE_MATH_NO_SIMD) && defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+#define VNE_MATH_KERNELS_AVX2 1
+#define VNE_MATH_SIMD_ISA avx2
+#include "vertexnova/math/simd/batch_kernels.inl"
+#endif
+
+namespace vne::math::simd {
+
+const BatchKernels* avx2Kernels() noexcept {
+#if defined(VNE_MATH_KERNELS_AVX2)
+    return &kBatchKernels;
+#else
+    return nullptr;
+#endif
+}
+
+}  // namespace vne::math::simd
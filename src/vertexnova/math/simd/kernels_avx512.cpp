@@ -0,0 +1,34 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Batch kernels built with AVX-512F/VL (EVEX encoding, 32 vector registers).
+// Compiled with -mavx512f -mavx512vl or /arch:AVX512.
+
+// Project headers
+#include "vertexnova/math/simd/dispatch.h"
+
+#if !defined(VNE_MATH_NO_SIMD) && defined(__AVX512F__) && defined(__AVX512VL__)
+#define VNE_MATH_KERNELS_AVX512 1
+#define VNE_MATH_SIMD_ISA avx512
+#include "vertexnova/math/simd/batch_kernels.inl"
+#endif
+
+namespace vne::math::simd {
+
+const BatchKernels* avx512Kernels() noexcept {
+#if defined(VNE_MATH_KERNELS_AVX512)
+    return &kBatchKernels;
+#else
+    return nullptr;
+#endif
+}
+
+}  // namespace vne::math::simd
@@ -0,0 +1,33 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Batch kernels built for AArch64 (NEON).
+
+// Project headers
+#include "vertexnova/math/simd/dispatch.h"
+
+#if !defined(VNE_MATH_NO_SIMD) && (defined(__aarch64__) || defined(_M_ARM64))
+#define VNE_MATH_KERNELS_NEON 1
+#define VNE_MATH_SIMD_ISA neon
+#include "vertexnova/math/simd/batch_kernels.inl"
+#endif
+
+namespace vne::math::simd {
+
+const BatchKernels* neonKernels() noexcept {
+#if defined(VNE_MATH_KERNELS_NEON)
+    return &kBatchKernels;
+#else
+    return nullptr;
+#endif
+}
+
+}  // namespace vne::math::simd
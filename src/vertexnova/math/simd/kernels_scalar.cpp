@@ -0,0 +1,31 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Portable batch kernels; always available and the reference for the other levels.
+// Forces the scalar Float4 backend whatever the target supports.
+
+#if !defined(VNE_MATH_NO_SIMD)
+#define VNE_MATH_NO_SIMD 1
+#endif
+
+// Project headers
+#include "vertexnova/math/simd/dispatch.h"
+
+#define VNE_MATH_SIMD_ISA scalar
+#include "vertexnova/math/simd/batch_kernels.inl"
+
+namespace vne::math::simd {
+
+const BatchKernels* scalarKernels() noexcept {
+    return &kBatchKernels;
+}
+
+}  // namespace vne::math::simd
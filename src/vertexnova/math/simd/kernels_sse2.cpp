@@ -0,0 +1,33 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Batch kernels built for the x86-64 baseline (SSE2).
+
+// Project headers
+#include "vertexnova/math/simd/dispatch.h"
+
+#if !defined(VNE_MATH_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define VNE_MATH_KERNELS_SSE2 1
+#define VNE_MATH_SIMD_ISA sse2
+#include "vertexnova/math/simd/batch_kernels.inl"
+#endif
+
+namespace vne::math::simd {
+
+const BatchKernels* sse2Kernels() noexcept {
+#if defined(VNE_MATH_KERNELS_SSE2)
+    return &kBatchKernels;
+#else
+    return nullptr;
+#endif
+}
+
+}  // namespace vne::math::simd
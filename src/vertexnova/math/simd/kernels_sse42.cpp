@@ -0,0 +1,33 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Batch kernels built with SSE4.2 (blendv select). Compiled with -msse4.2.
+
+// Project headers
+#include "vertexnova/math/simd/dispatch.h"
+
+#if !defined(VNE_MATH_NO_SIMD) && defined(__SSE4_2__)
+#define VNE_MATH_KERNELS_SSE42 1
+#define VNE_MATH_SIMD_ISA sse42
+#include "vertexnova/math/simd/batch_kernels.inl"
+#endif
+
+namespace vne::math::simd {
+
+const BatchKernels* sse42Kernels() noexcept {
+#if defined(VNE_MATH_KERNELS_SSE42)
+    return &kBatchKernels;
+#else
+    return nullptr;
+#endif
+}
+
+}  // namespace vne::math::simd
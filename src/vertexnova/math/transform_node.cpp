@@ -12,6 +12,9 @@
 // Corresponding header
 #include "vertexnova/math/transform_node.h"
 
+// Project headers
+#include "vertexnova/math/instrumentation.h"
+
 // System headers
 #include <algorithm>
 
@@ -34,6 +37,7 @@ TransformNode::~TransformNode() noexcept {
 
 //------------------------------------------------------------------------------
 void TransformNode::setLocalTransform(const Mat4x4f& transform) noexcept {
+    VNE_MATH_PROBE_COUNT(Probe::eTransformNodeUpdate);
     local_transform_ = transform;
 }
 
@@ -112,6 +116,7 @@ bool TransformNode::isLeaf() const noexcept {
 
 //------------------------------------------------------------------------------
 void TransformNode::updateRootTransform() noexcept {
+    VNE_MATH_PROBE_COUNT(Probe::eTransformNodeUpdate);
     if (parent_) {
         root_transform_ = parent_->getModelMatrix();
     } else {
@@ -121,6 +126,7 @@ void TransformNode::updateRootTransform() noexcept {
 
 //------------------------------------------------------------------------------
 void TransformNode::composeTransform(const Mat4x4f& transform) noexcept {
+    VNE_MATH_PROBE_COUNT(Probe::eTransformNodeUpdate);
     local_transform_ = transform * local_transform_;
 }
 
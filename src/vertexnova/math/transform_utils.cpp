@@ -0,0 +1,153 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+// Corresponding header
+#include "vertexnova/math/transform_utils.h"
+
+// Project headers
+#include "vertexnova/common/macros.h"
+#include "vertexnova/math/instrumentation.h"
+#include "vertexnova/math/simd/dispatch.h"
+
+// Standard library includes
+#include <algorithm>
+
+namespace vne::math {
+
+// The batch kernels reinterpret the arrays as packed floats.
+static_assert(sizeof(Vec3f) == 3 * sizeof(float), "Vec3f must be tightly packed");
+static_assert(sizeof(Quatf) == 4 * sizeof(float), "Quatf must be tightly packed");
+static_assert(sizeof(Mat4f) == 16 * sizeof(float), "Mat4f must be tightly packed");
+static_assert(sizeof(AffineComponents) == 13 * sizeof(float), "AffineComponents must be tightly packed");
+
+namespace {
+
+/// Singular fallback: no unique polar factor, so reuse the shear-free decomposition.
+void patchSingular(const Mat4f& matrix, AffineComponents& out) noexcept {
+    const TransformComponents tc = decompose(matrix);
+    out.translation = tc.translation;
+    out.rotation = tc.rotation;
+    out.scale = tc.scale;
+    out.shear = Vec3f::zero();
+}
+
+/// Batch decomposeAffine() without the probe, so the single-matrix overload is not counted as a batch.
+void decomposeAffineBlocks(std::span<const Mat4f> matrices,
+                           std::span<AffineComponents> out,
+                           std::size_t count) noexcept {
+    const auto decompose_affine_block = simd::batchKernels().decompose_affine4;
+    const std::size_t full = count - count % simd::kBlockSize;
+    for (std::size_t i = 0; i < full; i += simd::kBlockSize) {
+        const int singular = decompose_affine_block(matrices[i].ptr(), reinterpret_cast<float*>(&out[i]));
+        for (std::size_t lane = 0; singular != 0 && lane < simd::kBlockSize; ++lane) {
+            if ((singular & (1 << lane)) != 0) {
+                patchSingular(matrices[i + lane], out[i + lane]);
+            }
+        }
+    }
+
+    if (full == count) {
+        return;
+    }
+
+    Mat4f m[simd::kBlockSize]{Mat4f::identity(), Mat4f::identity(), Mat4f::identity(), Mat4f::identity()};
+    AffineComponents r[simd::kBlockSize];
+    const std::size_t tail = count - full;
+    std::copy_n(matrices.begin() + static_cast<std::ptrdiff_t>(full), tail, m);
+    const int singular = decompose_affine_block(m[0].ptr(), reinterpret_cast<float*>(r));
+    for (std::size_t lane = 0; lane < tail; ++lane) {
+        if ((singular & (1 << lane)) != 0) {
+            patchSingular(m[lane], r[lane]);
+        }
+    }
+    std::copy_n(r, tail, out.begin() + static_cast<std::ptrdiff_t>(full));
+}
+
+}  // namespace
+
+void compose(std::span<const Vec3f> translations,
+             std::span<const Quatf> rotations,
+             std::span<const Vec3f> scales,
+             std::span<Mat4f> out) noexcept {
+    VNE_ASSERT_MSG(translations.size() == out.size() && rotations.size() == out.size() && scales.size() == out.size(),
+                   "compose: span sizes must match");
+    const std::size_t count = std::min({translations.size(), rotations.size(), scales.size(), out.size()});
+    VNE_MATH_PROBE_SCOPE(Probe::eCompose, count);
+
+    const auto compose_block = simd::batchKernels().compose4;
+    const std::size_t full = count - count % simd::kBlockSize;
+    for (std::size_t i = 0; i < full; i += simd::kBlockSize) {
+        compose_block(translations[i].ptr(), &rotations[i].x, scales[i].ptr(), out[i].ptr());
+    }
+
+    if (full == count) {
+        return;
+    }
+
+    // Pad the tail to a full block so every element goes through the same kernel
+    Vec3f t[simd::kBlockSize];
+    Quatf r[simd::kBlockSize];
+    Vec3f s[simd::kBlockSize]{Vec3f::one(), Vec3f::one(), Vec3f::one(), Vec3f::one()};
+    Mat4f m[simd::kBlockSize];
+    const std::size_t tail = count - full;
+    std::copy_n(translations.begin() + static_cast<std::ptrdiff_t>(full), tail, t);
+    std::copy_n(rotations.begin() + static_cast<std::ptrdiff_t>(full), tail, r);
+    std::copy_n(scales.begin() + static_cast<std::ptrdiff_t>(full), tail, s);
+    compose_block(t[0].ptr(), &r[0].x, s[0].ptr(), m[0].ptr());
+    std::copy_n(m, tail, out.begin() + static_cast<std::ptrdiff_t>(full));
+}
+
+void decompose(std::span<const Mat4f> matrices,
+               std::span<Vec3f> translations,
+               std::span<Quatf> rotations,
+               std::span<Vec3f> scales) noexcept {
+    VNE_ASSERT_MSG(translations.size() == matrices.size() && rotations.size() == matrices.size()
+                       && scales.size() == matrices.size(),
+                   "decompose: span sizes must match");
+    const std::size_t count = std::min({matrices.size(), translations.size(), rotations.size(), scales.size()});
+    VNE_MATH_PROBE_SCOPE(Probe::eDecompose, count);
+
+    const auto decompose_block = simd::batchKernels().decompose4;
+    const std::size_t full = count - count % simd::kBlockSize;
+    for (std::size_t i = 0; i < full; i += simd::kBlockSize) {
+        decompose_block(matrices[i].ptr(), translations[i].ptr(), &rotations[i].x, scales[i].ptr());
+    }
+
+    if (full == count) {
+        return;
+    }
+
+    Mat4f m[simd::kBlockSize]{Mat4f::identity(), Mat4f::identity(), Mat4f::identity(), Mat4f::identity()};
+    Vec3f t[simd::kBlockSize];
+    Quatf r[simd::kBlockSize];
+    Vec3f s[simd::kBlockSize];
+    const std::size_t tail = count - full;
+    std::copy_n(matrices.begin() + static_cast<std::ptrdiff_t>(full), tail, m);
+    decompose_block(m[0].ptr(), t[0].ptr(), &r[0].x, s[0].ptr());
+    std::copy_n(t, tail, translations.begin() + static_cast<std::ptrdiff_t>(full));
+    std::copy_n(r, tail, rotations.begin() + static_cast<std::ptrdiff_t>(full));
+    std::copy_n(s, tail, scales.begin() + static_cast<std::ptrdiff_t>(full));
+}
+
+AffineComponents decomposeAffine(const Mat4f& matrix) noexcept {
+    AffineComponents result;
+    decomposeAffineBlocks(std::span<const Mat4f>(&matrix, 1), std::span<AffineComponents>(&result, 1), 1);
+    return result;
+}
+
+void decomposeAffine(std::span<const Mat4f> matrices, std::span<AffineComponents> out) noexcept {
+    VNE_ASSERT_MSG(matrices.size() == out.size(), "decomposeAffine: span sizes must match");
+    const std::size_t count = std::min(matrices.size(), out.size());
+    VNE_MATH_PROBE_SCOPE(Probe::eDecomposeAffine, count);
+    decomposeAffineBlocks(matrices, out, count);
+}
+
+}  // namespace vne::math
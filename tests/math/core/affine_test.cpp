@@ -0,0 +1,161 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/math/core/affine.h"
+#include "vertexnova/math/transform_utils.h"
+
+namespace vne::math {
+
+namespace {
+constexpr float kEps = 1e-5f;
+}  // namespace
+
+class AffineTest : public ::testing::Test {
+   protected:
+    Affine3f rigid_ = Affine3f::fromTrs(Vec3f(1.0f, -2.0f, 3.0f),
+                                        Quatf::fromAxisAngle(Vec3f(1.0f, 2.0f, 3.0f).normalized(), 0.9f),
+                                        Vec3f(1.0f, 1.0f, 1.0f));
+    Affine3f scaled_ = Affine3f::fromTrs(Vec3f(-4.0f, 0.5f, 7.0f),
+                                         Quatf::fromAxisAngle(Vec3f(0.0f, 1.0f, 1.0f).normalized(), -1.3f),
+                                         Vec3f(2.0f, 0.5f, 3.0f));
+};
+
+// ============================================================================
+// Construction and Layout
+// ============================================================================
+
+TEST_F(AffineTest, SizeIsThreeRows) {
+    EXPECT_EQ(sizeof(Affine3f), 48u);
+    EXPECT_EQ(sizeof(Affine3d), 96u);
+}
+
+TEST_F(AffineTest, DefaultIsIdentity) {
+    Affine3f a;
+    EXPECT_TRUE(a == Affine3f::identity());
+    EXPECT_TRUE(a.toMat4().approxEquals(Mat4f::identity()));
+}
+
+TEST_F(AffineTest, Mat4RoundTripIsLossless) {
+    const Mat4f m = scaled_.toMat4();
+    const Affine3f back(m);
+    EXPECT_TRUE(back == scaled_);
+    EXPECT_TRUE(back.toMat4() == m);
+}
+
+TEST_F(AffineTest, FromTrsMatchesCompose) {
+    const Vec3f t(3.0f, 4.0f, -5.0f);
+    const Quatf r = Quatf::fromAxisAngle(Vec3f(-1.0f, 0.3f, 0.2f).normalized(), 2.1f);
+    const Vec3f s(0.3f, 1.7f, 2.2f);
+    EXPECT_TRUE(Affine3f::fromTrs(t, r, s).toMat4().approxEquals(compose(t, r, s), kEps));
+}
+
+TEST_F(AffineTest, LinearAndTranslationConstructor) {
+    const Affine3f a(scaled_.linear(), scaled_.translation());
+    EXPECT_TRUE(a == scaled_);
+}
+
+TEST_F(AffineTest, SetTranslation) {
+    Affine3f a = rigid_;
+    a.setTranslation(Vec3f(9.0f, 8.0f, 7.0f));
+    EXPECT_TRUE(a.translation().approxEquals(Vec3f(9.0f, 8.0f, 7.0f)));
+    EXPECT_TRUE(a.linear().approxEquals(rigid_.linear()));
+}
+
+// ============================================================================
+// Composition
+// ============================================================================
+
+TEST_F(AffineTest, MultiplyMatchesMat4) {
+    const Affine3f product = rigid_ * scaled_;
+    const Mat4f expected = rigid_.toMat4() * scaled_.toMat4();
+    EXPECT_TRUE(product.toMat4().approxEquals(expected, kEps));
+}
+
+TEST_F(AffineTest, MultiplyAppliesRightFirst) {
+    const Vec3f p(0.25f, -1.5f, 2.0f);
+    const Vec3f expected = rigid_.transformPoint(scaled_.transformPoint(p));
+    EXPECT_TRUE((rigid_ * scaled_).transformPoint(p).approxEquals(expected, kEps));
+}
+
+TEST_F(AffineTest, CompoundMultiply) {
+    Affine3f a = rigid_;
+    a *= scaled_;
+    EXPECT_TRUE(a.approxEquals(rigid_ * scaled_));
+}
+
+// ============================================================================
+// Inverse
+// ============================================================================
+
+TEST_F(AffineTest, GeneralInverse) {
+    const Affine3f inv = scaled_.inverse();
+    EXPECT_TRUE((scaled_ * inv).approxEquals(Affine3f::identity(), kEps));
+    EXPECT_TRUE((inv * scaled_).approxEquals(Affine3f::identity(), kEps));
+    EXPECT_TRUE(inv.toMat4().approxEquals(scaled_.toMat4().inverse(), kEps));
+}
+
+TEST_F(AffineTest, RigidInverseMatchesGeneral) {
+    EXPECT_TRUE(rigid_.inverseRigid().approxEquals(rigid_.inverse(), kEps));
+    EXPECT_TRUE((rigid_ * rigid_.inverseRigid()).approxEquals(Affine3f::identity(), kEps));
+}
+
+TEST_F(AffineTest, DeterminantMatchesMat4) {
+    EXPECT_NEAR(scaled_.determinant(), scaled_.toMat4().determinant(), 1e-4f);
+    EXPECT_NEAR(rigid_.determinant(), 1.0f, kEps);
+}
+
+// ============================================================================
+// Vector Transformation
+// ============================================================================
+
+TEST_F(AffineTest, TransformPointAndVectorMatchMat4) {
+    const Vec3f v(1.0f, 2.0f, -3.0f);
+    const Mat4f m = scaled_.toMat4();
+    EXPECT_TRUE(scaled_.transformPoint(v).approxEquals(m.transformPoint(v), kEps));
+    EXPECT_TRUE(scaled_.transformVector(v).approxEquals(m.transformVector(v), kEps));
+}
+
+TEST_F(AffineTest, TransformNormalStaysPerpendicular) {
+    // Tangent plane spanned by two vectors; the transformed normal must stay orthogonal to it
+    const Vec3f tangent(1.0f, -1.0f, 0.0f);
+    const Vec3f bitangent(0.0f, 1.0f, -1.0f);
+    const Vec3f normal = tangent.cross(bitangent);
+
+    const Vec3f n = scaled_.transformNormal(normal);
+    EXPECT_NEAR(n.dot(scaled_.transformVector(tangent)), 0.0f, 1e-4f);
+    EXPECT_NEAR(n.dot(scaled_.transformVector(bitangent)), 0.0f, 1e-4f);
+}
+
+TEST_F(AffineTest, TransformNormalMatchesInverseTranspose) {
+    const Vec3f n(0.0f, 1.0f, 0.0f);
+    const Vec3f expected = (scaled_.toMat4().inverseTranspose() * Vec4f(n, 0.0f)).xyz();
+    EXPECT_TRUE(scaled_.transformNormal(n).approxEquals(expected, kEps));
+}
+
+// ============================================================================
+// TransformComponents Conversion
+// ============================================================================
+
+TEST_F(AffineTest, ComposeAffineDecomposeRoundTrip) {
+    const TransformComponents tc(Vec3f(1.0f, 2.0f, 3.0f),
+                                 Quatf::fromAxisAngle(Vec3f::zAxis(), 0.7f),
+                                 Vec3f(2.0f, 3.0f, 4.0f));
+    const Affine3f a = composeAffine(tc);
+    const TransformComponents back = decompose(a);
+
+    EXPECT_TRUE(back.translation.approxEquals(tc.translation, kEps));
+    EXPECT_TRUE(back.rotation.approxEquals(tc.rotation, kEps));
+    EXPECT_TRUE(back.scale.approxEquals(tc.scale, kEps));
+}
+
+}  // namespace vne::math
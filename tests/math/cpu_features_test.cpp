@@ -0,0 +1,243 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <vertexnova/math/cpu_features.h>
+#include <vertexnova/math/geometry/aabb.h>
+#include <vertexnova/math/geometry/frustum.h>
+#include <vertexnova/math/transform_utils.h>
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace vne::math;
+
+namespace {
+
+constexpr SimdLevel kAllLevels[] = {
+    SimdLevel::eScalar, SimdLevel::eSse2, SimdLevel::eSse42, SimdLevel::eAvx2, SimdLevel::eAvx512, SimdLevel::eNeon};
+
+/// Restores the level that was active when the test started.
+class ScopedSimdLevel {
+   public:
+    ScopedSimdLevel() noexcept
+        : saved_(activeSimdLevel()) {}
+    ~ScopedSimdLevel() { setSimdLevel(saved_); }
+
+    ScopedSimdLevel(const ScopedSimdLevel&) = delete;
+    ScopedSimdLevel& operator=(const ScopedSimdLevel&) = delete;
+
+   private:
+    SimdLevel saved_;
+};
+
+/// Inputs shared by every level; sizes leave a padded tail after the 4-wide blocks
+struct BatchInputs {
+    std::vector<Aabb> boxes;
+    std::vector<Mat4f> matrices;
+    std::vector<Vec3f> translations;
+    std::vector<Quatf> rotations;
+    std::vector<Vec3f> scales;
+    std::vector<Mat4f> sheared;
+};
+
+BatchInputs makeInputs(std::size_t count) {
+    std::mt19937 rng(0x5D15Au);
+    std::uniform_real_distribution<float> pos(-40.0f, 40.0f);
+    std::uniform_real_distribution<float> ext(0.0f, 4.0f);
+    std::uniform_real_distribution<float> scale(0.25f, 3.0f);
+    std::normal_distribution<float> gauss(0.0f, 1.0f);
+
+    BatchInputs in;
+    for (std::size_t i = 0; i < count; ++i) {
+        const Vec3f c(pos(rng), pos(rng), pos(rng));
+        const Vec3f e(ext(rng), ext(rng), ext(rng));
+        in.boxes.emplace_back(c - e, c + e);
+        in.translations.emplace_back(pos(rng), pos(rng), pos(rng));
+        in.rotations.push_back(Quatf(gauss(rng), gauss(rng), gauss(rng), gauss(rng)).normalized());
+        in.scales.emplace_back(scale(rng), scale(rng), scale(rng));
+        in.matrices.push_back(compose(in.translations.back(), in.rotations.back(), in.scales.back()));
+
+        Mat4f shear = in.matrices.back();
+        shear[1][0] += gauss(rng) * 0.3f;
+        shear[0][2] += gauss(rng) * 0.3f;
+        in.sheared.push_back(shear);
+    }
+    in.boxes[2] = Aabb();
+    if (count > 6) {
+        in.scales[6].x() = -in.scales[6].x();
+        in.matrices[6] = compose(in.translations[6], in.rotations[6], in.scales[6]);
+    }
+    return in;
+}
+
+/// Every batch API's output for one level
+struct BatchResults {
+    std::vector<Aabb> boxes;
+    std::vector<uint8_t> visible;
+    size_t visible_count{0};
+    std::vector<Mat4f> composed;
+    std::vector<Vec3f> translations;
+    std::vector<Quatf> rotations;
+    std::vector<Vec3f> scales;
+    std::vector<AffineComponents> affine;
+};
+
+BatchResults runBatches(const BatchInputs& in, const Frustum& frustum) {
+    const std::size_t n = in.boxes.size();
+    BatchResults r;
+    r.boxes.resize(n);
+    r.visible.resize(n);
+    r.composed.resize(n);
+    r.translations.resize(n);
+    r.rotations.resize(n);
+    r.scales.resize(n);
+    r.affine.resize(n);
+
+    transformAabbs(in.boxes, in.matrices, r.boxes);
+    r.visible_count = intersects(frustum, in.boxes, r.visible);
+    compose(in.translations, in.rotations, in.scales, r.composed);
+    decompose(in.matrices, r.translations, r.rotations, r.scales);
+    decomposeAffine(in.sheared, r.affine);
+    return r;
+}
+
+Frustum makeFrustum() {
+    Frustum frustum;
+    frustum.extractFromMatrix(
+        Mat4f::perspective(1.2f, 1.5f, 0.1f, 60.0f, GraphicsApi::eVulkan)
+            * Mat4f::lookAt(Vec3f(5.0f, 8.0f, 30.0f), Vec3f::zero(), Vec3f::yAxis(), GraphicsApi::eVulkan),
+        getClipSpaceDepth(GraphicsApi::eVulkan));
+    return frustum;
+}
+
+}  // namespace
+
+// ============================================================================
+// Detection and Selection
+// ============================================================================
+
+TEST(CpuFeaturesTest, ScalarIsAlwaysSupported) {
+    EXPECT_TRUE(isSimdLevelSupported(SimdLevel::eScalar));
+}
+
+TEST(CpuFeaturesTest, BestAndActiveLevelsAreSupported) {
+    EXPECT_TRUE(isSimdLevelSupported(bestSimdLevel()));
+    EXPECT_TRUE(isSimdLevelSupported(activeSimdLevel()));
+}
+
+TEST(CpuFeaturesTest, FeatureImplications) {
+    const CpuFeatures& f = cpuFeatures();
+    EXPECT_TRUE(!f.avx2 || f.avx);
+    EXPECT_TRUE(!f.fma || f.avx);
+    EXPECT_TRUE(!f.avx512vl || f.avx512f);
+    EXPECT_FALSE(f.neon && (f.sse2 || f.avx));
+}
+
+TEST(CpuFeaturesTest, ActiveLevelFollowsEnvironment) {
+    const char* value = std::getenv("VNE_MATH_SIMD");
+    const std::optional<SimdLevel> requested = value != nullptr ? parseSimdLevel(value) : std::nullopt;
+    if (!requested) {
+        EXPECT_EQ(activeSimdLevel(), bestSimdLevel());
+        return;
+    }
+    if (isSimdLevelSupported(*requested)) {
+        EXPECT_EQ(activeSimdLevel(), *requested);
+    } else {
+        // Falls back to a lower level the machine supports
+        EXPECT_NE(activeSimdLevel(), *requested);
+        EXPECT_TRUE(isSimdLevelSupported(activeSimdLevel()));
+    }
+}
+
+TEST(CpuFeaturesTest, ParseRoundTripsNames) {
+    for (const SimdLevel level : kAllLevels) {
+        const std::optional<SimdLevel> parsed = parseSimdLevel(simdLevelName(level));
+        ASSERT_TRUE(parsed.has_value()) << simdLevelName(level);
+        EXPECT_EQ(*parsed, level);
+    }
+    EXPECT_EQ(parseSimdLevel("AVX2"), SimdLevel::eAvx2);
+    EXPECT_EQ(parseSimdLevel("sse42"), SimdLevel::eSse42);
+    EXPECT_EQ(parseSimdLevel("avx512f"), SimdLevel::eAvx512);
+    EXPECT_FALSE(parseSimdLevel("").has_value());
+    EXPECT_FALSE(parseSimdLevel("avx").has_value());
+    EXPECT_FALSE(parseSimdLevel("avx2 ").has_value());
+}
+
+TEST(CpuFeaturesTest, SetLevelSwitchesAndRejectsUnsupported) {
+    const ScopedSimdLevel restore;
+    for (const SimdLevel level : kAllLevels) {
+        const SimdLevel before = activeSimdLevel();
+        const bool supported = isSimdLevelSupported(level);
+        EXPECT_EQ(setSimdLevel(level), supported) << simdLevelName(level);
+        EXPECT_EQ(activeSimdLevel(), supported ? level : before) << simdLevelName(level);
+    }
+}
+
+// ============================================================================
+// Dispatch Matrix
+// ============================================================================
+
+// Every level this machine supports must agree with the scalar kernels, so a
+// single host validates all of its paths. Levels it lacks are skipped here and
+// covered by CI hosts that have them.
+TEST(SimdDispatchTest, EveryLevelMatchesScalar) {
+    const ScopedSimdLevel restore;
+    const BatchInputs in = makeInputs(23);
+    const Frustum frustum = makeFrustum();
+
+    ASSERT_TRUE(setSimdLevel(SimdLevel::eScalar));
+    const BatchResults ref = runBatches(in, frustum);
+    EXPECT_GT(ref.visible_count, 0u);
+    EXPECT_LT(ref.visible_count, in.boxes.size());
+
+    for (const SimdLevel level : kAllLevels) {
+        if (!setSimdLevel(level)) {
+            continue;
+        }
+        SCOPED_TRACE(simdLevelName(level));
+        const BatchResults r = runBatches(in, frustum);
+
+        EXPECT_EQ(r.visible_count, ref.visible_count);
+        for (std::size_t i = 0; i < in.boxes.size(); ++i) {
+            EXPECT_EQ(r.boxes[i].isValid(), ref.boxes[i].isValid()) << i;
+            if (ref.boxes[i].isValid()) {
+                EXPECT_TRUE(r.boxes[i].min().areSame(ref.boxes[i].min(), 1e-4f)) << i;
+                EXPECT_TRUE(r.boxes[i].max().areSame(ref.boxes[i].max(), 1e-4f)) << i;
+            }
+            EXPECT_EQ(r.visible[i], ref.visible[i]) << i;
+            EXPECT_TRUE(r.composed[i].approxEquals(ref.composed[i], 1e-5f)) << i;
+            EXPECT_TRUE(r.translations[i].approxEquals(ref.translations[i], 1e-5f)) << i;
+            EXPECT_TRUE(r.rotations[i].approxEquals(ref.rotations[i], 1e-5f)) << i;
+            EXPECT_TRUE(r.scales[i].approxEquals(ref.scales[i], 1e-5f)) << i;
+            EXPECT_TRUE(r.affine[i].translation.approxEquals(ref.affine[i].translation, 1e-5f)) << i;
+            EXPECT_TRUE(r.affine[i].rotation.approxEquals(ref.affine[i].rotation, 1e-4f)) << i;
+            EXPECT_TRUE(r.affine[i].scale.approxEquals(ref.affine[i].scale, 1e-4f)) << i;
+            EXPECT_TRUE(r.affine[i].shear.approxEquals(ref.affine[i].shear, 1e-4f)) << i;
+        }
+    }
+}
+
+TEST(SimdDispatchTest, ScalarMatchesPerElementApis) {
+    const ScopedSimdLevel restore;
+    ASSERT_TRUE(setSimdLevel(SimdLevel::eScalar));
+    const BatchInputs in = makeInputs(9);
+    const Frustum frustum = makeFrustum();
+    const BatchResults r = runBatches(in, frustum);
+
+    for (std::size_t i = 0; i < in.boxes.size(); ++i) {
+        const Aabb expected = in.boxes[i].transformed(in.matrices[i]);
+        EXPECT_EQ(r.boxes[i].isValid(), expected.isValid()) << i;
+        if (expected.isValid()) {
+            EXPECT_TRUE(r.boxes[i].min().areSame(expected.min(), 1e-3f)) << i;
+            EXPECT_TRUE(r.boxes[i].max().areSame(expected.max(), 1e-3f)) << i;
+        }
+        EXPECT_EQ(r.visible[i], frustum.intersects(in.boxes[i]) ? 1 : 0) << i;
+        EXPECT_TRUE(r.composed[i].approxEquals(compose(in.translations[i], in.rotations[i], in.scales[i]), 1e-5f))
+            << i;
+    }
+}
@@ -14,8 +14,33 @@
 #include "vertexnova/math/geometry/aabb.h"
 #include "vertexnova/math/core/math_utils.h"
 
+#include <random>
+#include <vector>
+
 namespace vne::math {
 
+namespace {
+
+/// Bounds of the eight transformed corners
+Aabb transformCorners(const Aabb& box, const Mat4f& m) {
+    Aabb result;
+    for (uint32_t i = 0; i < 8; ++i) {
+        result.expand((m * Vec4f(box.corner(i), 1.0f)).xyz());
+    }
+    return result;
+}
+
+Mat4f makeRandomAffine(std::mt19937& rng) {
+    std::uniform_real_distribution<float> pos(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> scl(-3.0f, 3.0f);
+    const Vec3f axis = Vec3f(unit(rng), unit(rng), unit(rng)).normalized();
+    return Mat4f::translate(pos(rng), pos(rng), pos(rng)) * Mat4f::rotate(unit(rng) * 3.0f, axis)
+           * Mat4f::scale(scl(rng), scl(rng), scl(rng));
+}
+
+}  // namespace
+
 class AabbTest : public ::testing::Test {
    protected:
     void SetUp() override {
@@ -131,6 +156,62 @@ TEST_F(AabbTest, Translate) {
     EXPECT_TRUE(aabb.max().areSame(Vec3f(6.0f, 6.0f, 6.0f)));
 }
 
+TEST_F(AabbTest, TransformedByTranslationAndScale) {
+    const Aabb aabb = unit_box_.transformed(Mat4f::translate(1.0f, 2.0f, 3.0f) * Mat4f::scale(2.0f, -1.0f, 0.5f));
+
+    EXPECT_TRUE(aabb.min().areSame(Vec3f(-1.0f, 1.0f, 2.5f)));
+    EXPECT_TRUE(aabb.max().areSame(Vec3f(3.0f, 3.0f, 3.5f)));
+}
+
+TEST_F(AabbTest, TransformedMatchesCorners) {
+    std::mt19937 rng(0xAABB0062u);
+    for (int i = 0; i < 32; ++i) {
+        const Mat4f m = makeRandomAffine(rng);
+        const Aabb expected = transformCorners(offset_box_, m);
+        const Aabb aabb = offset_box_.transformed(m);
+
+        EXPECT_TRUE(aabb.min().areSame(expected.min(), 1e-3f)) << aabb << " vs " << expected;
+        EXPECT_TRUE(aabb.max().areSame(expected.max(), 1e-3f)) << aabb << " vs " << expected;
+    }
+}
+
+TEST_F(AabbTest, TransformedInvalidStaysInvalid) {
+    EXPECT_FALSE(Aabb().transformed(Mat4f::rotateY(0.5f)).isValid());
+}
+
+TEST_F(AabbTest, BatchTransformMatchesScalar) {
+    std::mt19937 rng(0xAABB0063u);
+    std::uniform_real_distribution<float> pos(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> ext(0.0f, 4.0f);
+
+    std::vector<Aabb> boxes;
+    std::vector<Mat4f> matrices;
+    for (int i = 0; i < 37; ++i) {
+        const Vec3f c(pos(rng), pos(rng), pos(rng));
+        const Vec3f e(ext(rng), ext(rng), ext(rng));
+        boxes.emplace_back(c - e, c + e);
+        matrices.push_back(makeRandomAffine(rng));
+    }
+    boxes[5] = Aabb();
+
+    std::vector<Aabb> out(boxes.size());
+    transformAabbs(boxes, matrices, out);
+    for (std::size_t i = 0; i < boxes.size(); ++i) {
+        const Aabb expected = boxes[i].transformed(matrices[i]);
+        EXPECT_EQ(out[i].isValid(), expected.isValid()) << i;
+        if (expected.isValid()) {
+            EXPECT_TRUE(out[i].min().areSame(expected.min(), 1e-3f)) << i;
+            EXPECT_TRUE(out[i].max().areSame(expected.max(), 1e-3f)) << i;
+        }
+    }
+
+    // In place
+    transformAabbs(boxes, matrices, boxes);
+    for (std::size_t i = 0; i < boxes.size(); ++i) {
+        EXPECT_TRUE(boxes[i] == out[i]) << i;
+    }
+}
+
 TEST_F(AabbTest, Reset) {
     Aabb aabb = unit_box_;
     aabb.reset();
@@ -230,6 +230,18 @@ TEST_F(CapsuleTest, IntersectsCapsule) {
     EXPECT_FALSE(c1.intersects(c3));
 }
 
+TEST_F(CapsuleTest, IntersectsCapsuleNearSegmentEnd) {
+    // The lines cross beyond both segments; the closest pair is c1's end and an interior point
+    // of c2, about 1.06 apart
+    Capsule c1(Vec3f(0, 0, 0), Vec3f(1, 0, 0), 0.6f);
+    Capsule c2(Vec3f(1.5f, -1, 0), Vec3f(3.5f, 1, 0), 0.6f);
+    EXPECT_TRUE(c1.intersects(c2));
+    EXPECT_TRUE(c2.intersects(c1));
+
+    c2.setRadius(0.45f);
+    EXPECT_FALSE(c1.intersects(c2));
+}
+
 TEST_F(CapsuleTest, IntersectsSphere) {
     Capsule capsule(Vec3f(0, -1, 0), Vec3f(0, 1, 0), 0.5f);
 
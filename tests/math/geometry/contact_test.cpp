@@ -0,0 +1,344 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Contact manifold tests - box, capsule and sphere pairs, and the batch API.
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/math/geometry/contact.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace vne::math {
+
+namespace {
+
+constexpr float kEps = 1e-4f;
+
+bool allDepthsNear(const ContactManifold& manifold, float depth) {
+    for (const ContactPoint& point : manifold.contacts()) {
+        if (std::abs(point.depth - depth) > kEps) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+// ============================================================================
+// Manifold Tests
+// ============================================================================
+
+TEST(ContactManifoldTest, CapacityIsFixed) {
+    ContactManifold manifold;
+    EXPECT_TRUE(manifold.empty());
+    for (int i = 0; i < 6; ++i) {
+        manifold.addPoint(Vec3f(static_cast<float>(i), 0, 0), 0.1f);
+    }
+    EXPECT_EQ(manifold.count, ContactManifold::kMaxPoints);
+    EXPECT_EQ(manifold.contacts().size(), ContactManifold::kMaxPoints);
+    EXPECT_EQ(manifold.contacts().back().position, Vec3f(3, 0, 0));
+
+    manifold.clear();
+    EXPECT_TRUE(manifold.empty());
+}
+
+// ============================================================================
+// Box-Box Tests
+// ============================================================================
+
+TEST(ContactBoxBoxTest, SmallBoxRestingOnLargeBox) {
+    const Obb a(Vec3f(0, 0, 0), Vec3f(1, 1, 1));
+    const Obb b(Vec3f(0, 0, 1.4f), Vec3f(0.5f, 0.5f, 0.5f));
+    ContactManifold manifold;
+
+    ASSERT_TRUE(generateContacts(a, b, manifold));
+    EXPECT_EQ(manifold.count, 4u);
+    EXPECT_TRUE(manifold.normal.areSame(Vec3f(0, 0, 1), kEps));
+    EXPECT_TRUE(allDepthsNear(manifold, 0.1f));
+    for (const ContactPoint& point : manifold.contacts()) {
+        // Corners of B's bottom face
+        EXPECT_NEAR(point.position.z(), 0.9f, kEps);
+        EXPECT_NEAR(std::abs(point.position.x()), 0.5f, kEps);
+        EXPECT_NEAR(std::abs(point.position.y()), 0.5f, kEps);
+    }
+}
+
+TEST(ContactBoxBoxTest, LargeBoxRestingOnSmallBox) {
+    const Obb a(Vec3f(0, 0, 0), Vec3f(0.5f, 0.5f, 0.5f));
+    const Obb b(Vec3f(0, 0, 0.9f), Vec3f(2, 2, 0.5f));
+    ContactManifold manifold;
+
+    // B's face is clipped to A's top face
+    ASSERT_TRUE(generateContacts(a, b, manifold));
+    EXPECT_EQ(manifold.count, 4u);
+    EXPECT_TRUE(manifold.normal.areSame(Vec3f(0, 0, 1), kEps));
+    EXPECT_TRUE(allDepthsNear(manifold, 0.1f));
+    for (const ContactPoint& point : manifold.contacts()) {
+        EXPECT_NEAR(point.position.z(), 0.4f, kEps);
+        EXPECT_NEAR(std::abs(point.position.x()), 0.5f, kEps);
+        EXPECT_NEAR(std::abs(point.position.y()), 0.5f, kEps);
+    }
+}
+
+TEST(ContactBoxBoxTest, ClippedOctagonIsReducedToFourPoints) {
+    // Two squares at 45 degrees overlap in an octagon
+    const Obb a(Vec3f(0, 0, 0), Vec3f(0.5f, 0.5f, 0.5f));
+    const Obb b(Vec3f(0, 0, 1.1f), Vec3f(0.6f, 0.6f, 0.65f), Quatf::fromAxisAngle(Vec3f::zAxis(), degToRad(45.0f)));
+    ContactManifold manifold;
+
+    ASSERT_TRUE(generateContacts(a, b, manifold));
+    EXPECT_EQ(manifold.count, 4u);
+    EXPECT_TRUE(manifold.normal.areSame(Vec3f(0, 0, 1), kEps));
+    EXPECT_TRUE(allDepthsNear(manifold, 0.05f));
+    for (const ContactPoint& point : manifold.contacts()) {
+        EXPECT_LE(std::abs(point.position.x()), 0.5f + kEps);
+        EXPECT_LE(std::abs(point.position.y()), 0.5f + kEps);
+    }
+}
+
+TEST(ContactBoxBoxTest, EdgeAgainstEdge) {
+    // Ridges crossing at right angles, as in the SAT edge-axis test
+    const Obb a(Vec3f(0, 0, 0), Vec3f(1, 1, 1), Quatf::fromAxisAngle(Vec3f::xAxis(), degToRad(45.0f)));
+    const Obb b(Vec3f(0, 0, 2.7f), Vec3f(1, 1, 1), Quatf::fromAxisAngle(Vec3f::yAxis(), degToRad(45.0f)));
+    ContactManifold manifold;
+
+    ASSERT_TRUE(generateContacts(a, b, manifold));
+    EXPECT_EQ(manifold.count, 1u);
+    EXPECT_TRUE(manifold.normal.areSame(Vec3f(0, 0, 1), kEps));
+    // Ridges at z = sqrt(2) and 2.7 - sqrt(2)
+    EXPECT_NEAR(manifold.points[0].depth, 2.0f * std::sqrt(2.0f) - 2.7f, kEps);
+    EXPECT_TRUE(manifold.points[0].position.areSame(Vec3f(0, 0, 2.7f - std::sqrt(2.0f)), kEps));
+}
+
+TEST(ContactBoxBoxTest, SeparatedBoxes) {
+    const Obb a(Vec3f(0, 0, 0), Vec3f(1, 1, 1));
+    const Obb b(Vec3f(3, 0, 0), Vec3f(1, 1, 1), Quatf::fromAxisAngle(Vec3f::zAxis(), 0.3f));
+    ContactManifold manifold;
+    manifold.addPoint(Vec3f::zero(), 1.0f);
+
+    EXPECT_FALSE(generateContacts(a, b, manifold));
+    EXPECT_TRUE(manifold.empty());
+}
+
+TEST(ContactBoxBoxTest, AgreesWithIntersects) {
+    std::mt19937 rng(0x61C0066u);
+    std::uniform_real_distribution<float> pos(-2.5f, 2.5f);
+    std::uniform_real_distribution<float> ext(0.2f, 1.5f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    for (int i = 0; i < 300; ++i) {
+        const Quatf qa = Quatf(unit(rng), unit(rng), unit(rng), unit(rng)).normalized();
+        const Quatf qb = Quatf(unit(rng), unit(rng), unit(rng), unit(rng)).normalized();
+        const Obb a(Vec3f(pos(rng), pos(rng), pos(rng)), Vec3f(ext(rng), ext(rng), ext(rng)), qa);
+        const Obb b(Vec3f(pos(rng), pos(rng), pos(rng)), Vec3f(ext(rng), ext(rng), ext(rng)), qb);
+
+        ContactManifold manifold;
+        ASSERT_EQ(generateContacts(a, b, manifold), a.intersects(b)) << i;
+        if (manifold.empty()) {
+            continue;
+        }
+        EXPECT_NEAR(manifold.normal.length(), 1.0f, kEps) << i;
+        for (const ContactPoint& point : manifold.contacts()) {
+            EXPECT_GE(point.depth, 0.0f) << i;
+            // Positions lie on (or just inside) B, and the matching point on A is within A
+            EXPECT_LE(b.distanceToPoint(point.position), 1e-3f) << i;
+            EXPECT_LE(a.distanceToPoint(point.position + manifold.normal * point.depth), 1e-3f) << i;
+        }
+    }
+}
+
+// ============================================================================
+// Capsule-Capsule Tests
+// ============================================================================
+
+TEST(ContactCapsuleCapsuleTest, Crossing) {
+    const Capsule a(Vec3f(-1, 0, 0), Vec3f(1, 0, 0), 0.5f);
+    const Capsule b(Vec3f(0, -1, 0.8f), Vec3f(0, 1, 0.8f), 0.5f);
+    ContactManifold manifold;
+
+    ASSERT_TRUE(generateContacts(a, b, manifold));
+    EXPECT_EQ(manifold.count, 1u);
+    EXPECT_TRUE(manifold.normal.areSame(Vec3f(0, 0, 1), kEps));
+    EXPECT_NEAR(manifold.points[0].depth, 0.2f, kEps);
+    EXPECT_TRUE(manifold.points[0].position.areSame(Vec3f(0, 0, 0.3f), kEps));
+}
+
+TEST(ContactCapsuleCapsuleTest, ParallelOverlapGivesTwoPoints) {
+    const Capsule a(Vec3f(0, 0, 0), Vec3f(4, 0, 0), 0.5f);
+    const Capsule b(Vec3f(3, 0.9f, 0), Vec3f(6, 0.9f, 0), 0.5f);
+    ContactManifold manifold;
+
+    ASSERT_TRUE(generateContacts(a, b, manifold));
+    ASSERT_EQ(manifold.count, 2u);
+    EXPECT_TRUE(manifold.normal.areSame(Vec3f(0, 1, 0), kEps));
+    EXPECT_TRUE(allDepthsNear(manifold, 0.1f));
+    EXPECT_NEAR(std::min(manifold.points[0].position.x(), manifold.points[1].position.x()), 3.0f, kEps);
+    EXPECT_NEAR(std::max(manifold.points[0].position.x(), manifold.points[1].position.x()), 4.0f, kEps);
+}
+
+TEST(ContactCapsuleCapsuleTest, IntersectingSegments) {
+    const Capsule a(Vec3f(-1, 0, 0), Vec3f(1, 0, 0), 0.25f);
+    const Capsule b(Vec3f(0, -1, 0), Vec3f(0, 1, 0), 0.25f);
+    ContactManifold manifold;
+
+    ASSERT_TRUE(generateContacts(a, b, manifold));
+    EXPECT_NEAR(std::abs(manifold.normal.z()), 1.0f, kEps);
+    EXPECT_NEAR(manifold.points[0].depth, 0.5f, kEps);
+}
+
+TEST(ContactCapsuleCapsuleTest, Separated) {
+    const Capsule a(Vec3f(0, 0, 0), Vec3f(1, 0, 0), 0.6f);
+    const Capsule b(Vec3f(1.5f, -1, 0), Vec3f(3.5f, 1, 0), 0.4f);
+    ContactManifold manifold;
+
+    EXPECT_FALSE(generateContacts(a, b, manifold));
+    EXPECT_TRUE(manifold.empty());
+}
+
+// ============================================================================
+// Sphere-Box Tests
+// ============================================================================
+
+TEST(ContactSphereBoxTest, CenterOutside) {
+    const Sphere a(Vec3f(0, 2.4f, 0), 0.5f);
+    const Obb b(Vec3f(0, 0, 0), Vec3f(1, 2, 1));
+    ContactManifold manifold;
+
+    ASSERT_TRUE(generateContacts(a, b, manifold));
+    EXPECT_EQ(manifold.count, 1u);
+    EXPECT_TRUE(manifold.normal.areSame(Vec3f(0, -1, 0), kEps));
+    EXPECT_NEAR(manifold.points[0].depth, 0.1f, kEps);
+    EXPECT_TRUE(manifold.points[0].position.areSame(Vec3f(0, 2, 0), kEps));
+}
+
+TEST(ContactSphereBoxTest, CenterInside) {
+    const Sphere a(Vec3f(0.8f, 0, 0), 0.5f);
+    const Obb b(Vec3f(0, 0, 0), Vec3f(1, 2, 1));
+    ContactManifold manifold;
+
+    // Nearest face is +x, 0.2 away: B must move in -x by 0.2 + 0.5
+    ASSERT_TRUE(generateContacts(a, b, manifold));
+    EXPECT_TRUE(manifold.normal.areSame(Vec3f(-1, 0, 0), kEps));
+    EXPECT_NEAR(manifold.points[0].depth, 0.7f, kEps);
+    EXPECT_TRUE(manifold.points[0].position.areSame(Vec3f(1, 0, 0), kEps));
+}
+
+TEST(ContactSphereBoxTest, Separated) {
+    const Sphere a(Vec3f(1.5f, 2.5f, 0), 0.6f);
+    const Obb b(Vec3f(0, 0, 0), Vec3f(1, 2, 1));
+    ContactManifold manifold;
+
+    EXPECT_FALSE(generateContacts(a, b, manifold));
+}
+
+// ============================================================================
+// Capsule-Box Tests
+// ============================================================================
+
+TEST(ContactCapsuleBoxTest, LyingOnFaceGivesTwoPoints) {
+    const Capsule a(Vec3f(-3, 1.4f, 0), Vec3f(0.5f, 1.4f, 0), 0.5f);
+    const Obb b(Vec3f(0, 0, 0), Vec3f(1, 1, 1));
+    ContactManifold manifold;
+
+    ASSERT_TRUE(generateContacts(a, b, manifold));
+    ASSERT_EQ(manifold.count, 2u);
+    EXPECT_TRUE(manifold.normal.areSame(Vec3f(0, -1, 0), kEps));
+    EXPECT_TRUE(allDepthsNear(manifold, 0.1f));
+    // The segment is clipped to the face: x in [-1, 0.5]
+    EXPECT_NEAR(std::min(manifold.points[0].position.x(), manifold.points[1].position.x()), -1.0f, kEps);
+    EXPECT_NEAR(std::max(manifold.points[0].position.x(), manifold.points[1].position.x()), 0.5f, kEps);
+    EXPECT_NEAR(manifold.points[0].position.y(), 1.0f, kEps);
+}
+
+TEST(ContactCapsuleBoxTest, StandingOnFaceGivesOnePoint) {
+    const Capsule a(Vec3f(0.2f, 1.3f, 0), Vec3f(0.2f, 3, 0), 0.5f);
+    const Obb b(Vec3f(0, 0, 0), Vec3f(1, 1, 1));
+    ContactManifold manifold;
+
+    ASSERT_TRUE(generateContacts(a, b, manifold));
+    EXPECT_EQ(manifold.count, 1u);
+    EXPECT_TRUE(manifold.normal.areSame(Vec3f(0, -1, 0), kEps));
+    EXPECT_NEAR(manifold.points[0].depth, 0.2f, kEps);
+    EXPECT_TRUE(manifold.points[0].position.areSame(Vec3f(0.2f, 1, 0), kEps));
+}
+
+TEST(ContactCapsuleBoxTest, SegmentInsideBox) {
+    const Capsule a(Vec3f(-0.5f, 0.7f, 0), Vec3f(0.5f, 0.7f, 0), 0.1f);
+    const Obb b(Vec3f(0, 0, 0), Vec3f(1, 1, 1));
+    ContactManifold manifold;
+
+    // Shortest way out is through +y: 0.3 + 0.1
+    ASSERT_TRUE(generateContacts(a, b, manifold));
+    EXPECT_EQ(manifold.count, 2u);
+    EXPECT_TRUE(manifold.normal.areSame(Vec3f(0, -1, 0), kEps));
+    EXPECT_TRUE(allDepthsNear(manifold, 0.4f));
+}
+
+TEST(ContactCapsuleBoxTest, Separated) {
+    const Capsule a(Vec3f(-3, 1.6f, 0), Vec3f(0.5f, 1.6f, 0), 0.5f);
+    const Obb b(Vec3f(0, 0, 0), Vec3f(1, 1, 1));
+    ContactManifold manifold;
+
+    EXPECT_FALSE(generateContacts(a, b, manifold));
+}
+
+// ============================================================================
+// Batch Tests
+// ============================================================================
+
+TEST(ContactBatchTest, MatchesPairQueries) {
+    std::mt19937 rng(0x61C0067u);
+    std::uniform_real_distribution<float> pos(-3.0f, 3.0f);
+    std::uniform_real_distribution<float> ext(0.2f, 1.5f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    std::vector<Obb> boxes;
+    std::vector<Sphere> spheres;
+    std::vector<Capsule> capsules;
+    for (int i = 0; i < 24; ++i) {
+        const Quatf q = Quatf(unit(rng), unit(rng), unit(rng), unit(rng)).normalized();
+        boxes.emplace_back(Vec3f(pos(rng), pos(rng), pos(rng)), Vec3f(ext(rng), ext(rng), ext(rng)), q);
+        spheres.emplace_back(Vec3f(pos(rng), pos(rng), pos(rng)), ext(rng));
+        capsules.emplace_back(Vec3f(pos(rng), pos(rng), pos(rng)), Vec3f(pos(rng), pos(rng), pos(rng)), ext(rng));
+    }
+    std::vector<ContactPair> pairs;
+    for (uint32_t i = 0; i < 24; ++i) {
+        for (uint32_t j = i + 1; j < 24; j += 3) {
+            pairs.push_back(ContactPair{i, j});
+        }
+    }
+
+    std::vector<ContactManifold> manifolds(pairs.size());
+    auto check = [&](auto shapes_a, auto shapes_b) {
+        const size_t touching = generateContacts(std::span(shapes_a), std::span(shapes_b), pairs, manifolds);
+        size_t expected = 0;
+        for (size_t i = 0; i < pairs.size(); ++i) {
+            ContactManifold single;
+            expected += generateContacts(shapes_a[pairs[i].a], shapes_b[pairs[i].b], single) ? 1 : 0;
+            ASSERT_EQ(manifolds[i].count, single.count) << i;
+            for (uint32_t k = 0; k < single.count; ++k) {
+                EXPECT_EQ(manifolds[i].points[k].position, single.points[k].position) << i;
+                EXPECT_EQ(manifolds[i].points[k].depth, single.points[k].depth) << i;
+            }
+        }
+        EXPECT_EQ(touching, expected);
+        EXPECT_GT(touching, 0u);
+    };
+
+    check(std::span<const Obb>(boxes), std::span<const Obb>(boxes));
+    check(std::span<const Capsule>(capsules), std::span<const Capsule>(capsules));
+    check(std::span<const Sphere>(spheres), std::span<const Obb>(boxes));
+    check(std::span<const Capsule>(capsules), std::span<const Obb>(boxes));
+}
+
+}  // namespace vne::math
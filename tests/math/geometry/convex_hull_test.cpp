@@ -0,0 +1,265 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Convex hull tests - monotone chain, quickhull topology and containment,
+ * degenerate inputs and scratch reuse.
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/math/geometry/convex_hull.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace vne::math {
+
+namespace {
+
+std::vector<Vec3f> randomCube(size_t count, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> coord(-1.0f, 1.0f);
+    std::vector<Vec3f> points;
+    for (size_t i = 0; i < count; ++i) {
+        points.emplace_back(coord(rng) * 2.0f + 5.0f, coord(rng), coord(rng) * 0.5f - 3.0f);
+    }
+    return points;
+}
+
+std::vector<Vec3f> randomSphere(size_t count, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> gauss(0.0f, 1.0f);
+    std::vector<Vec3f> points;
+    for (size_t i = 0; i < count; ++i) {
+        points.push_back(Vec3f(gauss(rng), gauss(rng), gauss(rng)).normalized());
+    }
+    return points;
+}
+
+/// Closed, consistently wound, V - E + F = 2 and every point behind every face
+void expectValidHull(const ConvexHull& hull, const std::vector<Vec3f>& points) {
+    ASSERT_FALSE(hull.empty());
+    ASSERT_EQ(hull.triangles.size() % 3, 0u);
+
+    // Each directed edge once, and its reverse in another face
+    std::map<std::pair<uint32_t, uint32_t>, int> directed;
+    for (size_t t = 0; t < hull.triangles.size(); t += 3) {
+        for (size_t i = 0; i < 3; ++i) {
+            ++directed[{hull.triangles[t + i], hull.triangles[t + (i + 1) % 3]}];
+        }
+    }
+    for (const auto& [edge, uses] : directed) {
+        EXPECT_EQ(uses, 1);
+        EXPECT_EQ(directed.count({edge.second, edge.first}), 1u);
+    }
+    EXPECT_EQ(hull.edgeCount() * 2, directed.size());
+    EXPECT_EQ(static_cast<long>(hull.vertices.size()) - static_cast<long>(hull.edgeCount())
+                  + static_cast<long>(hull.faceCount()),
+              2);
+    EXPECT_TRUE(std::is_sorted(hull.vertices.begin(), hull.vertices.end()));
+
+    float extent = 0.0f;
+    for (const Vec3f& p : points) {
+        extent = std::max(extent, std::abs(p.x()) + std::abs(p.y()) + std::abs(p.z()));
+    }
+    // A point within the build tolerance of one face can end up slightly above a
+    // sliver next to it; the plane error grows with the sliver's aspect ratio
+    for (size_t t = 0; t < hull.triangles.size(); t += 3) {
+        const Vec3f& a = points[hull.triangles[t]];
+        const Vec3f& b = points[hull.triangles[t + 1]];
+        const Vec3f& c = points[hull.triangles[t + 2]];
+        const Vec3f n = (b - a).cross(c - a);
+        if (n.length() == 0.0f) {
+            continue;
+        }
+        const float longest = std::max({(b - a).length(), (c - b).length(), (a - c).length()});
+        const float tolerance = 1e-6f * extent * std::max(1.0f, longest * longest / n.length());
+        const Vec3f unit = n.normalized();
+        for (const Vec3f& p : points) {
+            EXPECT_LE(unit.dot(p - a), tolerance);
+        }
+    }
+}
+
+}  // namespace
+
+// ============================================================================
+// 2D Hull Tests
+// ============================================================================
+
+TEST(ConvexHull2dTest, SquareDropsInteriorAndEdgePoints) {
+    const std::vector<Vec2f> points{Vec2f(0.5f, 0.5f),
+                                    Vec2f(1, 1),
+                                    Vec2f(0, 0),
+                                    Vec2f(0.5f, 0),
+                                    Vec2f(1, 0),
+                                    Vec2f(0, 1),
+                                    Vec2f(0.2f, 0.7f),
+                                    Vec2f(1, 0)};
+    const std::vector<uint32_t> hull = convexHull(points);
+    // Counter-clockwise from the lowest-x (then lowest-y) point
+    EXPECT_EQ(hull, (std::vector<uint32_t>{2, 4, 1, 5}));
+}
+
+TEST(ConvexHull2dTest, DuplicatesKeepLowestIndex) {
+    const std::vector<Vec2f> points{Vec2f(0, 0),
+                                    Vec2f(1, 0),
+                                    Vec2f(1, 1),
+                                    Vec2f(0, 1),
+                                    Vec2f(1, 1),
+                                    Vec2f(0, 1),
+                                    Vec2f(0, 0),
+                                    Vec2f(1, 0),
+                                    Vec2f(0, 1)};
+    // Upper-chain corners must report their first index too, not the last duplicate
+    EXPECT_EQ(convexHull(points), (std::vector<uint32_t>{0, 1, 2, 3}));
+
+    // Same through the reusable scratch, and with the originals at the end
+    const std::vector<Vec2f> reversed(points.rbegin(), points.rend());
+    HullScratch scratch;
+    std::vector<uint32_t> hull;
+    convexHull(reversed, hull, scratch);
+    EXPECT_EQ(hull, (std::vector<uint32_t>{2, 1, 4, 0}));
+}
+
+TEST(ConvexHull2dTest, Degenerate) {
+    EXPECT_TRUE(convexHull(std::span<const Vec2f>{}).empty());
+
+    const std::vector<Vec2f> same{Vec2f(3, 4), Vec2f(3, 4), Vec2f(3, 4)};
+    EXPECT_EQ(convexHull(same).size(), 1u);
+
+    const std::vector<Vec2f> line{Vec2f(1, 1), Vec2f(3, 3), Vec2f(0, 0), Vec2f(2, 2)};
+    EXPECT_EQ(convexHull(line), (std::vector<uint32_t>{2, 1}));
+}
+
+TEST(ConvexHull2dTest, RandomIsConvexAndEnclosing) {
+    std::mt19937 rng(7u);
+    std::uniform_real_distribution<float> coord(-10.0f, 10.0f);
+    std::vector<Vec2f> points;
+    for (int i = 0; i < 2000; ++i) {
+        points.emplace_back(coord(rng), coord(rng));
+    }
+    const std::vector<uint32_t> hull = convexHull(points);
+    ASSERT_GE(hull.size(), 3u);
+    for (size_t i = 0; i < hull.size(); ++i) {
+        const Vec2f& a = points[hull[i]];
+        const Vec2f edge = points[hull[(i + 1) % hull.size()]] - a;
+        for (const Vec2f& p : points) {
+            EXPECT_GE(edge.cross(p - a), -1e-3f);
+        }
+    }
+}
+
+// ============================================================================
+// 3D Hull Tests
+// ============================================================================
+
+TEST(ConvexHull3dTest, CubeWithInteriorPoints) {
+    std::vector<Vec3f> points = randomCube(500, 1u);
+    for (int i = 0; i < 8; ++i) {
+        points.emplace_back((i & 1) ? 7.0f : 3.0f, (i & 2) ? 1.0f : -1.0f, (i & 4) ? -2.5f : -3.5f);
+    }
+    const ConvexHull hull = convexHull(points);
+    expectValidHull(hull, points);
+    // Six square faces, each split in two
+    EXPECT_EQ(hull.vertices.size(), 8u);
+    EXPECT_EQ(hull.faceCount(), 12u);
+    EXPECT_EQ(hull.edgeCount(), 18u);
+    for (const uint32_t v : hull.vertices) {
+        EXPECT_GE(v, 500u);
+    }
+}
+
+TEST(ConvexHull3dTest, RandomClouds) {
+    for (uint32_t seed = 1; seed <= 4; ++seed) {
+        const std::vector<Vec3f> cube = randomCube(3000, seed);
+        expectValidHull(convexHull(cube), cube);
+    }
+}
+
+TEST(ConvexHull3dTest, AllPointsOnSphere) {
+    const std::vector<Vec3f> points = randomSphere(2000, 11u);
+    const ConvexHull hull = convexHull(points);
+    expectValidHull(hull, points);
+    // Nearly every point of a sphere sample is a hull vertex
+    EXPECT_GT(hull.vertices.size(), 1900u);
+}
+
+TEST(ConvexHull3dTest, Degenerate) {
+    EXPECT_TRUE(convexHull(std::span<const Vec3f>{}).empty());
+
+    const std::vector<Vec3f> same{Vec3f(1, 2, 3), Vec3f(1, 2, 3), Vec3f(1, 2, 3), Vec3f(1, 2, 3)};
+    EXPECT_TRUE(convexHull(same).empty());
+
+    const std::vector<Vec3f> line{Vec3f(0, 0, 0), Vec3f(1, 2, 3), Vec3f(2, 4, 6), Vec3f(-1, -2, -3)};
+    EXPECT_TRUE(convexHull(line).empty());
+}
+
+TEST(ConvexHull3dTest, CoplanarGivesTwoSidedPolygon) {
+    // A square in a tilted plane, corners first, with points strictly inside
+    const Vec3f u = Vec3f(1, 1, 0).normalized();
+    const Vec3f v = Vec3f(-1, 1, 2).normalized();
+    std::vector<Vec3f> points;
+    for (const float corner_u : {0.0f, 4.0f}) {
+        for (const float corner_v : {0.0f, 4.0f}) {
+            points.push_back(Vec3f(2, 0, 1) + u * corner_u + v * corner_v);
+        }
+    }
+    std::mt19937 rng(5u);
+    std::uniform_real_distribution<float> inside(0.5f, 3.5f);
+    for (int i = 0; i < 50; ++i) {
+        points.push_back(Vec3f(2, 0, 1) + u * inside(rng) + v * inside(rng));
+    }
+    const ConvexHull hull = convexHull(points);
+    EXPECT_EQ(hull.vertices, (std::vector<uint32_t>{0, 1, 2, 3}));
+    EXPECT_EQ(hull.faceCount(), 4u);
+
+    // Opposite windings on the two sides
+    const Vec3f n0 = (points[hull.triangles[1]] - points[hull.triangles[0]])
+                         .cross(points[hull.triangles[2]] - points[hull.triangles[0]]);
+    const Vec3f n2 = (points[hull.triangles[7]] - points[hull.triangles[6]])
+                         .cross(points[hull.triangles[8]] - points[hull.triangles[6]]);
+    EXPECT_LT(n0.normalized().dot(n2.normalized()), -0.99f);
+}
+
+// ============================================================================
+// Scratch Tests
+// ============================================================================
+
+TEST(HullScratchTest, RepeatedBuildsReuseMemory) {
+    const std::vector<Vec3f> points = randomSphere(1000, 3u);
+    HullScratch scratch;
+    scratch.reserve(points.size());  // Covers the 2D buffers too
+    ConvexHull hull;
+    convexHull(points, hull, scratch);
+    const size_t capacity = scratch.capacity();
+    const uint32_t* triangles = hull.triangles.data();
+    EXPECT_GT(capacity, 0u);
+
+    for (int i = 0; i < 3; ++i) {
+        convexHull(points, hull, scratch);
+        EXPECT_EQ(scratch.capacity(), capacity);
+        EXPECT_EQ(hull.triangles.data(), triangles);
+    }
+    expectValidHull(hull, points);
+
+    std::vector<Vec2f> flat;
+    for (const Vec3f& p : points) {
+        flat.emplace_back(p.x(), p.y());
+    }
+    std::vector<uint32_t> ring;
+    convexHull(flat, ring, scratch);
+    EXPECT_EQ(scratch.capacity(), capacity);
+    EXPECT_EQ(ring, convexHull(flat));
+}
+
+}  // namespace vne::math
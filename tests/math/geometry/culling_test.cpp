@@ -15,6 +15,7 @@
 #include "vertexnova/math/core/core.h"
 #include "vertexnova/math/geometry/geometry.h"
 
+#include <random>
 #include <vector>
 
 namespace vne::math {
@@ -288,4 +289,94 @@ TEST_F(SceneCullingTest, ObjectBeyondFarPlaneIsCulled) {
     }
 }
 
+TEST_F(SceneCullingTest, BatchCullMatchesPerObject) {
+    Vec3f eye(0.0f, 2.0f, 0.0f);
+    Vec3f target(0.0f, 0.0f, -10.0f);
+
+    Mat4f view = Mat4f::lookAt(eye, target, Vec3f::yAxis(), GraphicsApi::eVulkan);
+    Mat4f proj = Mat4f::perspective(degToRad(60.0f), 16.0f / 9.0f, 0.5f, 100.0f, GraphicsApi::eVulkan);
+
+    Frustum frustum;
+    frustum.extractFromMatrix(viewProjection(view, proj));
+
+    std::vector<Aabb> bounds;
+    for (const auto& obj : scene_) {
+        bounds.push_back(obj.bounds);
+    }
+    std::vector<uint8_t> visible(bounds.size());
+    const size_t count = intersects(frustum, bounds, visible);
+
+    size_t expected_count = 0;
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        const bool expected = frustum.intersects(bounds[i]);
+        EXPECT_EQ(visible[i], expected ? 1 : 0) << scene_[i].name;
+        expected_count += expected ? 1 : 0;
+    }
+    EXPECT_EQ(count, expected_count);
+}
+
+TEST_F(SceneCullingTest, BatchCullWithoutFarPlane) {
+    Vec3f eye(0.0f, 2.0f, 0.0f);
+    Vec3f target(0.0f, 0.0f, -10.0f);
+
+    Mat4f view = Mat4f::lookAt(eye, target, Vec3f::yAxis(), GraphicsApi::eVulkan);
+    Mat4f proj = Mat4f::perspective(degToRad(60.0f), 16.0f / 9.0f, 0.5f, 100.0f, GraphicsApi::eVulkan);
+
+    Frustum frustum;
+    frustum.extractFromMatrix(
+        viewProjection(view, proj), getClipSpaceDepth(GraphicsApi::eVulkan), DepthMode::eStandard, false);
+
+    // The distant mountain lies beyond the far plane, which is now ignored
+    std::vector<Aabb> bounds;
+    for (const auto& obj : scene_) {
+        bounds.push_back(obj.bounds);
+    }
+    std::vector<uint8_t> visible(bounds.size());
+    const size_t count = intersects(frustum, bounds, visible);
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        EXPECT_EQ(visible[i], frustum.intersects(bounds[i]) ? 1 : 0) << scene_[i].name;
+        if (scene_[i].name == "Distant_mountain") {
+            EXPECT_EQ(visible[i], 1);
+        }
+    }
+    EXPECT_GT(count, 0u);
+}
+
+TEST(BatchCullingTest, RandomBoxesMatchScalar) {
+    Frustum frustum;
+    frustum.extractFromMatrix(
+        Mat4f::perspective(degToRad(70.0f), 1.5f, 0.1f, 50.0f, GraphicsApi::eVulkan)
+            * Mat4f::lookAt(Vec3f(3.0f, 4.0f, 12.0f), Vec3f::zero(), Vec3f::yAxis(), GraphicsApi::eVulkan),
+        getClipSpaceDepth(GraphicsApi::eVulkan));
+
+    std::mt19937 rng(0xC0111u);
+    std::uniform_real_distribution<float> pos(-60.0f, 60.0f);
+    std::uniform_real_distribution<float> ext(0.0f, 3.0f);
+    // 103 exercises the 4-wide blocks and a padded tail
+    std::vector<Aabb> boxes;
+    for (int i = 0; i < 103; ++i) {
+        const Vec3f c(pos(rng), pos(rng), pos(rng));
+        const Vec3f e(ext(rng), ext(rng), ext(rng));
+        boxes.emplace_back(c - e, c + e);
+    }
+
+    std::vector<uint8_t> visible(boxes.size());
+    const size_t count = intersects(frustum, boxes, visible);
+    size_t expected_count = 0;
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        const bool expected = frustum.intersects(boxes[i]);
+        EXPECT_EQ(visible[i], expected ? 1 : 0) << i;
+        expected_count += expected ? 1 : 0;
+    }
+    EXPECT_EQ(count, expected_count);
+    EXPECT_GT(count, 0u);
+    EXPECT_LT(count, boxes.size());
+}
+
+TEST(BatchCullingTest, EmptyInput) {
+    Frustum frustum;
+    std::vector<uint8_t> visible;
+    EXPECT_EQ(intersects(frustum, std::span<const Aabb>{}, visible), 0u);
+}
+
 }  // namespace vne::math
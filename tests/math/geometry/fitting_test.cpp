@@ -0,0 +1,223 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Fitting tests - Ritter and Welzl spheres, PCA and DiTO boxes, k-DOPs and
+ * the multithreaded mesh batch.
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/math/geometry/fitting.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace vne::math {
+
+namespace {
+
+constexpr float kEps = 1e-4f;
+
+std::vector<Vec3f> randomCloud(size_t count, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> coord(-1.0f, 1.0f);
+    std::vector<Vec3f> points;
+    for (size_t i = 0; i < count; ++i) {
+        points.push_back(Vec3f(coord(rng) * 3.0f, coord(rng), coord(rng) * 0.5f) + Vec3f(10, -4, 2));
+    }
+    return points;
+}
+
+/// Points of a box with the given half extents, rotated and moved, including its corners
+std::vector<Vec3f> rotatedBoxCloud(const Vec3f& center, const Vec3f& half, const Quatf& rotation, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::vector<Vec3f> points;
+    for (int i = 0; i < 8; ++i) {
+        const Vec3f corner((i & 1) ? half.x() : -half.x(),
+                           (i & 2) ? half.y() : -half.y(),
+                           (i & 4) ? half.z() : -half.z());
+        points.push_back(center + rotation.rotate(corner));
+    }
+    for (int i = 0; i < 500; ++i) {
+        const Vec3f local(unit(rng) * half.x(), unit(rng) * half.y(), unit(rng) * half.z());
+        points.push_back(center + rotation.rotate(local));
+    }
+    return points;
+}
+
+void expectEncloses(const Sphere& sphere, const std::vector<Vec3f>& points) {
+    for (const Vec3f& p : points) {
+        EXPECT_LE((p - sphere.center()).length(), sphere.radius() * (1.0f + 1e-5f) + 1e-6f);
+    }
+}
+
+void expectEncloses(const Obb& box, const std::vector<Vec3f>& points) {
+    for (const Vec3f& p : points) {
+        const Vec3f d = p - box.center();
+        for (uint32_t k = 0; k < 3; ++k) {
+            EXPECT_LE(std::abs(d.dot(box.axis(k))), box.halfExtents()[k] + kEps);
+        }
+    }
+}
+
+}  // namespace
+
+// ============================================================================
+// Sphere Tests
+// ============================================================================
+
+TEST(FitSphereTest, EmptyIsInvalid) {
+    EXPECT_FALSE(fitSphereRitter({}).isValid());
+    EXPECT_FALSE(fitSphereWelzl({}).isValid());
+}
+
+TEST(FitSphereTest, WelzlIsMinimal) {
+    // Regular tetrahedron: the minimal sphere is the circumsphere
+    const std::vector<Vec3f> tetra{Vec3f(1, 1, 1), Vec3f(1, -1, -1), Vec3f(-1, 1, -1), Vec3f(-1, -1, 1)};
+    const Sphere sphere = fitSphereWelzl(tetra);
+    EXPECT_TRUE(sphere.center().areSame(Vec3f(0, 0, 0), kEps));
+    EXPECT_NEAR(sphere.radius(), std::sqrt(3.0f), kEps);
+
+    // An obtuse triangle's minimal sphere has its longest side as diameter
+    const std::vector<Vec3f> obtuse{Vec3f(-2, 0, 0), Vec3f(2, 0, 0), Vec3f(0, 0.5f, 0)};
+    const Sphere diameter = fitSphereWelzl(obtuse);
+    EXPECT_TRUE(diameter.center().areSame(Vec3f(0, 0, 0), kEps));
+    EXPECT_NEAR(diameter.radius(), 2.0f, kEps);
+}
+
+TEST(FitSphereTest, DegenerateClouds) {
+    const std::vector<Vec3f> single{Vec3f(1, 2, 3), Vec3f(1, 2, 3)};
+    EXPECT_NEAR(fitSphereWelzl(single).radius(), 0.0f, kEps);
+    EXPECT_NEAR(fitSphereRitter(single).radius(), 0.0f, kEps);
+
+    // Collinear and coplanar sets exercise the degenerate circumsphere paths
+    const std::vector<Vec3f> line{Vec3f(0, 0, 0), Vec3f(1, 1, 1), Vec3f(2, 2, 2), Vec3f(3, 3, 3)};
+    EXPECT_NEAR(fitSphereWelzl(line).radius(), std::sqrt(27.0f) * 0.5f, kEps);
+    const std::vector<Vec3f> square{Vec3f(1, 1, 0), Vec3f(-1, 1, 0), Vec3f(-1, -1, 0), Vec3f(1, -1, 0)};
+    EXPECT_NEAR(fitSphereWelzl(square).radius(), std::sqrt(2.0f), kEps);
+}
+
+TEST(FitSphereTest, RandomCloudsEnclosedAndRitterNotSmaller) {
+    for (uint32_t seed = 1; seed <= 5; ++seed) {
+        const std::vector<Vec3f> points = randomCloud(1001, seed);
+        const Sphere welzl = fitSphereWelzl(points);
+        const Sphere ritter = fitSphereRitter(points);
+        expectEncloses(welzl, points);
+        expectEncloses(ritter, points);
+        EXPECT_LE(welzl.radius(), ritter.radius() + kEps);
+        EXPECT_LE(ritter.radius(), welzl.radius() * 1.25f);
+    }
+}
+
+// ============================================================================
+// Oriented Box Tests
+// ============================================================================
+
+TEST(FitObbTest, EmptyGivesDefault) {
+    EXPECT_EQ(fitObbPca({}), Obb());
+    EXPECT_EQ(fitObbDito({}), Obb());
+}
+
+TEST(FitObbTest, RecoversRotatedBox) {
+    const Quatf rotation = Quatf::fromAxisAngle(Vec3f(1, 2, 0.5f).normalized(), 0.9f);
+    const Vec3f half(3.0f, 1.0f, 0.4f);
+    const std::vector<Vec3f> points = rotatedBoxCloud(Vec3f(5, -2, 1), half, rotation, 3u);
+    const float true_volume = 8.0f * half.x() * half.y() * half.z();
+
+    for (const Obb& box : {fitObbPca(points), fitObbDito(points)}) {
+        expectEncloses(box, points);
+        EXPECT_TRUE(box.center().areSame(Vec3f(5, -2, 1), 0.1f));
+        EXPECT_LT(box.volume(), true_volume * 1.3f);
+    }
+    // DiTO aligns with the box edges exactly because the corners are extreme points
+    EXPECT_NEAR(fitObbDito(points).volume(), true_volume, true_volume * 1e-3f);
+}
+
+TEST(FitObbTest, DitoNeverWorseThanAabb) {
+    for (uint32_t seed = 1; seed <= 5; ++seed) {
+        const std::vector<Vec3f> points = randomCloud(257, seed);
+        const Obb box = fitObbDito(points);
+        expectEncloses(box, points);
+        expectEncloses(fitObbPca(points), points);
+
+        Aabb aabb;
+        for (const Vec3f& p : points) {
+            aabb.expand(p);
+        }
+        EXPECT_LE(box.surfaceArea(), aabb.surfaceArea() * (1.0f + 1e-5f));
+    }
+}
+
+TEST(FitObbTest, AxesAreRightHanded) {
+    const std::vector<Vec3f> points = randomCloud(100, 9u);
+    for (const Obb& box : {fitObbPca(points), fitObbDito(points)}) {
+        EXPECT_TRUE(box.axisX().cross(box.axisY()).areSame(box.axisZ(), kEps));
+    }
+}
+
+// ============================================================================
+// k-DOP Tests
+// ============================================================================
+
+TEST(FitKdopTest, MatchesExpandLoop) {
+    // 103 points leaves a partial SIMD block
+    const std::vector<Vec3f> points = randomCloud(103, 4u);
+    for (const DopType type : {DopType::eDop14, DopType::eDop18, DopType::eDop26}) {
+        Kdop expected(type);
+        for (const Vec3f& p : points) {
+            expected.expand(p);
+        }
+        const Kdop dop = fitKdop(points, type);
+        ASSERT_EQ(dop.type(), type);
+        for (uint32_t slot = 0; slot < dop.axisCount(); ++slot) {
+            EXPECT_NEAR(dop.min(slot), expected.min(slot), kEps);
+            EXPECT_NEAR(dop.max(slot), expected.max(slot), kEps);
+        }
+    }
+    EXPECT_FALSE(fitKdop({}).isValid());
+}
+
+// ============================================================================
+// Batch Tests
+// ============================================================================
+
+TEST(FitBoundsTest, ThreadedMatchesSerial) {
+    std::vector<std::vector<Vec3f>> clouds;
+    std::vector<std::span<const Vec3f>> meshes;
+    for (uint32_t seed = 0; seed < 12; ++seed) {
+        clouds.push_back(randomCloud(50 + seed * 37, seed + 100));
+    }
+    clouds.emplace_back();  // An empty mesh in the batch
+    for (const auto& cloud : clouds) {
+        meshes.push_back(cloud);
+    }
+
+    FitOptions options;
+    std::vector<MeshBounds> serial(meshes.size());
+    fitBounds(meshes, serial, options);
+    options.thread_count = 4;
+    std::vector<MeshBounds> threaded(meshes.size());
+    fitBounds(meshes, threaded, options);
+
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        EXPECT_EQ(serial[i].aabb, threaded[i].aabb);
+        EXPECT_EQ(serial[i].sphere, threaded[i].sphere);
+        EXPECT_EQ(serial[i].obb, threaded[i].obb);
+        if (!clouds[i].empty()) {
+            expectEncloses(threaded[i].sphere, clouds[i]);
+            expectEncloses(threaded[i].obb, clouds[i]);
+            EXPECT_TRUE(threaded[i].aabb.contains(clouds[i][0]));
+            EXPECT_TRUE(threaded[i].dop.contains(clouds[i][0]));
+        }
+    }
+    EXPECT_FALSE(threaded.back().sphere.isValid());
+}
+
+}  // namespace vne::math
@@ -157,4 +157,89 @@ TEST_F(FrustumTest, PlaneAccessors) {
     EXPECT_TRUE(bottom.isNormalized(1e-3f));
 }
 
+// ============================================================================
+// Depth Convention Tests
+// ============================================================================
+
+class FrustumDepthModeTest : public ::testing::Test {
+   protected:
+    static constexpr float kNear = 0.5f;
+    static constexpr float kFar = 50.0f;
+
+    static Frustum extract(GraphicsApi api, DepthMode mode, bool with_far_plane = true) {
+        Mat4x4f proj = Mat4x4f::perspective(degToRad(60.0f), 1.0f, kNear, kFar, api, mode);
+        Mat4x4f view = Mat4x4f::lookAt(Vec3f::zero(), Vec3f(0.0f, 0.0f, -1.0f), Vec3f::up(), api);
+        Frustum frustum;
+        frustum.extractFromMatrix(proj * view, getClipSpaceDepth(api), mode, with_far_plane);
+        return frustum;
+    }
+
+    /// Point on the view axis at a distance in front of the camera (which looks down world -Z)
+    static Vec3f onAxis(float distance) { return Vec3f(0.0f, 0.0f, -distance); }
+};
+
+TEST_F(FrustumDepthModeTest, ZeroToOneNearPlaneIsTight) {
+    // The legacy [-1,1] extraction of a [0,1] matrix leaves the near plane behind the camera
+    Frustum frustum = extract(GraphicsApi::eVulkan, DepthMode::eStandard);
+    EXPECT_TRUE(frustum.contains(onAxis(kNear * 1.01f)));
+    EXPECT_FALSE(frustum.contains(onAxis(kNear * 0.9f)));
+    EXPECT_NEAR(frustum.nearPlane().signedDistance(Vec3f::zero()), -kNear, 1e-4f);
+    EXPECT_NEAR(frustum.farPlane().signedDistance(Vec3f::zero()), kFar, 1e-2f);
+}
+
+TEST_F(FrustumDepthModeTest, ReverseZMatchesStandardPlanes) {
+    GraphicsApi apis[] = {GraphicsApi::eOpenGL,
+                          GraphicsApi::eVulkan,
+                          GraphicsApi::eMetal,
+                          GraphicsApi::eDirectX,
+                          GraphicsApi::eWebGPU};
+
+    for (GraphicsApi api : apis) {
+        Frustum standard = extract(api, DepthMode::eStandard);
+        Frustum reversed = extract(api, DepthMode::eReversed);
+        const Plane* lhs[] = {&standard.nearPlane(), &standard.farPlane(), &standard.leftPlane()};
+        const Plane* rhs[] = {&reversed.nearPlane(), &reversed.farPlane(), &reversed.leftPlane()};
+        for (int i = 0; i < 3; ++i) {
+            EXPECT_NEAR(lhs[i]->normal.x(), rhs[i]->normal.x(), 1e-4f) << graphicsApiName(api) << " plane " << i;
+            EXPECT_NEAR(lhs[i]->normal.y(), rhs[i]->normal.y(), 1e-4f) << graphicsApiName(api) << " plane " << i;
+            EXPECT_NEAR(lhs[i]->normal.z(), rhs[i]->normal.z(), 1e-4f) << graphicsApiName(api) << " plane " << i;
+            EXPECT_NEAR(lhs[i]->d, rhs[i]->d, 1e-2f) << graphicsApiName(api) << " plane " << i;
+        }
+        EXPECT_TRUE(reversed.contains(onAxis(10.0f))) << graphicsApiName(api);
+        EXPECT_FALSE(reversed.contains(onAxis(kFar * 1.1f))) << graphicsApiName(api);
+        EXPECT_FALSE(reversed.contains(onAxis(kNear * 0.5f))) << graphicsApiName(api);
+    }
+}
+
+TEST_F(FrustumDepthModeTest, InfiniteProjectionHasFivePlanes) {
+    for (DepthMode mode : {DepthMode::eInfinite, DepthMode::eInfiniteReversed}) {
+        Frustum frustum = extract(GraphicsApi::eDirectX, mode);
+        EXPECT_FALSE(frustum.hasFarPlane());
+        EXPECT_EQ(frustum.planeCount(), 5u);
+        EXPECT_TRUE(frustum.nearPlane().isNormalized(1e-3f));
+
+        const Vec3f far_away = onAxis(1.0e6f);
+        EXPECT_TRUE(frustum.contains(far_away));
+        EXPECT_TRUE(frustum.intersects(Sphere(far_away, 1.0f)));
+        EXPECT_TRUE(frustum.intersects(Aabb(far_away - Vec3f(1.0f), far_away + Vec3f(1.0f))));
+        EXPECT_TRUE(frustum.containsFully(Sphere(far_away, 1.0f)));
+        EXPECT_FALSE(frustum.contains(onAxis(kNear * 0.5f)));
+        EXPECT_FALSE(frustum.intersects(Sphere(Vec3f(1.0e6f, 0.0f, 10.0f), 1.0f)));
+    }
+}
+
+TEST_F(FrustumDepthModeTest, OptionalFarPlaneForFiniteProjection) {
+    Frustum six = extract(GraphicsApi::eVulkan, DepthMode::eReversed);
+    Frustum five = extract(GraphicsApi::eVulkan, DepthMode::eReversed, false);
+    EXPECT_TRUE(six.hasFarPlane());
+    EXPECT_FALSE(five.hasFarPlane());
+    EXPECT_FALSE(six == five);
+
+    const Vec3f beyond_far = onAxis(kFar * 2.0f);
+    EXPECT_FALSE(six.contains(beyond_far));
+    EXPECT_TRUE(five.contains(beyond_far));
+    EXPECT_FALSE(six.intersects(Aabb(beyond_far - Vec3f(1.0f), beyond_far + Vec3f(1.0f))));
+    EXPECT_TRUE(five.intersects(Aabb(beyond_far - Vec3f(1.0f), beyond_far + Vec3f(1.0f))));
+}
+
 }  // namespace vne::math
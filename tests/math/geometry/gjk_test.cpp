@@ -0,0 +1,297 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * GJK / EPA tests - support functions, distance, overlap, penetration
+ * depth and warm starting.
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/math/geometry/gjk.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace vne::math {
+
+namespace {
+
+constexpr float kEps = 1e-3f;
+
+std::vector<Vec3f> cubeCorners(const Vec3f& center, float half) {
+    std::vector<Vec3f> corners;
+    for (uint32_t i = 0; i < 8; ++i) {
+        corners.push_back(center
+                          + Vec3f((i & 1u) ? half : -half, (i & 2u) ? half : -half, (i & 4u) ? half : -half));
+    }
+    return corners;
+}
+
+/// Segment-segment distance by dense sampling of one segment
+float sampledSegmentDistance(const LineSegment& a, const LineSegment& b) {
+    float best = std::numeric_limits<float>::max();
+    for (int i = 0; i <= 4000; ++i) {
+        best = std::min(best, b.distanceToPoint(a.getPoint(static_cast<float>(i) / 4000.0f)));
+    }
+    return best;
+}
+
+}  // namespace
+
+// ============================================================================
+// Support Function Tests
+// ============================================================================
+
+TEST(GjkSupportTest, PrimitiveSupports) {
+    const Aabb aabb(Vec3f(-1, -2, -3), Vec3f(1, 2, 3));
+    EXPECT_EQ(support(aabb, Vec3f(1, -1, 1)), Vec3f(1, -2, 3));
+
+    const Sphere sphere(Vec3f(1, 0, 0), 2.0f);
+    EXPECT_TRUE(support(sphere, Vec3f(0, 5, 0)).areSame(Vec3f(1, 2, 0)));
+
+    const Capsule capsule(Vec3f(0, -1, 0), Vec3f(0, 1, 0), 0.5f);
+    EXPECT_TRUE(support(capsule, Vec3f(1, 1, 0)).areSame(Vec3f(0.5f, 1.0f, 0.0f) + Vec3f(-0.5f + 0.35355339f, 0.35355339f, 0.0f)));
+
+    const Obb obb(Vec3f(0, 0, 0), Vec3f(1, 2, 3), Quatf::fromAxisAngle(Vec3f::zAxis(), degToRad(90.0f)));
+    // Local x maps to world y, local y to world -x
+    EXPECT_TRUE(support(obb, Vec3f(1, 1, 1)).areSame(Vec3f(2, 1, 3), kEps));
+
+    const Triangle triangle(Vec3f(0, 0, 0), Vec3f(1, 0, 0), Vec3f(0, 1, 0));
+    EXPECT_EQ(support(triangle, Vec3f(-1, 2, 0)), Vec3f(0, 1, 0));
+}
+
+TEST(GjkSupportTest, PointSetMatchesBruteForce) {
+    std::mt19937 rng(0x61C0063u);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::vector<Vec3f> points(37);  // Not a multiple of the SIMD width
+    for (Vec3f& p : points) {
+        p = Vec3f(unit(rng), unit(rng), unit(rng)) * 5.0f;
+    }
+
+    for (int i = 0; i < 50; ++i) {
+        const Vec3f dir(unit(rng), unit(rng), unit(rng));
+        float best = -1e30f;
+        for (const Vec3f& p : points) {
+            best = std::max(best, p.dot(dir));
+        }
+        EXPECT_FLOAT_EQ(support(ConvexPointSet{points}, dir).dot(dir), best);
+    }
+}
+
+// ============================================================================
+// Distance Tests
+// ============================================================================
+
+TEST(GjkDistanceTest, SphereSphere) {
+    const Sphere a(Vec3f(0, 0, 0), 1.0f);
+    const Sphere b(Vec3f(5, 0, 0), 2.0f);
+    const GjkResult result = gjkDistance(a, b);
+
+    EXPECT_FALSE(result.intersecting);
+    EXPECT_NEAR(result.distance, 2.0f, kEps);
+    EXPECT_TRUE(result.normal.areSame(Vec3f(1, 0, 0), kEps));
+    EXPECT_TRUE(result.point_a.areSame(Vec3f(1, 0, 0), kEps));
+    EXPECT_TRUE(result.point_b.areSame(Vec3f(3, 0, 0), kEps));
+}
+
+TEST(GjkDistanceTest, AabbAabbEdgeToEdge) {
+    const Aabb a(Vec3f(0, 0, 0), Vec3f(1, 1, 1));
+    const Aabb b(Vec3f(2, 3, 0), Vec3f(3, 4, 1));
+    const GjkResult result = gjkDistance(a, b);
+
+    EXPECT_FALSE(result.intersecting);
+    EXPECT_NEAR(result.distance, std::sqrt(5.0f), kEps);
+    EXPECT_NEAR((result.point_b - result.point_a).length(), result.distance, kEps);
+}
+
+TEST(GjkDistanceTest, ObbToPointMatchesClosestPoint) {
+    const Obb obb(Vec3f(1, 2, 3), Vec3f(1, 0.5f, 2), Quatf::fromAxisAngle(Vec3f(1, 1, 0).normalized(), 0.7f));
+    std::mt19937 rng(0x61C0064u);
+    std::uniform_real_distribution<float> pos(-6.0f, 6.0f);
+
+    for (int i = 0; i < 40; ++i) {
+        const Vec3f point(pos(rng), pos(rng), pos(rng));
+        const GjkResult result = gjkDistance(obb, point);
+        if (obb.contains(point)) {
+            EXPECT_TRUE(result.intersecting);
+            continue;
+        }
+        EXPECT_NEAR(result.distance, obb.distanceToPoint(point), kEps) << i;
+        EXPECT_TRUE(result.point_a.areSame(obb.closestPoint(point), kEps)) << i;
+    }
+}
+
+TEST(GjkDistanceTest, CapsuleCapsuleParallel) {
+    const Capsule a(Vec3f(0, -1, 0), Vec3f(0, 1, 0), 0.25f);
+    const Capsule b(Vec3f(3, -5, 0), Vec3f(3, 0.5f, 0), 0.5f);
+    const GjkResult result = gjkDistance(a, b);
+
+    EXPECT_NEAR(result.distance, 2.25f, kEps);
+    EXPECT_NEAR(result.point_a.x(), 0.25f, kEps);
+    EXPECT_NEAR(result.point_b.x(), 2.5f, kEps);
+}
+
+TEST(GjkDistanceTest, PointSetMatchesAabb) {
+    const std::vector<Vec3f> corners = cubeCorners(Vec3f(0, 0, 0), 1.0f);
+    const Aabb box(Vec3f(-1, -1, -1), Vec3f(1, 1, 1));
+    const Sphere sphere(Vec3f(3, 2.5f, -0.5f), 0.75f);
+
+    const GjkResult from_set = gjkDistance(ConvexPointSet{corners}, sphere);
+    const GjkResult from_box = gjkDistance(box, sphere);
+    EXPECT_NEAR(from_set.distance, from_box.distance, kEps);
+    EXPECT_TRUE(from_set.point_a.areSame(from_box.point_a, kEps));
+}
+
+// ============================================================================
+// Overlap Tests
+// ============================================================================
+
+TEST(GjkIntersectsTest, AgreesWithPairwiseTests) {
+    std::mt19937 rng(0x61C0065u);
+    std::uniform_real_distribution<float> pos(-3.0f, 3.0f);
+    std::uniform_real_distribution<float> ext(0.2f, 1.5f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    for (int i = 0; i < 200; ++i) {
+        const Quatf qa = Quatf(unit(rng), unit(rng), unit(rng), unit(rng)).normalized();
+        const Quatf qb = Quatf(unit(rng), unit(rng), unit(rng), unit(rng)).normalized();
+        const Obb a(Vec3f(pos(rng), pos(rng), pos(rng)), Vec3f(ext(rng), ext(rng), ext(rng)), qa);
+        const Obb b(Vec3f(pos(rng), pos(rng), pos(rng)), Vec3f(ext(rng), ext(rng), ext(rng)), qb);
+        EXPECT_EQ(gjkIntersects(a, b), a.intersects(b)) << i;
+
+        const Sphere sa(Vec3f(pos(rng), pos(rng), pos(rng)), ext(rng));
+        const Sphere sb(Vec3f(pos(rng), pos(rng), pos(rng)), ext(rng));
+        EXPECT_EQ(gjkIntersects(sa, sb), sa.intersects(sb)) << i;
+
+        const Capsule ca(Vec3f(pos(rng), pos(rng), pos(rng)), Vec3f(pos(rng), pos(rng), pos(rng)), ext(rng));
+        const Capsule cb(Vec3f(pos(rng), pos(rng), pos(rng)), Vec3f(pos(rng), pos(rng), pos(rng)), ext(rng));
+        const float gap = sampledSegmentDistance(ca.segment(), cb.segment()) - ca.radius() - cb.radius();
+        if (std::abs(gap) > 1e-2f) {
+            EXPECT_EQ(gjkIntersects(ca, cb), gap < 0.0f) << i;
+        }
+    }
+}
+
+TEST(GjkIntersectsTest, PairsWithoutDedicatedTests) {
+    const Obb box(Vec3f(0, 0, 0), Vec3f(1, 1, 1), Quatf::fromAxisAngle(Vec3f::yAxis(), degToRad(45.0f)));
+
+    // Triangle slicing through the box, and one floating above it
+    EXPECT_TRUE(gjkIntersects(box, Triangle(Vec3f(-3, 0, -3), Vec3f(3, 0, -3), Vec3f(0, 0, 3))));
+    EXPECT_FALSE(gjkIntersects(box, Triangle(Vec3f(-3, 1.1f, -3), Vec3f(3, 1.1f, -3), Vec3f(0, 1.1f, 3))));
+
+    // The box corner reaches sqrt(2) along x
+    EXPECT_TRUE(gjkIntersects(box, Capsule(Vec3f(1.6f, -2, 0), Vec3f(1.6f, 2, 0), 0.25f)));
+    EXPECT_FALSE(gjkIntersects(box, Capsule(Vec3f(1.7f, -2, 0), Vec3f(1.7f, 2, 0), 0.25f)));
+}
+
+// ============================================================================
+// Penetration Tests
+// ============================================================================
+
+TEST(GjkPenetrationTest, SpheresUseMargins) {
+    const Sphere a(Vec3f(0, 0, 0), 1.0f);
+    const Sphere b(Vec3f(1.5f, 0, 0), 1.0f);
+    const PenetrationResult result = penetration(a, b);
+
+    ASSERT_TRUE(result.intersecting);
+    EXPECT_NEAR(result.depth, 0.5f, kEps);
+    EXPECT_TRUE(result.normal.areSame(Vec3f(1, 0, 0), kEps));
+    EXPECT_TRUE(result.point_a.areSame(Vec3f(1, 0, 0), kEps));
+    EXPECT_TRUE(result.point_b.areSame(Vec3f(0.5f, 0, 0), kEps));
+
+    EXPECT_FALSE(penetration(a, Sphere(Vec3f(3, 0, 0), 1.0f)).intersecting);
+}
+
+TEST(GjkPenetrationTest, AabbOverlapPicksShallowAxis) {
+    const Aabb a(Vec3f(0, 0, 0), Vec3f(2, 2, 2));
+    const Aabb b(Vec3f(1.75f, 0.5f, 0.5f), Vec3f(3, 1.5f, 1.5f));
+    const PenetrationResult result = penetration(a, b);
+
+    ASSERT_TRUE(result.intersecting);
+    EXPECT_NEAR(result.depth, 0.25f, kEps);
+    EXPECT_TRUE(result.normal.areSame(Vec3f(1, 0, 0), kEps));
+    EXPECT_NEAR(result.point_a.x(), 2.0f, kEps);
+    EXPECT_NEAR(result.point_b.x(), 1.75f, kEps);
+}
+
+TEST(GjkPenetrationTest, ConcentricObbs) {
+    const Obb a(Vec3f(1, 1, 1), Vec3f(2, 3, 4));
+    const Obb b(Vec3f(1, 1, 1), Vec3f(1, 1, 0.5f), Quatf::fromAxisAngle(Vec3f::zAxis(), degToRad(90.0f)));
+    const PenetrationResult result = penetration(a, b);
+
+    // B spans (1, 1, 0.5) in world space; the cheapest escape is along x: 2 + 1
+    ASSERT_TRUE(result.intersecting);
+    EXPECT_NEAR(result.depth, 3.0f, kEps);
+    EXPECT_NEAR(std::abs(result.normal.x()), 1.0f, kEps);
+}
+
+TEST(GjkPenetrationTest, SphereCenterInsideBox) {
+    const Aabb box(Vec3f(-1, -1, -1), Vec3f(1, 1, 1));
+    const Sphere sphere(Vec3f(0, 0.8f, 0), 0.5f);
+    const PenetrationResult result = penetration(box, sphere);
+
+    ASSERT_TRUE(result.intersecting);
+    EXPECT_NEAR(result.depth, 0.7f, 2e-2f);
+    EXPECT_TRUE(result.normal.areSame(Vec3f(0, 1, 0), 2e-2f));
+}
+
+TEST(GjkPenetrationTest, ResolvingSeparatesShapes) {
+    std::mt19937 rng(0x61C0066u);
+    std::uniform_real_distribution<float> pos(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> ext(0.5f, 1.5f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    for (int i = 0; i < 50; ++i) {
+        const Obb a(Vec3f(0, 0, 0),
+                    Vec3f(ext(rng), ext(rng), ext(rng)),
+                    Quatf(unit(rng), unit(rng), unit(rng), unit(rng)).normalized());
+        Capsule b(Vec3f(pos(rng), pos(rng), pos(rng)), Vec3f(pos(rng), pos(rng), pos(rng)), ext(rng) * 0.5f);
+        const PenetrationResult result = penetration(a, b);
+        ASSERT_TRUE(result.intersecting) << i;
+
+        // Moving B out by slightly more than the depth separates; slightly less does not
+        b.translate(result.normal * (result.depth + 2e-2f));
+        EXPECT_FALSE(gjkIntersects(a, b)) << i;
+        b.translate(result.normal * -4e-2f);
+        EXPECT_TRUE(gjkIntersects(a, b)) << i;
+    }
+}
+
+// ============================================================================
+// Warm Start Tests
+// ============================================================================
+
+TEST(GjkCacheTest, WarmStartMatchesColdStartInFewerIterations) {
+    const Obb a(Vec3f(0, 0, 0), Vec3f(1, 1, 1), Quatf::fromAxisAngle(Vec3f(1, 2, 3).normalized(), 0.4f));
+    GjkCache cache;
+    uint32_t cold_iterations = 0;
+    uint32_t warm_iterations = 0;
+
+    for (int frame = 0; frame < 60; ++frame) {
+        const float t = static_cast<float>(frame) * 0.01f;
+        const Obb b(Vec3f(3.0f - t, 0.5f + t, 0.25f), Vec3f(0.5f, 0.75f, 1.0f), Quatf::fromAxisAngle(Vec3f::yAxis(), t));
+
+        const GjkResult cold = gjkDistance(a, b);
+        const GjkResult warm = gjkDistance(a, b, &cache);
+        EXPECT_EQ(cold.intersecting, warm.intersecting) << frame;
+        EXPECT_NEAR(cold.distance, warm.distance, kEps) << frame;
+        if (frame > 0) {
+            cold_iterations += cold.iterations;
+            warm_iterations += warm.iterations;
+        }
+    }
+    EXPECT_LT(warm_iterations, cold_iterations);
+
+    cache.reset();
+    EXPECT_EQ(cache.count, 0u);
+}
+
+}  // namespace vne::math
@@ -7,6 +7,10 @@
 #include <gtest/gtest.h>
 #include <vertexnova/math/geometry/intersection.h>
 
+#include <cmath>
+#include <random>
+#include <vector>
+
 using namespace vne::math;
 
 // ============================================================================
@@ -123,6 +127,121 @@ TEST(RayAabbTest, EdgeHit) {
     EXPECT_NEAR(hit.normal.x(), 1.0f, 1e-5f);  // +X face
 }
 
+// ============================================================================
+// Precomputed Ray Tests
+// ============================================================================
+
+TEST(PrecomputedRayTest, CachesReciprocalAndSigns) {
+    Ray ray(Vec3f(1.0f, 2.0f, 3.0f), Vec3f(1.0f, -2.0f, 0.0f));
+    PrecomputedRay pre(ray);
+
+    EXPECT_EQ(pre.origin, ray.origin());
+    EXPECT_FLOAT_EQ(pre.inv_direction.x(), 1.0f / ray.direction().x());
+    EXPECT_FLOAT_EQ(pre.inv_direction.y(), 1.0f / ray.direction().y());
+    EXPECT_TRUE(std::isinf(pre.inv_direction.z()));
+    EXPECT_EQ(pre.sign[0], 0u);
+    EXPECT_EQ(pre.sign[1], 1u);
+    EXPECT_EQ(pre.sign[2], 0u);
+
+    // Negative zero selects the max plane as the near one
+    PrecomputedRay negative_zero(Ray(Vec3f::zero(), Vec3f(-0.0f, 0.0f, 1.0f)));
+    EXPECT_EQ(negative_zero.sign[0], 1u);
+}
+
+TEST(PrecomputedRayTest, OriginOnSlabPlaneOfZeroComponent) {
+    // 0 * inf produces a NaN slab distance; the ray lies in the face plane and must still hit
+    Aabb aabb(Vec3f(-1.0f, -1.0f, -1.0f), Vec3f(1.0f, 1.0f, 1.0f));
+
+    for (float x : {-1.0f, 1.0f}) {
+        for (float dx : {0.0f, -0.0f}) {
+            PrecomputedRay ray(Ray(Vec3f(x, 0.0f, 10.0f), Vec3f(dx, 0.0f, -1.0f)));
+            EXPECT_TRUE(intersects(ray, aabb)) << x;
+            RayHit hit = intersect(ray, aabb);
+            ASSERT_TRUE(hit.valid()) << x;
+            EXPECT_FLOAT_EQ(hit.distance, 9.0f);
+            EXPECT_EQ(hit.normal, Vec3f(0.0f, 0.0f, 1.0f));
+        }
+    }
+
+    // Along an edge: two NaN slabs
+    EXPECT_TRUE(intersects(PrecomputedRay(Ray(Vec3f(1.0f, 1.0f, 10.0f), Vec3f(0.0f, 0.0f, -1.0f))), aabb));
+
+    // Just outside the slab with a zero component never hits
+    EXPECT_FALSE(intersects(PrecomputedRay(Ray(Vec3f(1.001f, 0.0f, 10.0f), Vec3f(0.0f, 0.0f, -1.0f))), aabb));
+    EXPECT_FALSE(intersect(Ray(Vec3f(1.001f, 0.0f, 10.0f), Vec3f(0.0f, 0.0f, -1.0f)), aabb).valid());
+}
+
+TEST(PrecomputedRayTest, GrazingCornerHits) {
+    Aabb aabb(Vec3f(-1.0f, -1.0f, -1.0f), Vec3f(1.0f, 1.0f, 1.0f));
+
+    // Touches only the (1, 1, 1) corner
+    PrecomputedRay ray(Ray(Vec3f(2.0f, 0.0f, 1.0f), Vec3f(-1.0f, 1.0f, 0.0f)));
+    EXPECT_TRUE(intersects(ray, aabb));
+    RayHit hit = intersect(ray, aabb);
+    ASSERT_TRUE(hit.valid());
+    EXPECT_NEAR(hit.distance, std::sqrt(2.0f), 1e-5f);
+}
+
+TEST(PrecomputedRayTest, NormalsAndRanges) {
+    Aabb aabb(Vec3f(-1.0f, -2.0f, -3.0f), Vec3f(1.0f, 2.0f, 3.0f));
+
+    // From inside the normal is the exit face
+    RayHit exit = intersect(PrecomputedRay(Ray(Vec3f::zero(), Vec3f(0.0f, -1.0f, 0.0f))), aabb);
+    ASSERT_TRUE(exit.valid());
+    EXPECT_NEAR(exit.distance, 2.0f, 1e-5f);
+    EXPECT_EQ(exit.normal, Vec3f(0.0f, -1.0f, 0.0f));
+
+    // Entering diagonally through the x face
+    RayHit enter = intersect(PrecomputedRay(Ray(Vec3f(-5.0f, -4.0f, 0.0f), Vec3f(1.0f, 1.0f, 0.0f))), aabb);
+    ASSERT_TRUE(enter.valid());
+    EXPECT_NEAR(enter.point.x(), -1.0f, 1e-5f);
+    EXPECT_EQ(enter.normal, Vec3f(-1.0f, 0.0f, 0.0f));
+
+    // Behind the ray and beyond max_distance
+    PrecomputedRay away(Ray(Vec3f(0.0f, 0.0f, 10.0f), Vec3f(0.0f, 0.0f, 1.0f)));
+    EXPECT_FALSE(intersects(away, aabb));
+    EXPECT_FALSE(intersect(away, aabb).valid());
+    PrecomputedRay toward(Ray(Vec3f(0.0f, 0.0f, 10.0f), Vec3f(0.0f, 0.0f, -1.0f)));
+    EXPECT_FALSE(intersects(toward, aabb, 6.0f));
+    EXPECT_TRUE(intersects(toward, aabb, 7.0f));
+}
+
+TEST(PrecomputedRayTest, MatchesDoublePrecisionReference) {
+    std::mt19937 rng(0x5EED0066u);
+    std::uniform_real_distribution<float> pos(-5.0f, 5.0f);
+    std::uniform_real_distribution<float> size(0.1f, 3.0f);
+
+    int hits = 0;
+    for (int i = 0; i < 2000; ++i) {
+        const Vec3f min(pos(rng), pos(rng), pos(rng));
+        const Aabb aabb(min, min + Vec3f(size(rng), size(rng), size(rng)));
+        const Vec3f origin = Vec3f(pos(rng), pos(rng), pos(rng)) * 2.0f;
+        const Ray ray(origin, aabb.center() + Vec3f(pos(rng), pos(rng), pos(rng)) * 0.5f - origin);  // Roughly aimed
+
+        double enter = 0.0;
+        double exit = 1e30;
+        for (int k = 0; k < 3; ++k) {
+            const double t0 = (double(aabb.min()[k]) - ray.origin()[k]) / ray.direction()[k];
+            const double t1 = (double(aabb.max()[k]) - ray.origin()[k]) / ray.direction()[k];
+            enter = std::max(enter, std::min(t0, t1));
+            exit = std::min(exit, std::max(t0, t1));
+        }
+        if (std::abs(exit - enter) < 1e-4) {
+            continue;  // Grazing: either answer is acceptable
+        }
+        const bool expected = enter <= exit;
+        const PrecomputedRay pre(ray);
+        EXPECT_EQ(intersects(pre, aabb), expected) << i;
+        const RayHit hit = intersect(pre, aabb);
+        ASSERT_EQ(hit.valid(), expected) << i;
+        if (expected) {
+            ++hits;
+            EXPECT_NEAR(hit.distance, enter > 0.0 ? enter : exit, 1e-3) << i;
+        }
+    }
+    EXPECT_GT(hits, 200);
+}
+
 // ============================================================================
 // Ray-Triangle Intersection Tests
 // ============================================================================
@@ -182,6 +301,105 @@ TEST(RayTriangleTest, BarycentricCoords) {
     EXPECT_NEAR(u + v + w, 1.0f, 1e-5f);
 }
 
+// ============================================================================
+// Watertight Ray-Triangle Tests
+// ============================================================================
+
+TEST(WatertightTriangleTest, MatchesMollerTrumbore) {
+    std::mt19937 rng(0x5EED0068u);
+    std::uniform_real_distribution<float> pos(-5.0f, 5.0f);
+    std::uniform_real_distribution<float> bary(0.05f, 0.9f);
+
+    for (int i = 0; i < 500; ++i) {
+        const Triangle tri(Vec3f(pos(rng), pos(rng), pos(rng)),
+                           Vec3f(pos(rng), pos(rng), pos(rng)),
+                           Vec3f(pos(rng), pos(rng), pos(rng)));
+        const float u = bary(rng);
+        const float v = bary(rng) * (1.0f - u);
+        const Vec3f target = tri.v0 * (1.0f - u - v) + tri.v1 * u + tri.v2 * v;
+        const Vec3f origin = Vec3f(pos(rng), pos(rng), pos(rng)) * 3.0f;
+        const Ray ray(origin, target - origin);
+
+        const RayHit fast = intersect(ray, tri);
+        const RayHit exact = intersect(ray, tri, std::numeric_limits<float>::max(), false, TriangleIntersectMode::eWatertight);
+        ASSERT_TRUE(exact.valid()) << i;
+        ASSERT_TRUE(fast.valid()) << i;
+        EXPECT_NEAR(exact.distance, (target - origin).length(), 1e-3f * exact.distance) << i;
+        EXPECT_NEAR(exact.uv.x(), u, 1e-3f) << i;
+        EXPECT_NEAR(exact.uv.y(), v, 1e-3f) << i;
+        EXPECT_TRUE(exact.normal.areSame(fast.normal, 1e-5f)) << i;
+    }
+}
+
+TEST(WatertightTriangleTest, SharedEdgesNeverLeak) {
+    // Jittered grid; rays aimed at points on interior edges and vertices must hit some triangle
+    std::mt19937 rng(0x5EED0069u);
+    std::uniform_real_distribution<float> jitter(-0.3f, 0.3f);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::uniform_real_distribution<float> dir(-1.0f, 1.0f);
+
+    constexpr int kSide = 6;
+    std::vector<Vec3f> grid;
+    for (int z = 0; z <= kSide; ++z) {
+        for (int x = 0; x <= kSide; ++x) {
+            grid.push_back(Vec3f(float(x) + jitter(rng), jitter(rng), float(z) + jitter(rng)) * 1.37f);
+        }
+    }
+    std::vector<Triangle> triangles;
+    for (int z = 0; z < kSide; ++z) {
+        for (int x = 0; x < kSide; ++x) {
+            const int i = z * (kSide + 1) + x;
+            triangles.emplace_back(grid[i], grid[i + kSide + 1], grid[i + 1]);
+            triangles.emplace_back(grid[i + 1], grid[i + kSide + 1], grid[i + kSide + 2]);
+        }
+    }
+
+    int leaks = 0;
+    for (int r = 0; r < 5000; ++r) {
+        // Interior cell, then a point on its diagonal or on one of its vertices
+        const int i = (1 + r % (kSide - 2)) * (kSide + 1) + 1 + (r / 7) % (kSide - 2);
+        const Vec3f& a = grid[i + 1];
+        const Vec3f& b = grid[i + kSide + 1];
+        const Vec3f target = r % 10 == 0 ? a : a + (b - a) * unit(rng);
+        const Vec3f origin = target + Vec3f(dir(rng), 3.0f + dir(rng), dir(rng)) * 4.0f;
+        const PrecomputedRay ray(Ray(origin, target - origin));
+
+        bool hit = false;
+        for (const Triangle& tri : triangles) {
+            hit = hit || intersect(ray, tri).valid();
+        }
+        leaks += hit ? 0 : 1;
+    }
+    EXPECT_EQ(leaks, 0);
+}
+
+TEST(WatertightTriangleTest, BackfacesAndRanges) {
+    Triangle tri(Vec3f(0.0f, 0.0f, 0.0f), Vec3f(1.0f, 0.0f, 0.0f), Vec3f(0.0f, 1.0f, 0.0f));
+
+    PrecomputedRay front(Ray(Vec3f(0.2f, 0.3f, 1.0f), Vec3f(0.0f, 0.0f, -1.0f)));
+    RayHit hit = intersect(front, tri);
+    ASSERT_TRUE(hit.valid());
+    EXPECT_FLOAT_EQ(hit.distance, 1.0f);
+    EXPECT_NEAR(hit.uv.x(), 0.2f, 1e-6f);
+    EXPECT_NEAR(hit.uv.y(), 0.3f, 1e-6f);
+    EXPECT_EQ(hit.normal, Vec3f(0.0f, 0.0f, 1.0f));
+    EXPECT_TRUE(intersect(front, tri, 1.0f).valid());
+    EXPECT_FALSE(intersect(front, tri, 0.99f).valid());
+
+    PrecomputedRay back(Ray(Vec3f(0.2f, 0.3f, -1.0f), Vec3f(0.0f, 0.0f, 1.0f)));
+    RayHit back_hit = intersect(back, tri);
+    ASSERT_TRUE(back_hit.valid());
+    EXPECT_EQ(back_hit.normal, Vec3f(0.0f, 0.0f, -1.0f));
+    EXPECT_FALSE(intersect(back, tri, std::numeric_limits<float>::max(), true).valid());
+    EXPECT_TRUE(intersect(front, tri, std::numeric_limits<float>::max(), true).valid());
+
+    // Behind the origin
+    EXPECT_FALSE(intersect(PrecomputedRay(Ray(Vec3f(0.2f, 0.3f, 1.0f), Vec3f(0.0f, 0.0f, 1.0f))), tri).valid());
+    // Exactly through a vertex and along an edge
+    EXPECT_TRUE(intersect(PrecomputedRay(Ray(Vec3f(1.0f, 0.0f, 1.0f), Vec3f(0.0f, 0.0f, -1.0f))), tri).valid());
+    EXPECT_TRUE(intersect(PrecomputedRay(Ray(Vec3f(0.5f, 0.5f, 1.0f), Vec3f(0.0f, 0.0f, -1.0f))), tri).valid());
+}
+
 // ============================================================================
 // Fast Intersection Tests
 // ============================================================================
@@ -252,3 +470,139 @@ TEST(DistanceTest, PointToTriangle) {
     // Above triangle center
     EXPECT_NEAR(distance(Vec3f(0.25f, 0.25f, 1.0f), tri), 1.0f, 0.1f);
 }
+
+// ============================================================================
+// Batch Ray Casting Tests
+// ============================================================================
+
+TEST(BatchRayAabbTest, MatchesScalar) {
+    // Integer boxes and axis-aligned rays from integer origins exercise the NaN slab cases
+    std::mt19937 rng(0x5EED0067u);
+    std::uniform_int_distribution<int> cell(-4, 4);
+    std::uniform_int_distribution<int> extent(1, 3);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    std::vector<Aabb> boxes;
+    for (int i = 0; i < 103; ++i) {  // Not a multiple of the SIMD width
+        const Vec3f min(float(cell(rng)), float(cell(rng)), float(cell(rng)));
+        boxes.emplace_back(min, min + Vec3f(float(extent(rng)), float(extent(rng)), float(extent(rng))));
+    }
+
+    const Vec3f axes[] = {Vec3f(1, 0, 0), Vec3f(0, -1, 0), Vec3f(0, 0, 1), Vec3f(-0.0f, 0, -1)};
+    std::vector<float> distances(boxes.size());
+    for (int r = 0; r < 40; ++r) {
+        const Vec3f origin(float(cell(rng)), float(cell(rng)), float(cell(rng)));
+        const Vec3f direction = r % 2 == 0 ? axes[(r / 2) % 4] : Vec3f(unit(rng), unit(rng), unit(rng));
+        const PrecomputedRay ray(Ray(origin, direction));
+        const float max_distance = r % 5 == 0 ? 3.0f : std::numeric_limits<float>::max();
+
+        const size_t count = intersect(ray, boxes, distances, max_distance);
+
+        size_t expected_count = 0;
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            const bool hit = intersects(ray, boxes[i], max_distance);
+            ASSERT_EQ(distances[i] >= 0.0f, hit) << r << " " << i;
+            if (!hit) {
+                EXPECT_EQ(distances[i], -1.0f);
+                continue;
+            }
+            ++expected_count;
+            const float expected = boxes[i].contains(origin) ? 0.0f : intersect(ray, boxes[i]).distance;
+            EXPECT_EQ(distances[i], expected) << r << " " << i;
+        }
+        EXPECT_EQ(count, expected_count);
+    }
+}
+
+TEST(BatchRayTriangleTest, PacksWithNaNPadding) {
+    const std::vector<Triangle> triangles{Triangle(Vec3f(0, 0, 0), Vec3f(1, 0, 0), Vec3f(0, 1, 0)),
+                                          Triangle(Vec3f(1, 2, 3), Vec3f(4, 5, 6), Vec3f(7, 8, 9)),
+                                          Triangle(Vec3f(-1, 0, 0), Vec3f(0, -1, 0), Vec3f(0, 0, -1)),
+                                          Triangle(Vec3f(2, 2, 2), Vec3f(3, 2, 2), Vec3f(2, 3, 2)),
+                                          Triangle(Vec3f(5, 0, 0), Vec3f(6, 0, 0), Vec3f(5, 1, 0))};
+    std::vector<TrianglePacket> packets(2);
+    EXPECT_EQ(packTriangles(triangles, packets), 2u);
+    for (size_t i = 0; i < triangles.size(); ++i) {
+        const Triangle tri = packets[i / 4].triangle(i % 4);
+        EXPECT_EQ(tri.v0, triangles[i].v0);
+        EXPECT_EQ(tri.v1, triangles[i].v1);
+        EXPECT_EQ(tri.v2, triangles[i].v2);
+    }
+    EXPECT_TRUE(std::isnan(packets[1].v[0][0][1]));
+    EXPECT_TRUE(std::isnan(packets[1].v[2][2][3]));
+
+    // Indexed mesh packs the same triangles
+    std::vector<Vec3f> vertices;
+    std::vector<uint32_t> indices;
+    for (const Triangle& tri : triangles) {
+        for (const Vec3f& v : {tri.v0, tri.v1, tri.v2}) {
+            indices.push_back(static_cast<uint32_t>(vertices.size()));
+            vertices.push_back(v);
+        }
+    }
+    std::vector<TrianglePacket> indexed(2);
+    EXPECT_EQ(packTriangles(vertices, indices, indexed), 2u);
+    for (size_t i = 0; i < triangles.size(); ++i) {
+        EXPECT_EQ(indexed[i / 4].triangle(i % 4).v1, triangles[i].v1);
+    }
+}
+
+TEST(BatchRayTriangleTest, ClosestHitMatchesScalar) {
+    // Integer triangles and axis-aligned rays from integer points hit edges and vertices exactly
+    std::mt19937 rng(0x5EED006Au);
+    std::uniform_int_distribution<int> cell(-3, 3);
+    std::uniform_real_distribution<float> pos(-3.0f, 3.0f);
+
+    std::vector<Triangle> triangles;
+    for (int i = 0; i < 37; ++i) {  // Not a multiple of the packet width
+        if (i % 2 == 0) {
+            const Vec3f base(float(cell(rng)), float(cell(rng)), float(cell(rng)));
+            triangles.emplace_back(base, base + Vec3f(2, 0, 0), base + Vec3f(0, 2, float(i % 3)));
+        } else {
+            triangles.emplace_back(Vec3f(pos(rng), pos(rng), pos(rng)),
+                                   Vec3f(pos(rng), pos(rng), pos(rng)),
+                                   Vec3f(pos(rng), pos(rng), pos(rng)));
+        }
+    }
+    std::vector<TrianglePacket> packets((triangles.size() + 3) / 4);
+    ASSERT_EQ(packTriangles(triangles, packets), packets.size());
+
+    const Vec3f axes[] = {Vec3f(0, 0, -1), Vec3f(0, 1, 0), Vec3f(-1, 0, 0)};
+    int hits = 0;
+    for (int r = 0; r < 300; ++r) {
+        const Vec3f origin = r % 2 == 0 ? Vec3f(float(cell(rng)), float(cell(rng)), 6.0f)
+                                        : Vec3f(pos(rng), pos(rng), pos(rng)) * 3.0f;
+        const Vec3f direction = r % 2 == 0 ? axes[(r / 2) % 3] : Vec3f(pos(rng), pos(rng), pos(rng)) - origin;
+        const PrecomputedRay ray(Ray(origin, direction));
+        const bool cull = r % 3 == 0;
+        const float max_distance = r % 5 == 0 ? 4.0f : std::numeric_limits<float>::max();
+
+        RayHit expected = RayHit::none();
+        uint32_t expected_index = 0;
+        for (size_t i = 0; i < triangles.size(); ++i) {
+            const RayHit hit = intersect(ray, triangles[i], max_distance, cull);
+            if (hit && (!expected || hit.distance < expected.distance)) {
+                expected = hit;
+                expected_index = static_cast<uint32_t>(i);
+            }
+        }
+
+        uint32_t index = 0;
+        const RayHit hit = intersect(ray, packets, index, max_distance, cull);
+        ASSERT_EQ(hit.valid(), expected.valid()) << r;
+        if (!expected) {
+            continue;
+        }
+        ++hits;
+        EXPECT_EQ(index, expected_index) << r;
+        EXPECT_NEAR(hit.distance, expected.distance, 1e-5f) << r;
+        EXPECT_NEAR(hit.uv.x(), expected.uv.x(), 1e-5f) << r;
+        EXPECT_NEAR(hit.uv.y(), expected.uv.y(), 1e-5f) << r;
+        EXPECT_EQ(hit.normal, expected.normal) << r;
+    }
+    EXPECT_GT(hits, 60);
+
+    uint32_t index = 0;
+    EXPECT_FALSE(intersect(PrecomputedRay(Ray(Vec3f(0, 0, 0), Vec3f(0, 0, 1))), std::span<const TrianglePacket>(), index)
+                     .valid());
+}
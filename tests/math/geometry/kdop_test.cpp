@@ -0,0 +1,100 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/math/geometry/kdop.h"
+
+#include <sstream>
+
+namespace vne::math {
+
+TEST(KdopTest, AxisCounts) {
+    EXPECT_EQ(Kdop::axisCount(DopType::eDop14), 7u);
+    EXPECT_EQ(Kdop::axisCount(DopType::eDop18), 9u);
+    EXPECT_EQ(Kdop::axisCount(DopType::eDop26), 13u);
+}
+
+TEST(KdopTest, CoordinateAxesComeFirst) {
+    for (const DopType type : {DopType::eDop14, DopType::eDop18, DopType::eDop26}) {
+        EXPECT_EQ(Kdop::axis(type, 0), Vec3f(1, 0, 0));
+        EXPECT_EQ(Kdop::axis(type, 1), Vec3f(0, 1, 0));
+        EXPECT_EQ(Kdop::axis(type, 2), Vec3f(0, 0, 1));
+    }
+    // 14-DOP adds cube diagonals, 18-DOP edge diagonals
+    EXPECT_EQ(Kdop::axis(DopType::eDop14, 3), Vec3f(1, 1, 1));
+    EXPECT_EQ(Kdop::axis(DopType::eDop18, 3), Vec3f(1, 1, 0));
+    EXPECT_EQ(Kdop::axis(DopType::eDop26, 12), Vec3f(0, 1, -1));
+}
+
+TEST(KdopTest, DefaultIsEmpty) {
+    Kdop dop(DopType::eDop14);
+    EXPECT_FALSE(dop.isValid());
+    dop.expand(Vec3f(1, 2, 3));
+    EXPECT_TRUE(dop.isValid());
+    EXPECT_TRUE(dop.contains(Vec3f(1, 2, 3)));
+    dop.reset();
+    EXPECT_FALSE(dop.isValid());
+}
+
+TEST(KdopTest, CutsCornersOffTheAabb) {
+    Kdop dop(DopType::eDop26);
+    // Octahedron vertices
+    for (const Vec3f& p : {Vec3f(1, 0, 0), Vec3f(-1, 0, 0), Vec3f(0, 1, 0), Vec3f(0, -1, 0), Vec3f(0, 0, 1),
+                           Vec3f(0, 0, -1)}) {
+        dop.expand(p);
+    }
+    EXPECT_EQ(dop.getAabb(), Aabb(Vec3f(-1, -1, -1), Vec3f(1, 1, 1)));
+    EXPECT_TRUE(dop.getAabb().contains(Vec3f(0.9f, 0.9f, 0.9f)));
+    EXPECT_FALSE(dop.contains(Vec3f(0.9f, 0.9f, 0.9f)));
+    EXPECT_TRUE(dop.contains(Vec3f(0.3f, 0.3f, 0.3f)));
+}
+
+TEST(KdopTest, Intersects) {
+    // Wedge under the x + y = 1 plane, one unit thick
+    Kdop a(DopType::eDop18);
+    for (const Vec3f& p : {Vec3f(0, 0, 0), Vec3f(1, 0, 0), Vec3f(0, 1, 0), Vec3f(0, 0, 1)}) {
+        a.expand(p);
+    }
+
+    // The AABBs overlap near (1, 1) but the (1, 1, 0) slab separates them
+    Kdop b(DopType::eDop18);
+    for (const Vec3f& p : {Vec3f(1, 1, 0), Vec3f(0.8f, 1, 0), Vec3f(1, 0.8f, 0), Vec3f(1, 1, 1)}) {
+        b.expand(p);
+    }
+    EXPECT_TRUE(a.getAabb().intersects(b.getAabb()));
+    EXPECT_FALSE(a.intersects(b));
+
+    b.expand(Vec3f(0.4f, 0.4f, 0));
+    EXPECT_TRUE(a.intersects(b));
+}
+
+TEST(KdopTest, ExpandByKdop) {
+    Kdop a(DopType::eDop14);
+    a.expand(Vec3f(-1, 0, 0));
+    Kdop b(DopType::eDop14);
+    b.expand(Vec3f(2, 3, 0));
+    a.expand(b);
+    EXPECT_TRUE(a.contains(Vec3f(-1, 0, 0)));
+    EXPECT_TRUE(a.contains(Vec3f(2, 3, 0)));
+    EXPECT_FLOAT_EQ(a.min(0), -1.0f);
+    EXPECT_FLOAT_EQ(a.max(3), 5.0f);
+}
+
+TEST(KdopTest, StreamOutput) {
+    Kdop dop(DopType::eDop14);
+    dop.expand(Vec3f(0, 0, 0));
+    std::ostringstream os;
+    os << dop;
+    EXPECT_EQ(os.str().rfind("Kdop14: [(0, 0)", 0), 0u);
+}
+
+}  // namespace vne::math
@@ -94,6 +94,28 @@ TEST(LineSegmentTest, Distance) {
     EXPECT_NEAR(seg.distanceToPoint(Vec3f(-3.0f, 4.0f, 0.0f)), 5.0f, 1e-5f);
 }
 
+TEST(LineSegmentTest, ClosestPointsBetweenSegments) {
+    LineSegment seg(Vec3f(0.0f, 0.0f, 0.0f), Vec3f(10.0f, 0.0f, 0.0f));
+    Vec3f p;
+    Vec3f q;
+
+    // Crossing above the middle
+    EXPECT_NEAR(seg.closestPoints(LineSegment(Vec3f(4.0f, -1.0f, 2.0f), Vec3f(4.0f, 1.0f, 2.0f)), p, q), 4.0f, 1e-5f);
+    EXPECT_TRUE(p.areSame(Vec3f(4.0f, 0.0f, 0.0f)));
+    EXPECT_TRUE(q.areSame(Vec3f(4.0f, 0.0f, 2.0f)));
+
+    // Lines meet beyond the end of seg: the closest point is seg.end, not the clamped line solution
+    EXPECT_NEAR(seg.closestPoints(LineSegment(Vec3f(10.5f, -1.0f, 0.0f), Vec3f(12.5f, 1.0f, 0.0f)), p, q), 1.125f, 1e-4f);
+    EXPECT_EQ(p, seg.end);
+    EXPECT_TRUE(q.areSame(Vec3f(10.75f, -0.75f, 0.0f), 1e-5f));
+
+    // Parallel and overlapping
+    EXPECT_NEAR(seg.squaredDistanceToSegment(LineSegment(Vec3f(2.0f, 3.0f, 0.0f), Vec3f(20.0f, 3.0f, 0.0f))), 9.0f, 1e-5f);
+
+    // Degenerate segment acts as a point
+    EXPECT_NEAR(seg.squaredDistanceToSegment(LineSegment(Vec3f(-3.0f, 4.0f, 0.0f), Vec3f(-3.0f, 4.0f, 0.0f))), 25.0f, 1e-4f);
+}
+
 TEST(LineSegmentTest, Degenerate) {
     LineSegment seg(Vec3f(1.0f, 2.0f, 3.0f), Vec3f(1.0f, 2.0f, 3.0f));
 
@@ -14,8 +14,63 @@
 #include "vertexnova/math/geometry/aabb.h"
 #include "vertexnova/math/geometry/obb.h"
 
+#include <random>
+#include <vector>
+
 namespace vne::math {
 
+namespace {
+
+/// Reference SAT over explicit, normalized world-space axes
+bool referenceIntersects(const Obb& a, const Obb& b) {
+    const Vec3f axes_a[3] = {a.axisX(), a.axisY(), a.axisZ()};
+    const Vec3f axes_b[3] = {b.axisX(), b.axisY(), b.axisZ()};
+    const Vec3f t = b.center() - a.center();
+
+    auto overlapsOn = [&](const Vec3f& axis) {
+        if (axis.lengthSquared() < 1e-6f) {
+            return true;
+        }
+        const Vec3f n = axis.normalized();
+        float ra = 0.0f;
+        float rb = 0.0f;
+        for (int i = 0; i < 3; ++i) {
+            ra += std::abs(axes_a[i].dot(n)) * a.halfExtents()[i];
+            rb += std::abs(axes_b[i].dot(n)) * b.halfExtents()[i];
+        }
+        return std::abs(t.dot(n)) <= ra + rb;
+    };
+
+    for (int i = 0; i < 3; ++i) {
+        if (!overlapsOn(axes_a[i]) || !overlapsOn(axes_b[i])) {
+            return false;
+        }
+        for (int j = 0; j < 3; ++j) {
+            if (!overlapsOn(axes_a[i].cross(axes_b[j]))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+std::vector<Obb> makeRandomObbs(std::size_t count, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> pos(-4.0f, 4.0f);
+    std::uniform_real_distribution<float> ext(0.1f, 2.0f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    std::vector<Obb> boxes;
+    boxes.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const Quatf q = Quatf(unit(rng), unit(rng), unit(rng), unit(rng)).normalized();
+        boxes.emplace_back(Vec3f(pos(rng), pos(rng), pos(rng)), Vec3f(ext(rng), ext(rng), ext(rng)), q);
+    }
+    return boxes;
+}
+
+}  // namespace
+
 class ObbTest : public ::testing::Test {
    protected:
     void SetUp() override {
@@ -191,6 +246,74 @@ TEST_F(ObbTest, IntersectsAabb) {
     EXPECT_FALSE(obb.intersects(aabb_far));
 }
 
+TEST_F(ObbTest, IntersectsObbSeparatedByEdgeAxis) {
+    // Two cubes turned edge-on: A's top edge runs along x, B's bottom edge along y.
+    // Every face axis overlaps; only X x Y (world z) separates them.
+    Obb a(Vec3f::zero(), Vec3f(1, 1, 1), Quatf::fromAxisAngle(Vec3f::xAxis(), degToRad(45.0f)));
+    Obb b(Vec3f(0.0f, 0.0f, 3.0f), Vec3f(1, 1, 1), Quatf::fromAxisAngle(Vec3f::yAxis(), degToRad(45.0f)));
+    EXPECT_FALSE(a.intersects(b));
+    EXPECT_FALSE(b.intersects(a));
+    EXPECT_FALSE(referenceIntersects(a, b));
+
+    b.setCenter(Vec3f(0.0f, 0.0f, 2.5f));
+    EXPECT_TRUE(a.intersects(b));
+    EXPECT_TRUE(b.intersects(a));
+}
+
+TEST_F(ObbTest, IntersectsObbMatchesReference) {
+    const std::vector<Obb> boxes = makeRandomObbs(200, 0x0BB0061u);
+    for (std::size_t i = 0; i + 1 < boxes.size(); i += 2) {
+        EXPECT_EQ(boxes[i].intersects(boxes[i + 1]), referenceIntersects(boxes[i], boxes[i + 1])) << i;
+    }
+}
+
+TEST_F(ObbTest, IntersectsAabbMatchesObbPath) {
+    const std::vector<Obb> boxes = makeRandomObbs(200, 0x0BB0062u);
+    for (std::size_t i = 0; i + 1 < boxes.size(); i += 2) {
+        const Aabb aabb = boxes[i + 1].getAabb();
+        EXPECT_EQ(boxes[i].intersects(aabb), boxes[i].intersects(Obb::fromAabb(aabb))) << i;
+    }
+}
+
+TEST_F(ObbTest, BatchIntersectsMatchesScalar) {
+    const std::vector<Obb> candidates = makeRandomObbs(103, 0x0BB0063u);  // Not a multiple of the SIMD width
+    const Obb query(Vec3f(0.5f, -0.25f, 1.0f),
+                    Vec3f(2.0f, 1.0f, 3.0f),
+                    Quatf::fromAxisAngle(Vec3f(1, 2, 3).normalized(), degToRad(30.0f)));
+
+    std::vector<uint8_t> hits(candidates.size(), 7);
+    const size_t hit_count = intersects(query, candidates, hits);
+
+    size_t expected = 0;
+    for (std::size_t i = 0; i < candidates.size(); ++i) {
+        const bool scalar = query.intersects(candidates[i]);
+        expected += scalar ? 1 : 0;
+        EXPECT_EQ(hits[i], scalar ? 1 : 0) << i;
+    }
+    EXPECT_EQ(hit_count, expected);
+    EXPECT_GT(hit_count, 0u);
+    EXPECT_LT(hit_count, candidates.size());
+}
+
+TEST_F(ObbTest, BatchIntersectsEmpty) {
+    std::vector<uint8_t> hits;
+    EXPECT_EQ(intersects(unit_obb_, std::span<const Obb>(), hits), 0u);
+}
+
+TEST_F(ObbTest, GetAabbBoundsCorners) {
+    for (const Obb& obb : makeRandomObbs(16, 0x0BB0064u)) {
+        Vec3f corners[8];
+        obb.getCorners(corners);
+        Aabb expected;
+        for (const Vec3f& c : corners) {
+            expected.expand(c);
+        }
+        const Aabb aabb = obb.getAabb();
+        EXPECT_TRUE(aabb.min().areSame(expected.min(), 1e-4f));
+        EXPECT_TRUE(aabb.max().areSame(expected.max(), 1e-4f));
+    }
+}
+
 TEST_F(ObbTest, Comparison) {
     Obb obb1(Vec3f(1, 2, 3), Vec3f(1, 1, 1));
     Obb obb2(Vec3f(1, 2, 3), Vec3f(1, 1, 1));
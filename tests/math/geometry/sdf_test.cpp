@@ -0,0 +1,254 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * SDF tests - analytic primitives, smooth operators, batch evaluation and
+ * sparse-brick volumes baked from meshes.
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/math/geometry/sdf.h"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace vne::math {
+
+namespace {
+
+constexpr float kEps = 1e-5f;
+
+/// Unit cube centered on the origin, wound counter-clockwise seen from outside
+struct CubeMesh {
+    std::vector<Vec3f> vertices{Vec3f(-0.5f, -0.5f, -0.5f),
+                                Vec3f(0.5f, -0.5f, -0.5f),
+                                Vec3f(0.5f, 0.5f, -0.5f),
+                                Vec3f(-0.5f, 0.5f, -0.5f),
+                                Vec3f(-0.5f, -0.5f, 0.5f),
+                                Vec3f(0.5f, -0.5f, 0.5f),
+                                Vec3f(0.5f, 0.5f, 0.5f),
+                                Vec3f(-0.5f, 0.5f, 0.5f)};
+    std::vector<uint32_t> indices{0, 2, 1, 0, 3, 2, 4, 5, 6, 4, 6, 7, 0, 1, 5, 0, 5, 4,
+                                  3, 7, 6, 3, 6, 2, 0, 4, 7, 0, 7, 3, 1, 2, 6, 1, 6, 5};
+};
+
+std::vector<Vec3f> randomPoints(size_t count, float range, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> coord(-range, range);
+    std::vector<Vec3f> points;
+    for (size_t i = 0; i < count; ++i) {
+        points.push_back(Vec3f(coord(rng), coord(rng), coord(rng)));
+    }
+    return points;
+}
+
+}  // namespace
+
+// ============================================================================
+// Primitive Tests
+// ============================================================================
+
+TEST(SdfPrimitiveTest, Sphere) {
+    EXPECT_NEAR(sdfSphere(Vec3f(0, 0, 0), 2.0f), -2.0f, kEps);
+    EXPECT_NEAR(sdfSphere(Vec3f(3, 4, 0), 2.0f), 3.0f, kEps);
+}
+
+TEST(SdfPrimitiveTest, Box) {
+    const Vec3f half(1.0f, 2.0f, 3.0f);
+    EXPECT_NEAR(sdfBox(Vec3f(0, 0, 0), half), -1.0f, kEps);
+    EXPECT_NEAR(sdfBox(Vec3f(3, 0, 0), half), 2.0f, kEps);
+    EXPECT_NEAR(sdfBox(Vec3f(0, 1.5f, 0), half), -0.5f, kEps);
+    // Corner region: distance to the corner point
+    EXPECT_NEAR(sdfBox(Vec3f(2, 3, 3), half), std::sqrt(2.0f), kEps);
+}
+
+TEST(SdfPrimitiveTest, RoundedBox) {
+    const Vec3f half(1.0f, 1.0f, 1.0f);
+    // Faces stay where the sharp box has them
+    EXPECT_NEAR(sdfRoundedBox(Vec3f(2, 0, 0), half, 0.25f), 1.0f, kEps);
+    EXPECT_NEAR(sdfRoundedBox(Vec3f(0, 0, 0), half, 0.25f), -1.0f, kEps);
+    // Corners are pulled in: the corner sphere has center 0.75 and radius 0.25
+    const Vec3f corner(1.0f, 1.0f, 1.0f);
+    EXPECT_NEAR(sdfRoundedBox(corner, half, 0.25f), std::sqrt(3.0f) * 0.25f - 0.25f, kEps);
+    EXPECT_NEAR(sdfRoundedBox(corner, half, 0.0f), sdfBox(corner, half), kEps);
+}
+
+TEST(SdfPrimitiveTest, Torus) {
+    EXPECT_NEAR(sdfTorus(Vec3f(2, 0, 0), 2.0f, 0.5f), -0.5f, kEps);
+    EXPECT_NEAR(sdfTorus(Vec3f(0, 0, 0), 2.0f, 0.5f), 1.5f, kEps);
+    EXPECT_NEAR(sdfTorus(Vec3f(0, 1, 2), 2.0f, 0.5f), 0.5f, kEps);
+}
+
+TEST(SdfPrimitiveTest, Cylinder) {
+    EXPECT_NEAR(sdfCylinder(Vec3f(0, 0, 0), 2.0f, 1.0f), -1.0f, kEps);
+    EXPECT_NEAR(sdfCylinder(Vec3f(3, 0, 0), 2.0f, 1.0f), 2.0f, kEps);
+    EXPECT_NEAR(sdfCylinder(Vec3f(0, 5, 0), 2.0f, 1.0f), 3.0f, kEps);
+    // Rim region
+    EXPECT_NEAR(sdfCylinder(Vec3f(0, 3, 2), 2.0f, 1.0f), std::sqrt(2.0f), kEps);
+}
+
+TEST(SdfPrimitiveTest, Cone) {
+    // Equal radii is a cylinder
+    for (const Vec3f& p : {Vec3f(0, 0, 0), Vec3f(3, 0, 0), Vec3f(0, 5, 0), Vec3f(0, 3, 2), Vec3f(0.5f, 1, 0)}) {
+        EXPECT_NEAR(sdfCone(p, 2.0f, 1.0f, 1.0f), sdfCylinder(p, 2.0f, 1.0f), kEps);
+    }
+    // Pointed cone of half height 1 and base radius 1: the slant runs from (1, -1) to the apex (0, 1)
+    EXPECT_NEAR(sdfCone(Vec3f(0, 1, 0), 1.0f, 1.0f, 0.0f), 0.0f, kEps);
+    EXPECT_NEAR(sdfCone(Vec3f(0, -2, 0), 1.0f, 1.0f, 0.0f), 1.0f, kEps);
+    EXPECT_NEAR(sdfCone(Vec3f(1, 1, 0), 1.0f, 1.0f, 0.0f), 2.0f / std::sqrt(5.0f), kEps);
+    EXPECT_LT(sdfCone(Vec3f(0, 0, 0), 1.0f, 1.0f, 0.0f), 0.0f);
+}
+
+TEST(SdfPrimitiveTest, PlacedPrimitiveUsesLocalFrame) {
+    const Quatf rotation = Quatf::fromAxisAngle(Vec3f(0, 0, 1), kPi * 0.5f);
+    const SdfPrimitive cylinder = SdfPrimitive::cylinder(Vec3f(10, 0, 0), 2.0f, 1.0f, rotation);
+
+    // The cylinder axis now runs along world X
+    EXPECT_NEAR(cylinder.distance(Vec3f(13, 0, 0)), 1.0f, kEps);
+    EXPECT_NEAR(cylinder.distance(Vec3f(10, 3, 0)), 2.0f, kEps);
+}
+
+// ============================================================================
+// Operator Tests
+// ============================================================================
+
+TEST(SdfOperatorTest, ZeroSmoothnessIsHardCsg) {
+    EXPECT_FLOAT_EQ(sdfSmoothUnion(1.0f, -2.0f, 0.0f), -2.0f);
+    EXPECT_FLOAT_EQ(sdfSmoothIntersection(1.0f, -2.0f, 0.0f), 1.0f);
+    EXPECT_FLOAT_EQ(sdfSmoothSubtraction(1.0f, -2.0f, 0.0f), 2.0f);
+}
+
+TEST(SdfOperatorTest, SmoothUnionBlendsOnlyNearSeam) {
+    // Far apart: unchanged
+    EXPECT_FLOAT_EQ(sdfSmoothUnion(0.1f, 5.0f, 0.5f), 0.1f);
+    // Equal: pulled down by k / 4
+    EXPECT_NEAR(sdfSmoothUnion(1.0f, 1.0f, 0.5f), 1.0f - 0.125f, kEps);
+    // Never above the hard union, never below it by more than k / 4
+    for (float a = -1.0f; a <= 1.0f; a += 0.1f) {
+        const float s = sdfSmoothUnion(a, 0.2f, 0.4f);
+        EXPECT_LE(s, std::min(a, 0.2f));
+        EXPECT_GE(s, std::min(a, 0.2f) - 0.1f - kEps);
+        EXPECT_NEAR(sdfSmoothIntersection(a, 0.2f, 0.4f), -sdfSmoothUnion(-a, -0.2f, 0.4f), kEps);
+    }
+}
+
+// ============================================================================
+// Batch Evaluation Tests
+// ============================================================================
+
+TEST(SdfBatchTest, MatchesScalarForEveryPrimitive) {
+    const Quatf rotation = Quatf::fromAxisAngle(Vec3f(1, 2, 3).normalized(), 0.7f);
+    const std::vector<SdfPrimitive> primitives{SdfPrimitive::sphere(Vec3f(0.5f, 0, 0), 1.5f),
+                                               SdfPrimitive::box(Vec3f(0, 1, 0), Vec3f(1, 2, 0.5f), rotation),
+                                               SdfPrimitive::roundedBox(Vec3f(0, 0, 1), Vec3f(1, 1, 2), 0.3f, rotation),
+                                               SdfPrimitive::torus(Vec3f(-1, 0, 0), 1.5f, 0.4f, rotation),
+                                               SdfPrimitive::cylinder(Vec3f(0, 0, -1), 1.0f, 0.8f, rotation),
+                                               SdfPrimitive::cone(Vec3f(1, 1, 1), 1.2f, 1.0f, 0.2f, rotation)};
+
+    // 103 points leaves a partial last block
+    const std::vector<Vec3f> points = randomPoints(103, 4.0f, 7u);
+    std::vector<float> out(points.size());
+    for (const SdfPrimitive& primitive : primitives) {
+        evaluate(primitive, points, out);
+        for (size_t i = 0; i < points.size(); ++i) {
+            EXPECT_NEAR(out[i], primitive.distance(points[i]), 1e-4f) << "type " << static_cast<int>(primitive.type);
+        }
+    }
+}
+
+TEST(SdfBatchTest, SmoothUnionOfPrimitives) {
+    const std::vector<SdfPrimitive> primitives{SdfPrimitive::sphere(Vec3f(-1, 0, 0), 1.0f),
+                                               SdfPrimitive::box(Vec3f(1, 0, 0), Vec3f(0.7f, 0.7f, 0.7f)),
+                                               SdfPrimitive::torus(Vec3f(0, 1, 0), 1.0f, 0.2f)};
+    const std::vector<Vec3f> points = randomPoints(66, 3.0f, 11u);
+    std::vector<float> out(points.size());
+
+    for (const float k : {0.0f, 0.3f}) {
+        evaluate(primitives, points, out, k);
+        for (size_t i = 0; i < points.size(); ++i) {
+            float expected = std::numeric_limits<float>::infinity();
+            for (const SdfPrimitive& primitive : primitives) {
+                expected = sdfSmoothUnion(expected, primitive.distance(points[i]), k);
+            }
+            EXPECT_NEAR(out[i], expected, 1e-4f);
+        }
+    }
+}
+
+TEST(SdfBatchTest, EmptyPrimitiveListIsInfinite) {
+    const std::vector<Vec3f> points{Vec3f(0, 0, 0), Vec3f(1, 2, 3)};
+    std::vector<float> out(points.size(), 0.0f);
+    evaluate(std::span<const SdfPrimitive>(), points, out);
+    EXPECT_TRUE(std::isinf(out[0]) && out[0] > 0.0f);
+    EXPECT_TRUE(std::isinf(out[1]) && out[1] > 0.0f);
+}
+
+// ============================================================================
+// Volume Tests
+// ============================================================================
+
+TEST(SdfVolumeTest, BakedCubeMatchesAnalyticBox) {
+    const CubeMesh cube;
+    SdfBakeSettings settings;
+    settings.voxel_size = 0.05f;
+    settings.narrow_band = 0.1f;
+    settings.brick_size = 4;
+    const SdfVolume volume = SdfVolume::bake(cube.vertices, cube.indices, settings);
+
+    ASSERT_FALSE(volume.empty());
+    EXPECT_TRUE(volume.bounds().contains(Vec3f(0.55f, 0.55f, 0.55f)));
+    EXPECT_GT(volume.allocatedBrickCount(), 0u);
+    EXPECT_LT(volume.allocatedBrickCount(), volume.brickCount());
+
+    const Vec3f half(0.5f, 0.5f, 0.5f);
+    const std::vector<Vec3f> points = randomPoints(2000, 0.6f, 3u);
+    std::vector<float> out(points.size());
+    volume.sample(points, out);
+    const float brick_extent = settings.voxel_size * static_cast<float>(settings.brick_size);
+    for (size_t i = 0; i < points.size(); ++i) {
+        const float exact = sdfBox(points[i], half);
+        // Within the narrow band samples are one voxel apart; outside it only brick corners are kept
+        const float tolerance = std::abs(exact) < settings.narrow_band ? settings.voxel_size : brick_extent;
+        EXPECT_NEAR(out[i], exact, tolerance) << "point " << i;
+        EXPECT_FLOAT_EQ(out[i], volume.sample(points[i]));
+    }
+}
+
+TEST(SdfVolumeTest, SignAndFarField) {
+    const CubeMesh cube;
+    const SdfVolume volume = SdfVolume::bake(cube.vertices, cube.indices);
+
+    // The center lies outside the narrow band, so it is interpolated from brick corners
+    EXPECT_LT(volume.sample(Vec3f(0, 0, 0)), -0.2f);
+    EXPECT_GT(volume.sample(Vec3f(0.6f, 0, 0)), 0.0f);
+    // Outside the volume the distance keeps growing continuously
+    EXPECT_NEAR(volume.sample(Vec3f(3, 0, 0)), 2.5f, 0.1f);
+    EXPECT_NEAR(volume.sample(Vec3f(0, -10, 0)), 9.5f, 0.1f);
+}
+
+TEST(SdfVolumeTest, WindingNumberToleratesHoles) {
+    CubeMesh cube;
+    // Drop one triangle of the -Z face
+    cube.indices.erase(cube.indices.begin(), cube.indices.begin() + 3);
+    const SdfVolume volume = SdfVolume::bake(cube.vertices, cube.indices);
+
+    EXPECT_LT(volume.sample(Vec3f(0, 0, 0)), 0.0f);
+    EXPECT_LT(volume.sample(Vec3f(0.3f, -0.3f, 0.3f)), 0.0f);
+    EXPECT_GT(volume.sample(Vec3f(0, 0, 0.8f)), 0.0f);
+}
+
+TEST(SdfVolumeTest, EmptyMeshGivesEmptyVolume) {
+    const SdfVolume volume = SdfVolume::bake({}, {});
+    EXPECT_TRUE(volume.empty());
+    EXPECT_EQ(volume.memoryUsage(), 0u);
+    EXPECT_EQ(volume.sample(Vec3f(0, 0, 0)), std::numeric_limits<float>::max());
+}
+
+}  // namespace vne::math
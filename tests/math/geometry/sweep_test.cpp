@@ -0,0 +1,365 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Sweep tests - time of impact for spheres, boxes and capsules, conservative
+ * advancement and the batch queries.
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/math/geometry/sweep.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace vne::math {
+
+namespace {
+
+constexpr float kEps = 1e-4f;
+
+/// Two quads of two triangles each, at z = 0 and z = -2, spanning [-2, 2] in x and y
+struct QuadMesh {
+    std::vector<Vec3f> vertices{Vec3f(-2, -2, 0),
+                                Vec3f(2, -2, 0),
+                                Vec3f(2, 2, 0),
+                                Vec3f(-2, 2, 0),
+                                Vec3f(-2, -2, -2),
+                                Vec3f(2, -2, -2),
+                                Vec3f(2, 2, -2),
+                                Vec3f(-2, 2, -2)};
+    std::vector<uint32_t> indices{0, 1, 2, 0, 2, 3, 4, 5, 6, 4, 6, 7};
+};
+
+}  // namespace
+
+// ============================================================================
+// Swept Sphere Tests
+// ============================================================================
+
+TEST(SweepSphereTest, TriangleFace) {
+    const Triangle triangle(Vec3f(-5, -5, 0), Vec3f(5, -5, 0), Vec3f(0, 5, 0));
+    const SweepHit hit = sweep(Sphere(Vec3f(0, 0, 5), 1.0f), Vec3f(0, 0, -10), triangle);
+
+    ASSERT_TRUE(hit);
+    EXPECT_NEAR(hit.time, 0.4f, kEps);
+    EXPECT_TRUE(hit.point.areSame(Vec3f(0, 0, 0), kEps));
+    EXPECT_TRUE(hit.normal.areSame(Vec3f(0, 0, 1), kEps));
+}
+
+TEST(SweepSphereTest, FastSphereDoesNotTunnel) {
+    // Starts and ends far from the triangle; a discrete test at either end misses it
+    const Triangle triangle(Vec3f(-5, -5, 0), Vec3f(5, -5, 0), Vec3f(0, 5, 0));
+    const Sphere sphere(Vec3f(0, 0, 5), 0.1f);
+    const SweepHit hit = sweep(sphere, Vec3f(0, 0, -100), triangle);
+
+    ASSERT_TRUE(hit);
+    EXPECT_NEAR(hit.time, 0.049f, kEps);
+    EXPECT_TRUE(hit.normal.areSame(Vec3f(0, 0, 1), kEps));
+
+    // Back face
+    const SweepHit from_below = sweep(Sphere(Vec3f(0, 0, -5), 0.1f), Vec3f(0, 0, 100), triangle);
+    ASSERT_TRUE(from_below);
+    EXPECT_TRUE(from_below.normal.areSame(Vec3f(0, 0, -1), kEps));
+}
+
+TEST(SweepSphereTest, TriangleEdge) {
+    const Triangle triangle(Vec3f(0, 0, 0), Vec3f(4, 0, 0), Vec3f(0, 4, 0));
+    const SweepHit hit = sweep(Sphere(Vec3f(2, -3, 0), 1.0f), Vec3f(0, 4, 0), triangle);
+
+    ASSERT_TRUE(hit);
+    EXPECT_NEAR(hit.time, 0.5f, kEps);
+    EXPECT_TRUE(hit.point.areSame(Vec3f(2, 0, 0), kEps));
+    EXPECT_TRUE(hit.normal.areSame(Vec3f(0, -1, 0), kEps));
+}
+
+TEST(SweepSphereTest, TriangleVertex) {
+    const Triangle triangle(Vec3f(0, 0, 0), Vec3f(4, 0, 0), Vec3f(0, 4, 0));
+    const SweepHit hit = sweep(Sphere(Vec3f(-3, -0.5f, 0), 1.0f), Vec3f(4, 0, 0), triangle);
+
+    // Reaches the vertex at x = -sqrt(1 - 0.25)
+    ASSERT_TRUE(hit);
+    EXPECT_NEAR(hit.time, (3.0f - std::sqrt(0.75f)) / 4.0f, kEps);
+    EXPECT_TRUE(hit.point.areSame(Vec3f(0, 0, 0), kEps));
+}
+
+TEST(SweepSphereTest, MissesAndOverlaps) {
+    const Triangle triangle(Vec3f(0, 0, 0), Vec3f(4, 0, 0), Vec3f(0, 4, 0));
+
+    // Parallel to the plane, above it
+    EXPECT_FALSE(sweep(Sphere(Vec3f(-3, 1, 2), 1.0f), Vec3f(10, 0, 0), triangle));
+    // Stops short
+    EXPECT_FALSE(sweep(Sphere(Vec3f(1, 1, 5), 1.0f), Vec3f(0, 0, -3.5f), triangle));
+    // Moving away
+    EXPECT_FALSE(sweep(Sphere(Vec3f(1, 1, 2), 1.0f), Vec3f(0, 0, 3), triangle));
+
+    const SweepHit overlap = sweep(Sphere(Vec3f(1, 1, 0.5f), 1.0f), Vec3f(5, 0, 0), triangle);
+    ASSERT_TRUE(overlap);
+    EXPECT_EQ(overlap.time, 0.0f);
+    EXPECT_TRUE(overlap.normal.areSame(Vec3f(0, 0, 1), kEps));
+}
+
+TEST(SweepSphereTest, MeshReportsFirstTriangle) {
+    const QuadMesh mesh;
+    const Sphere sphere(Vec3f(1, -1, 5), 0.5f);
+
+    const SweepHit hit = sweep(sphere, Vec3f(0, 0, -10), mesh.vertices, mesh.indices);
+    ASSERT_TRUE(hit);
+    EXPECT_NEAR(hit.time, 0.45f, kEps);
+    EXPECT_EQ(hit.index, 0u);
+
+    // Starting between the quads, moving down, hits the lower one
+    const SweepHit lower = sweep(Sphere(Vec3f(-1, 1, -1), 0.5f), Vec3f(0, 0, -10), mesh.vertices, mesh.indices);
+    ASSERT_TRUE(lower);
+    EXPECT_NEAR(lower.time, 0.05f, kEps);
+    EXPECT_EQ(lower.index, 3u);
+
+    EXPECT_FALSE(sweep(Sphere(Vec3f(5, 5, 5), 0.5f), Vec3f(0, 0, -10), mesh.vertices, mesh.indices));
+}
+
+// ============================================================================
+// Swept AABB Tests
+// ============================================================================
+
+TEST(SweepAabbTest, SlabHit) {
+    const Aabb box(Vec3f(0, 0, 0), Vec3f(1, 1, 1));
+    const Aabb obstacle(Vec3f(5, 0, 0), Vec3f(6, 1, 1));
+    const SweepHit hit = sweep(box, Vec3f(10, 0, 0), obstacle);
+
+    ASSERT_TRUE(hit);
+    EXPECT_NEAR(hit.time, 0.4f, kEps);
+    EXPECT_EQ(hit.normal, Vec3f(-1, 0, 0));
+    EXPECT_TRUE(hit.point.areSame(Vec3f(5, 0.5f, 0.5f), kEps));
+}
+
+TEST(SweepAabbTest, ZeroMotionAxesDoNotProduceNaN) {
+    const Aabb box(Vec3f(0, 0, 0), Vec3f(1, 1, 1));
+
+    // Offset in y with no y motion: never meets
+    EXPECT_FALSE(sweep(box, Vec3f(10, 0, 0), Aabb(Vec3f(5, 2, 0), Vec3f(6, 3, 1))));
+    // Faces exactly flush in y still touch
+    EXPECT_TRUE(sweep(box, Vec3f(10, 0, 0), Aabb(Vec3f(5, 1, 0), Vec3f(6, 2, 1))));
+    // No motion at all
+    EXPECT_FALSE(sweep(box, Vec3f::zero(), Aabb(Vec3f(5, 0, 0), Vec3f(6, 1, 1))));
+}
+
+TEST(SweepAabbTest, DiagonalAndOverlap) {
+    const Aabb box(Vec3f(0, 0, 0), Vec3f(1, 1, 1));
+
+    // Enters through the y face last, so y is the hit axis
+    const SweepHit diagonal = sweep(box, Vec3f(4, 8, 0), Aabb(Vec3f(2, 5, 0), Vec3f(4, 6, 1)));
+    ASSERT_TRUE(diagonal);
+    EXPECT_NEAR(diagonal.time, 0.5f, kEps);
+    EXPECT_EQ(diagonal.normal, Vec3f(0, -1, 0));
+
+    const SweepHit overlap = sweep(box, Vec3f(4, 0, 0), Aabb(Vec3f(0.8f, -1, -1), Vec3f(3, 2, 2)));
+    ASSERT_TRUE(overlap);
+    EXPECT_EQ(overlap.time, 0.0f);
+    EXPECT_EQ(overlap.normal, Vec3f(-1, 0, 0));
+}
+
+// ============================================================================
+// Swept Capsule Tests
+// ============================================================================
+
+TEST(SweepCapsuleTest, FallsOntoBoxFace) {
+    const Capsule capsule(Vec3f(-1, 3, 0), Vec3f(1, 3, 0), 0.5f);
+    const Obb box(Vec3f(0, 0, 0), Vec3f(2, 1, 2));
+    const SweepHit hit = sweep(capsule, Vec3f(0, -4, 0), box);
+
+    ASSERT_TRUE(hit);
+    EXPECT_NEAR(hit.time, 0.375f, 1e-3f);
+    EXPECT_LE(hit.time, 0.375f);
+    EXPECT_TRUE(hit.normal.areSame(Vec3f(0, 1, 0), 1e-3f));
+    EXPECT_NEAR(hit.point.y(), 1.0f, 1e-3f);
+}
+
+TEST(SweepCapsuleTest, FallsOntoRotatedBoxRidge) {
+    const Capsule capsule(Vec3f(-2, 3, 0), Vec3f(2, 3, 0), 0.5f);
+    const Obb box(Vec3f(0, 0, 0), Vec3f(1, 1, 1), Quatf::fromAxisAngle(Vec3f::zAxis(), degToRad(45.0f)));
+    const SweepHit hit = sweep(capsule, Vec3f(0, -4, 0), box);
+
+    ASSERT_TRUE(hit);
+    EXPECT_NEAR(hit.time, (2.5f - std::sqrt(2.0f)) / 4.0f, 1e-3f);
+    EXPECT_TRUE(hit.point.areSame(Vec3f(0, std::sqrt(2.0f), 0), 1e-2f));
+}
+
+TEST(SweepCapsuleTest, MissesAndOverlaps) {
+    const Obb box(Vec3f(0, 0, 0), Vec3f(1, 1, 1));
+
+    EXPECT_FALSE(sweep(Capsule(Vec3f(-1, 3, 0), Vec3f(1, 3, 0), 0.5f), Vec3f(0, 4, 0), box));
+    EXPECT_FALSE(sweep(Capsule(Vec3f(-1, 3, 0), Vec3f(1, 3, 0), 0.5f), Vec3f(0, -1, 0), box));
+    EXPECT_FALSE(sweep(Capsule(Vec3f(-1, 3, 0), Vec3f(1, 3, 0), 0.5f), Vec3f(10, 0, 0), box));
+
+    const SweepHit overlap = sweep(Capsule(Vec3f(-1, 1.2f, 0), Vec3f(1, 1.2f, 0), 0.5f), Vec3f(0, -1, 0), box);
+    ASSERT_TRUE(overlap);
+    EXPECT_EQ(overlap.time, 0.0f);
+    EXPECT_TRUE(overlap.normal.areSame(Vec3f(0, 1, 0), 1e-3f));
+}
+
+// ============================================================================
+// Conservative Advancement Tests
+// ============================================================================
+
+TEST(TimeOfImpactTest, TwoMovingSpheres) {
+    const Sphere a(Vec3f(0, 0, 0), 1.0f);
+    const Sphere b(Vec3f(10, 1, 0), 1.0f);
+    const SweepHit hit = timeOfImpact(a, Vec3f(10, 0, 0), b, Vec3f(-10, 0, 0));
+
+    // |(10 - 20t, 1)| = 2
+    const float expected = (10.0f - std::sqrt(3.0f)) / 20.0f;
+    ASSERT_TRUE(hit);
+    EXPECT_NEAR(hit.time, expected, 1e-4f);
+    EXPECT_TRUE(hit.normal.areSame(Vec3f(-std::sqrt(3.0f), -1, 0) / 2.0f, 1e-3f));
+}
+
+TEST(TimeOfImpactTest, ConvexPairsStopAtContact) {
+    std::mt19937 rng(0x61C0068u);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> ext(0.3f, 1.0f);
+
+    int hits = 0;
+    for (int i = 0; i < 100; ++i) {
+        std::vector<Vec3f> hull(12);
+        for (Vec3f& p : hull) {
+            p = Vec3f(unit(rng), unit(rng), unit(rng)) + Vec3f(-4, 0, 0);
+        }
+        const ConvexPointSet set{hull};
+        const Obb box(Vec3f(unit(rng), unit(rng), unit(rng)),
+                      Vec3f(ext(rng), ext(rng), ext(rng)),
+                      Quatf(unit(rng), unit(rng), unit(rng), unit(rng)).normalized());
+        const Vec3f motion_a = Vec3f(8, unit(rng) * 2.0f, unit(rng) * 2.0f);
+        const Vec3f motion_b = Vec3f(unit(rng), unit(rng), unit(rng));
+
+        const SweepHit hit = timeOfImpact(set, motion_a, box, motion_b);
+        if (!hit) {
+            continue;
+        }
+        ++hits;
+        const ConvexShape a_at_hit = ConvexShape(set).translated(motion_a * hit.time);
+        const ConvexShape b_at_hit = ConvexShape(box).translated(motion_b * hit.time);
+        EXPECT_LE(gjkDistance(a_at_hit, b_at_hit).distance, 1e-3f + kEps) << i;
+        EXPECT_FALSE(gjkIntersects(ConvexShape(set).translated(motion_a * hit.time * 0.98f),
+                                   ConvexShape(box).translated(motion_b * hit.time * 0.98f)))
+            << i;
+    }
+    EXPECT_GT(hits, 20);
+}
+
+// ============================================================================
+// Batch Tests
+// ============================================================================
+
+TEST(SweepBatchTest, AabbsMatchScalar) {
+    std::mt19937 rng(0x61C0069u);
+    std::uniform_real_distribution<float> pos(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> size(0.2f, 2.0f);
+
+    auto random_box = [&]() {
+        const Vec3f min(pos(rng), pos(rng), pos(rng));
+        return Aabb(min, min + Vec3f(size(rng), size(rng), size(rng)));
+    };
+    std::vector<Aabb> world(53);  // Not a multiple of the SIMD width
+    for (Aabb& obstacle : world) {
+        obstacle = random_box();
+    }
+    std::vector<Aabb> boxes(37);
+    std::vector<Vec3f> motions(boxes.size());
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        boxes[i] = random_box();
+        motions[i] = Vec3f(pos(rng), pos(rng), i % 3 == 0 ? 0.0f : pos(rng));
+    }
+
+    std::vector<SweepHit> hits(boxes.size());
+    const size_t count = sweep(boxes, motions, world, hits);
+
+    size_t expected_count = 0;
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        SweepHit best = SweepHit::none();
+        for (size_t j = 0; j < world.size(); ++j) {
+            const SweepHit hit = sweep(boxes[i], motions[i], world[j]);
+            if (hit && (!best || hit.time < best.time)) {
+                best = hit;
+                best.index = static_cast<uint32_t>(j);
+            }
+        }
+        ASSERT_EQ(hits[i].valid(), best.valid()) << i;
+        if (best) {
+            ++expected_count;
+            EXPECT_EQ(hits[i].time, best.time) << i;
+            EXPECT_EQ(hits[i].index, best.index) << i;
+            EXPECT_EQ(hits[i].normal, best.normal) << i;
+        }
+    }
+    EXPECT_EQ(count, expected_count);
+    EXPECT_GT(count, 5u);
+}
+
+TEST(SweepBatchTest, SpheresAgainstMesh) {
+    const QuadMesh mesh;
+    const std::vector<Sphere> spheres{Sphere(Vec3f(1, -1, 5), 0.5f),
+                                      Sphere(Vec3f(-1, 1, -1), 0.5f),
+                                      Sphere(Vec3f(5, 5, 5), 0.5f)};
+    const std::vector<Vec3f> motions(spheres.size(), Vec3f(0, 0, -10));
+    std::vector<SweepHit> hits(spheres.size());
+
+    EXPECT_EQ(sweep(spheres, motions, mesh.vertices, mesh.indices, hits), 2u);
+    for (size_t i = 0; i < spheres.size(); ++i) {
+        const SweepHit single = sweep(spheres[i], motions[i], mesh.vertices, mesh.indices);
+        EXPECT_EQ(hits[i].valid(), single.valid());
+        EXPECT_EQ(hits[i].time, single.time);
+        EXPECT_EQ(hits[i].index, single.index);
+    }
+}
+
+TEST(SweepBatchTest, CapsulesAgainstBoxes) {
+    std::mt19937 rng(0x61C006Au);
+    std::uniform_real_distribution<float> pos(-6.0f, 6.0f);
+    std::uniform_real_distribution<float> ext(0.3f, 1.2f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    std::vector<Obb> world;
+    for (int i = 0; i < 20; ++i) {
+        world.emplace_back(Vec3f(pos(rng), pos(rng), pos(rng)),
+                           Vec3f(ext(rng), ext(rng), ext(rng)),
+                           Quatf(unit(rng), unit(rng), unit(rng), unit(rng)).normalized());
+    }
+    std::vector<Capsule> capsules;
+    std::vector<Vec3f> motions;
+    for (int i = 0; i < 30; ++i) {
+        const Vec3f start(pos(rng), pos(rng), pos(rng));
+        capsules.emplace_back(start, start + Vec3f(unit(rng), unit(rng), unit(rng)), ext(rng) * 0.3f);
+        motions.push_back(Vec3f(pos(rng), pos(rng), pos(rng)));
+    }
+
+    std::vector<SweepHit> hits(capsules.size());
+    const size_t count = sweep(capsules, motions, world, hits);
+
+    size_t expected_count = 0;
+    for (size_t i = 0; i < capsules.size(); ++i) {
+        SweepHit best = SweepHit::none();
+        for (size_t j = 0; j < world.size(); ++j) {
+            const SweepHit hit = sweep(capsules[i], motions[i], world[j]);
+            if (hit && (!best || hit.time < best.time)) {
+                best = hit;
+                best.index = static_cast<uint32_t>(j);
+            }
+        }
+        ASSERT_EQ(hits[i].valid(), best.valid()) << i;
+        if (best) {
+            ++expected_count;
+            EXPECT_EQ(hits[i].index, best.index) << i;
+            EXPECT_EQ(hits[i].time, best.time) << i;
+        }
+    }
+    EXPECT_EQ(count, expected_count);
+    EXPECT_GT(count, 3u);
+}
+
+}  // namespace vne::math
@@ -0,0 +1,185 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * GPU sub-allocator tests - alignment, exhaustion, frame ring wraparound
+ * and concurrent allocation.
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/math/gpu_allocator.h"
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace vne::math {
+
+namespace {
+
+using TestBlock140 = GpuStructLayout<GpuBufferLayout::eStd140, Mat4f, Vec3f, float>;
+using TestBlock430 = GpuStructLayout<GpuBufferLayout::eStd430, Vec3f, float>;
+
+}  // namespace
+
+// ============================================================================
+// Linear Allocator Tests
+// ============================================================================
+
+class GpuLinearAllocatorTest : public ::testing::Test {
+   protected:
+    std::vector<std::byte> memory_ = std::vector<std::byte>(4096);
+};
+
+TEST_F(GpuLinearAllocatorTest, OffsetsAreAlignedWithinTheBuffer) {
+    // The region starts 64 bytes into the GPU buffer
+    GpuLinearAllocator allocator(memory_, 64, 256);
+
+    const GpuAllocation a = allocator.allocate(10);
+    ASSERT_TRUE(a);
+    EXPECT_EQ(a.offset, 256u);
+    EXPECT_EQ(a.data.data(), memory_.data() + 192);
+    EXPECT_EQ(a.data.size(), 10u);
+
+    const GpuAllocation b = allocator.allocate(100, 1024);
+    ASSERT_TRUE(b);
+    EXPECT_EQ(b.offset, 1024u);
+    EXPECT_EQ(allocator.used(), 1024u - 64u + 100u);
+}
+
+TEST_F(GpuLinearAllocatorTest, ExhaustionAndReset) {
+    GpuLinearAllocator allocator(memory_, 0, 256);
+    for (int i = 0; i < 16; ++i) {
+        EXPECT_TRUE(allocator.allocate(200));
+    }
+    EXPECT_FALSE(allocator.allocate(1));
+    EXPECT_FALSE(allocator.allocate(memory_.size() + 1));
+    EXPECT_FALSE(allocator.allocate(0));
+
+    allocator.reset();
+    EXPECT_EQ(allocator.used(), 0u);
+    EXPECT_EQ(allocator.allocate(memory_.size()).offset, 0u);
+}
+
+TEST_F(GpuLinearAllocatorTest, BlockAllocationsUseLayoutStrides) {
+    GpuLinearAllocator allocator(memory_, 0, 16);
+
+    const GpuAllocation uniforms = allocator.allocateBlocks<TestBlock140>(3);
+    ASSERT_TRUE(uniforms);
+    EXPECT_EQ(uniforms.stride, gpu::kUniformBufferAlign);
+    EXPECT_EQ(uniforms.data.size(), 2 * gpu::kUniformBufferAlign + TestBlock140::kSize);
+
+    const GpuAllocation storage = allocator.allocateBlocks<TestBlock430>(4);
+    ASSERT_TRUE(storage);
+    EXPECT_EQ(storage.stride, TestBlock430::kSize);
+    EXPECT_EQ(storage.data.size(), 4 * TestBlock430::kSize);
+    EXPECT_EQ(storage.offset % TestBlock430::kAlignment, 0u);
+
+    EXPECT_FALSE(allocator.allocateBlocks<TestBlock140>(0));
+}
+
+// Web builds run without pthreads
+#if !defined(VNE_PLATFORM_WEB)
+TEST_F(GpuLinearAllocatorTest, ConcurrentAllocationsDoNotOverlap) {
+    std::vector<std::byte> memory(1u << 20);
+    GpuLinearAllocator allocator(memory, 0, 16);
+
+    constexpr int kThreads = 4;
+    constexpr int kPerThread = 1000;
+    std::vector<std::vector<std::pair<size_t, size_t>>> ranges(kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < kPerThread; ++i) {
+                const size_t size = 16 + static_cast<size_t>((i * 7 + t) % 48);
+                const GpuAllocation a = allocator.allocate(size);
+                if (a) {
+                    ranges[t].emplace_back(a.offset, a.offset + size);
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<std::pair<size_t, size_t>> all;
+    for (const auto& r : ranges) {
+        all.insert(all.end(), r.begin(), r.end());
+    }
+    ASSERT_EQ(all.size(), static_cast<size_t>(kThreads * kPerThread));
+    std::sort(all.begin(), all.end());
+    for (size_t i = 0; i < all.size(); ++i) {
+        EXPECT_EQ(all[i].first % 16, 0u);
+        if (i > 0) {
+            EXPECT_LE(all[i - 1].second, all[i].first);
+        }
+    }
+}
+#endif
+
+// ============================================================================
+// Ring Allocator Tests
+// ============================================================================
+
+class GpuRingAllocatorTest : public ::testing::Test {
+   protected:
+    std::vector<std::byte> memory_ = std::vector<std::byte>(1024);
+};
+
+TEST_F(GpuRingAllocatorTest, InFlightFramesAreNotOverwritten) {
+    GpuRingAllocator ring(memory_, 2, 0, 256);
+
+    // Frame 0 fills three quarters of the ring
+    EXPECT_EQ(ring.allocate(256).offset, 0u);
+    EXPECT_EQ(ring.allocate(256).offset, 256u);
+    EXPECT_EQ(ring.allocate(256).offset, 512u);
+
+    // Frame 1: frame 0 is still on the GPU, so only the last quarter is free
+    ring.beginFrame();
+    EXPECT_EQ(ring.frameIndex(), 1u);
+    EXPECT_EQ(ring.allocate(256).offset, 768u);
+    EXPECT_FALSE(ring.allocate(256));
+
+    // Frame 2 reuses frame 0's slot: its memory wraps around to the start
+    ring.beginFrame();
+    EXPECT_EQ(ring.frameIndex(), 0u);
+    EXPECT_EQ(ring.used(), 256u);
+    EXPECT_EQ(ring.allocate(512).offset, 0u);
+    EXPECT_EQ(ring.allocate(200).offset, 512u);
+    EXPECT_FALSE(ring.allocate(1));
+}
+
+TEST_F(GpuRingAllocatorTest, AllocationsNeverStraddleTheEnd) {
+    GpuRingAllocator ring(memory_, 1, 0, 16);
+    for (int frame = 0; frame < 50; ++frame) {
+        ring.beginFrame();
+        for (int i = 0; i < 3; ++i) {
+            const size_t size = 96 + static_cast<size_t>((frame * 37 + i * 11) % 160);
+            const GpuAllocation a = ring.allocate(size);
+            ASSERT_TRUE(a) << "frame " << frame;
+            EXPECT_LE(a.offset + size, memory_.size());
+            EXPECT_EQ(a.offset % 16, 0u);
+        }
+    }
+}
+
+TEST_F(GpuRingAllocatorTest, ResetForgetsFrames) {
+    GpuRingAllocator ring(memory_, 3, 0, 256);
+    EXPECT_TRUE(ring.allocate(1024));
+    EXPECT_FALSE(ring.allocate(1));
+
+    ring.reset();
+    EXPECT_EQ(ring.used(), 0u);
+    EXPECT_EQ(ring.frameIndex(), 0u);
+    EXPECT_EQ(ring.allocateBlocks<TestBlock140>(4).offset, 0u);
+    EXPECT_EQ(ring.capacity(), memory_.size());
+}
+
+}  // namespace vne::math
@@ -0,0 +1,180 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * GPU instance packing tests - half floats, quaternion compression and
+ * batch conversion to affine / quantized TRS instances.
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/math/gpu_instance.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace vne::math {
+
+namespace {
+
+std::vector<TransformComponents> makeInstances(std::size_t count) {
+    std::vector<TransformComponents> instances(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const float f = static_cast<float>(i);
+        const Vec3f axis = Vec3f(0.3f + f, 1.0f, -0.7f * f + 0.2f).normalized();
+        instances[i].translation = Vec3f(f * 0.5f - 3.0f, 2.0f - f, f * 1.25f);
+        instances[i].rotation = Quatf::fromAxisAngle(axis, 0.37f * f - 1.5f);
+        instances[i].scale = Vec3f(0.5f + 0.1f * f, 1.0f + 0.05f * f, 2.0f - 0.03f * f);
+    }
+    return instances;
+}
+
+void expectSameRotation(const Quatf& a, const Quatf& b, float tolerance) {
+    const float dot = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+    EXPECT_GT(std::abs(dot), 1.0f - tolerance);
+}
+
+}  // namespace
+
+// ============================================================================
+// Half Float Tests
+// ============================================================================
+
+TEST(HalfFloatTest, KnownValues) {
+    static_assert(packHalf(1.0f) == 0x3C00);
+    EXPECT_EQ(packHalf(-2.0f), 0xC000);
+    EXPECT_EQ(packHalf(0.0f), 0x0000);
+    EXPECT_EQ(packHalf(-0.0f), 0x8000);
+    EXPECT_EQ(packHalf(65504.0f), 0x7BFF);
+    EXPECT_EQ(packHalf(65520.0f), 0x7C00);  // rounds to infinity
+    EXPECT_EQ(packHalf(std::numeric_limits<float>::infinity()), 0x7C00);
+    EXPECT_EQ(packHalf(std::ldexp(1.0f, -24)), 0x0001);  // smallest subnormal
+    EXPECT_EQ(packHalf(std::ldexp(1.0f, -26)), 0x0000);
+    EXPECT_EQ(packHalf(1.0f + std::ldexp(1.0f, -11)), 0x3C00);  // tie rounds to even
+    EXPECT_EQ(packHalf(1.0f + 3.0f * std::ldexp(1.0f, -11)), 0x3C02);
+
+    const uint16_t nan = packHalf(std::numeric_limits<float>::quiet_NaN());
+    EXPECT_EQ(nan & 0x7C00, 0x7C00);
+    EXPECT_NE(nan & 0x03FF, 0);
+    EXPECT_TRUE(std::isnan(unpackHalf(nan)));
+}
+
+TEST(HalfFloatTest, EveryHalfRoundTrips) {
+    for (uint32_t bits = 0; bits <= 0xFFFFu; ++bits) {
+        const auto half = static_cast<uint16_t>(bits);
+        const float value = unpackHalf(half);
+        if (std::isnan(value)) {
+            continue;
+        }
+        ASSERT_EQ(packHalf(value), half) << "bits " << bits;
+    }
+}
+
+// ============================================================================
+// Quaternion Compression Tests
+// ============================================================================
+
+TEST(QuaternionPackTest, RoundTripIsAccurate) {
+    for (const TransformComponents& instance : makeInstances(64)) {
+        expectSameRotation(unpackQuaternion(packQuaternion(instance.rotation)), instance.rotation, 2e-6f);
+    }
+    // Each component as the dropped one, with both signs
+    for (int axis = 0; axis < 4; ++axis) {
+        for (float sign : {1.0f, -1.0f}) {
+            float c[4] = {0.1f, -0.2f, 0.3f, 0.0f};
+            c[axis] = 0.9f * sign;
+            const Quatf q = Quatf(c[0], c[1], c[2], c[3]).normalized();
+            const uint32_t bits = packQuaternion(q);
+            EXPECT_EQ(bits >> 30, static_cast<uint32_t>(axis));
+            expectSameRotation(unpackQuaternion(bits), q, 2e-6f);
+        }
+    }
+}
+
+// ============================================================================
+// Batch Instance Packing Tests
+// ============================================================================
+
+TEST(InstancePackTest, MatricesToAffineRows) {
+    const std::vector<TransformComponents> instances = makeInstances(7);
+    std::vector<Mat4f> matrices;
+    for (const TransformComponents& instance : instances) {
+        matrices.push_back(compose(instance));
+    }
+
+    std::vector<GpuAffine3f> out(matrices.size());
+    packInstances(matrices, out);
+
+    for (std::size_t i = 0; i < matrices.size(); ++i) {
+        for (int r = 0; r < 3; ++r) {
+            const Vec4f row = out[i].rows[r].toVec4f();
+            for (int c = 0; c < 4; ++c) {
+                EXPECT_EQ(row[c], matrices[i][c][r]) << "index " << i;
+            }
+        }
+    }
+}
+
+TEST(InstancePackTest, ComponentsToAffineMatchesComposeAffine) {
+    // 11 exercises both the 4-wide blocks and the padded tail
+    const std::vector<TransformComponents> instances = makeInstances(11);
+    std::vector<GpuAffine3f> out(instances.size());
+    packInstances(instances, out);
+
+    for (std::size_t i = 0; i < instances.size(); ++i) {
+        const Affine3f expected = composeAffine(instances[i]);
+        for (int r = 0; r < 3; ++r) {
+            EXPECT_TRUE(out[i].rows[r].toVec4f().approxEquals(expected[r], 1e-5f)) << "index " << i;
+        }
+    }
+}
+
+TEST(InstancePackTest, QuantizedTrsMatchesScalar) {
+    const std::vector<TransformComponents> instances = makeInstances(13);
+    std::vector<GpuInstanceTrs> out(instances.size());
+    packInstances(instances, out);
+
+    for (std::size_t i = 0; i < instances.size(); ++i) {
+        EXPECT_EQ(out[i].position, instances[i].translation);
+        EXPECT_EQ(out[i].rotation >> 30, packQuaternion(instances[i].rotation) >> 30) << "index " << i;
+
+        const TransformComponents decoded = unpackInstanceTrs(out[i]);
+        expectSameRotation(decoded.rotation, instances[i].rotation, 2e-6f);
+        EXPECT_TRUE(decoded.scale.approxEquals(instances[i].scale, 2e-3f)) << "index " << i;
+    }
+}
+
+TEST(InstancePackTest, MatricesToQuantizedTrs) {
+    // More than one decompose chunk
+    const std::vector<TransformComponents> instances = makeInstances(70);
+    std::vector<Mat4f> matrices;
+    for (const TransformComponents& instance : instances) {
+        matrices.push_back(compose(instance));
+    }
+
+    std::vector<GpuInstanceTrs> out(matrices.size());
+    packInstances(matrices, out);
+
+    for (std::size_t i = 0; i < matrices.size(); ++i) {
+        // Half-precision scale and the 10-bit rotation error both grow with scale
+        const float tolerance = 2e-3f * instances[i].scale.length();
+        const Mat4f rebuilt = compose(unpackInstanceTrs(out[i]));
+        EXPECT_TRUE(rebuilt.approxEquals(matrices[i], tolerance)) << "index " << i;
+    }
+}
+
+TEST(InstancePackTest, EmptySpansAreNoOp) {
+    std::vector<GpuAffine3f> affine;
+    std::vector<GpuInstanceTrs> trs;
+    packInstances(std::span<const Mat4f>(), affine);
+    packInstances(std::span<const TransformComponents>(), trs);
+    EXPECT_TRUE(affine.empty());
+    EXPECT_TRUE(trs.empty());
+}
+
+}  // namespace vne::math
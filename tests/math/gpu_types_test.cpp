@@ -13,6 +13,10 @@
 
 #include "vertexnova/math/gpu_types.h"
 
+#include <array>
+#include <cstring>
+#include <vector>
+
 namespace vne::math {
 
 // ============================================================================
@@ -40,6 +44,12 @@ TEST_F(GpuAlignmentTest, GpuMat4fAlignment) {
     EXPECT_EQ(sizeof(GpuMat4f), 64);  // 4 * 16 bytes
 }
 
+TEST_F(GpuAlignmentTest, GpuAffine3fAlignment) {
+    EXPECT_EQ(alignof(GpuAffine3f), 16);
+    EXPECT_EQ(sizeof(GpuAffine3f), 48);  // 3 * 16 bytes
+    EXPECT_EQ(sizeof(GpuAffine3f), sizeof(Affine3f));
+}
+
 TEST_F(GpuAlignmentTest, PaddingTypes) {
     EXPECT_EQ(sizeof(Pad4), 4);
     EXPECT_EQ(sizeof(Pad8), 8);
@@ -175,6 +185,16 @@ TEST_F(GpuTypeConversionTest, GpuMat4fRoundTrip) {
     EXPECT_TRUE(original.approxEquals(recovered, kEps));
 }
 
+TEST_F(GpuTypeConversionTest, GpuAffine3fRoundTrip) {
+    Affine3f original = Affine3f::fromTrs(Vec3f(1.0f, 2.0f, 3.0f),
+                                          Quatf::fromAxisAngle(Vec3f::yAxis(), 0.5f),
+                                          Vec3f(2.0f, 1.0f, 0.5f));
+    GpuAffine3f gpu_affine = original;
+    Affine3f recovered = gpu_affine.toAffine3f();
+
+    EXPECT_TRUE(original == recovered);
+}
+
 TEST_F(GpuTypeConversionTest, ToGpuVec4Helper) {
     Vec3f v(1.0f, 2.0f, 3.0f);
 
@@ -231,6 +251,188 @@ TEST_F(GpuPracticalTest, Std140PaddedSize) {
     EXPECT_EQ(std140PaddedSize<GpuMat4f>(), 64);
 }
 
+// ============================================================================
+// Layout Descriptor Tests
+// ============================================================================
+
+class GpuStructLayoutTest : public ::testing::Test {};
+
+// layout(...) { mat4 model; vec3 tint; float alpha; vec2 uv; vec4 params[2]; float weights[3]; }
+template<GpuBufferLayout Layout>
+using MixedBlock = GpuStructLayout<Layout, Mat4f, Vec3f, float, Vec2f, std::array<Vec4f, 2>, std::array<float, 3>>;
+
+TEST_F(GpuStructLayoutTest, Std140Offsets) {
+    using Block = MixedBlock<GpuBufferLayout::eStd140>;
+    static_assert(Block::offsetOf<0>() == 0);
+    static_assert(Block::offsetOf<1>() == 64);
+    static_assert(Block::offsetOf<2>() == 76);  // scalar fills the vec3 slot
+    static_assert(Block::offsetOf<3>() == 80);
+    static_assert(Block::offsetOf<4>() == 96);
+    static_assert(Block::offsetOf<5>() == 128);
+    static_assert(Block::kFields[5].array_stride == 16);  // float[] elements round up to vec4
+    static_assert(Block::kAlignment == 16);
+    static_assert(Block::kSize == 176);
+    static_assert(Block::kUniformStride == gpu::kUniformBufferAlign);
+}
+
+TEST_F(GpuStructLayoutTest, Std430Offsets) {
+    using Block = MixedBlock<GpuBufferLayout::eStd430>;
+    static_assert(Block::offsetOf<2>() == 76);
+    static_assert(Block::offsetOf<3>() == 80);
+    static_assert(Block::offsetOf<4>() == 96);
+    static_assert(Block::offsetOf<5>() == 128);
+    static_assert(Block::kFields[5].array_stride == 4);  // scalar arrays stay tight
+    static_assert(Block::kSize == 144);
+
+    // std430 struct alignment is the largest member, not a vec4
+    using Scalars = GpuStructLayout<GpuBufferLayout::eStd430, float, uint32_t, int32_t>;
+    static_assert(Scalars::kAlignment == 4);
+    static_assert(Scalars::kSize == 12);
+    using Std140Scalars = GpuStructLayout<GpuBufferLayout::eStd140, float, uint32_t, int32_t>;
+    static_assert(Std140Scalars::kSize == 16);
+}
+
+TEST_F(GpuStructLayoutTest, MetalOffsets) {
+    using Block = MixedBlock<GpuBufferLayout::eMetal>;
+    static_assert(Block::offsetOf<1>() == 64);
+    static_assert(Block::offsetOf<2>() == 80);  // float3 is 16 bytes in Metal
+    static_assert(Block::offsetOf<3>() == 88);
+    static_assert(Block::offsetOf<4>() == 96);
+    static_assert(Block::kSize == 144);
+
+    using Vec3Array = GpuStructLayout<GpuBufferLayout::eMetal, std::array<Vec3f, 3>, float>;
+    static_assert(Vec3Array::kFields[0].array_stride == 16);
+    static_assert(Vec3Array::offsetOf<1>() == 48);
+    static_assert(Vec3Array::kSize == 64);
+}
+
+TEST_F(GpuStructLayoutTest, MatchesHandWrittenStd140Struct) {
+    struct alignas(16) SceneUniforms {
+        GpuMat4f view_projection;
+        GpuVec4f camera_pos;
+        GpuVec3f light_dir;
+    };
+    using Block = GpuStructLayout<GpuBufferLayout::eStd140, Mat4f, Vec4f, Vec3f>;
+    static_assert(Block::kSize == sizeof(SceneUniforms));
+    EXPECT_EQ(Block::offsetOf<1>(), offsetof(SceneUniforms, camera_pos));
+    EXPECT_EQ(Block::offsetOf<2>(), offsetof(SceneUniforms, light_dir));
+}
+
+// ============================================================================
+// Bulk Packing Tests
+// ============================================================================
+
+class GpuPackTest : public ::testing::Test {
+   protected:
+    static Mat4f makeMatrix(float seed) {
+        Mat4f m;
+        for (int c = 0; c < 4; ++c) {
+            for (int r = 0; r < 4; ++r) {
+                m[c][r] = seed + static_cast<float>(c * 4 + r);
+            }
+        }
+        return m;
+    }
+
+    template<typename T>
+    static T readAt(const std::vector<std::byte>& buffer, size_t offset) {
+        T value;
+        std::memcpy(&value, buffer.data() + offset, sizeof(T));
+        return value;
+    }
+};
+
+struct DrawData {
+    Vec3f tint;
+    Mat4f model;
+    float alpha;
+    Mat3f normal;
+    uint32_t id;
+};
+
+TEST_F(GpuPackTest, PacksMembersAtUniformStride) {
+    using Block = GpuBlock<GpuBufferLayout::eStd140,
+                           &DrawData::model,
+                           &DrawData::tint,
+                           &DrawData::alpha,
+                           &DrawData::normal,
+                           &DrawData::id>;
+    static_assert(Block::offsetOf<1>() == 64);
+    static_assert(Block::offsetOf<2>() == 76);
+    static_assert(Block::offsetOf<3>() == 80);
+    static_assert(Block::offsetOf<4>() == 128);
+    static_assert(Block::kSize == 144);
+
+    std::vector<DrawData> draws(5);
+    for (size_t i = 0; i < draws.size(); ++i) {
+        const auto f = static_cast<float>(i);
+        draws[i].model = makeMatrix(f * 100.0f);
+        draws[i].tint = Vec3f(f, f + 0.5f, f + 0.25f);
+        draws[i].alpha = 0.1f * f;
+        draws[i].normal = Mat3f(Vec3f(1.0f, 2.0f, f), Vec3f(4.0f, 5.0f, f), Vec3f(7.0f, 8.0f, f));
+        draws[i].id = static_cast<uint32_t>(i) + 7u;
+    }
+
+    std::vector<std::byte> buffer((draws.size() - 1) * Block::kUniformStride + Block::kSize, std::byte{0xCD});
+    Block::pack(std::span<const DrawData>(draws), buffer);
+
+    for (size_t i = 0; i < draws.size(); ++i) {
+        const size_t base = i * Block::kUniformStride;
+        EXPECT_EQ(readAt<Mat4f>(buffer, base), draws[i].model);
+        EXPECT_EQ(readAt<Vec3f>(buffer, base + 64), draws[i].tint);
+        EXPECT_FLOAT_EQ(readAt<float>(buffer, base + 76), draws[i].alpha);
+        for (int c = 0; c < 3; ++c) {
+            EXPECT_EQ(readAt<Vec3f>(buffer, base + 80 + 16 * static_cast<size_t>(c)), draws[i].normal[c]);
+        }
+        EXPECT_EQ(readAt<uint32_t>(buffer, base + 128), draws[i].id);
+        // Nothing is written between blocks
+        if (i + 1 < draws.size()) {
+            EXPECT_EQ(buffer[base + Block::kSize], std::byte{0xCD});
+        }
+    }
+}
+
+TEST_F(GpuPackTest, PacksParallelArraysAndShaderArrays) {
+    using Block = GpuStructLayout<GpuBufferLayout::eStd430, Vec3f, std::array<Vec3f, 2>, std::array<float, 3>>;
+    static_assert(Block::offsetOf<1>() == 16);
+    static_assert(Block::offsetOf<2>() == 48);
+    static_assert(Block::kSize == 64);
+
+    const std::vector<Vec3f> positions = {Vec3f(1.0f, 2.0f, 3.0f), Vec3f(4.0f, 5.0f, 6.0f)};
+    const std::vector<std::array<Vec3f, 2>> pairs = {{Vec3f(7.0f), Vec3f(8.0f)}, {Vec3f(9.0f), Vec3f(10.0f)}};
+    const std::vector<std::array<float, 3>> weights = {{0.1f, 0.2f, 0.3f}, {0.4f, 0.5f, 0.6f}};
+
+    // Tightly packed storage-buffer array: stride is the block size
+    std::vector<std::byte> buffer(positions.size() * Block::kSize);
+    Block::pack(buffer,
+                Block::kSize,
+                std::span<const Vec3f>(positions),
+                std::span<const std::array<Vec3f, 2>>(pairs),
+                std::span<const std::array<float, 3>>(weights));
+
+    for (size_t i = 0; i < positions.size(); ++i) {
+        const size_t base = i * Block::kSize;
+        EXPECT_EQ(readAt<Vec3f>(buffer, base), positions[i]);
+        EXPECT_EQ(readAt<Vec3f>(buffer, base + 16), pairs[i][0]);
+        EXPECT_EQ(readAt<Vec3f>(buffer, base + 32), pairs[i][1]);
+        for (size_t w = 0; w < 3; ++w) {
+            EXPECT_FLOAT_EQ(readAt<float>(buffer, base + 48 + 4 * w), weights[i][w]);
+        }
+    }
+}
+
+TEST_F(GpuPackTest, Vec3FollowedByScalarKeepsScalar) {
+    // The vec3 store widens to 16 bytes; the scalar written after it must win
+    using Block = GpuStructLayout<GpuBufferLayout::eStd140, Vec3f, float>;
+    const std::vector<Vec3f> dirs = {Vec3f(1.0f, 2.0f, 3.0f)};
+    const std::vector<float> intensity = {42.0f};
+    std::vector<std::byte> buffer(Block::kSize);
+    Block::pack(buffer, Block::kUniformStride, std::span<const Vec3f>(dirs), std::span<const float>(intensity));
+
+    EXPECT_EQ(readAt<Vec3f>(buffer, 0), dirs[0]);
+    EXPECT_FLOAT_EQ(readAt<float>(buffer, 12), 42.0f);
+}
+
 // ============================================================================
 // Negative Tests - Demonstrate What NOT to Do
 // ============================================================================
@@ -16,6 +16,10 @@
 #include "vertexnova/math/core/core.h"
 #include "vertexnova/math/projection_utils.h"
 
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
 namespace vne::math {
 
 // ============================================================================
@@ -227,6 +231,24 @@ TEST_F(OrthographicProjectionTest, VulkanOrtho) {
     EXPECT_NEAR(clip.z(), 0.0f, kEps);  // Vulkan: near maps to 0
 }
 
+TEST_F(OrthographicProjectionTest, VulkanOrthoOffCenter) {
+    // Off-center window: the Y translation must be flipped along with the Y scale
+    Mat4f proj = Mat4f::ortho(0.0f, 20.0f, 0.0f, 10.0f, kNear, kFar, GraphicsApi::eVulkan);
+    Mat4f proj_gl = Mat4f::ortho(0.0f, 20.0f, 0.0f, 10.0f, kNear, kFar, GraphicsApi::eOpenGL);
+
+    // Vulkan NDC Y points down: the top of the window maps to -1
+    Vec4f top = proj * Vec4f(10.0f, 10.0f, -kNear, 1.0f);
+    EXPECT_NEAR(top.x(), 0.0f, kEps);
+    EXPECT_NEAR(top.y(), -1.0f, kEps);
+
+    Vec4f bottom = proj * Vec4f(10.0f, 0.0f, -kNear, 1.0f);
+    EXPECT_NEAR(bottom.y(), 1.0f, kEps);
+
+    // Every point is the OpenGL result mirrored in Y
+    Vec4f p(3.0f, 7.5f, -kNear, 1.0f);
+    EXPECT_NEAR((proj * p).y(), -(proj_gl * p).y(), kEps);
+}
+
 TEST_F(OrthographicProjectionTest, ScreenSpaceOrtho) {
     // Common use case: 2D UI rendering
     float screen_width = 1920.0f;
@@ -586,4 +608,318 @@ TEST_F(ProjectionValidationTest, GraphicsApiName) {
     EXPECT_STREQ(graphicsApiName(GraphicsApi::eWebGPU), "WebGPU");
 }
 
+// ============================================================================
+// Compile-time API Specialization Tests
+// ============================================================================
+
+class CompileTimeApiTest : public ::testing::Test {
+   protected:
+    template<GraphicsApi Api>
+    void expectMatchesRuntime() {
+        const char* name = graphicsApiName(Api);
+        const Viewport viewport(0.0f, 0.0f, 800.0f, 600.0f);
+
+        EXPECT_EQ((Mat4f::perspective<Api>(degToRad(45.0f), 1.5f, 0.1f, 100.0f)),
+                  Mat4f::perspective(degToRad(45.0f), 1.5f, 0.1f, 100.0f, Api))
+            << name;
+        EXPECT_EQ((Mat4f::ortho<Api>(-4.0f, 4.0f, -3.0f, 3.0f, 0.1f, 50.0f)),
+                  Mat4f::ortho(-4.0f, 4.0f, -3.0f, 3.0f, 0.1f, 50.0f, Api))
+            << name;
+        EXPECT_EQ((Mat4f::lookAt<Api>(Vec3f(1.0f, 2.0f, 3.0f), Vec3f::zero(), Vec3f::yAxis())),
+                  Mat4f::lookAt(Vec3f(1.0f, 2.0f, 3.0f), Vec3f::zero(), Vec3f::yAxis(), Api))
+            << name;
+
+        const Mat4f vp = Mat4f::perspective<Api>(degToRad(60.0f), viewport.aspectRatio(), 0.1f, 100.0f)
+                         * Mat4f::lookAt<Api>(Vec3f(0.0f, 2.0f, 8.0f), Vec3f::zero(), Vec3f::yAxis());
+        const Vec3f world(0.5f, -0.25f, 1.0f);
+        const Vec3f screen = project<Api>(world, vp, viewport);
+        EXPECT_EQ(screen, project(world, vp, viewport, Api)) << name;
+        EXPECT_EQ(unproject<Api>(screen, vp.inverse(), viewport), unproject(screen, vp.inverse(), viewport, Api))
+            << name;
+
+        EXPECT_FLOAT_EQ(linearizeDepth<Api>(0.7f, 0.1f, 100.0f), linearizeDepth(0.7f, 0.1f, 100.0f, Api)) << name;
+        EXPECT_FLOAT_EQ(encodeDepth<Api>(12.0f, 0.1f, 100.0f), encodeDepth(12.0f, 0.1f, 100.0f, Api)) << name;
+    }
+};
+
+TEST_F(CompileTimeApiTest, OverloadsMatchRuntimeForAllApis) {
+    expectMatchesRuntime<GraphicsApi::eOpenGL>();
+    expectMatchesRuntime<GraphicsApi::eVulkan>();
+    expectMatchesRuntime<GraphicsApi::eMetal>();
+    expectMatchesRuntime<GraphicsApi::eDirectX>();
+    expectMatchesRuntime<GraphicsApi::eWebGPU>();
+}
+
+TEST_F(CompileTimeApiTest, VulkanPerspectiveIsYFlipped) {
+    Mat4f vulkan = Mat4f::perspective<GraphicsApi::eVulkan>(degToRad(60.0f), 1.0f, 0.1f, 100.0f);
+    Mat4f metal = Mat4f::perspective<GraphicsApi::eMetal>(degToRad(60.0f), 1.0f, 0.1f, 100.0f);
+    EXPECT_LT(vulkan[1][1], 0.0f);
+    EXPECT_GT(metal[1][1], 0.0f);
+    EXPECT_TRUE(validateProjectionMatrix(vulkan, GraphicsApi::eVulkan));
+    EXPECT_TRUE(validateProjectionMatrix(metal, GraphicsApi::eMetal));
+}
+
+TEST_F(CompileTimeApiTest, DispatchSelectsMatchingTag) {
+    GraphicsApi apis[] = {GraphicsApi::eOpenGL,
+                          GraphicsApi::eVulkan,
+                          GraphicsApi::eMetal,
+                          GraphicsApi::eDirectX,
+                          GraphicsApi::eWebGPU};
+
+    for (GraphicsApi api : apis) {
+        GraphicsApi seen = dispatchGraphicsApi(api, [](auto tag) { return decltype(tag)::value; });
+        EXPECT_EQ(seen, api);
+        bool top_left = dispatchGraphicsApi(
+            api, [](auto tag) { return GraphicsApiTraits<decltype(tag)::value>::kScreenOriginTopLeft; });
+        EXPECT_EQ(top_left, screenOriginIsTopLeft(api));
+    }
+
+    // Values outside the enumeration fall back to OpenGL
+    const auto unknown = static_cast<GraphicsApi>(0xFF);
+    EXPECT_EQ(dispatchGraphicsApi(unknown, [](auto tag) { return decltype(tag)::value; }), GraphicsApi::eOpenGL);
+
+    static_assert(dispatchGraphicsApi(GraphicsApi::eDirectX, [](auto tag) { return decltype(tag)::value; })
+                      == GraphicsApi::eDirectX,
+                  "dispatch is usable in constant expressions");
+    static_assert(linearizeDepth<GraphicsApi::eVulkan>(0.0f, 1.0f, 10.0f) == 1.0f, "near plane linearizes to z_near");
+}
+
+TEST_F(CompileTimeApiTest, DispatchedTraitsMatchRuntimeQueries) {
+    GraphicsApi apis[] = {GraphicsApi::eOpenGL,
+                          GraphicsApi::eVulkan,
+                          GraphicsApi::eMetal,
+                          GraphicsApi::eDirectX,
+                          GraphicsApi::eWebGPU};
+
+    for (GraphicsApi api : apis) {
+        dispatchGraphicsApi(api, [api](auto tag) {
+            using Traits = GraphicsApiTraits<decltype(tag)::value>;
+            EXPECT_EQ(Traits::kDepth, getClipSpaceDepth(api)) << graphicsApiName(api);
+            EXPECT_EQ(Traits::kHandedness, getHandedness(api)) << graphicsApiName(api);
+            EXPECT_EQ(Traits::kProjectionYFlip, needsProjectionYFlip(api)) << graphicsApiName(api);
+            EXPECT_EQ(Traits::kScreenOriginTopLeft, screenOriginIsTopLeft(api)) << graphicsApiName(api);
+        });
+    }
+}
+
+// ============================================================================
+// Reverse-Z and Infinite Projection Tests
+// ============================================================================
+
+class DepthModeTest : public ::testing::Test {
+   protected:
+    static constexpr float kNear = 0.1f;
+    static constexpr float kFar = 1000.0f;
+
+    /// NDC depth of a point on the view axis at a given distance
+    static float ndcDepth(const Mat4f& proj, GraphicsApi api, float distance) {
+        const float z = getHandedness(api) == Handedness::eLeft ? distance : -distance;
+        Vec4f clip = proj * Vec4f(0.0f, 0.0f, z, 1.0f);
+        return clip.z() / clip.w();
+    }
+};
+
+TEST_F(DepthModeTest, ReverseZMapsNearToOne) {
+    GraphicsApi apis[] = {GraphicsApi::eVulkan, GraphicsApi::eMetal, GraphicsApi::eDirectX, GraphicsApi::eWebGPU};
+
+    for (GraphicsApi api : apis) {
+        Mat4f proj = Mat4f::perspectiveReverseZ(degToRad(60.0f), 1.5f, kNear, kFar, api);
+        EXPECT_NEAR(ndcDepth(proj, api, kNear), 1.0f, 1e-5f) << graphicsApiName(api);
+        EXPECT_NEAR(ndcDepth(proj, api, kFar), 0.0f, 1e-5f) << graphicsApiName(api);
+        EXPECT_TRUE(validateProjectionMatrix(proj, api)) << graphicsApiName(api);
+    }
+
+    // [-1,1] depth: near -> +1, far -> -1
+    Mat4f gl = Mat4f::perspectiveReverseZ(degToRad(60.0f), 1.5f, kNear, kFar, GraphicsApi::eOpenGL);
+    EXPECT_NEAR(ndcDepth(gl, GraphicsApi::eOpenGL, kNear), 1.0f, 1e-4f);
+    EXPECT_NEAR(ndcDepth(gl, GraphicsApi::eOpenGL, kFar), -1.0f, 1e-4f);
+}
+
+TEST_F(DepthModeTest, InfiniteFarApproachesFarEnd) {
+    GraphicsApi apis[] = {GraphicsApi::eOpenGL,
+                          GraphicsApi::eVulkan,
+                          GraphicsApi::eMetal,
+                          GraphicsApi::eDirectX,
+                          GraphicsApi::eWebGPU};
+
+    for (GraphicsApi api : apis) {
+        const bool zero_to_one = getClipSpaceDepth(api) == ClipSpaceDepth::eZeroToOne;
+        Mat4f infinite = Mat4f::perspectiveInfinite(degToRad(60.0f), 1.5f, kNear, api);
+        Mat4f finite = Mat4f::perspective(degToRad(60.0f), 1.5f, kNear, 1.0e7f, api);
+        EXPECT_NEAR(ndcDepth(infinite, api, kNear), zero_to_one ? 0.0f : -1.0f, 1e-5f) << graphicsApiName(api);
+        EXPECT_NEAR(ndcDepth(infinite, api, 1.0e6f), 1.0f, 1e-5f) << graphicsApiName(api);
+        EXPECT_NEAR(ndcDepth(infinite, api, 7.0f), ndcDepth(finite, api, 7.0f), 1e-5f) << graphicsApiName(api);
+
+        Mat4f reversed = Mat4f::perspectiveInfiniteReverseZ(degToRad(60.0f), 1.5f, kNear, api);
+        EXPECT_NEAR(ndcDepth(reversed, api, kNear), 1.0f, 1e-5f) << graphicsApiName(api);
+        if (zero_to_one) {
+            // Depth is exactly near / distance
+            EXPECT_NEAR(ndcDepth(reversed, api, 25.0f), kNear / 25.0f, 1e-7f) << graphicsApiName(api);
+        }
+        EXPECT_EQ(reversed[1][1] < 0.0f, needsProjectionYFlip(api)) << graphicsApiName(api);
+    }
+}
+
+TEST_F(DepthModeTest, CompileTimeMatchesRuntime) {
+    EXPECT_EQ((Mat4f::perspective<GraphicsApi::eMetal, DepthMode::eInfiniteReversed>(1.0f, 2.0f, kNear, kFar)),
+              Mat4f::perspective(1.0f, 2.0f, kNear, kFar, GraphicsApi::eMetal, DepthMode::eInfiniteReversed));
+    EXPECT_EQ((Mat4f::perspective<GraphicsApi::eOpenGL, DepthMode::eReversed>(1.0f, 2.0f, kNear, kFar)),
+              Mat4f::perspectiveReverseZ(1.0f, 2.0f, kNear, kFar, GraphicsApi::eOpenGL));
+    EXPECT_EQ((Mat4f::perspective<GraphicsApi::eVulkan, DepthMode::eStandard>(1.0f, 2.0f, kNear, kFar)),
+              Mat4f::perspective(1.0f, 2.0f, kNear, kFar, GraphicsApi::eVulkan));
+}
+
+TEST_F(DepthModeTest, LinearizeAndEncodeRoundTripForAllModes) {
+    GraphicsApi apis[] = {GraphicsApi::eOpenGL, GraphicsApi::eVulkan, GraphicsApi::eDirectX};
+    DepthMode modes[] = {
+        DepthMode::eStandard, DepthMode::eReversed, DepthMode::eInfinite, DepthMode::eInfiniteReversed};
+    float distances[] = {kNear, 1.0f, 37.5f, 400.0f};
+
+    for (GraphicsApi api : apis) {
+        for (DepthMode mode : modes) {
+            Mat4f proj = Mat4f::perspective(degToRad(60.0f), 1.0f, kNear, kFar, api, mode);
+            for (float distance : distances) {
+                // Depth buffer value produced by the matching projection
+                float ndc = ndcDepth(proj, api, distance);
+                float buffer = getClipSpaceDepth(api) == ClipSpaceDepth::eZeroToOne ? ndc : ndc * 0.5f + 0.5f;
+
+                float encoded = encodeDepth(distance, kNear, kFar, api, mode);
+                EXPECT_NEAR(encoded, buffer, 1e-5f) << graphicsApiName(api) << " mode " << static_cast<int>(mode);
+                EXPECT_NEAR(linearizeDepth(encoded, kNear, kFar, api, mode), distance, distance * 1e-3f)
+                    << graphicsApiName(api) << " mode " << static_cast<int>(mode);
+            }
+        }
+    }
+
+    static_assert(linearizeDepth<GraphicsApi::eVulkan, DepthMode::eInfiniteReversed>(0.5f, 0.1f, 0.0f) == 0.2f,
+                  "reverse-Z infinite depth is near / distance");
+}
+
+// ============================================================================
+// Batch Projection Tests
+// ============================================================================
+
+class BatchProjectionTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        viewport_ = Viewport(10.0f, 20.0f, 1280.0f, 720.0f);
+        // A grid of points on both sides of a camera at the origin looking down -Z
+        for (int i = 0; i < 23; ++i) {
+            const float fi = static_cast<float>(i);
+            points_.emplace_back(fi * 0.7f - 8.0f, 4.0f - fi * 0.35f, i % 5 == 0 ? 3.0f + fi : -2.0f - fi);
+        }
+    }
+
+    Mat4f makeViewProjection(GraphicsApi api) const {
+        Mat4f view = Mat4f::lookAt(Vec3f::zero(), Vec3f(0.0f, 0.0f, -1.0f), Vec3f::yAxis(), api);
+        Mat4f proj = Mat4f::perspective(degToRad(60.0f), viewport_.aspectRatio(), 0.1f, 100.0f, api);
+        return proj * view;
+    }
+
+    Viewport viewport_;
+    std::vector<Vec3f> points_;
+    static constexpr float kEps = 1e-3f;
+};
+
+TEST_F(BatchProjectionTest, ProjectPointsMatchesScalarForAllApis) {
+    GraphicsApi apis[] = {GraphicsApi::eOpenGL,
+                          GraphicsApi::eVulkan,
+                          GraphicsApi::eMetal,
+                          GraphicsApi::eDirectX,
+                          GraphicsApi::eWebGPU};
+
+    for (GraphicsApi api : apis) {
+        const Mat4f vp = makeViewProjection(api);
+        std::vector<Vec3f> screen(points_.size());
+        projectPoints(points_, vp, viewport_, screen, api);
+
+        for (std::size_t i = 0; i < points_.size(); ++i) {
+            const Vec3f expected = project(points_[i], vp, viewport_, api);
+            EXPECT_NEAR(screen[i].x(), expected.x(), kEps * std::abs(expected.x()) + kEps)
+                << "API " << graphicsApiName(api) << " point " << i;
+            EXPECT_NEAR(screen[i].y(), expected.y(), kEps * std::abs(expected.y()) + kEps)
+                << "API " << graphicsApiName(api) << " point " << i;
+            EXPECT_NEAR(screen[i].z(), expected.z(), kEps) << "API " << graphicsApiName(api) << " point " << i;
+        }
+    }
+}
+
+TEST_F(BatchProjectionTest, VisibilityMaskFlagsPointsBehindCamera) {
+    const Mat4f vp = makeViewProjection(GraphicsApi::eVulkan);
+    std::vector<Vec3f> screen(points_.size());
+    std::vector<uint8_t> visible(points_.size(), 0xFF);
+    projectPoints(points_, vp, viewport_, screen, GraphicsApi::eVulkan, visible);
+
+    for (std::size_t i = 0; i < points_.size(); ++i) {
+        const bool in_front = points_[i].z() < 0.0f;
+        EXPECT_EQ(visible[i], in_front ? 1 : 0) << "point " << i;
+    }
+}
+
+TEST_F(BatchProjectionTest, DegenerateClipWMatchesScalar) {
+    // Points on the camera plane have clip w == 0
+    std::vector<Vec3f> points = {Vec3f(1.0f, 2.0f, 0.0f), Vec3f(0.0f, 0.0f, -5.0f), Vec3f(-3.0f, 1.0f, 0.0f)};
+    const Mat4f vp = makeViewProjection(GraphicsApi::eOpenGL);
+    std::vector<Vec3f> screen(points.size());
+    std::vector<uint8_t> visible(points.size());
+    projectPoints(points, vp, viewport_, screen, GraphicsApi::eOpenGL, visible);
+
+    EXPECT_EQ(screen[0], Vec3f(0.0f, 0.0f, -1.0f));
+    EXPECT_EQ(screen[2], Vec3f(0.0f, 0.0f, -1.0f));
+    EXPECT_EQ(visible[0], 0);
+    EXPECT_EQ(visible[1], 1);
+    EXPECT_EQ(visible[2], 0);
+}
+
+TEST_F(BatchProjectionTest, CompileTimeApiMatchesRuntime) {
+    const Mat4f vp = makeViewProjection(GraphicsApi::eMetal);
+    std::vector<Vec3f> runtime(points_.size());
+    std::vector<Vec3f> compile_time(points_.size());
+    projectPoints(points_, vp, viewport_, runtime, GraphicsApi::eMetal);
+    projectPoints<GraphicsApi::eMetal>(points_, vp, viewport_, compile_time);
+
+    for (std::size_t i = 0; i < points_.size(); ++i) {
+        EXPECT_EQ(runtime[i], compile_time[i]) << "point " << i;
+    }
+
+    constexpr ScreenMapping kMapping = ScreenMapping::create<GraphicsApi::eVulkan>(Viewport(0.0f, 0.0f, 100.0f, 50.0f));
+    static_assert(kMapping.scale.y() < 0.0f, "Vulkan screen origin is top-left");
+    static_assert(kMapping.offset.z() == 0.0f, "Vulkan depth maps [0, 1] directly");
+}
+
+TEST_F(BatchProjectionTest, UnprojectPointsRoundTrips) {
+    GraphicsApi apis[] = {GraphicsApi::eOpenGL, GraphicsApi::eVulkan, GraphicsApi::eDirectX};
+
+    for (GraphicsApi api : apis) {
+        const Mat4f vp = makeViewProjection(api);
+        std::vector<Vec3f> in_front;
+        for (const Vec3f& p : points_) {
+            if (p.z() < -0.5f) {
+                in_front.push_back(p);
+            }
+        }
+
+        std::vector<Vec3f> screen(in_front.size());
+        std::vector<Vec3f> world(in_front.size());
+        projectPoints(in_front, vp, viewport_, screen, api);
+        unprojectPoints(screen, vp.inverse(), viewport_, world, api);
+
+        for (std::size_t i = 0; i < in_front.size(); ++i) {
+            const Vec3f expected = unproject(screen[i], vp.inverse(), viewport_, api);
+            EXPECT_NEAR(world[i].x(), expected.x(), 1e-2f) << "API " << graphicsApiName(api);
+            EXPECT_NEAR(world[i].y(), expected.y(), 1e-2f) << "API " << graphicsApiName(api);
+            EXPECT_NEAR(world[i].z(), expected.z(), 1e-2f) << "API " << graphicsApiName(api);
+            EXPECT_NEAR(world[i].x(), in_front[i].x(), 5e-2f) << "API " << graphicsApiName(api);
+            EXPECT_NEAR(world[i].z(), in_front[i].z(), 5e-2f) << "API " << graphicsApiName(api);
+        }
+    }
+}
+
+TEST_F(BatchProjectionTest, EmptyInputIsNoOp) {
+    std::vector<Vec3f> empty;
+    projectPoints(empty, Mat4f::identity(), viewport_, empty);
+    unprojectPoints(empty, Mat4f::identity(), viewport_, empty);
+    SUCCEED();
+}
+
 }  // namespace vne::math
@@ -0,0 +1,373 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <vertexnova/math/geometry/aabb.h>
+#include <vertexnova/math/geometry/contact.h>
+#include <vertexnova/math/geometry/frustum.h>
+#include <vertexnova/math/geometry/intersection.h>
+#include <vertexnova/math/geometry/obb.h>
+#include <vertexnova/math/geometry/sdf.h>
+#include <vertexnova/math/geometry/sweep.h>
+#include <vertexnova/math/gpu_instance.h>
+#include <vertexnova/math/instrumentation.h>
+#include <vertexnova/math/projection_utils.h>
+#include <vertexnova/math/transform_node.h>
+#include <vertexnova/math/transform_utils.h>
+
+#include <chrono>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace vne::math;
+
+namespace {
+
+/// Clears the counters and trace around each test.
+class InstrumentationTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        setTraceRecording(false);
+        setInstrumentationHooks({});
+        resetInstrumentation();
+    }
+
+    void TearDown() override {
+        setTraceRecording(false);
+        setInstrumentationHooks({});
+        resetInstrumentation();
+    }
+};
+
+struct HookLog {
+    int begins{0};
+    int ends{0};
+    uint64_t last_items{0};
+    bool tokens_matched{true};
+};
+
+uint64_t zoneBegin(Probe probe, void* user_data) {
+    auto* log = static_cast<HookLog*>(user_data);
+    ++log->begins;
+    return 100 + static_cast<uint64_t>(probe);
+}
+
+void zoneEnd(Probe probe, uint64_t token, uint64_t items, void* user_data) {
+    auto* log = static_cast<HookLog*>(user_data);
+    ++log->ends;
+    log->last_items = items;
+    log->tokens_matched = log->tokens_matched && token == 100 + static_cast<uint64_t>(probe);
+}
+
+Frustum makeFrustum() {
+    Frustum frustum;
+    const Vec3f eye(0.0f, 0.0f, 10.0f);
+    const Vec3f target = Vec3f::zero();
+    frustum.extractFromMatrix(Mat4f::perspective(1.2f, 1.0f, 0.1f, 50.0f, GraphicsApi::eVulkan)
+                                  * Mat4f::lookAt(eye, target, Vec3f::yAxis(), GraphicsApi::eVulkan),
+                              getClipSpaceDepth(GraphicsApi::eVulkan));
+    return frustum;
+}
+
+/**
+ * Runs @p call and checks that it recorded exactly one call with @p items on
+ * @p probe and nothing on any other probe (nothing at all when disabled).
+ */
+template <typename Fn>
+void expectSingleBatch(Probe probe, uint64_t items, Fn&& call) {
+    const InstrumentationSnapshot before = instrumentationSnapshot();
+    call();
+    const InstrumentationSnapshot delta = instrumentationSnapshot() - before;
+    for (std::size_t p = 0; p < kProbeCount; ++p) {
+        const auto other = static_cast<Probe>(p);
+        const bool expected = kInstrumentationEnabled && other == probe;
+        EXPECT_EQ(delta[other].calls, expected ? 1u : 0u) << probeName(probe) << " -> " << probeName(other);
+        EXPECT_EQ(delta[other].items, expected ? items : 0u) << probeName(probe) << " -> " << probeName(other);
+    }
+}
+
+/// Checks that @p call records no probe at all.
+template <typename Fn>
+void expectNoProbes(Fn&& call) {
+    const InstrumentationSnapshot before = instrumentationSnapshot();
+    call();
+    const InstrumentationSnapshot delta = instrumentationSnapshot() - before;
+    for (std::size_t p = 0; p < kProbeCount; ++p) {
+        EXPECT_EQ(delta[static_cast<Probe>(p)].calls, 0u) << probeName(static_cast<Probe>(p));
+    }
+}
+
+}  // namespace
+
+// ============================================================================
+// Probe Names
+// ============================================================================
+
+TEST(ProbeNameTest, EveryProbeHasAUniqueName) {
+    std::set<std::string> names;
+    for (std::size_t p = 0; p < kProbeCount; ++p) {
+        const std::string name = probeName(static_cast<Probe>(p));
+        EXPECT_NE(name, "unknown") << p;
+        EXPECT_NE(name.find('.'), std::string::npos) << name;
+        EXPECT_TRUE(names.insert(name).second) << name;
+    }
+    EXPECT_STREQ(probeName(Probe::eCount), "unknown");
+}
+
+// ============================================================================
+// Counters and Snapshots
+// ============================================================================
+
+TEST_F(InstrumentationTest, ScopeCountsCallsItemsAndTime) {
+    {
+        const ProbeScope scope(Probe::eSweep, 7);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    {
+        const ProbeScope scope(Probe::eSweep, 5);
+    }
+
+    const InstrumentationSnapshot snapshot = instrumentationSnapshot();
+    EXPECT_EQ(snapshot[Probe::eSweep].calls, 2u);
+    EXPECT_EQ(snapshot[Probe::eSweep].items, 12u);
+    EXPECT_GE(snapshot[Probe::eSweep].nanoseconds, 1'000'000u);
+    EXPECT_EQ(snapshot[Probe::eContacts].calls, 0u);
+    EXPECT_GE(snapshot.threads, 1u);
+}
+
+TEST_F(InstrumentationTest, ResetZeroesCounters) {
+    {
+        const ProbeScope scope(Probe::eCompose, 4);
+    }
+    ASSERT_EQ(instrumentationSnapshot()[Probe::eCompose].calls, 1u);
+
+    resetInstrumentation();
+    const InstrumentationSnapshot snapshot = instrumentationSnapshot();
+    for (const ProbeStats& stats : snapshot.probes) {
+        EXPECT_EQ(stats.calls, 0u);
+        EXPECT_EQ(stats.items, 0u);
+        EXPECT_EQ(stats.nanoseconds, 0u);
+    }
+
+    {
+        const ProbeScope scope(Probe::eCompose, 4);
+    }
+    EXPECT_EQ(instrumentationSnapshot()[Probe::eCompose].calls, 1u);
+}
+
+TEST_F(InstrumentationTest, SnapshotDifferenceGivesPerFrameTotals) {
+    {
+        const ProbeScope scope(Probe::eDecompose, 10);
+    }
+    const InstrumentationSnapshot before = instrumentationSnapshot();
+    for (int i = 0; i < 3; ++i) {
+        const ProbeScope scope(Probe::eDecompose, 2);
+    }
+    const InstrumentationSnapshot frame = instrumentationSnapshot() - before;
+    EXPECT_EQ(frame[Probe::eDecompose].calls, 3u);
+    EXPECT_EQ(frame[Probe::eDecompose].items, 6u);
+    EXPECT_EQ(frame[Probe::eCompose].calls, 0u);
+}
+
+TEST_F(InstrumentationTest, AggregatesAcrossThreads) {
+    constexpr int kThreads = 4;
+    constexpr int kScopesPerThread = 250;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([] {
+            for (int i = 0; i < kScopesPerThread; ++i) {
+                const ProbeScope scope(Probe::eContacts, 3);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // Finished threads still count
+    const InstrumentationSnapshot snapshot = instrumentationSnapshot();
+    EXPECT_EQ(snapshot[Probe::eContacts].calls, static_cast<uint64_t>(kThreads * kScopesPerThread));
+    EXPECT_EQ(snapshot[Probe::eContacts].items, static_cast<uint64_t>(3 * kThreads * kScopesPerThread));
+    EXPECT_GE(snapshot.threads, static_cast<uint32_t>(kThreads));
+}
+
+// ============================================================================
+// Trace Export and Hooks
+// ============================================================================
+
+TEST_F(InstrumentationTest, ChromeTraceContainsRecordedBatches) {
+    {
+        const ProbeScope scope(Probe::eCompose, 1);  // Not recorded
+    }
+    setTraceRecording(true);
+    EXPECT_TRUE(isTraceRecording());
+    {
+        const ProbeScope scope(Probe::eProjectPoints, 64);
+    }
+    setTraceRecording(false);
+
+    std::ostringstream os;
+    writeChromeTrace(os);
+    const std::string json = os.str();
+    EXPECT_EQ(json.rfind("{\"traceEvents\":[", 0), 0u);
+    EXPECT_NE(json.find("\"name\":\"projection.project_batch\""), std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("\"args\":{\"items\":64}"), std::string::npos);
+    EXPECT_EQ(json.find("transform.compose_batch"), std::string::npos);
+    EXPECT_EQ(instrumentationSnapshot().dropped_events, 0u);
+
+    resetInstrumentation();
+    std::ostringstream cleared;
+    writeChromeTrace(cleared);
+    EXPECT_EQ(cleared.str().find("projection.project_batch"), std::string::npos);
+}
+
+TEST_F(InstrumentationTest, HooksWrapEveryScope) {
+    HookLog log;
+    setInstrumentationHooks({&zoneBegin, &zoneEnd, &log});
+    {
+        const ProbeScope scope(Probe::eSdfEvaluate, 9);
+    }
+    {
+        const ProbeScope scope(Probe::eInstancePacking, 3);
+    }
+    EXPECT_EQ(log.begins, 2);
+    EXPECT_EQ(log.ends, 2);
+    EXPECT_EQ(log.last_items, 3u);
+    EXPECT_TRUE(log.tokens_matched);
+
+    setInstrumentationHooks({});
+    {
+        const ProbeScope scope(Probe::eSdfEvaluate, 1);
+    }
+    EXPECT_EQ(log.begins, 2);
+}
+
+// ============================================================================
+// Library Probes
+// ============================================================================
+
+TEST_F(InstrumentationTest, LibraryProbesFollowBuildSwitch) {
+    const Frustum frustum = makeFrustum();
+    const Aabb box(Vec3f(-1.0f), Vec3f(1.0f));
+    EXPECT_TRUE(frustum.intersects(box));
+    EXPECT_TRUE(frustum.containsFully(box));
+    EXPECT_TRUE(frustum.contains(Vec3f::zero()));
+
+    const Ray ray(Vec3f(0.0f, 0.0f, 10.0f), Vec3f(0.0f, 0.0f, -1.0f));
+    EXPECT_TRUE(intersects(ray, box));
+    EXPECT_TRUE(intersect(ray, box).valid());
+
+    TransformNode node;
+    node.setLocalTransform(Mat4f::translate(Vec3f(1.0f, 2.0f, 3.0f)));
+
+    std::vector<Aabb> boxes(6, box);
+    std::vector<Mat4f> matrices(6, Mat4f::identity());
+    std::vector<Aabb> out(6);
+    transformAabbs(boxes, matrices, out);
+
+    const InstrumentationSnapshot snapshot = instrumentationSnapshot();
+    if (!kInstrumentationEnabled) {
+        for (const ProbeStats& stats : snapshot.probes) {
+            EXPECT_EQ(stats.calls, 0u);
+        }
+        return;
+    }
+    // One count per query: containsFully() and the Ray overloads do not re-count their helpers
+    EXPECT_EQ(snapshot[Probe::eFrustumTest].calls, 3u);
+    EXPECT_EQ(snapshot[Probe::eRayTest].calls, 2u);
+    EXPECT_EQ(snapshot[Probe::eTransformNodeUpdate].calls, 1u);
+    EXPECT_EQ(snapshot[Probe::eTransformAabbs].calls, 1u);
+    EXPECT_EQ(snapshot[Probe::eTransformAabbs].items, 6u);
+}
+
+TEST_F(InstrumentationTest, EveryBatchProbeCountsOneCallWithItsItems) {
+    // Six elements: one full SIMD block and a partial tail
+    constexpr std::size_t kCount = 6;
+    const Aabb box(Vec3f(-1.0f), Vec3f(1.0f));
+    const Obb obb(Vec3f::zero(), Vec3f(1.0f));
+
+    std::vector<Aabb> boxes(kCount, box);
+    std::vector<Mat4f> matrices(kCount, Mat4f::translate(Vec3f(1.0f, 2.0f, 3.0f)));
+    std::vector<Vec3f> points(kCount, Vec3f(0.5f, 0.0f, -5.0f));
+    std::vector<Vec3f> out_points(kCount);
+    std::vector<uint8_t> flags(kCount);
+    std::vector<float> distances(kCount);
+
+    expectSingleBatch(Probe::eTransformAabbs, kCount, [&] {
+        std::vector<Aabb> out(kCount);
+        transformAabbs(boxes, matrices, out);
+    });
+    const Frustum frustum = makeFrustum();
+    expectSingleBatch(Probe::eFrustumCull, kCount, [&] { (void)intersects(frustum, boxes, flags); });
+    expectSingleBatch(Probe::eRayBatch, kCount, [&] {
+        const PrecomputedRay ray(Ray(Vec3f(0.0f, 0.0f, 10.0f), Vec3f(0.0f, 0.0f, -1.0f)));
+        (void)intersect(ray, boxes, distances);
+    });
+    expectSingleBatch(Probe::eObbBatch, kCount, [&] {
+        const std::vector<Obb> candidates(kCount, obb);
+        (void)intersects(obb, candidates, flags);
+    });
+
+    // Transforms
+    std::vector<Vec3f> translations(kCount, Vec3f(1.0f, 2.0f, 3.0f));
+    std::vector<Quatf> rotations(kCount, Quatf::identity());
+    std::vector<Vec3f> scales(kCount, Vec3f(1.0f));
+    expectSingleBatch(Probe::eCompose, kCount, [&] {
+        std::vector<Mat4f> out(kCount);
+        compose(translations, rotations, scales, out);
+    });
+    expectSingleBatch(Probe::eDecompose, kCount, [&] { decompose(matrices, translations, rotations, scales); });
+    expectSingleBatch(Probe::eDecomposeAffine, kCount, [&] {
+        std::vector<AffineComponents> out(kCount);
+        decomposeAffine(matrices, out);
+    });
+    expectNoProbes([&] { (void)decomposeAffine(matrices[0]); });
+
+    // Projection, with and without the visibility mask
+    const ScreenMapping mapping = ScreenMapping::create(Viewport(640.0f, 480.0f), GraphicsApi::eVulkan);
+    const Mat4f mvp = Mat4f::perspective(1.2f, 1.0f, 0.1f, 50.0f, GraphicsApi::eVulkan);
+    expectSingleBatch(Probe::eProjectPoints, kCount, [&] { projectPoints(points, mvp, mapping, out_points); });
+    expectSingleBatch(Probe::eProjectPoints, kCount, [&] { projectPoints(points, mvp, mapping, out_points, flags); });
+    expectSingleBatch(Probe::eUnprojectPoints, kCount, [&] {
+        unprojectPoints(out_points, mvp.inverse(), mapping, points);
+    });
+
+    // Instance packing: every overload is one packing batch, none re-counts compose or decompose
+    const TransformComponents trs_components(Vec3f(1.0f, 2.0f, 3.0f), Quatf::identity(), Vec3f(1.0f));
+    const std::vector<TransformComponents> components(kCount, trs_components);
+    std::vector<GpuAffine3f> affine(kCount);
+    std::vector<GpuInstanceTrs> trs(kCount);
+    expectSingleBatch(Probe::eInstancePacking, kCount, [&] { packInstances(matrices, affine); });
+    expectSingleBatch(Probe::eInstancePacking, kCount, [&] { packInstances(components, affine); });
+    expectSingleBatch(Probe::eInstancePacking, kCount, [&] { packInstances(components, trs); });
+    expectSingleBatch(Probe::eInstancePacking, kCount, [&] { packInstances(matrices, trs); });
+    expectNoProbes([&] { (void)packInstanceTrs(components[0]); });
+
+    // Distance fields, one primitive and a smooth union
+    const std::vector<SdfPrimitive> primitives = {SdfPrimitive::sphere(Vec3f::zero(), 1.0f),
+                                                  SdfPrimitive::box(Vec3f(2.0f, 0.0f, 0.0f), Vec3f(0.5f))};
+    expectSingleBatch(Probe::eSdfEvaluate, kCount, [&] { evaluate(primitives[0], points, distances); });
+    expectSingleBatch(Probe::eSdfEvaluate, kCount, [&] { evaluate(primitives, points, distances, 0.25f); });
+
+    // Contacts and sweeps
+    expectSingleBatch(Probe::eContacts, kCount, [&] {
+        const std::vector<Obb> shapes(kCount, obb);
+        const std::vector<ContactPair> pairs(kCount, ContactPair{0, 1});
+        std::vector<ContactManifold> out(kCount);
+        (void)generateContacts(shapes, shapes, pairs, out);
+    });
+    expectSingleBatch(Probe::eSweep, kCount, [&] {
+        const std::vector<Vec3f> motions(kCount, Vec3f(5.0f, 0.0f, 0.0f));
+        const std::vector<Aabb> world = {Aabb(Vec3f(3.0f, -1.0f, -1.0f), Vec3f(4.0f, 1.0f, 1.0f))};
+        std::vector<SweepHit> out(kCount);
+        (void)sweep(boxes, motions, world, out);
+    });
+}
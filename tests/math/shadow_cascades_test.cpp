@@ -0,0 +1,247 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   January 2026
+ *
+ * Cascaded shadow map tests - split schemes, projection fitting,
+ * texel snapping and per-cascade culling frustums.
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/math/core/core.h"
+#include "vertexnova/math/geometry/sphere.h"
+#include "vertexnova/math/projection_utils.h"
+#include "vertexnova/math/shadow_cascades.h"
+
+#include <array>
+#include <cmath>
+
+namespace vne::math {
+
+// ============================================================================
+// Split Scheme Tests
+// ============================================================================
+
+class CascadeSplitTest : public ::testing::Test {
+   protected:
+    static constexpr float kNear = 0.5f;
+    static constexpr float kFar = 200.0f;
+    static constexpr float kEps = 1e-4f;
+};
+
+TEST_F(CascadeSplitTest, LinearSplitsAreUniform) {
+    std::array<float, 5> splits{};
+    computeCascadeSplits(kNear, kFar, splits, CascadeSplitScheme::eLinear);
+
+    const float step = (kFar - kNear) / 4.0f;
+    for (std::size_t i = 0; i < splits.size(); ++i) {
+        EXPECT_NEAR(splits[i], kNear + step * static_cast<float>(i), kEps * kFar);
+    }
+}
+
+TEST_F(CascadeSplitTest, LogarithmicSplitsHaveConstantRatio) {
+    std::array<float, 5> splits{};
+    computeCascadeSplits(kNear, kFar, splits, CascadeSplitScheme::eLogarithmic);
+
+    const float ratio = std::pow(kFar / kNear, 0.25f);
+    for (std::size_t i = 1; i < splits.size(); ++i) {
+        EXPECT_NEAR(splits[i] / splits[i - 1], ratio, 1e-3f);
+    }
+}
+
+TEST_F(CascadeSplitTest, PracticalSplitsBlendAndPinEnds) {
+    std::array<float, 5> linear{};
+    std::array<float, 5> logarithmic{};
+    std::array<float, 5> practical{};
+    computeCascadeSplits(kNear, kFar, linear, CascadeSplitScheme::eLinear);
+    computeCascadeSplits(kNear, kFar, logarithmic, CascadeSplitScheme::eLogarithmic);
+    computeCascadeSplits(kNear, kFar, practical, CascadeSplitScheme::ePractical, 0.5f);
+
+    EXPECT_FLOAT_EQ(practical.front(), kNear);
+    EXPECT_FLOAT_EQ(practical.back(), kFar);
+    for (std::size_t i = 1; i + 1 < practical.size(); ++i) {
+        EXPECT_NEAR(practical[i], 0.5f * (linear[i] + logarithmic[i]), kEps * kFar);
+        EXPECT_GT(practical[i], practical[i - 1]);
+    }
+}
+
+// ============================================================================
+// Cascade Fitting Tests
+// ============================================================================
+
+class ShadowCascadeTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        computeCascadeSplits(camera_.z_near, camera_.z_far, splits_);
+        settings_.light_direction = Vec3f(0.3f, -1.0f, 0.4f).normalized();
+        settings_.resolution = 1024;
+    }
+
+    static CascadeCamera makeCamera(const Vec3f& eye, const Vec3f& target, GraphicsApi api) {
+        CascadeCamera camera;
+        camera.view = Mat4f::lookAt(eye, target, Vec3f::yAxis(), api);
+        camera.fov_y = degToRad(60.0f);
+        camera.aspect = 16.0f / 9.0f;
+        camera.z_near = 0.1f;
+        camera.z_far = 120.0f;
+        camera.handedness = getHandedness(api);
+        return camera;
+    }
+
+    /// World-space corners of the camera slice [slice_near, slice_far]
+    static std::array<Vec3f, 8> sliceCorners(const CascadeCamera& camera, float slice_near, float slice_far) {
+        const Mat4f inv_view = camera.view.inverse();
+        const float tan_y = std::tan(camera.fov_y * 0.5f);
+        const float tan_x = tan_y * camera.aspect;
+        const float forward = camera.handedness == Handedness::eRight ? -1.0f : 1.0f;
+        std::array<Vec3f, 8> corners;
+        for (uint32_t c = 0; c < 8; ++c) {
+            const float d = (c & 4u) ? slice_far : slice_near;
+            const Vec3f local((c & 1u) ? d * tan_x : -d * tan_x, (c & 2u) ? d * tan_y : -d * tan_y, forward * d);
+            corners[c] = (inv_view * Vec4f(local, 1.0f)).xyz();
+        }
+        return corners;
+    }
+
+    /// Checks every slice corner lands inside the cascade's clip volume
+    static void expectCoversSlice(const CascadeCamera& camera, const ShadowCascade& cascade, GraphicsApi api) {
+        const float min_z = getClipSpaceDepth(api) == ClipSpaceDepth::eZeroToOne ? 0.0f : -1.0f;
+        for (const Vec3f& corner : sliceCorners(camera, cascade.split_near, cascade.split_far)) {
+            const Vec4f clip = cascade.view_projection * Vec4f(corner, 1.0f);
+            EXPECT_GE(clip.x(), -1.0f - kEps) << graphicsApiName(api);
+            EXPECT_LE(clip.x(), 1.0f + kEps) << graphicsApiName(api);
+            EXPECT_GE(clip.y(), -1.0f - kEps) << graphicsApiName(api);
+            EXPECT_LE(clip.y(), 1.0f + kEps) << graphicsApiName(api);
+            EXPECT_GE(clip.z(), min_z - kEps) << graphicsApiName(api);
+            EXPECT_LE(clip.z(), 1.0f + kEps) << graphicsApiName(api);
+            EXPECT_TRUE(cascade.frustum.intersects(Sphere(corner, 1e-2f))) << graphicsApiName(api);
+        }
+    }
+
+    /// Shadow map texel column of a world point
+    float texelX(const ShadowCascade& cascade, const Vec3f& world) const {
+        const Vec4f clip = cascade.view_projection * Vec4f(world, 1.0f);
+        return (clip.x() * 0.5f + 0.5f) * static_cast<float>(settings_.resolution);
+    }
+
+    CascadeCamera camera_ = makeCamera(Vec3f(5.0f, 3.0f, 10.0f), Vec3f(0.0f, 0.0f, -20.0f), GraphicsApi::eVulkan);
+    std::array<float, 5> splits_{};
+    ShadowCascadeSettings settings_;
+    static constexpr float kEps = 1e-3f;
+};
+
+TEST_F(ShadowCascadeTest, CascadesCoverTheirSlicesForAllApis) {
+    GraphicsApi apis[] = {GraphicsApi::eOpenGL,
+                          GraphicsApi::eVulkan,
+                          GraphicsApi::eMetal,
+                          GraphicsApi::eDirectX,
+                          GraphicsApi::eWebGPU};
+
+    for (GraphicsApi api : apis) {
+        for (CascadeFitMode fit : {CascadeFitMode::eTight, CascadeFitMode::eStable}) {
+            const CascadeCamera camera = makeCamera(Vec3f(5.0f, 3.0f, 10.0f), Vec3f(0.0f, 0.0f, -20.0f), api);
+            settings_.api = api;
+            settings_.fit = fit;
+            std::array<ShadowCascade, 4> cascades;
+            computeShadowCascades(camera, splits_, settings_, cascades);
+
+            for (std::size_t i = 0; i < cascades.size(); ++i) {
+                EXPECT_FLOAT_EQ(cascades[i].split_near, splits_[i]);
+                EXPECT_FLOAT_EQ(cascades[i].split_far, splits_[i + 1]);
+                EXPECT_GT(cascades[i].texel_size, 0.0f);
+                EXPECT_TRUE(validateProjectionMatrix(cascades[i].projection, api));
+                expectCoversSlice(camera, cascades[i], api);
+            }
+        }
+    }
+}
+
+TEST_F(ShadowCascadeTest, TightFitUsesNoMoreTexelsThanStable) {
+    std::array<ShadowCascade, 4> tight;
+    std::array<ShadowCascade, 4> stable;
+    settings_.fit = CascadeFitMode::eTight;
+    computeShadowCascades(camera_, splits_, settings_, tight);
+    settings_.fit = CascadeFitMode::eStable;
+    computeShadowCascades(camera_, splits_, settings_, stable);
+
+    for (std::size_t i = 0; i < tight.size(); ++i) {
+        EXPECT_LE(tight[i].texel_size, stable[i].texel_size + kEps);
+        if (i > 0) {
+            EXPECT_GT(stable[i].texel_size, stable[i - 1].texel_size);
+        }
+    }
+}
+
+TEST_F(ShadowCascadeTest, StableFitIsRotationInvariant) {
+    std::array<ShadowCascade, 4> a;
+    std::array<ShadowCascade, 4> b;
+    const Vec3f eye(5.0f, 3.0f, 10.0f);
+    computeShadowCascades(makeCamera(eye, Vec3f(0.0f, 0.0f, -20.0f), GraphicsApi::eVulkan), splits_, settings_, a);
+    computeShadowCascades(makeCamera(eye, Vec3f(40.0f, -5.0f, 12.0f), GraphicsApi::eVulkan), splits_, settings_, b);
+
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        EXPECT_FLOAT_EQ(a[i].texel_size, b[i].texel_size) << "cascade " << i;
+    }
+}
+
+TEST_F(ShadowCascadeTest, SnappedCascadesMoveInWholeTexels) {
+    const Vec3f target(0.0f, 0.0f, -20.0f);
+    const Vec3f probe(2.0f, 0.0f, -15.0f);
+    std::array<ShadowCascade, 4> before;
+    std::array<ShadowCascade, 4> after;
+
+    for (float step : {0.013f, 0.21f, 1.7f}) {
+        const Vec3f offset(step, 0.0f, step * 0.5f);
+        computeShadowCascades(makeCamera(Vec3f(5.0f, 3.0f, 10.0f), target, GraphicsApi::eVulkan),
+                              splits_,
+                              settings_,
+                              before);
+        computeShadowCascades(makeCamera(Vec3f(5.0f, 3.0f, 10.0f) + offset, target + offset, GraphicsApi::eVulkan),
+                              splits_,
+                              settings_,
+                              after);
+
+        for (std::size_t i = 0; i < before.size(); ++i) {
+            // A fixed world point lands on the same texel phase in both frames
+            const float shift = texelX(after[i], probe) - texelX(before[i], probe);
+            EXPECT_NEAR(shift, std::round(shift), 2e-2f) << "cascade " << i << " step " << step;
+        }
+    }
+}
+
+TEST_F(ShadowCascadeTest, CasterExtensionReachesTowardLight) {
+    std::array<ShadowCascade, 4> plain;
+    std::array<ShadowCascade, 4> extended;
+    settings_.fit = CascadeFitMode::eTight;
+    computeShadowCascades(camera_, splits_, settings_, plain);
+    settings_.caster_extension = 100.0f;
+    computeShadowCascades(camera_, splits_, settings_, extended);
+
+    // A caster well above the first slice, between it and the light
+    const auto corners = sliceCorners(camera_, splits_[0], splits_[1]);
+    Vec3f slice_center = Vec3f::zero();
+    for (const Vec3f& c : corners) {
+        slice_center += c * 0.125f;
+    }
+    const Vec3f caster = slice_center - settings_.light_direction * 60.0f;
+
+    EXPECT_FALSE(plain[0].frustum.intersects(Sphere(caster, 0.01f)));
+    EXPECT_TRUE(extended[0].frustum.intersects(Sphere(caster, 0.01f)));
+}
+
+TEST_F(ShadowCascadeTest, VerticalLightUsesFallbackUp) {
+    settings_.light_direction = Vec3f(0.0f, -1.0f, 0.0f);
+    std::array<ShadowCascade, 4> cascades;
+    computeShadowCascades(camera_, splits_, settings_, cascades);
+
+    for (const ShadowCascade& cascade : cascades) {
+        EXPECT_FALSE(std::isnan(cascade.view_projection[0][0]));
+        expectCoversSlice(camera_, cascade, GraphicsApi::eVulkan);
+    }
+}
+
+}  // namespace vne::math
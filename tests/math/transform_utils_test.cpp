@@ -7,6 +7,8 @@
 #include <gtest/gtest.h>
 #include <vertexnova/math/transform_utils.h>
 
+#include <vector>
+
 using namespace vne::math;
 
 // ============================================================================
@@ -316,3 +318,205 @@ TEST(RoundTripTest, MultipleIterations) {
     EXPECT_NEAR(final_components.translation.x(), 1.0f, 0.01f);
     EXPECT_NEAR(final_components.scale.x(), 2.0f, 0.01f);
 }
+
+// ============================================================================
+// Batch Compose/Decompose Tests
+// ============================================================================
+
+namespace {
+
+struct BatchTrs {
+    std::vector<Vec3f> translations;
+    std::vector<Quatf> rotations;
+    std::vector<Vec3f> scales;
+};
+
+BatchTrs makeBatchTrs(std::size_t count) {
+    BatchTrs batch;
+    for (std::size_t i = 0; i < count; ++i) {
+        const float f = static_cast<float>(i);
+        batch.translations.emplace_back(f * 0.5f - 3.0f, 2.0f - f, f * 1.25f);
+        const Vec3f axis = Vec3f(0.3f + f, 1.0f, -0.7f * f + 0.2f).normalized();
+        batch.rotations.push_back(Quatf::fromAxisAngle(axis, 0.37f * f - 1.5f));
+        batch.scales.emplace_back(0.5f + 0.1f * f, 1.0f + 0.05f * f, 2.0f - 0.03f * f);
+    }
+    return batch;
+}
+
+}  // namespace
+
+TEST(BatchTransformTest, ComposeMatchesScalar) {
+    // 11 exercises both the 4-wide blocks and the padded tail
+    const BatchTrs batch = makeBatchTrs(11);
+    std::vector<Mat4f> out(batch.translations.size());
+
+    compose(batch.translations, batch.rotations, batch.scales, out);
+
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        const Mat4f expected = compose(batch.translations[i], batch.rotations[i], batch.scales[i]);
+        EXPECT_TRUE(out[i].approxEquals(expected, 1e-5f)) << "index " << i;
+    }
+}
+
+TEST(BatchTransformTest, DecomposeMatchesScalar) {
+    const BatchTrs batch = makeBatchTrs(13);
+    std::vector<Mat4f> matrices(batch.translations.size());
+    for (std::size_t i = 0; i < matrices.size(); ++i) {
+        matrices[i] = compose(batch.translations[i], batch.rotations[i], batch.scales[i]);
+    }
+
+    std::vector<Vec3f> translations(matrices.size());
+    std::vector<Quatf> rotations(matrices.size());
+    std::vector<Vec3f> scales(matrices.size());
+    decompose(matrices, translations, rotations, scales);
+
+    for (std::size_t i = 0; i < matrices.size(); ++i) {
+        const TransformComponents expected = decompose(matrices[i]);
+        EXPECT_TRUE(translations[i].approxEquals(expected.translation, 1e-5f)) << "index " << i;
+        EXPECT_TRUE(rotations[i].approxEquals(expected.rotation, 1e-5f)) << "index " << i;
+        EXPECT_TRUE(scales[i].approxEquals(expected.scale, 1e-5f)) << "index " << i;
+    }
+}
+
+TEST(BatchTransformTest, DecomposeHandlesReflectionAndZeroScale) {
+    std::vector<Mat4f> matrices = {
+        compose(Vec3f(1.0f, 2.0f, 3.0f), Quatf::fromAxisAngle(Vec3f::yAxis(), 0.8f), Vec3f(-2.0f, 1.0f, 1.0f)),
+        makeScale(Vec3f(0.0f, 3.0f, 1.0f)),
+        compose(Vec3f::zero(), Quatf::fromAxisAngle(Vec3f::xAxis(), 3.1f), Vec3f(1.0f, 1.0f, 1.0f)),
+    };
+
+    std::vector<Vec3f> translations(matrices.size());
+    std::vector<Quatf> rotations(matrices.size());
+    std::vector<Vec3f> scales(matrices.size());
+    decompose(matrices, translations, rotations, scales);
+
+    for (std::size_t i = 0; i < matrices.size(); ++i) {
+        const TransformComponents expected = decompose(matrices[i]);
+        EXPECT_TRUE(translations[i].approxEquals(expected.translation, 1e-5f)) << "index " << i;
+        EXPECT_TRUE(rotations[i].approxEquals(expected.rotation, 1e-5f)) << "index " << i;
+        EXPECT_TRUE(scales[i].approxEquals(expected.scale, 1e-5f)) << "index " << i;
+    }
+    EXPECT_LT(scales[0].x(), 0.0f);
+    EXPECT_FLOAT_EQ(scales[1].x(), 0.0f);
+}
+
+TEST(BatchTransformTest, EmptySpansAreNoOp) {
+    std::vector<Mat4f> out;
+    compose(std::span<const Vec3f>{}, std::span<const Quatf>{}, std::span<const Vec3f>{}, out);
+    EXPECT_TRUE(out.empty());
+}
+
+TEST(BatchTransformTest, RoundTrip) {
+    const BatchTrs batch = makeBatchTrs(32);
+    std::vector<Mat4f> matrices(batch.translations.size());
+    compose(batch.translations, batch.rotations, batch.scales, matrices);
+
+    std::vector<Vec3f> translations(matrices.size());
+    std::vector<Quatf> rotations(matrices.size());
+    std::vector<Vec3f> scales(matrices.size());
+    decompose(matrices, translations, rotations, scales);
+
+    std::vector<Mat4f> rebuilt(matrices.size());
+    compose(translations, rotations, scales, rebuilt);
+
+    for (std::size_t i = 0; i < matrices.size(); ++i) {
+        EXPECT_TRUE(matrices[i].approxEquals(rebuilt[i], 1e-4f)) << "index " << i;
+    }
+}
+
+// ============================================================================
+// Affine (Polar) Decomposition Tests
+// ============================================================================
+
+namespace {
+
+Mat4f makeSheared(const Vec3f& translation, const Quatf& rotation, const Vec3f& scale, float shear) {
+    // T * R * H * S with H an upper-triangular shear, as exported by DCC tools
+    Mat4f shear_matrix = Mat4f::identity();
+    shear_matrix[1][0] = shear;
+    shear_matrix[2][1] = 0.5f * shear;
+    return compose(translation, rotation, Vec3f(1.0f, 1.0f, 1.0f)) * shear_matrix * makeScale(scale);
+}
+
+}  // namespace
+
+TEST(DecomposeAffineTest, ShearFreeMatchesDecompose) {
+    Mat4f matrix = compose(Vec3f(1.0f, -2.0f, 3.0f),
+                           Quatf::fromAxisAngle(Vec3f(1.0f, 2.0f, -1.0f).normalized(), 1.1f),
+                           Vec3f(2.0f, 0.5f, 3.0f));
+    AffineComponents affine = decomposeAffine(matrix);
+    TransformComponents trs = decompose(matrix);
+
+    EXPECT_TRUE(affine.translation.approxEquals(trs.translation, 1e-5f));
+    EXPECT_TRUE(affine.rotation.approxEquals(trs.rotation, 1e-4f));
+    EXPECT_TRUE(affine.scale.approxEquals(trs.scale, 1e-4f));
+    EXPECT_FALSE(affine.hasShear(1e-4f));
+}
+
+TEST(DecomposeAffineTest, ShearedRoundTrip) {
+    Mat4f matrix = makeSheared(Vec3f(5.0f, 6.0f, -7.0f),
+                               Quatf::fromAxisAngle(Vec3f(0.2f, 1.0f, 0.4f).normalized(), -0.6f),
+                               Vec3f(1.5f, 2.5f, 0.75f),
+                               0.8f);
+    AffineComponents affine = decomposeAffine(matrix);
+
+    EXPECT_TRUE(affine.hasShear());
+    EXPECT_TRUE(compose(affine).approxEquals(matrix, 1e-4f));
+}
+
+TEST(DecomposeAffineTest, RotationIsOrthonormal) {
+    Mat4f matrix =
+        makeSheared(Vec3f::zero(), Quatf::fromAxisAngle(Vec3f::zAxis(), 2.0f), Vec3f(3.0f, 0.2f, 1.0f), 1.5f);
+    AffineComponents affine = decomposeAffine(matrix);
+
+    EXPECT_NEAR(affine.rotation.length(), 1.0f, 1e-5f);
+    Mat3f r = affine.rotation.toMatrix3();
+    EXPECT_TRUE((r * r.transpose()).approxEquals(Mat3f::identity(), 1e-5f));
+    EXPECT_NEAR(r.determinant(), 1.0f, 1e-5f);
+}
+
+TEST(DecomposeAffineTest, ReflectionCarriedByStretch) {
+    Mat4f matrix =
+        compose(Vec3f(1.0f, 1.0f, 1.0f), Quatf::fromAxisAngle(Vec3f::yAxis(), 0.4f), Vec3f(-1.0f, 2.0f, 1.0f));
+    AffineComponents affine = decomposeAffine(matrix);
+
+    EXPECT_NEAR(affine.rotation.toMatrix3().determinant(), 1.0f, 1e-5f);
+    EXPECT_LT(affine.stretch().determinant(), 0.0f);
+    EXPECT_TRUE(compose(affine).approxEquals(matrix, 1e-4f));
+}
+
+TEST(DecomposeAffineTest, SingularFallsBackToDecompose) {
+    Mat4f matrix = makeScale(Vec3f(0.0f, 2.0f, 3.0f));
+    AffineComponents affine = decomposeAffine(matrix);
+    TransformComponents trs = decompose(matrix);
+
+    EXPECT_TRUE(affine.scale.approxEquals(trs.scale));
+    EXPECT_TRUE(affine.rotation.approxEquals(trs.rotation));
+    EXPECT_TRUE(affine.shear.approxEquals(Vec3f::zero()));
+}
+
+TEST(DecomposeAffineTest, BatchMatchesScalar) {
+    std::vector<Mat4f> matrices;
+    for (int i = 0; i < 11; ++i) {
+        const float f = static_cast<float>(i);
+        matrices.push_back(makeSheared(Vec3f(f, -f, 2.0f * f),
+                                       Quatf::fromAxisAngle(Vec3f(1.0f, f, 0.5f).normalized(), 0.3f * f),
+                                       Vec3f(0.5f + 0.2f * f, 1.0f, 2.0f - 0.1f * f),
+                                       0.1f * f));
+    }
+    matrices[5] = makeScale(Vec3f(1.0f, 0.0f, 1.0f));
+
+    std::vector<AffineComponents> out(matrices.size());
+    decomposeAffine(matrices, out);
+
+    for (std::size_t i = 0; i < matrices.size(); ++i) {
+        const AffineComponents expected = decomposeAffine(matrices[i]);
+        EXPECT_TRUE(out[i].translation.approxEquals(expected.translation, 1e-5f)) << "index " << i;
+        EXPECT_TRUE(out[i].rotation.approxEquals(expected.rotation, 1e-5f)) << "index " << i;
+        EXPECT_TRUE(out[i].scale.approxEquals(expected.scale, 1e-5f)) << "index " << i;
+        EXPECT_TRUE(out[i].shear.approxEquals(expected.shear, 1e-5f)) << "index " << i;
+        if (i != 5) {
+            EXPECT_TRUE(compose(out[i]).approxEquals(matrices[i], 1e-4f)) << "index " << i;
+        }
+    }
+}